@@ -18,6 +18,7 @@
 #include "smtk/attribute/GroupItem.h"
 #include "smtk/attribute/IntItem.h"
 #include "smtk/attribute/Item.h"
+#include "smtk/attribute/ItemLookup.h"
 #include "smtk/attribute/ModelEntityItem.h"
 #include "smtk/attribute/ModelEntityItemDefinition.h"
 #include "smtk/attribute/Resource.h"
@@ -41,6 +42,7 @@ SMTK_THIRDPARTY_POST_INCLUDE
 #include <cassert>
 #include <functional>
 #include <iostream>
+#include <limits>
 
 using namespace smtk::attribute;
 using namespace smtk::common;
@@ -98,6 +100,7 @@ void Attribute::build()
   if (m_definition != nullptr)
   {
     m_definition->buildAttribute(this);
+    m_itemLookup = &m_definition->itemLookup();
   }
 }
 void Attribute::removeAllItems()
@@ -109,6 +112,7 @@ void Attribute::removeAllItems()
     m_items[i]->detachOwningAttribute();
   }
   m_items.clear();
+  m_itemLookup = nullptr;
 }
 
 const double* Attribute::color() const
@@ -191,6 +195,26 @@ unsigned int Attribute::advanceLevel(int mode) const
 smtk::attribute::ConstItemPtr
 Attribute::itemAtPath(const std::string& path, const std::string& seps, bool activeOnly) const
 {
+  if (path.empty())
+  {
+    return nullptr;
+  }
+
+  // Paths of items (without group indices) are precomputed by the definition.
+  if (m_itemLookup && seps == "/")
+  {
+    const auto* entry = m_itemLookup->findPath(path[0] == '/' ? path.substr(1) : path);
+    ItemPtr item;
+    if (
+      entry &&
+      ItemLookup::resolve(
+        *this, entry->path, std::numeric_limits<std::size_t>::max(), activeOnly, item) !=
+        ItemLookup::Resolution::Mismatch)
+    {
+      return item;
+    }
+  }
+
   std::vector<std::string> tree;
   std::vector<std::string>::iterator it;
   if (path[0] == '/')
@@ -295,6 +319,8 @@ bool Attribute::isValid(bool useActiveCategories) const
     auto aResource = this->attributeResource();
     if (aResource && aResource->activeCategoriesEnabled())
     {
+      CategoryIndex::Scope scope(
+        aResource->activeCategories(), aResource->activeCategoryMask());
       return this->isValid(aResource->activeCategories());
     }
   }
@@ -355,7 +381,7 @@ bool Attribute::isRelevant(
     auto aResource = this->attributeResource();
     if (aResource && aResource->activeCategoriesEnabled())
     {
-      if (!this->categories().passes(aResource->activeCategories()))
+      if (!this->categories().passes(aResource->activeCategoryMask()))
       {
         return false;
       }
@@ -908,6 +934,12 @@ std::string smtk::attribute::Attribute::itemPath(const ItemPtr& item, const std:
   */
 smtk::attribute::ItemPtr Attribute::find(const std::string& inName, SearchStyle style)
 {
+  ItemPtr result;
+  if (m_itemLookup && m_itemLookup->find(*this, inName, style, result))
+  {
+    return result;
+  }
+
   // Lets see if we can find it in the attribute's items
   for (auto& item : m_items)
   {
@@ -936,6 +968,12 @@ smtk::attribute::ItemPtr Attribute::find(const std::string& inName, SearchStyle
 
 smtk::attribute::ConstItemPtr Attribute::find(const std::string& inName, SearchStyle style) const
 {
+  ItemPtr result;
+  if (m_itemLookup && m_itemLookup->find(*this, inName, style, result))
+  {
+    return result;
+  }
+
   // Lets see if we can find it in the attribute's items
   for (const auto& item : m_items)
   {
@@ -35,6 +35,7 @@ namespace attribute
 {
 class Evaluator;
 class Item;
+class ItemLookup;
 class Resource;
 
 /**\brief Represent a (possibly composite) value according to a definition.
@@ -43,6 +44,7 @@ class Resource;
 class SMTKCORE_EXPORT Attribute : public resource::Component
 {
   friend class smtk::attribute::Definition;
+  friend class smtk::attribute::ItemLookup;
   friend class smtk::attribute::Resource;
 
 public:
@@ -428,6 +430,8 @@ protected:
 
   std::string m_name;
   std::vector<smtk::attribute::ItemPtr> m_items;
+  // The positions of m_items (and their children) when the attribute was built.
+  const ItemLookup* m_itemLookup = nullptr;
   ReferenceItemPtr m_associatedObjects;
   smtk::attribute::DefinitionPtr m_definition;
   bool m_appliesToBoundaryNodes;
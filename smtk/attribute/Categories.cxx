@@ -12,10 +12,94 @@
 
 #include <algorithm>
 #include <iostream>
+#include <memory>
 #include <sstream>
 
 using namespace smtk::attribute;
 
+namespace
+{
+// Evaluate a stack of (mode, set) pairs from its top (the end of the vector)
+// down, stopping as soon as the result can no longer change.
+template<typename SetType, typename Input>
+bool stackPasses(
+  const std::vector<std::pair<Categories::CombinationMode, SetType>>& stack,
+  const Input& cats)
+{
+  bool lastResult = false;
+  for (auto it = stack.crbegin(); it != stack.crend(); ++it)
+  {
+    lastResult = it->second.passes(cats);
+    if (lastResult)
+    {
+      if (
+        (it->first == Categories::CombinationMode::Or) ||
+        (it->first == Categories::CombinationMode::LocalOnly))
+      {
+        return true;
+      }
+    }
+    else if (
+      (it->first == Categories::CombinationMode::And) ||
+      (it->first == Categories::CombinationMode::LocalOnly))
+    {
+      return false;
+    }
+  }
+  return lastResult;
+}
+} // namespace
+
+/// The stacks of a Categories instance with each category name replaced by
+/// its ID in a CategoryIndex.
+struct Categories::Compiled
+{
+  struct Set
+  {
+    bool passes(const CategoryIndex::Mask& cats) const
+    {
+      if (m_combinationMode == CombinationMode::And)
+      {
+        return passesCheck(cats, m_included, m_includeMode) &&
+          !passesCheck(cats, m_excluded, m_excludeMode);
+      }
+      return passesCheck(cats, m_included, m_includeMode) ||
+        !passesCheck(cats, m_excluded, m_excludeMode);
+    }
+
+    static bool passesCheck(
+      const CategoryIndex::Mask& cats,
+      const CategoryIndex::Mask& testSet,
+      CombinationMode comboMode)
+    {
+      // Every name was assigned an ID, so an empty mask means an empty set of names.
+      if (testSet.empty())
+      {
+        return false;
+      }
+      return comboMode == CombinationMode::Or ? testSet.intersects(cats)
+                                              : testSet.isSubsetOf(cats);
+    }
+
+    CombinationMode m_includeMode;
+    CombinationMode m_excludeMode;
+    CombinationMode m_combinationMode;
+    CategoryIndex::Mask m_included;
+    CategoryIndex::Mask m_excluded;
+  };
+  using Stack = std::vector<std::pair<CombinationMode, Set>>;
+
+  bool passes(const CategoryIndex::Mask& cats) const
+  {
+    return std::any_of(m_stacks.begin(), m_stacks.end(), [&cats](const Stack& stack) {
+      return stackPasses(stack, cats);
+    });
+  }
+
+  std::uint64_t m_serial;
+  std::vector<Stack> m_stacks;
+};
+
 std::string Categories::Set::combinationModeAsString(const CombinationMode mode)
 {
   return Categories::combinationModeAsString(mode);
@@ -38,9 +122,13 @@ bool Categories::Set::setCombinationMode(const Set::CombinationMode& newMode)
 
 bool Categories::Set::passes(const std::string& category) const
 {
-  std::set<std::string> categories;
-  categories.insert(category);
-  return this->passes(categories);
+  if (m_combinationMode == CombinationMode::And)
+  {
+    return passesCheck(category, m_includedCategories, m_includeMode) &&
+      !passesCheck(category, m_excludedCategories, m_excludeMode);
+  }
+  return passesCheck(category, m_includedCategories, m_includeMode) ||
+    !passesCheck(category, m_excludedCategories, m_excludeMode);
 }
 
 bool Categories::Set::passes(const std::set<std::string>& categories) const
@@ -60,6 +148,24 @@ bool Categories::Set::passes(const std::set<std::string>& categories) const
   return result;
 }
 
+bool Categories::Set::passesCheck(
+  const std::string& category,
+  const std::set<std::string>& testSet,
+  Set::CombinationMode comboMode)
+{
+  if (testSet.empty())
+  {
+    return false;
+  }
+
+  if (comboMode == CombinationMode::Or)
+  {
+    return testSet.find(category) != testSet.end();
+  }
+  // Every name in the test set must be the given category.
+  return (testSet.size() == 1) && (*testSet.begin() == category);
+}
+
 bool Categories::Set::passesCheck(
   const std::set<std::string>& categories,
   const std::set<std::string>& testSet,
@@ -162,30 +268,12 @@ bool Categories::Stack::append(CombinationMode mode, const Set& categorySet)
 
 bool Categories::Stack::passes(const std::string& category) const
 {
-  std::set<std::string> categories;
-  categories.insert(category);
-  return this->passes(categories);
+  return stackPasses(m_stack, category);
 }
 
 bool Categories::Stack::passes(const std::set<std::string>& cats) const
 {
-  bool lastResult = false;
-  for (auto it = m_stack.crbegin(); it != m_stack.crend(); ++it)
-  {
-    lastResult = it->second.passes(cats);
-    if (lastResult)
-    {
-      if ((it->first == CombinationMode::Or) || (it->first == CombinationMode::LocalOnly))
-      {
-        return true;
-      }
-    }
-    else if ((it->first == CombinationMode::And) || (it->first == CombinationMode::LocalOnly))
-    {
-      return false;
-    }
-  }
-  return lastResult;
+  return stackPasses(m_stack, cats);
 }
 
 std::string Categories::Stack::convertToString(const std::string& prefix) const
@@ -267,6 +355,48 @@ bool Categories::combinationModeFromString(const std::string& val, CombinationMo
   return false;
 }
 
+Categories::Categories(const Categories& other)
+  : m_stacks(other.m_stacks)
+{
+}
+
+Categories::Categories(Categories&& other) noexcept
+  : m_stacks(std::move(other.m_stacks))
+  , m_compiled(other.m_compiled.exchange(nullptr))
+{
+}
+
+Categories& Categories::operator=(const Categories& other)
+{
+  if (this != &other)
+  {
+    m_stacks = other.m_stacks;
+    this->clearCompiled();
+  }
+  return *this;
+}
+
+Categories& Categories::operator=(Categories&& other) noexcept
+{
+  if (this != &other)
+  {
+    m_stacks = std::move(other.m_stacks);
+    this->clearCompiled();
+    m_compiled.store(other.m_compiled.exchange(nullptr));
+  }
+  return *this;
+}
+
+Categories::~Categories()
+{
+  this->clearCompiled();
+}
+
+void Categories::clearCompiled()
+{
+  delete m_compiled.exchange(nullptr);
+}
+
 bool Categories::insert(const Set& set)
 {
   // if the set is not empty, add it
@@ -275,6 +405,7 @@ bool Categories::insert(const Set& set)
     Stack newStack;
     newStack.append(CombinationMode::LocalOnly, set);
     m_stacks.insert(newStack);
+    this->clearCompiled();
     return true;
   }
   return false;
@@ -286,6 +417,7 @@ bool Categories::insert(const Stack& stack)
   if (!stack.empty())
   {
     m_stacks.insert(stack);
+    this->clearCompiled();
     return true;
   }
   return false;
@@ -313,6 +445,12 @@ bool Categories::passes(const std::string& category) const
   });
 }
 
+void Categories::reset()
+{
+  m_stacks.clear();
+  this->clearCompiled();
+}
+
 bool Categories::passes(const std::set<std::string>& categories) const
 {
   // If there are no stacks which means there are no categories
@@ -322,11 +460,77 @@ bool Categories::passes(const std::set<std::string>& categories) const
     return false;
   }
 
+  if (const CategoryIndex::Mask* mask = CategoryIndex::Scope::find(categories))
+  {
+    return this->passes(*mask);
+  }
+
   return std::any_of(m_stacks.begin(), m_stacks.end(), [&categories](const Stack& stack) {
     return stack.passes(categories);
   });
 }
 
+bool Categories::passes(const CategoryIndex::Mask& categories) const
+{
+  // If there are no stacks which means there are no categories
+  // associated then fail
+  if (m_stacks.empty())
+  {
+    return false;
+  }
+
+  // A default-constructed mask holds no categories.
+  if (!categories.index())
+  {
+    return this->passes(std::set<std::string>());
+  }
+
+  const Compiled* compiled = this->compiled(categories);
+  if (compiled)
+  {
+    return compiled->passes(categories);
+  }
+
+  // The stacks have not been compiled yet or were compiled against
+  // another index; compile them against the mask's index.
+  std::unique_ptr<Compiled> fresh(new Compiled);
+  fresh->m_serial = categories.serial();
+  CategoryIndex& index = *categories.index();
+  for (const auto& stack : m_stacks)
+  {
+    Compiled::Stack entry;
+    entry.reserve(stack.m_stack.size());
+    for (const auto& modeAndSet : stack.m_stack)
+    {
+      const Set& set = modeAndSet.second;
+      Compiled::Set compiledSet;
+      compiledSet.m_includeMode = set.inclusionMode();
+      compiledSet.m_excludeMode = set.exclusionMode();
+      compiledSet.m_combinationMode = set.combinationMode();
+      compiledSet.m_included = index.mask(set.includedCategoryNames());
+      compiledSet.m_excluded = index.mask(set.excludedCategoryNames());
+      entry.emplace_back(modeAndSet.first, std::move(compiledSet));
+    }
+    fresh->m_stacks.push_back(std::move(entry));
+  }
+  bool result = fresh->passes(categories);
+
+  // Only cache the result when nothing is cached. A cached form for another
+  // index may be in use by other threads, so it cannot be replaced here.
+  const Compiled* expected = nullptr;
+  if (m_compiled.compare_exchange_strong(expected, fresh.get()))
+  {
+    fresh.release();
+  }
+  return result;
+}
+
+const Categories::Compiled* Categories::compiled(const CategoryIndex::Mask& cats) const
+{
+  const Compiled* result = m_compiled.load();
+  return (result && result->m_serial == cats.serial()) ? result : nullptr;
+}
+
 std::set<std::string> Categories::categoryNames() const
 {
   std::set<std::string> result;
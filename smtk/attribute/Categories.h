@@ -14,8 +14,10 @@
 #include "smtk/CoreExports.h"
 #include "smtk/SystemConfig.h" // quiet dll-interface warnings on windows
 
+#include "smtk/attribute/CategoryIndex.h"
 #include "smtk/common/Deprecation.h"
 
+#include <atomic>
 #include <set>
 #include <string>
 #include <utility>
@@ -143,6 +145,10 @@ public:
     bool passes(const std::set<std::string>& cats) const;
     bool passes(const std::string& cat) const;
     ///@}
+    static bool passesCheck(
+      const std::string& cat,
+      const std::set<std::string>& testSet,
+      Set::CombinationMode comboMode);
     static bool passesCheck(
       const std::set<std::string>& cats,
       const std::set<std::string>& testSet,
@@ -178,15 +184,33 @@ public:
     bool operator<(const Stack& rhs) const;
 
   protected:
+    friend class Categories;
+
     std::vector<std::pair<CombinationMode, Set>> m_stack;
   };
 
   Categories() = default;
+  Categories(const Categories& other);
+  Categories(Categories&& other) noexcept;
+  Categories& operator=(const Categories& other);
+  Categories& operator=(Categories&& other) noexcept;
+  ~Categories();
+
   ///@{
   /// \brief Returns true if atleast one of its sets passes its check
+  ///
+  /// When \a cats has been associated with a mask by a CategoryIndex::Scope
+  /// on the calling thread, the mask is used to evaluate the check.
   bool passes(const std::set<std::string>& cats) const;
   bool passes(const std::string& cat) const;
   ///@}
+  ///\brief Returns true if atleast one of its sets passes its check given the
+  /// categories held in \a cats.
+  ///
+  /// The first call compiles every stack into masks over the index that produced
+  /// \a cats (assigning IDs to category names it has not seen); the compiled form
+  /// is cached so later calls only perform word-wide bit operations.
+  bool passes(const CategoryIndex::Mask& cats) const;
   ///@{
   ///\brief Insert either a Categories::Set or the sets of another Categories instance into
   /// this instance.
@@ -196,7 +220,7 @@ public:
   void insert(const Categories& cats);
   ///@}
   ///\brief Remove all stacks from this instance.
-  void reset() { m_stacks.clear(); }
+  void reset();
   ///\brief Return the number of stacks in this instance.
   std::size_t size() const { return m_stacks.size(); }
   ///\brief Return the sets contained in this instance.
@@ -214,7 +238,14 @@ public:
   static bool combinationModeFromString(const std::string& val, Set::CombinationMode& mode);
 
 private:
+  struct Compiled;
+
+  const Compiled* compiled(const CategoryIndex::Mask& cats) const;
+  void clearCompiled();
+
   std::set<Stack> m_stacks;
+  // The stacks compiled into masks; built on first use and owned by this instance.
+  mutable std::atomic<const Compiled*> m_compiled{ nullptr };
 };
 } // namespace attribute
 } // namespace smtk
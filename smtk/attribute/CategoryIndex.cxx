@@ -0,0 +1,134 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/attribute/CategoryIndex.h"
+
+#include <algorithm>
+#include <atomic>
+
+using namespace smtk::attribute;
+
+namespace
+{
+std::atomic<std::uint64_t> g_nextSerial{ 1 };
+
+// The innermost scope on this thread.
+thread_local const CategoryIndex::Scope* g_currentScope = nullptr;
+} // namespace
+
+void CategoryIndex::Mask::insert(std::size_t id)
+{
+  std::size_t word = id / 64;
+  if (word >= m_words.size())
+  {
+    m_words.resize(word + 1, 0);
+  }
+  m_words[word] |= std::uint64_t(1) << (id % 64);
+}
+
+bool CategoryIndex::Mask::empty() const
+{
+  return std::all_of(
+    m_words.begin(), m_words.end(), [](std::uint64_t word) { return word == 0; });
+}
+
+bool CategoryIndex::Mask::intersects(const Mask& other) const
+{
+  std::size_t count = std::min(m_words.size(), other.m_words.size());
+  for (std::size_t ii = 0; ii < count; ++ii)
+  {
+    if (m_words[ii] & other.m_words[ii])
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool CategoryIndex::Mask::isSubsetOf(const Mask& other) const
+{
+  std::size_t count = std::min(m_words.size(), other.m_words.size());
+  for (std::size_t ii = 0; ii < count; ++ii)
+  {
+    if (m_words[ii] & ~other.m_words[ii])
+    {
+      return false;
+    }
+  }
+  // Any words beyond the end of other must be empty.
+  for (std::size_t ii = count; ii < m_words.size(); ++ii)
+  {
+    if (m_words[ii])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool CategoryIndex::Mask::operator==(const Mask& other) const
+{
+  return m_serial == other.m_serial && this->isSubsetOf(other) && other.isSubsetOf(*this);
+}
+
+CategoryIndex::Scope::Scope(const std::set<std::string>& names, const Mask& mask)
+  : m_names(&names)
+  , m_mask(&mask)
+  , m_previous(g_currentScope)
+{
+  g_currentScope = this;
+}
+
+CategoryIndex::Scope::~Scope()
+{
+  g_currentScope = m_previous;
+}
+
+const CategoryIndex::Mask* CategoryIndex::Scope::find(const std::set<std::string>& names)
+{
+  for (const Scope* scope = g_currentScope; scope; scope = scope->m_previous)
+  {
+    if (scope->m_names == &names)
+    {
+      return scope->m_mask;
+    }
+  }
+  return nullptr;
+}
+
+CategoryIndex::CategoryIndex()
+  : m_serial(g_nextSerial++)
+{
+}
+
+std::size_t CategoryIndex::size() const
+{
+  std::lock_guard<std::mutex> guard(m_mutex);
+  return m_ids.size();
+}
+
+std::size_t CategoryIndex::insert(const std::string& name)
+{
+  std::lock_guard<std::mutex> guard(m_mutex);
+  return m_ids.emplace(name, m_ids.size()).first->second;
+}
+
+CategoryIndex::Mask CategoryIndex::mask(const std::set<std::string>& names)
+{
+  Mask result;
+  result.m_index = this;
+  result.m_serial = m_serial;
+  std::lock_guard<std::mutex> guard(m_mutex);
+  for (const auto& name : names)
+  {
+    result.insert(m_ids.emplace(name, m_ids.size()).first->second);
+  }
+  return result;
+}
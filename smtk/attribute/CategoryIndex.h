@@ -0,0 +1,125 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_attribute_CategoryIndex_h
+#define smtk_attribute_CategoryIndex_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/SystemConfig.h" // quiet dll-interface warnings on windows
+
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace smtk
+{
+namespace attribute
+{
+///\brief Assigns small integer IDs to category names so that sets of
+/// categories can be represented and compared as bitmasks.
+///
+/// Each attribute::Resource owns an index. IDs are assigned in the order
+/// names are first seen and are never reused, so a mask computed earlier
+/// stays valid as more names are added. The index may be used from
+/// several threads at once.
+class SMTKCORE_EXPORT CategoryIndex
+{
+public:
+  ///\brief A set of categories held as one bit per ID of a CategoryIndex.
+  ///
+  /// A mask refers to the index that produced it and is only meaningful
+  /// while that index exists.
+  class SMTKCORE_EXPORT Mask
+  {
+  public:
+    Mask() = default;
+
+    ///\brief Return the index whose IDs this mask uses (null if default-constructed).
+    CategoryIndex* index() const { return m_index; }
+    ///\brief Return the serial number of the index whose IDs this mask uses.
+    std::uint64_t serial() const { return m_serial; }
+
+    ///\brief Add the category with the given \a id to the mask.
+    void insert(std::size_t id);
+    ///\brief Return true if the category with the given \a id is in the mask.
+    bool contains(std::size_t id) const
+    {
+      std::size_t word = id / 64;
+      return word < m_words.size() && (m_words[word] >> (id % 64)) & 1;
+    }
+    ///\brief Return true if no categories are in the mask.
+    bool empty() const;
+    ///\brief Return true if this mask and \a other share at least one category.
+    bool intersects(const Mask& other) const;
+    ///\brief Return true if every category in this mask is also in \a other.
+    bool isSubsetOf(const Mask& other) const;
+
+    bool operator==(const Mask& other) const;
+    bool operator!=(const Mask& other) const { return !(*this == other); }
+
+  private:
+    friend class CategoryIndex;
+
+    CategoryIndex* m_index{ nullptr };
+    std::uint64_t m_serial{ 0 };
+    std::vector<std::uint64_t> m_words;
+  };
+
+  ///\brief Associate a mask with a set of category names for the current thread.
+  ///
+  /// While a Scope is alive, Categories::passes(const std::set<std::string>&)
+  /// calls made on the same thread with \a names (the very same object, not
+  /// an equal copy) are evaluated with \a mask instead of by comparing names.
+  /// This lets the virtual Item::isValidInternal() chain, which passes the
+  /// set of names down by reference, benefit from the bitmask evaluation.
+  /// Scopes may be nested.
+  class SMTKCORE_EXPORT Scope
+  {
+  public:
+    Scope(const std::set<std::string>& names, const Mask& mask);
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    ///\brief Return the mask in effect for \a names on this thread or null if there is none.
+    static const Mask* find(const std::set<std::string>& names);
+
+  private:
+    const std::set<std::string>* m_names;
+    const Mask* m_mask;
+    const Scope* m_previous;
+  };
+
+  CategoryIndex();
+  CategoryIndex(const CategoryIndex&) = delete;
+  CategoryIndex& operator=(const CategoryIndex&) = delete;
+
+  ///\brief Return a number that uniquely identifies this index for the life of the process.
+  std::uint64_t serial() const { return m_serial; }
+  ///\brief Return the number of category names that have been assigned IDs.
+  std::size_t size() const;
+
+  ///\brief Return the ID of \a name, assigning the next free ID if it has none.
+  std::size_t insert(const std::string& name);
+  ///\brief Return a mask holding \a names, assigning IDs to any names that have none.
+  Mask mask(const std::set<std::string>& names);
+
+private:
+  const std::uint64_t m_serial;
+  mutable std::mutex m_mutex;
+  std::unordered_map<std::string, std::size_t> m_ids;
+};
+} // namespace attribute
+} // namespace smtk
+#endif
@@ -189,7 +189,7 @@ bool Definition::isRelevant(
     auto aResource = this->resource();
     if (aResource && aResource->activeCategoriesEnabled())
     {
-      if (!this->categories().passes(aResource->activeCategories()))
+      if (!this->categories().passes(aResource->activeCategoryMask()))
       {
         return false;
       }
@@ -657,6 +657,7 @@ bool Definition::addItemDefinition(smtk::attribute::ItemDefinitionPtr cdef)
   std::size_t n = m_itemDefs.size();
   m_itemDefs.push_back(cdef);
   m_itemDefPositions[cdef->name()] = static_cast<int>(n);
+  ItemDefinition::structureModified();
   this->updateDerivedDefinitions();
   return true;
 }
@@ -689,6 +690,35 @@ smtk::attribute::ItemDefinitionPtr Definition::itemDefinition(int ith) const
   return smtk::attribute::ItemDefinitionPtr();
 }
 
+const ItemLookup& Definition::itemLookup() const
+{
+  std::size_t generation = ItemDefinition::structureGeneration();
+  const ItemLookup* current = m_itemLookup.load(std::memory_order_acquire);
+  if (current && current->generation() == generation)
+  {
+    return *current;
+  }
+
+  std::lock_guard<std::mutex> guard(m_itemLookupMutex);
+  current = m_itemLookup.load(std::memory_order_acquire);
+  if (current && current->generation() == generation)
+  {
+    return *current;
+  }
+  std::unique_ptr<const ItemLookup> lookup(new ItemLookup(*this, generation));
+  if (current && *current == *lookup)
+  {
+    // Some other definition changed; attributes built with the current
+    // lookup still match this definition.
+    current->revalidate(generation);
+    return *current;
+  }
+  m_itemLookups.push_back(std::move(lookup));
+  current = m_itemLookups.back().get();
+  m_itemLookup.store(current, std::memory_order_release);
+  return *current;
+}
+
 int Definition::findItemPosition(const std::string& name) const
 {
   std::map<std::string, int>::const_iterator it;
@@ -722,6 +752,7 @@ bool Definition::removeItemDefinition(ItemDefinitionPtr itemDef)
     m_itemDefs.erase(itItemDef);
   }
   m_itemDefPositions.erase(itemDef->name());
+  ItemDefinition::structureModified();
   this->updateDerivedDefinitions();
   return true;
 }
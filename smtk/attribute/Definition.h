@@ -22,6 +22,7 @@
 #include "smtk/SharedFromThis.h" // For smtkTypeMacroBase.
 
 #include "smtk/attribute/Categories.h"
+#include "smtk/attribute/ItemLookup.h"
 #include "smtk/attribute/ReferenceItemDefinition.h"
 #include "smtk/attribute/Tag.h"
 
@@ -29,7 +30,10 @@
 #include "smtk/model/EntityTypeBits.h" // for BitFlags type
 
 #include <algorithm>
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -339,6 +343,7 @@ public:
       item = SharedTypes::RawPointerType::New(name);
       m_itemDefs.push_back(item);
       m_itemDefPositions[name] = static_cast<int>(n);
+      ItemDefinition::structureModified();
       this->updateDerivedDefinitions();
     }
     return item;
@@ -358,6 +363,15 @@ public:
 
   int findItemPosition(const std::string& name) const;
 
+  ///\brief Return the positions of the items held by attributes of this definition.
+  ///
+  /// The lookup is built on first use and rebuilt when item definitions are
+  /// added to or removed from this definition (or any other; see
+  /// ItemDefinition::structureGeneration()) and its structure has changed as a
+  /// result. Lookups are never destroyed before the definition, so attributes
+  /// may keep the lookup that describes how they were built.
+  const ItemLookup& itemLookup() const;
+
   const std::string& detailedDescription() const { return m_detailedDescription; }
   void setDetailedDescription(const std::string& text) { m_detailedDescription = text; }
 
@@ -479,6 +493,10 @@ protected:
   std::string m_briefDescription;
   // Used by the find method to calculate an item's position
   std::size_t m_baseItemOffset;
+  // The current item lookup and all those built before it.
+  mutable std::atomic<const ItemLookup*> m_itemLookup{ nullptr };
+  mutable std::vector<std::unique_ptr<const ItemLookup>> m_itemLookups;
+  mutable std::mutex m_itemLookupMutex;
   std::string m_rootName;
   Tags m_tags;
   std::size_t m_includeIndex;
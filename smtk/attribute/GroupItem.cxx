@@ -9,11 +9,118 @@
 //=========================================================================
 
 #include "smtk/attribute/GroupItem.h"
+#include "smtk/attribute/Attribute.h"
 #include "smtk/attribute/GroupItemDefinition.h"
+#include "smtk/attribute/Resource.h"
+#include "smtk/attribute/ValueItemDefinitionTemplate.h"
+#include "smtk/attribute/ValueItemTemplate.h"
+
+#include <algorithm>
 #include <iostream>
 
 using namespace smtk::attribute;
 
+namespace
+{
+template<typename T>
+struct ColumnType;
+
+template<>
+struct ColumnType<int>
+{
+  static Item::Type value() { return Item::IntType; }
+};
+
+template<>
+struct ColumnType<double>
+{
+  static Item::Type value() { return Item::DoubleType; }
+};
+
+template<>
+struct ColumnType<std::string>
+{
+  static Item::Type value() { return Item::StringType; }
+};
+
+template<typename T>
+void insertDefaults(
+  std::vector<T>& data,
+  std::vector<bool>& isSet,
+  const ItemDefinition* itemDef,
+  std::size_t pos,
+  std::size_t num)
+{
+  const auto* def = dynamic_cast<const ValueItemDefinitionTemplate<T>*>(itemDef);
+  bool hasDefault = def && def->hasDefault();
+  data.insert(data.begin() + pos, num, hasDefault ? def->defaultValue() : T());
+  isSet.insert(isSet.begin() + pos, num, hasDefault);
+}
+
+template<typename T>
+void eraseEntries(std::vector<T>& data, std::size_t pos, std::size_t num)
+{
+  if (pos < data.size())
+  {
+    data.erase(data.begin() + pos, data.begin() + std::min(pos + num, data.size()));
+  }
+}
+
+// Copy the value of a single-valued item; returns false if it is not of type T.
+template<typename T>
+bool loadValue(const ItemPtr& item, T& value, bool& isSet)
+{
+  const auto* valueItem = dynamic_cast<const ValueItemTemplate<T>*>(item.get());
+  if (!valueItem || (valueItem->numberOfValues() != 1))
+  {
+    return false;
+  }
+  isSet = valueItem->isSet();
+  value = isSet ? valueItem->value() : T();
+  return true;
+}
+
+template<typename T>
+bool storeValue(const ItemPtr& item, const T& value, bool isSet)
+{
+  auto* valueItem = dynamic_cast<ValueItemTemplate<T>*>(item.get());
+  if (!valueItem || (valueItem->numberOfValues() != 1))
+  {
+    return false;
+  }
+  if (!isSet)
+  {
+    valueItem->unset();
+    return true;
+  }
+  return valueItem->setValue(value);
+}
+} // namespace
+
+namespace smtk
+{
+namespace attribute
+{
+template<>
+std::vector<int>& GroupItem::Column::data<int>()
+{
+  return ints;
+}
+
+template<>
+std::vector<double>& GroupItem::Column::data<double>()
+{
+  return doubles;
+}
+
+template<>
+std::vector<std::string>& GroupItem::Column::data<std::string>()
+{
+  return strings;
+}
+} // namespace attribute
+} // namespace smtk
+
 GroupItem::GroupItem(Attribute* owningAttribute, int itemPosition)
   : Item(owningAttribute, itemPosition)
   , m_maxNumberOfChoices(0)
@@ -97,6 +204,11 @@ bool GroupItem::isValidInternal(bool useCategories, const std::set<std::string>&
     return true;
   }
 
+  if (m_isColumnar)
+  {
+    return this->isColumnarValid(useCategories, categories);
+  }
+
   // Finally, if all of its values are set then it is valid
   // else it is invalid
   unsigned int numChoices = 0;
@@ -143,6 +255,49 @@ bool GroupItem::isValidInternal(bool useCategories, const std::set<std::string>&
   return true;
 }
 
+bool GroupItem::isColumnarValid(bool useCategories, const std::set<std::string>& categories) const
+{
+  const GroupItemDefinition* def = static_cast<const GroupItemDefinition*>(m_definition.get());
+  // Item::isValid() (used below when categories are not given) consults the
+  // resource's active categories.
+  smtk::attribute::ResourcePtr resource;
+  if (!useCategories && this->attribute())
+  {
+    resource = this->attribute()->attributeResource();
+    if (resource && !resource->activeCategoriesEnabled())
+    {
+      resource = nullptr;
+    }
+  }
+
+  std::lock_guard<std::mutex> guard(m_columnarMutex);
+  for (std::size_t j = 0; j < m_columns.size(); ++j)
+  {
+    // Unset values of children that are filtered out by category do not matter.
+    auto itemDef = def->itemDefinition(static_cast<int>(j));
+    bool checkValues = !itemDef ||
+      (useCategories ? itemDef->categories().passes(categories)
+                     : (!resource || itemDef->categories().passes(resource->activeCategoryMask())));
+    const Column& column = m_columns[j];
+    for (std::size_t i = 0; i < m_items.size(); ++i)
+    {
+      if (!m_items[i].empty())
+      {
+        const auto& item = m_items[i][j];
+        if (!item || !(useCategories ? item->isValid(categories) : item->isValid()))
+        {
+          return false;
+        }
+      }
+      else if (checkValues && !column.isSet[i])
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 bool GroupItem::setDefinition(smtk::attribute::ConstItemDefinitionPtr gdef)
 {
   // Note that we do a dynamic cast here since we don't
@@ -162,6 +317,19 @@ bool GroupItem::setDefinition(smtk::attribute::ConstItemDefinitionPtr gdef)
   }
 
   std::size_t i, n = def->numberOfRequiredGroups();
+  m_isColumnar = def->isColumnar();
+  if (m_isColumnar)
+  {
+    // Items are built when a sub-group is accessed.
+    m_columns.resize(def->numberOfItemDefinitions());
+    for (i = 0; i < m_columns.size(); i++)
+    {
+      m_columns[i].type = def->itemDefinition(static_cast<int>(i))->type();
+    }
+    m_items.resize(n);
+    this->insertColumnEntries(0, n);
+    return true;
+  }
   if (n)
   {
     m_items.resize(n);
@@ -211,12 +379,38 @@ void GroupItem::reset()
       }
     }
   }
+  if (m_isColumnar)
+  {
+    this->resetColumns();
+  }
   Item::reset();
 }
 
 bool GroupItem::rotate(std::size_t fromPosition, std::size_t toPosition)
 {
-  return this->rotateVector(m_items, fromPosition, toPosition);
+  if (!this->rotateVector(m_items, fromPosition, toPosition))
+  {
+    return false;
+  }
+  for (auto& column : m_columns)
+  {
+    this->rotateVector(column.isSet, fromPosition, toPosition);
+    switch (column.type)
+    {
+      case Item::IntType:
+        this->rotateVector(column.ints, fromPosition, toPosition);
+        break;
+      case Item::DoubleType:
+        this->rotateVector(column.doubles, fromPosition, toPosition);
+        break;
+      case Item::StringType:
+        this->rotateVector(column.strings, fromPosition, toPosition);
+        break;
+      default:
+        break;
+    }
+  }
+  return true;
 }
 
 /**\brief Return an iterator to the first group in this item.
@@ -224,6 +418,15 @@ bool GroupItem::rotate(std::size_t fromPosition, std::size_t toPosition)
   */
 GroupItem::const_iterator GroupItem::begin() const
 {
+  if (m_isColumnar)
+  {
+    // Callers may visit any sub-group so they all need items.
+    std::lock_guard<std::mutex> guard(m_columnarMutex);
+    for (std::size_t i = 0; i < m_items.size(); ++i)
+    {
+      this->buildColumnarGroup(i);
+    }
+  }
   return m_items.begin();
 }
 
@@ -301,6 +504,11 @@ bool GroupItem::insertGroups(std::size_t pos, std::size_t num)
   std::vector<smtk::attribute::ItemPtr> placeHolder;
 
   m_items.insert(m_items.begin() + pos, num, placeHolder);
+  if (m_isColumnar)
+  {
+    this->insertColumnEntries(pos, num);
+    return true;
+  }
 
   for (std::size_t i = pos; i < pos + num; i++)
   {
@@ -339,6 +547,7 @@ bool GroupItem::removeGroup(std::size_t element)
     items[j]->detachOwningItem();
   }
   m_items.erase(m_items.begin() + element);
+  this->eraseColumnEntries(element, 1);
   return true;
 }
 
@@ -385,6 +594,12 @@ bool GroupItem::setNumberOfGroups(std::size_t newSize)
       }
     }
     m_items.resize(newSize);
+    this->eraseColumnEntries(newSize, n - newSize);
+  }
+  else if (m_isColumnar)
+  {
+    m_items.resize(newSize);
+    this->insertColumnEntries(n, newSize - n);
   }
   else
   {
@@ -417,6 +632,11 @@ GroupItem::find(std::size_t element, const std::string& inName, SearchStyle styl
   {
     return nullptr;
   }
+  if (m_isColumnar)
+  {
+    std::lock_guard<std::mutex> guard(m_columnarMutex);
+    this->buildColumnarGroup(element);
+  }
 
   // Lets see if we can find it in the group's items
   for (auto& item : m_items[element])
@@ -452,6 +672,11 @@ GroupItem::find(std::size_t element, const std::string& inName, SearchStyle styl
   {
     return nullptr;
   }
+  if (m_isColumnar)
+  {
+    std::lock_guard<std::mutex> guard(m_columnarMutex);
+    this->buildColumnarGroup(element);
+  }
 
   // Lets see if we can find it in the group's items
   for (const auto& item : m_items[element])
@@ -493,8 +718,19 @@ bool GroupItem::assign(ConstItemPtr& sourceItem, unsigned int options)
 
   // Update children (items)
   this->setNumberOfGroups(sourceGroupItem->numberOfGroups());
+  // Values of columnar sub-groups without items can be copied directly.
+  bool copyColumns = m_isColumnar && sourceGroupItem->isColumnar() &&
+    (m_columns.size() == sourceGroupItem->m_columns.size());
+  for (std::size_t j = 0; copyColumns && (j < m_columns.size()); ++j)
+  {
+    copyColumns = (m_columns[j].type == sourceGroupItem->m_columns[j].type);
+  }
   for (std::size_t i = 0; i < sourceGroupItem->numberOfGroups(); ++i)
   {
+    if (copyColumns && this->copyColumnarGroup(*sourceGroupItem, i))
+    {
+      continue;
+    }
     for (std::size_t j = 0; j < sourceGroupItem->numberOfItemsPerGroup(); ++j)
     {
       ConstItemPtr sourceChildItem =
@@ -515,8 +751,23 @@ bool GroupItem::hasRelevantChildren(
   bool includeReadAccess,
   int readAccessLevel) const
 {
+  // The items of columnar sub-groups that have not been accessed would all
+  // be identical, so only the first of them needs to be built.
+  bool checkedUnbuilt = false;
   for (size_t elementIndex = 0; elementIndex < this->numberOfGroups(); elementIndex++)
   {
+    if (m_isColumnar)
+    {
+      std::lock_guard<std::mutex> guard(m_columnarMutex);
+      if (m_items[elementIndex].empty())
+      {
+        if (checkedUnbuilt)
+        {
+          continue;
+        }
+        checkedUnbuilt = true;
+      }
+    }
     for (size_t valueIndex = 0; valueIndex < this->numberOfItemsPerGroup(); valueIndex++)
     {
       if (this->item(elementIndex, valueIndex)
@@ -528,3 +779,320 @@ bool GroupItem::hasRelevantChildren(
   }
   return false;
 }
+
+ItemPtr GroupItem::columnarItem(std::size_t element, std::size_t ith) const
+{
+  std::lock_guard<std::mutex> guard(m_columnarMutex);
+  this->buildColumnarGroup(element);
+  assert(m_items[element].size() > ith);
+  return m_items[element][ith];
+}
+
+void GroupItem::buildColumnarGroup(std::size_t element) const
+{
+  if (!m_items[element].empty())
+  {
+    return;
+  }
+  const GroupItemDefinition* def = static_cast<const GroupItemDefinition*>(m_definition.get());
+  // Only m_items (which holds a cache of the columns) is modified.
+  def->buildGroup(const_cast<GroupItem*>(this), static_cast<int>(element));
+  const auto& items = m_items[element];
+  for (std::size_t j = 0; (j < m_columns.size()) && (j < items.size()); ++j)
+  {
+    const Column& column = m_columns[j];
+    bool isSet = column.isSet[element];
+    switch (column.type)
+    {
+      case Item::IntType:
+        storeValue(items[j], column.ints[element], isSet);
+        break;
+      case Item::DoubleType:
+        storeValue(items[j], column.doubles[element], isSet);
+        break;
+      case Item::StringType:
+        storeValue(items[j], column.strings[element], isSet);
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+bool GroupItem::copyColumnarGroup(const GroupItem& source, std::size_t element)
+{
+  std::lock_guard<std::mutex> guard(source.m_columnarMutex);
+  if (!(source.m_items[element].empty() && m_items[element].empty()))
+  {
+    return false;
+  }
+  for (std::size_t j = 0; j < m_columns.size(); ++j)
+  {
+    Column& column = m_columns[j];
+    const Column& sourceColumn = source.m_columns[j];
+    column.isSet[element] = sourceColumn.isSet[element];
+    switch (column.type)
+    {
+      case Item::IntType:
+        column.ints[element] = sourceColumn.ints[element];
+        break;
+      case Item::DoubleType:
+        column.doubles[element] = sourceColumn.doubles[element];
+        break;
+      case Item::StringType:
+        column.strings[element] = sourceColumn.strings[element];
+        break;
+      default:
+        break;
+    }
+  }
+  return true;
+}
+
+void GroupItem::insertColumnEntries(std::size_t pos, std::size_t num)
+{
+  const GroupItemDefinition* def = static_cast<const GroupItemDefinition*>(m_definition.get());
+  for (std::size_t j = 0; j < m_columns.size(); ++j)
+  {
+    Column& column = m_columns[j];
+    const ItemDefinition* itemDef = def->itemDefinition(static_cast<int>(j)).get();
+    switch (column.type)
+    {
+      case Item::IntType:
+        insertDefaults(column.ints, column.isSet, itemDef, pos, num);
+        break;
+      case Item::DoubleType:
+        insertDefaults(column.doubles, column.isSet, itemDef, pos, num);
+        break;
+      case Item::StringType:
+        insertDefaults(column.strings, column.isSet, itemDef, pos, num);
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+void GroupItem::eraseColumnEntries(std::size_t pos, std::size_t num)
+{
+  for (auto& column : m_columns)
+  {
+    eraseEntries(column.ints, pos, num);
+    eraseEntries(column.doubles, pos, num);
+    eraseEntries(column.strings, pos, num);
+    eraseEntries(column.isSet, pos, num);
+  }
+}
+
+void GroupItem::resetColumns()
+{
+  for (auto& column : m_columns)
+  {
+    column.ints.clear();
+    column.doubles.clear();
+    column.strings.clear();
+    column.isSet.clear();
+  }
+  this->insertColumnEntries(0, m_items.size());
+}
+
+template<typename T>
+bool GroupItem::columnValuesInternal(
+  std::size_t ith,
+  std::vector<T>& values,
+  std::vector<bool>* isSet) const
+{
+  std::size_t i, n = m_items.size();
+  if (m_isColumnar)
+  {
+    if ((ith >= m_columns.size()) || (m_columns[ith].type != ColumnType<T>::value()))
+    {
+      return false;
+    }
+    const Column& column = m_columns[ith];
+    std::lock_guard<std::mutex> guard(m_columnarMutex);
+    values = const_cast<Column&>(column).data<T>();
+    if (isSet)
+    {
+      *isSet = column.isSet;
+    }
+    // Items built for individual sub-groups hold the current values.
+    for (i = 0; i < n; i++)
+    {
+      if (!m_items[i].empty())
+      {
+        bool set;
+        loadValue(m_items[i][ith], values[i], set);
+        if (isSet)
+        {
+          (*isSet)[i] = set;
+        }
+      }
+    }
+    return true;
+  }
+
+  values.resize(n);
+  if (isSet)
+  {
+    isSet->resize(n);
+  }
+  for (i = 0; i < n; i++)
+  {
+    bool set;
+    if ((ith >= m_items[i].size()) || !loadValue(m_items[i][ith], values[i], set))
+    {
+      return false;
+    }
+    if (isSet)
+    {
+      (*isSet)[i] = set;
+    }
+  }
+  return true;
+}
+
+template<typename T>
+bool GroupItem::setColumnValuesInternal(
+  std::size_t ith,
+  const std::vector<T>& values,
+  const std::vector<bool>* isSet)
+{
+  std::size_t i, n = m_items.size();
+  if ((values.size() != n) || (isSet && (isSet->size() != n)))
+  {
+    return false;
+  }
+
+  bool ok = true;
+  if (m_isColumnar)
+  {
+    const GroupItemDefinition* def = static_cast<const GroupItemDefinition*>(m_definition.get());
+    const auto* valueDef = dynamic_cast<const ValueItemDefinitionTemplate<T>*>(
+      def->itemDefinition(static_cast<int>(ith)).get());
+    if (
+      !valueDef || (ith >= m_columns.size()) || (m_columns[ith].type != ColumnType<T>::value()))
+    {
+      return false;
+    }
+    Column& column = m_columns[ith];
+    std::vector<T>& data = column.data<T>();
+    for (i = 0; i < n; i++)
+    {
+      bool set = !isSet || (*isSet)[i];
+      if (set && !valueDef->isValueValid(values[i]))
+      {
+        ok = false;
+        continue;
+      }
+      data[i] = values[i];
+      column.isSet[i] = set;
+      if (!m_items[i].empty())
+      {
+        storeValue(m_items[i][ith], values[i], set);
+      }
+    }
+    return ok;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    if (ith >= m_items[i].size())
+    {
+      return false;
+    }
+    ok &= storeValue(m_items[i][ith], values[i], !isSet || (*isSet)[i]);
+  }
+  return ok;
+}
+
+bool GroupItem::columnValues(std::size_t ith, std::vector<int>& values, std::vector<bool>* isSet)
+  const
+{
+  return this->columnValuesInternal(ith, values, isSet);
+}
+
+bool GroupItem::columnValues(
+  std::size_t ith,
+  std::vector<double>& values,
+  std::vector<bool>* isSet) const
+{
+  return this->columnValuesInternal(ith, values, isSet);
+}
+
+bool GroupItem::columnValues(
+  std::size_t ith,
+  std::vector<std::string>& values,
+  std::vector<bool>* isSet) const
+{
+  return this->columnValuesInternal(ith, values, isSet);
+}
+
+bool GroupItem::setColumnValues(
+  std::size_t ith,
+  const std::vector<int>& values,
+  const std::vector<bool>* isSet)
+{
+  return this->setColumnValuesInternal(ith, values, isSet);
+}
+
+bool GroupItem::setColumnValues(
+  std::size_t ith,
+  const std::vector<double>& values,
+  const std::vector<bool>* isSet)
+{
+  return this->setColumnValuesInternal(ith, values, isSet);
+}
+
+bool GroupItem::setColumnValues(
+  std::size_t ith,
+  const std::vector<std::string>& values,
+  const std::vector<bool>* isSet)
+{
+  return this->setColumnValuesInternal(ith, values, isSet);
+}
+
+std::size_t GroupItem::releaseItems()
+{
+  if (!m_isColumnar)
+  {
+    return 0;
+  }
+  std::size_t released = 0;
+  std::lock_guard<std::mutex> guard(m_columnarMutex);
+  for (std::size_t i = 0; i < m_items.size(); ++i)
+  {
+    auto& items = m_items[i];
+    if (
+      items.empty() ||
+      std::any_of(items.begin(), items.end(), [](const ItemPtr& item) {
+        return item.use_count() > 1;
+      }))
+    {
+      continue;
+    }
+    for (std::size_t j = 0; (j < m_columns.size()) && (j < items.size()); ++j)
+    {
+      Column& column = m_columns[j];
+      bool isSet = false;
+      switch (column.type)
+      {
+        case Item::IntType:
+          loadValue(items[j], column.ints[i], isSet);
+          break;
+        case Item::DoubleType:
+          loadValue(items[j], column.doubles[i], isSet);
+          break;
+        case Item::StringType:
+          loadValue(items[j], column.strings[i], isSet);
+          break;
+        default:
+          break;
+      }
+      column.isSet[i] = isSet;
+    }
+    items.clear();
+    ++released;
+  }
+  return released;
+}
@@ -13,6 +13,8 @@
 #include "smtk/CoreExports.h"
 #include "smtk/attribute/Item.h"
 #include <cassert>
+#include <mutex>
+#include <string>
 #include <vector>
 namespace smtk
 {
@@ -45,6 +47,19 @@ class GroupItemDefinition;
 ///   }
 /// ```
 ///
+/// Extensible groups whose definition isColumnar() store the values of their
+/// children in one array per child rather than one Item per child per
+/// sub-group. The example above still works (Items are built for each
+/// sub-group when it is accessed), but the values can also be read and
+/// written a column at a time:
+///
+/// ```
+///   std::vector<double> values(5);
+///   // ...
+///   g->setNumberOfGroups(values.size());
+///   g->setColumnValues(1, values);
+/// ```
+///
 class SMTKCORE_EXPORT GroupItem : public Item
 {
   friend class GroupItemDefinition;
@@ -93,10 +108,66 @@ public:
   smtk::attribute::ItemPtr item(std::size_t element, std::size_t ith) const
   {
     assert(m_items.size() > element);
+    if (m_isColumnar)
+    {
+      return this->columnarItem(element, ith);
+    }
     assert(m_items[element].size() > ith);
     return m_items[element][ith];
   }
 
+  /// \brief Returns true if the values of the group's children are stored in columns.
+  ///
+  /// See GroupItemDefinition::isColumnar().
+  bool isColumnar() const { return m_isColumnar; }
+
+  ///@{
+  /// \brief Copy the value of the \a ith item of every sub-group into \a values.
+  ///
+  /// If \a isSet is provided, it is filled with whether each value is set (the
+  /// corresponding entries of \a values are unspecified when it is not).
+  /// Returns false if the \a ith items are not single-valued items of the
+  /// requested type. Columnar groups answer without building items.
+  bool columnValues(std::size_t ith, std::vector<int>& values, std::vector<bool>* isSet = nullptr)
+    const;
+  bool columnValues(
+    std::size_t ith,
+    std::vector<double>& values,
+    std::vector<bool>* isSet = nullptr) const;
+  bool columnValues(
+    std::size_t ith,
+    std::vector<std::string>& values,
+    std::vector<bool>* isSet = nullptr) const;
+  ///@}
+
+  ///@{
+  /// \brief Set the value of the \a ith item of every sub-group from \a values.
+  ///
+  /// \a values must hold numberOfGroups() entries. Entries whose \a isSet flag
+  /// is false (when \a isSet is provided) are unset instead. Returns false
+  /// (after setting the valid entries) if any value is rejected by the item's
+  /// definition or if the sizes or types do not match.
+  bool setColumnValues(
+    std::size_t ith,
+    const std::vector<int>& values,
+    const std::vector<bool>* isSet = nullptr);
+  bool setColumnValues(
+    std::size_t ith,
+    const std::vector<double>& values,
+    const std::vector<bool>* isSet = nullptr);
+  bool setColumnValues(
+    std::size_t ith,
+    const std::vector<std::string>& values,
+    const std::vector<bool>* isSet = nullptr);
+  ///@}
+
+  /// \brief Return the values of items built for columnar sub-groups to the columns.
+  ///
+  /// Items of sub-groups that are not referenced outside of the group are
+  /// discarded; they will be rebuilt if accessed again. Returns the number
+  /// of sub-groups released.
+  std::size_t releaseItems();
+
   smtk::attribute::ItemPtr
   find(std::size_t element, const std::string& name, SearchStyle style = IMMEDIATE);
   smtk::attribute::ConstItemPtr
@@ -187,11 +258,46 @@ protected:
   // this group
   void detachAllItems();
   bool isValidInternal(bool useCategories, const std::set<std::string>& categories) const override;
-  std::vector<std::vector<smtk::attribute::ItemPtr>> m_items;
+  // Sub-groups of columnar groups have no items until they are accessed.
+  mutable std::vector<std::vector<smtk::attribute::ItemPtr>> m_items;
   unsigned int m_maxNumberOfChoices;
   unsigned int m_minNumberOfChoices;
 
 private:
+  // The values of one child item across all sub-groups of a columnar group.
+  struct Column
+  {
+    Item::Type type;
+    std::vector<int> ints;
+    std::vector<double> doubles;
+    std::vector<std::string> strings;
+    std::vector<bool> isSet;
+
+    template<typename T>
+    std::vector<T>& data();
+  };
+
+  smtk::attribute::ItemPtr columnarItem(std::size_t element, std::size_t ith) const;
+  // Build the items of a columnar sub-group; the caller must hold m_columnarMutex.
+  void buildColumnarGroup(std::size_t element) const;
+  // Copy the values of a sub-group when neither group has built its items.
+  bool copyColumnarGroup(const GroupItem& source, std::size_t element);
+  void insertColumnEntries(std::size_t pos, std::size_t num);
+  void eraseColumnEntries(std::size_t pos, std::size_t num);
+  void resetColumns();
+  bool isColumnarValid(bool useCategories, const std::set<std::string>& categories) const;
+  template<typename T>
+  bool columnValuesInternal(std::size_t ith, std::vector<T>& values, std::vector<bool>* isSet)
+    const;
+  template<typename T>
+  bool setColumnValuesInternal(
+    std::size_t ith,
+    const std::vector<T>& values,
+    const std::vector<bool>* isSet);
+
+  bool m_isColumnar{ false };
+  std::vector<Column> m_columns;
+  mutable std::mutex m_columnarMutex;
 };
 
 template<typename T>
@@ -10,6 +10,7 @@
 
 #include "smtk/attribute/GroupItemDefinition.h"
 #include "smtk/attribute/GroupItem.h"
+#include "smtk/attribute/ValueItemDefinition.h"
 
 #include <algorithm>
 #include <functional>
@@ -59,6 +60,7 @@ bool GroupItemDefinition::addItemDefinition(smtk::attribute::ItemDefinitionPtr c
   std::size_t n = m_itemDefs.size();
   m_itemDefs.push_back(cdef);
   m_itemDefPositions[cdef->name()] = static_cast<int>(n);
+  ItemDefinition::structureModified();
   // If we represent a set of conditionals then each item should be considered optional.
   if (m_isConditional)
   {
@@ -67,6 +69,33 @@ bool GroupItemDefinition::addItemDefinition(smtk::attribute::ItemDefinitionPtr c
   return true;
 }
 
+bool GroupItemDefinition::isColumnar() const
+{
+  if (!(m_usesColumnarStorage && m_isExtensible) || m_isConditional)
+  {
+    return false;
+  }
+  for (const auto& itemDef : m_itemDefs)
+  {
+    Item::Type childType = itemDef->type();
+    if (
+      (childType != Item::IntType) && (childType != Item::DoubleType) &&
+      (childType != Item::StringType))
+    {
+      return false;
+    }
+    const auto* valueDef = static_cast<const ValueItemDefinition*>(itemDef.get());
+    if (
+      valueDef->isOptional() || valueDef->isDiscrete() || valueDef->isExtensible() ||
+      (valueDef->numberOfRequiredValues() != 1) || valueDef->allowsExpressions() ||
+      valueDef->numberOfChildrenItemDefinitions())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 void GroupItemDefinition::buildGroup(GroupItem* groupItem, int subGroupPosition) const
 {
   std::size_t i, n = m_itemDefs.size();
@@ -210,6 +239,7 @@ ItemDefinitionPtr GroupItemDefinition::createCopy(ItemDefinition::CopyInfo& info
   instance->setIsExtensible(m_isExtensible);
   instance->setNumberOfRequiredGroups(m_numberOfRequiredGroups);
   instance->setMaxNumberOfGroups(m_maxNumberOfGroups);
+  instance->setUsesColumnarStorage(m_usesColumnarStorage);
 
   // Labels
   if (m_useCommonLabel)
@@ -241,5 +271,6 @@ bool GroupItemDefinition::removeItemDefinition(ItemDefinitionPtr itemDef)
     m_itemDefs.erase(itItemDef);
   }
   m_itemDefPositions.erase(itemDef->name());
+  ItemDefinition::structureModified();
   return true;
 }
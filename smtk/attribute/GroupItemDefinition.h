@@ -67,6 +67,7 @@ public:
       }
       m_itemDefs.push_back(item);
       m_itemDefPositions[inName] = static_cast<int>(n);
+      ItemDefinition::structureModified();
     }
     return item;
   }
@@ -125,6 +126,25 @@ public:
   unsigned int maxNumberOfChoices() const { return m_maxNumberOfChoices; }
   ///@}
 
+  ///@{
+  /// \brief Returns or sets whether items of this definition should store values in columns.
+  ///
+  /// A GroupItem normally holds one Item per child per sub-group. When columnar
+  /// storage is requested (and isColumnar() is true), the group instead holds one
+  /// contiguous array of values per child; Items are only built for sub-groups
+  /// that are accessed individually. See GroupItem::columnValues() and
+  /// GroupItem::setColumnValues() for bulk access. Default is false.
+  void setUsesColumnarStorage(bool value) { m_usesColumnarStorage = value; }
+  bool usesColumnarStorage() const { return m_usesColumnarStorage; }
+  ///@}
+
+  /// \brief Returns true if items of this definition will store values in columns.
+  ///
+  /// This requires usesColumnarStorage() to be set on an extensible, non-conditional
+  /// group whose children are all required, non-discrete, single-valued Int, Double,
+  /// or String items that do not allow expressions or have children of their own.
+  bool isColumnar() const;
+
   bool hasSubGroupLabels() const { return !m_labels.empty(); }
 
   /// \brief Returns or Sets the maximum number of groups that items from this def can have.
@@ -165,6 +185,7 @@ protected:
   bool m_isExtensible;
   bool m_useCommonLabel;
   bool m_isConditional;
+  bool m_usesColumnarStorage{ false };
   unsigned int m_maxNumberOfChoices;
   unsigned int m_minNumberOfChoices;
 
@@ -0,0 +1,101 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/attribute/InfixExpressionCache.h"
+
+#include "smtk/attribute/StringItem.h"
+
+#include <algorithm>
+
+namespace smtk
+{
+namespace attribute
+{
+
+std::shared_ptr<const InfixExpressionCache::Program> InfixExpressionCache::program(
+  const smtk::attribute::ConstStringItemPtr& item,
+  std::size_t element,
+  smtk::common::InfixExpressionError& err)
+{
+  err = smtk::common::InfixExpressionError::ERROR_NONE;
+  if (!item || !item->isSet(element))
+  {
+    err = smtk::common::InfixExpressionError::ERROR_INVALID_SYNTAX;
+    return nullptr;
+  }
+  const std::string source = item->value(element);
+
+  std::lock_guard<std::mutex> guard(m_mutex);
+  Entry& entry = m_entries[item.get()];
+  if (entry.item.lock() != item)
+  {
+    // Either a new item or a new item allocated where a destroyed one lived.
+    entry.item = item;
+    entry.elements.clear();
+  }
+  if (entry.elements.size() <= element)
+  {
+    entry.elements.resize(element + 1);
+  }
+
+  Compiled& compiled = entry.elements[element];
+  if (!compiled.built || compiled.source != source)
+  {
+    compiled.built = true;
+    compiled.source = source;
+    compiled.program = m_grammar.compile(source, compiled.error);
+  }
+  err = compiled.error;
+
+  if (m_entries.size() > m_pruneThreshold)
+  {
+    this->prune();
+  }
+  return compiled.program;
+}
+
+void InfixExpressionCache::invalidate(const smtk::attribute::ConstStringItemPtr& item)
+{
+  std::lock_guard<std::mutex> guard(m_mutex);
+  m_entries.erase(item.get());
+}
+
+void InfixExpressionCache::clear()
+{
+  std::lock_guard<std::mutex> guard(m_mutex);
+  m_entries.clear();
+}
+
+std::size_t InfixExpressionCache::size() const
+{
+  std::lock_guard<std::mutex> guard(m_mutex);
+  return m_entries.size();
+}
+
+void InfixExpressionCache::prune()
+{
+  for (auto it = m_entries.begin(); it != m_entries.end();)
+  {
+    if (it->second.item.expired())
+    {
+      it = m_entries.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+  // Grow the threshold with the number of live entries so pruning stays
+  // amortized constant time per lookup.
+  m_pruneThreshold = std::max<std::size_t>(64, 2 * m_entries.size());
+}
+
+} // namespace attribute
+} // namespace smtk
@@ -0,0 +1,87 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_attribute_InfixExpressionCache_h
+#define smtk_attribute_InfixExpressionCache_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/PublicPointerDefs.h"
+
+#include "smtk/common/InfixExpressionError.h"
+#include "smtk/common/InfixExpressionGrammar.h"
+#include "smtk/common/InfixExpressionProgram.h"
+
+#include "smtk/resource/query/Cache.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace smtk
+{
+namespace attribute
+{
+
+// InfixExpressionCache holds compiled programs for the values of expression
+// StringItems so that an expression is parsed once rather than every time it
+// is evaluated. Entries are keyed on the item and element; a program is
+// recompiled when the item's value no longer matches the text it was compiled
+// from, so editing an expression invalidates its program.
+struct SMTKCORE_EXPORT InfixExpressionCache : public smtk::resource::query::Cache
+{
+public:
+  using Program = smtk::common::InfixExpressionProgram;
+
+  // Returns the program for |element| of |item|, compiling it if needed. On
+  // failure, returns nullptr and sets |err| to the compilation error (which is
+  // also cached until the expression changes).
+  std::shared_ptr<const Program> program(
+    const smtk::attribute::ConstStringItemPtr& item,
+    std::size_t element,
+    smtk::common::InfixExpressionError& err);
+
+  // Discards the programs compiled for |item|.
+  void invalidate(const smtk::attribute::ConstStringItemPtr& item);
+
+  // Discards all programs.
+  void clear();
+
+  // The number of items with cached programs.
+  std::size_t size() const;
+
+private:
+  struct Compiled
+  {
+    std::string source;
+    std::shared_ptr<const Program> program;
+    smtk::common::InfixExpressionError error{ smtk::common::InfixExpressionError::ERROR_NONE };
+    bool built{ false };
+  };
+
+  struct Entry
+  {
+    std::weak_ptr<const smtk::attribute::StringItem> item;
+    std::vector<Compiled> elements;
+  };
+
+  // Removes entries whose items have been destroyed.
+  void prune();
+
+  mutable std::mutex m_mutex;
+  std::unordered_map<const smtk::attribute::StringItem*, Entry> m_entries;
+  std::size_t m_pruneThreshold{ 64 };
+  smtk::common::InfixExpressionGrammar m_grammar;
+};
+
+} // namespace attribute
+} // namespace smtk
+
+#endif // smtk_attribute_InfixExpressionCache_h
@@ -10,12 +10,15 @@
 
 #include "InfixExpressionEvaluator.h"
 
+#include "smtk/attribute/InfixExpressionCache.h"
 #include "smtk/attribute/Resource.h"
 #include "smtk/attribute/StringItem.h"
 #include "smtk/attribute/SymbolDependencyStorage.h"
 
-#include "smtk/common/InfixExpressionGrammar.h"
+#include "smtk/common/InfixExpressionProgram.h"
 
+#include <cmath>
+#include <sstream>
 #include <string>
 #include <unordered_set>
 
@@ -44,92 +47,114 @@ bool smtk::attribute::InfixExpressionEvaluator::evaluate(
     return false;
   }
 
-  smtk::common::InfixExpressionGrammar grammar;
+  smtk::attribute::ConstStringItemPtr expressionStringItem = att->findString("expression");
+  if (!expressionStringItem->isSet(element))
+  {
+    log.addRecord(
+      smtk::io::Logger::Error,
+      "Missing element " + std::to_string(element + 1) + " needed for evaluation.");
+    return false;
+  }
+
+  // Parsing happens once per distinct expression; see InfixExpressionCache.
+  smtk::common::InfixExpressionError err = smtk::common::InfixExpressionError::ERROR_NONE;
+  std::shared_ptr<const smtk::common::InfixExpressionProgram> program =
+    attRes->queries().cache<InfixExpressionCache>().program(expressionStringItem, element, err);
+  if (!program)
+  {
+    logError(err, log);
+    return false;
+  }
 
   const std::string attSymbol = att->name();
+
+  // Resolve each distinct subsymbol to a value for its slot in the program.
+  std::vector<double> symbolValues(program->symbols().size());
+  for (std::size_t slot = 0; slot < symbolValues.size(); ++slot)
+  {
+    if (!this->evaluateSymbol(
+          program->symbols()[slot], attSymbol, attRes, log, element, symbolValues[slot]))
+    {
+      logError(smtk::common::InfixExpressionError::ERROR_SUBEVALUATION_FAILED, log);
+      return false;
+    }
+  }
+
+  const double evaluationResult = program->evaluate(symbolValues, err);
+  if (err != smtk::common::InfixExpressionError::ERROR_NONE)
+  {
+    logError(err, log);
+    return false;
+  }
+
+  result = evaluationResult;
+
+  // Need to know: what symbols list "a" as their dependent? if "a" no longer uses them,
+  // we need to remove the dependency.
   SymbolDependencyStorage& ctxtStorage = attRes->queries().cache<SymbolDependencyStorage>();
+  std::unordered_set<std::string> symbolsUsed(
+    program->symbols().begin(), program->symbols().end());
+  ctxtStorage.pruneOldSymbols(symbolsUsed, attSymbol);
 
-  // Collects symbols used by this expression.
-  std::unordered_set<std::string> symbolsUsed;
-
-  // Tells |grammar| to attempt to create an Evaluator and evaluate() child
-  // expressions.
-  smtk::common::SubsymbolVisitor childExpressionVisitor =
-    [&symbolsUsed, &ctxtStorage, attSymbol, attRes, &log, element](const std::string& symbol) {
-      // Are we attempting to reference ourself?
-      if (attSymbol == symbol)
-      {
-        log.addRecord(
-          smtk::io::Logger::Error, "Cannot write " + attSymbol + " in terms of itself.");
-        return std::pair<double, bool>(0.0, false);
-      }
-
-      // Are we attempting to reference a dependent expression?
-      // If we can reach |symbol| from |attSymbol|, this would be a cycle.
-      if (ctxtStorage.isDependentOn(attSymbol, symbol))
-      {
-        log.addRecord(
-          smtk::io::Logger::Error,
-          "Cannot use " + symbol + " in expression " + attSymbol + " because the expression " +
-            symbol + " already uses " + attSymbol + ".");
-        return std::pair<double, bool>(0.0, false);
-      }
-
-      symbolsUsed.insert(symbol);
-
-      // |attSymbol| is dependent on |symbol|.
-      ctxtStorage.addDependency(symbol, attSymbol);
-
-      smtk::attribute::AttributePtr childAtt = attRes->findAttribute(symbol);
-      if (!childAtt)
-      {
-        log.addRecord(
-          smtk::io::Logger::Error, "Cannot find referenced attribute with name " + symbol);
-        return std::pair<double, bool>(0.0, false);
-      }
-
-      std::unique_ptr<smtk::attribute::Evaluator> childEvaluator =
-        attRes->createEvaluator(childAtt);
-      if (childEvaluator)
-      {
-        // Recursively evaluates this child so we can learn its result. evaluationMode
-        // is set to DO_NOT_EVALUATE_DEPENDENTS to prevent infinite recursion.
-        ValueType result;
-        if (childEvaluator->evaluate(
-              result, log, element, DependentEvaluationMode::DO_NOT_EVALUATE_DEPENDENTS))
-        {
-          try
-          {
-            // TODO: The result of evaluate() could be an int, but there are no
-            // Evaluators that currently return an int, so this is OK for now.
-            return std::pair<double, bool>(boost::get<double>(result), true);
-          }
-          catch (const boost::bad_get&)
-          {
-            // This tells us that the result of |childEvaluator| was not
-            // compatible with InfixExpressionEvaluator.
-            log.addRecord(
-              smtk::io::Logger::Error,
-              "Result type of child expression evaluation was not "
-              "compatible with an infix expression.");
-            return std::pair<double, bool>(0.0, false);
-          }
-        }
-        else
-        {
-          log.addRecord(smtk::io::Logger::Error, "Evaluation failed for " + symbol + ".");
-          return std::pair<double, bool>(0.0, false);
-        }
-      }
+  if (evaluationMode == DependentEvaluationMode::EVALUATE_DEPENDENTS)
+  {
+    // allDependentSymbols() returns dependents in a level-order traversal order,
+    // so these evaluators will run in an order in keeping with the dependency ordering.
+    for (const std::string& dependent : ctxtStorage.allDependentSymbols(attSymbol))
+    {
+      smtk::attribute::AttributePtr dependentAtt = attRes->findAttribute(dependent);
+      if (!dependentAtt)
+        continue;
+
+      std::unique_ptr<smtk::attribute::Evaluator> dependentEvaluator =
+        attRes->createEvaluator(dependentAtt);
+      if (!dependentEvaluator)
+        continue;
+
+      ValueType dependentResult;
+      // evaluationMode is set to DO_NOT_EVALUATE_DEPENDENTS to prevent infinite recursion.
+      dependentEvaluator->evaluate(
+        dependentResult, log, element, DependentEvaluationMode::DO_NOT_EVALUATE_DEPENDENTS);
+    }
+  }
+
+  return true;
+}
 
+bool smtk::attribute::InfixExpressionEvaluator::evaluateBatch(
+  std::vector<double>& results,
+  smtk::io::Logger& log,
+  const std::map<std::string, std::vector<double>>& symbolValues,
+  const std::size_t& element)
+{
+  smtk::attribute::ConstAttributePtr att = attribute().lock();
+  if (!att)
+  {
+    return false;
+  }
+
+  smtk::attribute::ResourcePtr attRes =
+    std::dynamic_pointer_cast<smtk::attribute::Resource>(att->resource());
+  if (!attRes)
+  {
+    return false;
+  }
+
+  std::size_t numberOfRows = symbolValues.empty() ? 1 : symbolValues.begin()->second.size();
+  for (const auto& entry : symbolValues)
+  {
+    if (entry.second.size() != numberOfRows)
+    {
       log.addRecord(
-        smtk::io::Logger::Error, "Referenced attribute " + symbol + " is not evaluatable");
-      return std::pair<double, bool>(0.0, false);
-    };
-  grammar.setSubsymbolVisitor(childExpressionVisitor);
+        smtk::io::Logger::Error,
+        "Values for " + entry.first + " have " + std::to_string(entry.second.size()) +
+          " rows; expected " + std::to_string(numberOfRows) + ".");
+      return false;
+    }
+  }
 
   smtk::attribute::ConstStringItemPtr expressionStringItem = att->findString("expression");
-  if (!expressionStringItem->isSet(element))
+  if (!expressionStringItem || !expressionStringItem->isSet(element))
   {
     log.addRecord(
       smtk::io::Logger::Error,
@@ -137,49 +162,126 @@ bool smtk::attribute::InfixExpressionEvaluator::evaluate(
     return false;
   }
 
-  const std::string expressionStr = att->findString("expression")->value(element);
-
   smtk::common::InfixExpressionError err = smtk::common::InfixExpressionError::ERROR_NONE;
-  const double evaluationResult = grammar.evaluate(expressionStr, err);
-
-  if (err == smtk::common::InfixExpressionError::ERROR_NONE)
+  std::shared_ptr<const smtk::common::InfixExpressionProgram> program =
+    attRes->queries().cache<InfixExpressionCache>().program(expressionStringItem, element, err);
+  if (!program)
   {
-    result = evaluationResult;
-
-    // Need to know: what symbols list "a" as their dependent? if "a" no longer uses them,
-    // we need to remove the dependency.
-    ctxtStorage.pruneOldSymbols(symbolsUsed, attSymbol);
+    logError(err, log);
+    return false;
+  }
 
-    if (evaluationMode == DependentEvaluationMode::EVALUATE_DEPENDENTS)
+  // Slots without supplied values are evaluated once and broadcast to every row.
+  const std::string attSymbol = att->name();
+  std::vector<const double*> columns(program->symbols().size(), nullptr);
+  std::vector<std::vector<double>> broadcast;
+  broadcast.reserve(columns.size());
+  for (std::size_t slot = 0; slot < columns.size(); ++slot)
+  {
+    const std::string& symbol = program->symbols()[slot];
+    auto supplied = symbolValues.find(symbol);
+    if (supplied != symbolValues.end())
     {
-      // allDependentSymbols() returns dependents in a level-order traversal order,
-      // so these evaluators will run in an order in keeping with the dependency ordering.
-      for (const std::string& dependent : ctxtStorage.allDependentSymbols(attSymbol))
-      {
-        smtk::attribute::AttributePtr dependentAtt = attRes->findAttribute(dependent);
-        if (!att)
-          continue;
-
-        std::unique_ptr<smtk::attribute::Evaluator> dependentEvaluator =
-          attRes->createEvaluator(dependentAtt);
-        if (!dependentEvaluator)
-          continue;
-
-        ValueType dependentResult;
-        // evaluationMode is set to DO_NOT_EVALUATE_DEPENDENTS to prevent infinite recursion.
-        dependentEvaluator->evaluate(
-          dependentResult, log, element, DependentEvaluationMode::DO_NOT_EVALUATE_DEPENDENTS);
-      }
+      columns[slot] = supplied->second.data();
+      continue;
     }
 
-    return true;
+    double value;
+    if (!this->evaluateSymbol(symbol, attSymbol, attRes, log, element, value))
+    {
+      logError(smtk::common::InfixExpressionError::ERROR_SUBEVALUATION_FAILED, log);
+      return false;
+    }
+    broadcast.emplace_back(numberOfRows, value);
+    columns[slot] = broadcast.back().data();
   }
-  else
+
+  results.resize(numberOfRows);
+  err = program->evaluate(numberOfRows, columns, results.data());
+  if (err != smtk::common::InfixExpressionError::ERROR_NONE)
   {
     logError(err, log);
+    return false;
+  }
+  return true;
+}
+
+bool smtk::attribute::InfixExpressionEvaluator::evaluateSymbol(
+  const std::string& symbol,
+  const std::string& attSymbol,
+  const smtk::attribute::ResourcePtr& attRes,
+  smtk::io::Logger& log,
+  std::size_t element,
+  double& value) const
+{
+  SymbolDependencyStorage& ctxtStorage = attRes->queries().cache<SymbolDependencyStorage>();
+
+  // Are we attempting to reference ourself?
+  if (attSymbol == symbol)
+  {
+    log.addRecord(smtk::io::Logger::Error, "Cannot write " + attSymbol + " in terms of itself.");
+    return false;
+  }
+
+  // Are we attempting to reference a dependent expression?
+  // If we can reach |symbol| from |attSymbol|, this would be a cycle.
+  if (ctxtStorage.isDependentOn(attSymbol, symbol))
+  {
+    log.addRecord(
+      smtk::io::Logger::Error,
+      "Cannot use " + symbol + " in expression " + attSymbol + " because the expression " +
+        symbol + " already uses " + attSymbol + ".");
+    return false;
+  }
+
+  // |attSymbol| is dependent on |symbol|.
+  ctxtStorage.addDependency(symbol, attSymbol);
+
+  smtk::attribute::AttributePtr childAtt = attRes->findAttribute(symbol);
+  if (!childAtt)
+  {
+    log.addRecord(smtk::io::Logger::Error, "Cannot find referenced attribute with name " + symbol);
+    return false;
+  }
+
+  std::unique_ptr<smtk::attribute::Evaluator> childEvaluator = attRes->createEvaluator(childAtt);
+  if (!childEvaluator)
+  {
+    log.addRecord(
+      smtk::io::Logger::Error, "Referenced attribute " + symbol + " is not evaluatable");
+    return false;
+  }
+
+  // Recursively evaluates this child so we can learn its result. evaluationMode
+  // is set to DO_NOT_EVALUATE_DEPENDENTS to prevent infinite recursion.
+  ValueType result;
+  if (!childEvaluator->evaluate(
+        result, log, element, DependentEvaluationMode::DO_NOT_EVALUATE_DEPENDENTS))
+  {
+    log.addRecord(smtk::io::Logger::Error, "Evaluation failed for " + symbol + ".");
+    return false;
+  }
+
+  try
+  {
+    // TODO: The result of evaluate() could be an int, but there are no
+    // Evaluators that currently return an int, so this is OK for now.
+    value = boost::get<double>(result);
+  }
+  catch (const boost::bad_get&)
+  {
+    // This tells us that the result of |childEvaluator| was not
+    // compatible with InfixExpressionEvaluator.
+    log.addRecord(
+      smtk::io::Logger::Error,
+      "Result type of child expression evaluation was not "
+      "compatible with an infix expression.");
+    return false;
   }
 
-  return false;
+  // TODO: if a subexpression evaluates to nan or inf, isn't that really a
+  // math error?
+  return !std::isnan(value) && !std::isinf(value);
 }
 
 // InfixExpressionEvaluates chooses not to place anything in the Logger at this
@@ -17,12 +17,20 @@
 
 #include "smtk/common/InfixExpressionError.h"
 
+#include <map>
+#include <string>
+#include <vector>
+
 namespace smtk
 {
 namespace attribute
 {
 
 // An Evaluator for infix math expressions.
+//
+// Expressions are compiled once and cached (see InfixExpressionCache) on the
+// attribute resource that owns them; evaluating an attribute whose expression
+// has not changed does not parse it again.
 class SMTKCORE_EXPORT InfixExpressionEvaluator : public smtk::attribute::Evaluator
 {
 public:
@@ -43,7 +51,33 @@ public:
 
   std::size_t numberOfEvaluatableElements() override;
 
+  // Evaluates the expression at |element| once for each row of |symbolValues|.
+  //
+  // |symbolValues| maps names of symbols referenced by the expression to
+  // per-row values; every vector must hold the same number of rows. Symbols
+  // not present in |symbolValues| are evaluated once from their attributes
+  // and used for every row. |results| is resized to the number of rows (one,
+  // if |symbolValues| is empty). Rows are evaluated in blocks by the compiled
+  // program rather than one at a time. Dependent expressions are not
+  // evaluated. Returns false and adds records to |log| on failure.
+  bool evaluateBatch(
+    std::vector<double>& results,
+    smtk::io::Logger& log,
+    const std::map<std::string, std::vector<double>>& symbolValues,
+    const std::size_t& element = 0);
+
 private:
+  // Evaluates the attribute named |symbol| (referenced by the expression of
+  // the attribute named |attSymbol|) and records the dependency. Returns false
+  // and adds records to |log| if it cannot be evaluated.
+  bool evaluateSymbol(
+    const std::string& symbol,
+    const std::string& attSymbol,
+    const smtk::attribute::ResourcePtr& attRes,
+    smtk::io::Logger& log,
+    std::size_t element,
+    double& value) const;
+
   // Maps |err| to an error message and adds it as a record to |log|. Does
   // nothing if |err| == smtk::common::InfixExpressionError::ERROR_NONE.
   void logError(const smtk::common::InfixExpressionError& err, smtk::io::Logger& log) const;
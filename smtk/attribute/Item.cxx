@@ -78,6 +78,8 @@ bool Item::isValid(bool useActiveCategories) const
       auto aResource = myAttribute->attributeResource();
       if (aResource && aResource->activeCategoriesEnabled())
       {
+        CategoryIndex::Scope scope(
+          aResource->activeCategories(), aResource->activeCategoryMask());
         return this->isValidInternal(true, aResource->activeCategories());
       }
     }
@@ -103,7 +105,7 @@ bool Item::isRelevant(bool includeCategories, bool includeReadAccess, unsigned i
       auto aResource = myAttribute->attributeResource();
       if (aResource && aResource->activeCategoriesEnabled())
       {
-        if (!this->categories().passes(aResource->activeCategories()))
+        if (!this->categories().passes(aResource->activeCategoryMask()))
         {
           return false;
         }
@@ -0,0 +1,106 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_attribute_ItemAccessor_h
+#define smtk_attribute_ItemAccessor_h
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/ItemLookup.h"
+
+#include <string>
+
+namespace smtk
+{
+namespace attribute
+{
+///\brief Find the same item in many attributes of a Definition.
+///
+/// Attribute::find() looks the name up each time it is called. An accessor
+/// looks the name up once, when it is constructed, and then only follows the
+/// item's position in each attribute it is applied to. Attributes that were
+/// not built by the accessor's definition (including those of derived
+/// definitions) are searched with Attribute::find().
+///
+/// \code
+///   smtk::attribute::ItemAccessor<smtk::attribute::DoubleItem> temperature(
+///     definition, "temperature");
+///   for (const auto& attribute : attributes)
+///   {
+///     if (auto item = temperature(attribute))
+///     {
+///       // ...
+///     }
+///   }
+/// \endcode
+template<typename T = Item>
+class ItemAccessor
+{
+public:
+  ItemAccessor() = default;
+  ItemAccessor(
+    const smtk::attribute::ConstDefinitionPtr& definition,
+    const std::string& name,
+    SearchStyle style = RECURSIVE_ACTIVE)
+    : m_definition(definition)
+    , m_name(name)
+    , m_style(style)
+  {
+    if (m_definition)
+    {
+      m_lookup = &m_definition->itemLookup();
+      m_entry = m_lookup->findName(m_name);
+    }
+  }
+
+  ///\brief Return the item of \a attribute with the accessor's name (or null).
+  typename T::Ptr operator()(const smtk::attribute::AttributePtr& attribute) const
+  {
+    if (!attribute)
+    {
+      return typename T::Ptr();
+    }
+    ItemPtr item;
+    if (!(m_lookup && m_lookup->find(*attribute, m_entry, m_style, item)))
+    {
+      item = attribute->find(m_name, m_style);
+    }
+    return smtk::dynamic_pointer_cast<T>(item);
+  }
+
+  typename T::ConstPtr operator()(const smtk::attribute::ConstAttributePtr& attribute) const
+  {
+    if (!attribute)
+    {
+      return typename T::ConstPtr();
+    }
+    ItemPtr item;
+    if (m_lookup && m_lookup->find(*attribute, m_entry, m_style, item))
+    {
+      return smtk::dynamic_pointer_cast<const T>(item);
+    }
+    return smtk::dynamic_pointer_cast<const T>(attribute->find(m_name, m_style));
+  }
+
+  const smtk::attribute::ConstDefinitionPtr& definition() const { return m_definition; }
+  const std::string& name() const { return m_name; }
+  SearchStyle style() const { return m_style; }
+
+private:
+  smtk::attribute::ConstDefinitionPtr m_definition;
+  std::string m_name;
+  SearchStyle m_style{ RECURSIVE_ACTIVE };
+  const ItemLookup* m_lookup{ nullptr };
+  const ItemLookup::Entry* m_entry{ nullptr };
+};
+} // namespace attribute
+} // namespace smtk
+
+#endif
@@ -9,9 +9,26 @@
 //=========================================================================
 
 #include "smtk/attribute/ItemDefinition.h"
+
+#include <atomic>
 #include <iostream>
 using namespace smtk::attribute;
 
+namespace
+{
+std::atomic<std::size_t> g_structureGeneration{ 0 };
+} // namespace
+
+std::size_t ItemDefinition::structureGeneration()
+{
+  return g_structureGeneration.load(std::memory_order_acquire);
+}
+
+void ItemDefinition::structureModified()
+{
+  g_structureGeneration.fetch_add(1, std::memory_order_acq_rel);
+}
+
 ItemDefinition::ItemDefinition(const std::string& myName)
   : m_name(myName)
 {
@@ -57,6 +57,16 @@ public:
   };
 
   virtual ~ItemDefinition();
+
+  ///\brief Return a process-wide counter that changes whenever an item definition
+  /// is added to or removed from any Definition or ItemDefinition.
+  ///
+  /// Lookup tables derived from the structure of definitions (see ItemLookup)
+  /// compare this against the value they were built with to detect changes.
+  static std::size_t structureGeneration();
+  ///\brief Indicate that item definitions have been added or removed.
+  static void structureModified();
+
   // The name used to access the item - this name is unique w/r to the attribute
   // or parent item
   const std::string& name() const { return m_name; }
@@ -0,0 +1,349 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/attribute/ItemLookup.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/CustomItemDefinition.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/GroupItem.h"
+#include "smtk/attribute/GroupItemDefinition.h"
+#include "smtk/attribute/ReferenceItem.h"
+#include "smtk/attribute/ReferenceItemDefinition.h"
+#include "smtk/attribute/ValueItem.h"
+#include "smtk/attribute/ValueItemDefinition.h"
+
+#include <limits>
+#include <string>
+
+using namespace smtk::attribute;
+
+namespace
+{
+// Return true if Attribute::itemAtPath() would treat \a name as a group index.
+bool isIndex(const std::string& name)
+{
+  try
+  {
+    std::size_t pos = 0;
+    std::stoi(name, &pos);
+    return pos == name.size();
+  }
+  catch (...)
+  {
+    return false;
+  }
+}
+
+bool isActiveChild(const ValueItem& parent, const ItemPtr& child)
+{
+  for (std::size_t ii = 0; ii < parent.numberOfActiveChildrenItems(); ++ii)
+  {
+    if (parent.activeChildItem(static_cast<int>(ii)) == child)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool isActiveChild(const ReferenceItem& parent, const ItemPtr& child)
+{
+  for (std::size_t ii = 0; ii < parent.numberOfActiveChildrenItems(); ++ii)
+  {
+    if (parent.activeChildItem(ii) == child)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Visit a child held by name (as value and reference items hold their children).
+template<typename ParentType>
+ItemLookup::Resolution
+namedChild(const ParentType& parent, const ItemLookup::Step& step, bool activeOnly, ItemPtr& child)
+{
+  const auto& children = parent.childrenItems();
+  auto it = children.find(step.name);
+  if (it == children.end())
+  {
+    return ItemLookup::Resolution::Mismatch;
+  }
+  if (activeOnly && !isActiveChild(parent, it->second))
+  {
+    return ItemLookup::Resolution::Unreachable;
+  }
+  child = it->second;
+  return ItemLookup::Resolution::Found;
+}
+
+// Walk the item definitions below \a definition, calling \a visitor with the
+// path to (and "/"-separated key of) each; returns false if the children of
+// some item definition are unknown.
+template<typename Visitor>
+bool visitChildren(
+  const ItemDefinition* definition,
+  ItemLookup::Path& path,
+  const std::string& key,
+  bool keyIsValid,
+  Visitor& visitor)
+{
+  bool complete = true;
+  auto descend = [&](std::size_t position, const ItemDefinitionPtr& child, bool childKeyIsValid) {
+    path.push_back(ItemLookup::Step{ position, child->name(), child.get() });
+    std::string childKey = key + "/" + child->name();
+    visitor(path, childKey, childKeyIsValid);
+    complete &= visitChildren(child.get(), path, childKey, childKeyIsValid, visitor);
+    path.pop_back();
+  };
+
+  if (const auto* group = dynamic_cast<const GroupItemDefinition*>(definition))
+  {
+    for (std::size_t ii = 0; ii < group->numberOfItemDefinitions(); ++ii)
+    {
+      auto child = group->itemDefinition(static_cast<int>(ii));
+      // Names that parse as integers are taken as group indices by itemAtPath().
+      descend(ii, child, keyIsValid && !isIndex(child->name()));
+    }
+  }
+  else if (const auto* value = dynamic_cast<const ValueItemDefinition*>(definition))
+  {
+    for (const auto& entry : value->childrenItemDefinitions())
+    {
+      descend(0, entry.second, keyIsValid);
+    }
+  }
+  else if (const auto* reference = dynamic_cast<const ReferenceItemDefinition*>(definition))
+  {
+    for (const auto& entry : reference->childrenItemDefinitions())
+    {
+      descend(0, entry.second, keyIsValid);
+    }
+  }
+  else if (dynamic_cast<const CustomItemBaseDefinition*>(definition))
+  {
+    // Custom items may hold children that are not described by definitions.
+    complete = false;
+  }
+  return complete;
+}
+} // namespace
+
+ItemLookup::ItemLookup(const Definition& definition, std::size_t generation)
+  : m_generation(generation)
+{
+  auto visitor = [this](const Path& path, const std::string& key, bool keyIsValid) {
+    this->insert(path, key, keyIsValid);
+  };
+  Path path;
+  for (std::size_t ii = 0; ii < definition.numberOfItemDefinitions(); ++ii)
+  {
+    auto itemDefinition = definition.itemDefinition(static_cast<int>(ii));
+    if (!itemDefinition)
+    {
+      continue;
+    }
+    path.push_back(Step{ ii, itemDefinition->name(), itemDefinition.get() });
+    this->insert(path, itemDefinition->name(), true);
+    m_complete &= visitChildren(itemDefinition.get(), path, itemDefinition->name(), true, visitor);
+    path.pop_back();
+  }
+}
+
+void ItemLookup::insert(const Path& path, const std::string& key, bool keyIsValid)
+{
+  auto inserted =
+    m_names.emplace(smtk::string::Token(path.back().name).id(), Entry{ path, true });
+  if (!inserted.second)
+  {
+    inserted.first->second.unique = false;
+  }
+  if (keyIsValid)
+  {
+    m_paths.emplace(smtk::string::Token(key).id(), Entry{ path, true });
+  }
+}
+
+const ItemLookup::Entry* ItemLookup::findName(const std::string& name) const
+{
+  // Every name in the lookup has been interned, so a name the string manager
+  // does not know cannot be present.
+  smtk::string::Hash hash = smtk::string::Token::manager().find(name);
+  if (hash == smtk::string::Manager::Invalid)
+  {
+    return nullptr;
+  }
+  auto it = m_names.find(hash);
+  return it == m_names.end() ? nullptr : &it->second;
+}
+
+const ItemLookup::Entry* ItemLookup::findPath(const std::string& path) const
+{
+  smtk::string::Hash hash = smtk::string::Token::manager().find(path);
+  if (hash == smtk::string::Manager::Invalid)
+  {
+    return nullptr;
+  }
+  auto it = m_paths.find(hash);
+  return it == m_paths.end() ? nullptr : &it->second;
+}
+
+bool ItemLookup::find(
+  const Attribute& attribute,
+  const std::string& name,
+  SearchStyle style,
+  ItemPtr& item) const
+{
+  return this->find(attribute, this->findName(name), style, item);
+}
+
+bool ItemLookup::find(
+  const Attribute& attribute,
+  const Entry* entry,
+  SearchStyle style,
+  ItemPtr& item) const
+{
+  // The lookup must describe the items the attribute was built with.
+  if (attribute.m_itemLookup != this)
+  {
+    return false;
+  }
+
+  if (entry && entry->unique)
+  {
+    // Custom items may hold children the lookup does not know about; only
+    // the attribute's own items (which are searched first) can be trusted.
+    if (!m_complete && entry->path.size() > 1)
+    {
+      return false;
+    }
+    std::size_t maxDepth = std::numeric_limits<std::size_t>::max();
+    if (style == IMMEDIATE)
+    {
+      maxDepth = 1;
+    }
+    else if (style == IMMEDIATE_ACTIVE)
+    {
+      // The attribute's items and their (active) children are searched.
+      maxDepth = 2;
+    }
+    bool activeOnly = (style == IMMEDIATE_ACTIVE) || (style == RECURSIVE_ACTIVE);
+    ItemPtr result;
+    switch (ItemLookup::resolve(attribute, entry->path, maxDepth, activeOnly, result))
+    {
+      case Resolution::Found:
+        item = result;
+        return true;
+      case Resolution::Mismatch:
+        return false;
+      case Resolution::Unreachable:
+        break;
+    }
+  }
+  else if (entry || !m_complete)
+  {
+    // Several items share the name (so the search order matters) or
+    // the attribute may hold items the lookup does not know about.
+    return false;
+  }
+
+  // Nothing visible has the name. That is only certain if the definition
+  // has not changed since the attribute was built.
+  const auto& definition = attribute.definition();
+  if (!definition || &definition->itemLookup() != this)
+  {
+    return false;
+  }
+  item = nullptr;
+  return true;
+}
+
+ItemLookup::Resolution ItemLookup::resolve(
+  const Attribute& attribute,
+  const Path& path,
+  std::size_t maxDepth,
+  bool activeOnly,
+  ItemPtr& item)
+{
+  if (path.empty())
+  {
+    return Resolution::Mismatch;
+  }
+  auto step = path.begin();
+  ItemPtr current = attribute.item(static_cast<int>(step->position));
+  if (!current || current->definition().get() != step->definition)
+  {
+    return Resolution::Mismatch;
+  }
+  if (path.size() > maxDepth)
+  {
+    return Resolution::Unreachable;
+  }
+  for (++step; step != path.end(); ++step)
+  {
+    ItemPtr child;
+    Resolution result = Resolution::Found;
+    if (const auto* group = dynamic_cast<const GroupItem*>(current.get()))
+    {
+      if (group->numberOfGroups() == 0)
+      {
+        return Resolution::Unreachable;
+      }
+      // Only the first group is searched.
+      if (group->isColumnar())
+      {
+        // Columnar groups build the items of a sub-group when it is accessed.
+        if (step->position >= group->numberOfItemsPerGroup())
+        {
+          return Resolution::Mismatch;
+        }
+        child = group->item(0, step->position);
+      }
+      else
+      {
+        const auto& items = *group->begin();
+        if (step->position >= items.size())
+        {
+          return Resolution::Mismatch;
+        }
+        child = items[step->position];
+      }
+    }
+    else if (const auto* value = dynamic_cast<const ValueItem*>(current.get()))
+    {
+      result = namedChild(*value, *step, activeOnly, child);
+    }
+    else if (const auto* reference = dynamic_cast<const ReferenceItem*>(current.get()))
+    {
+      result = namedChild(*reference, *step, activeOnly, child);
+    }
+    else
+    {
+      result = Resolution::Mismatch;
+    }
+    if (result != Resolution::Found)
+    {
+      return result;
+    }
+    if (!child || child->definition().get() != step->definition)
+    {
+      return Resolution::Mismatch;
+    }
+    current = child;
+  }
+  item = current;
+  return Resolution::Found;
+}
+
+bool ItemLookup::operator==(const ItemLookup& other) const
+{
+  return m_complete == other.m_complete && m_names == other.m_names && m_paths == other.m_paths;
+}
@@ -0,0 +1,140 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_attribute_ItemLookup_h
+#define smtk_attribute_ItemLookup_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/PublicPointerDefs.h"
+#include "smtk/SystemConfig.h" // quiet dll-interface warnings on windows
+
+#include "smtk/attribute/SearchStyle.h"
+#include "smtk/string/Token.h"
+
+#include <atomic>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace smtk
+{
+namespace attribute
+{
+///\brief Precomputed positions of the items held by attributes of a Definition.
+///
+/// Attribute::find() would otherwise compare the requested name against each
+/// of the attribute's items and then recurse into their children, and
+/// Attribute::itemAtPath() would split the path and search at every level.
+/// An ItemLookup is built from a Definition's item definitions (including
+/// the children of group, value, and reference item definitions). It maps
+/// interned item names and "/"-separated item paths to the positions that
+/// lead from an attribute to the item.
+///
+/// Each attribute remembers the lookup of its definition at the time it
+/// was built; see Definition::itemLookup() for how lookups are kept current.
+class SMTKCORE_EXPORT ItemLookup
+{
+public:
+  /// One step from an attribute or item to one of its children.
+  struct Step
+  {
+    /// The child's position among an attribute's items or group's items.
+    std::size_t position;
+    /// The child's name (children of value and reference items are held by name).
+    std::string name;
+    /// The child's definition.
+    const ItemDefinition* definition;
+
+    bool operator==(const Step& other) const
+    {
+      return position == other.position && definition == other.definition && name == other.name;
+    }
+  };
+  /// The steps from an attribute to one of its items.
+  using Path = std::vector<Step>;
+
+  /// The locations of items with a given name.
+  struct Entry
+  {
+    /// The path to the first item with the name.
+    Path path;
+    /// False if more than one item has the name.
+    bool unique;
+
+    bool operator==(const Entry& other) const
+    {
+      return unique == other.unique && path == other.path;
+    }
+  };
+
+  /// The outcome of following a Path from an attribute.
+  enum class Resolution
+  {
+    Found,       //!< The path led to the item.
+    Unreachable, //!< The item exists but is not visible to the requested search.
+    Mismatch     //!< The attribute's items do not match the path; a search is required.
+  };
+
+  ItemLookup(const Definition& definition, std::size_t generation);
+  ItemLookup(const ItemLookup&) = delete;
+  ItemLookup& operator=(const ItemLookup&) = delete;
+
+  ///\brief Return the ItemDefinition::structureGeneration() this lookup is known to match.
+  std::size_t generation() const { return m_generation.load(std::memory_order_acquire); }
+  ///\brief Record that the lookup still matches its definition at \a generation.
+  void revalidate(std::size_t generation) const { m_generation.store(generation); }
+
+  ///\brief Return true if every item an attribute may hold is known to the lookup.
+  ///
+  /// This is false when custom items (which may hold children of their own) are present.
+  bool isComplete() const { return m_complete; }
+
+  ///\brief Return the entry for items named \a name or null if there are none.
+  const Entry* findName(const std::string& name) const;
+  ///\brief Return the entry for the item at \a path or null if there is none.
+  ///
+  /// Paths are item names separated by "/" and do not include group indices.
+  const Entry* findPath(const std::string& path) const;
+
+  ///\brief Find the item of \a attribute named \a name as Attribute::find() would.
+  ///
+  /// Returns false (leaving \a item untouched) when the lookup cannot answer
+  /// and the attribute's items must be searched instead.
+  bool find(const Attribute& attribute, const std::string& name, SearchStyle style, ItemPtr& item)
+    const;
+  ///\brief Find the item of \a attribute described by \a entry (which may be null).
+  bool find(const Attribute& attribute, const Entry* entry, SearchStyle style, ItemPtr& item) const;
+
+  ///\brief Follow \a path from \a attribute.
+  ///
+  /// At most \a maxDepth steps are taken. When \a activeOnly is true, only
+  /// the active children of value and reference items may be visited.
+  static Resolution resolve(
+    const Attribute& attribute,
+    const Path& path,
+    std::size_t maxDepth,
+    bool activeOnly,
+    ItemPtr& item);
+
+  ///\brief Return true if both lookups describe the same items.
+  bool operator==(const ItemLookup& other) const;
+
+private:
+  void insert(const Path& path, const std::string& key, bool keyIsValid);
+
+  mutable std::atomic<std::size_t> m_generation;
+  bool m_complete{ true };
+  std::unordered_map<smtk::string::Hash, Entry> m_names;
+  std::unordered_map<smtk::string::Hash, Entry> m_paths;
+};
+} // namespace attribute
+} // namespace smtk
+
+#endif
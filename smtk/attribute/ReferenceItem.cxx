@@ -241,6 +241,7 @@ ReferenceItem& ReferenceItem::operator=(const ReferenceItem& referenceItem)
   m_referencedAttribute = referenceItem.m_referencedAttribute;
   m_cache.reset(new ReferenceItem::Cache(*(referenceItem.m_cache)));
   m_nextUnsetPos = referenceItem.m_nextUnsetPos;
+  this->invalidatePositions();
   return *this;
 }
 
@@ -342,6 +343,10 @@ bool ReferenceItem::setNumberOfValues(std::size_t newSize)
   {
     m_nextUnsetPos = currentSize;
   }
+  if (newSize < currentSize)
+  {
+    this->invalidatePositions();
+  }
   m_keys.resize(newSize);
   m_cache->resize(newSize);
   return true;
@@ -420,6 +425,7 @@ bool ReferenceItem::setObjectKey(std::size_t i, const smtk::attribute::Reference
   {
     myAtt->guardedLinks()->removeLink(m_keys[i]);
     m_keys[i] = key;
+    this->invalidatePositions();
     return true;
   }
   return false;
@@ -566,6 +572,7 @@ bool ReferenceItem::setValue(std::size_t i, const PersistentObjectPtr& val)
     return false;
   }
 
+  this->unindexPosition(i);
   AttributePtr myAtt = this->m_referencedAttribute.lock();
   if (myAtt != nullptr)
   {
@@ -576,6 +583,10 @@ bool ReferenceItem::setValue(std::size_t i, const PersistentObjectPtr& val)
   {
     m_keys[i] = Key();
   }
+  if (val != nullptr && !m_keys[i].first.isNull())
+  {
+    this->indexPosition(i, val->id());
+  }
 
   assignToCache(i, val);
   // Did we set a Null Value?
@@ -617,14 +628,24 @@ bool ReferenceItem::appendValue(const PersistentObjectPtr& val, bool allowDuplic
   // Next - are we doing an append unique?
   if (!allowDuplicates)
   {
-    std::size_t n = this->numberOfValues();
-    for (std::size_t i = 0; i < n; ++i)
+    if (val != nullptr)
     {
-      if (this->isSet(i) && (this->value(i) == val))
+      if (this->find(val) >= 0)
       {
         return true;
       }
     }
+    else
+    {
+      std::size_t n = this->numberOfValues();
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        if (this->isSet(i) && (this->value(i) == val))
+        {
+          return true;
+        }
+      }
+    }
   }
 
   // Do we have an unset value location?
@@ -645,6 +666,10 @@ bool ReferenceItem::appendValue(const PersistentObjectPtr& val, bool allowDuplic
 
   m_keys.push_back(this->linkTo(val));
   appendToCache(val);
+  if (val != nullptr && !m_keys.back().first.isNull())
+  {
+    this->indexPosition(m_keys.size() - 1, val->id());
+  }
   return true;
 }
 
@@ -674,12 +699,101 @@ bool ReferenceItem::removeValue(std::size_t i)
     --m_nextUnsetPos;
   }
 
+  if (i + 1 == m_keys.size())
+  {
+    // No other values move.
+    this->unindexPosition(i);
+  }
+  else
+  {
+    this->invalidatePositions();
+  }
   myAtt->guardedLinks()->removeLink(m_keys[i]);
   m_keys.erase(m_keys.begin() + i);
   (*m_cache).erase((*m_cache).begin() + i);
   return true;
 }
 
+std::size_t ReferenceItem::removeValuesWithIds(const smtk::common::UUIDIndex<bool>& ids)
+{
+  const auto* def = static_cast<const ReferenceItemDefinition*>(this->definition().get());
+  AttributePtr myAtt = this->m_referencedAttribute.lock();
+  if (myAtt == nullptr)
+  {
+    return 0;
+  }
+
+  // Find the values to remove.
+  std::vector<std::size_t> doomed;
+  {
+    auto links = myAtt->guardedLinks();
+    for (std::size_t i = 0; i < m_keys.size(); ++i)
+    {
+      if (!m_keys[i].first.isNull() && ids.find(links->linkedObjectId(m_keys[i])))
+      {
+        doomed.push_back(i);
+      }
+    }
+  }
+  if (doomed.empty())
+  {
+    return 0;
+  }
+
+  // As with removeValue(), values are unset rather than removed when the item
+  // would otherwise hold fewer than its required number of values. The values
+  // nearest the end are the ones removed.
+  std::size_t required = def->numberOfRequiredValues();
+  std::size_t removable = m_keys.size() > required ? m_keys.size() - required : 0;
+  std::size_t numberToUnset = doomed.size() > removable ? doomed.size() - removable : 0;
+  for (std::size_t jj = 0; jj < numberToUnset; ++jj)
+  {
+    this->unset(doomed[jj]);
+  }
+
+  // Remove the rest in a single pass.
+  if (numberToUnset < doomed.size())
+  {
+    {
+      auto links = myAtt->guardedLinks();
+      for (std::size_t jj = numberToUnset; jj < doomed.size(); ++jj)
+      {
+        links->removeLink(m_keys[doomed[jj]]);
+      }
+    }
+    std::size_t next = numberToUnset;
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < m_keys.size(); ++i)
+    {
+      if (next < doomed.size() && doomed[next] == i)
+      {
+        ++next;
+        continue;
+      }
+      if (kept != i)
+      {
+        m_keys[kept] = m_keys[i];
+        (*m_cache)[kept] = std::move((*m_cache)[i]);
+      }
+      ++kept;
+    }
+    m_keys.resize(kept);
+    m_cache->resize(kept);
+
+    m_nextUnsetPos = -1;
+    for (std::size_t i = 0; i < kept; ++i)
+    {
+      if (m_keys[i].first.isNull())
+      {
+        m_nextUnsetPos = i;
+        break;
+      }
+    }
+  }
+  this->invalidatePositions();
+  return doomed.size();
+}
+
 void ReferenceItem::detachOwningResource()
 {
   AttributePtr myAtt = this->m_referencedAttribute.lock();
@@ -698,6 +812,7 @@ void ReferenceItem::detachOwningResource()
   // Flush keys
   m_keys.clear();
   m_keys.resize((*m_cache).size());
+  this->invalidatePositions();
 
   // Let the base class detach from the resource
   Item::detachOwningResource();
@@ -718,6 +833,7 @@ void ReferenceItem::reset()
 
   // Flush keys
   m_keys.clear();
+  this->invalidatePositions();
 
   (*m_cache).clear();
   if (this->numberOfRequiredValues() > 0)
@@ -866,17 +982,40 @@ ReferenceItem::const_iterator ReferenceItem::end() const
 std::ptrdiff_t ReferenceItem::find(const smtk::common::UUID& uid) const
 {
   AttributePtr myAtt = this->m_referencedAttribute.lock();
-  if (myAtt != nullptr)
+  if (myAtt == nullptr)
   {
+    return -1;
+  }
+  if (uid.isNull())
+  {
+    // Unset values have no linked object; they are not indexed.
     for (std::size_t i = 0; i < m_keys.size(); ++i)
     {
-      if (uid == myAtt->guardedLinks()->linkedObjectId(m_keys[i]))
+      if (myAtt->guardedLinks()->linkedObjectId(m_keys[i]).isNull())
       {
         return i;
       }
     }
+    return -1;
   }
-  return -1;
+
+  if (!m_positionsValid)
+  {
+    this->rebuildPositions();
+  }
+  const std::size_t* position = m_positions.find(uid);
+  if (position == nullptr)
+  {
+    return -1;
+  }
+  if (*position < m_keys.size() && this->linkedObjectId(*position) == uid)
+  {
+    return static_cast<std::ptrdiff_t>(*position);
+  }
+  // The attribute's links were changed behind the item's back.
+  this->rebuildPositions();
+  position = m_positions.find(uid);
+  return position ? static_cast<std::ptrdiff_t>(*position) : -1;
 }
 
 std::ptrdiff_t ReferenceItem::find(const PersistentObjectPtr& comp) const
@@ -913,6 +1052,7 @@ bool ReferenceItem::setDefinition(smtk::attribute::ConstItemDefinitionPtr adef)
     m_cache->resize(n);
     m_nextUnsetPos = 0;
   }
+  this->invalidatePositions();
   // Build the item's children
   def->buildChildrenItems(this);
 
@@ -1028,6 +1168,90 @@ void ReferenceItem::appendToCache(const PersistentObjectPtr& obj) const
   return assignToCache(i, obj);
 }
 
+smtk::common::UUID ReferenceItem::linkedObjectId(std::size_t i) const
+{
+  AttributePtr myAtt = this->m_referencedAttribute.lock();
+  if (myAtt == nullptr || i >= m_keys.size() || m_keys[i].first.isNull())
+  {
+    return smtk::common::UUID::null();
+  }
+  return myAtt->guardedLinks()->linkedObjectId(m_keys[i]);
+}
+
+void ReferenceItem::indexPosition(std::size_t i, const smtk::common::UUID& id) const
+{
+  if (!m_positionsValid || id.isNull())
+  {
+    return;
+  }
+  const std::size_t* position = m_positions.find(id);
+  if (position == nullptr)
+  {
+    m_positions.insert(id, i);
+    return;
+  }
+  ++m_duplicatePositions;
+  if (*position > i)
+  {
+    // Keep the first position, as find() reports.
+    m_positions.erase(id);
+    m_positions.insert(id, i);
+  }
+}
+
+void ReferenceItem::unindexPosition(std::size_t i) const
+{
+  if (!m_positionsValid)
+  {
+    return;
+  }
+  auto id = this->linkedObjectId(i);
+  if (id.isNull())
+  {
+    return;
+  }
+  const std::size_t* position = m_positions.find(id);
+  if (m_duplicatePositions > 0 || position == nullptr || *position != i)
+  {
+    // Another position may hold the object; let find() sort it out.
+    this->invalidatePositions();
+    return;
+  }
+  m_positions.erase(id);
+}
+
+void ReferenceItem::invalidatePositions() const
+{
+  m_positionsValid = false;
+  m_positions.clear();
+  m_duplicatePositions = 0;
+}
+
+void ReferenceItem::rebuildPositions() const
+{
+  m_positions.clear();
+  m_duplicatePositions = 0;
+  AttributePtr myAtt = this->m_referencedAttribute.lock();
+  if (myAtt != nullptr)
+  {
+    m_positions.reserve(m_keys.size());
+    auto links = myAtt->guardedLinks();
+    for (std::size_t i = 0; i < m_keys.size(); ++i)
+    {
+      if (m_keys[i].first.isNull())
+      {
+        continue;
+      }
+      auto id = links->linkedObjectId(m_keys[i]);
+      if (!id.isNull() && !m_positions.insert(id, i))
+      {
+        ++m_duplicatePositions;
+      }
+    }
+  }
+  m_positionsValid = true;
+}
+
 bool ReferenceItem::removeInvalidValues()
 {
   bool valuesRemoved = false;
@@ -13,6 +13,7 @@
 #include "smtk/attribute/Item.h"
 
 #include "smtk/common/UUID.h"
+#include "smtk/common/UUIDIndex.h"
 #include "smtk/resource/Lock.h"
 
 #include <iterator>
@@ -273,6 +274,16 @@ public:
     * from the array (reducing the number of values stored by 1).
     */
   bool removeValue(std::size_t i);
+  /**\brief Remove every occurrence of the objects in [\a vbegin, \a vend).
+    *
+    * This is equivalent to calling removeValue() with the position of each
+    * object, but the item's values are compacted once rather than once per
+    * object. Values are unset rather than removed when removing them would
+    * leave fewer than the required number of values.
+    * Returns the number of values removed or unset.
+    */
+  template<typename I>
+  std::size_t removeValues(I vbegin, I vend);
   /// Release the item's dependency on its parent attribute's Resource.
   void detachOwningResource() override;
   /// Clear the list of values and fill it with null entries up to the number of required values.
@@ -321,6 +332,9 @@ public:
 
   /**\brief Return the index of the first component with the given \a compId.
     *
+    * Positions are looked up in a hash of object ids that is kept current
+    * as values are set and appended (and rebuilt when values are removed
+    * or the item's links change), so this does not scan the item.
     */
   std::ptrdiff_t find(const smtk::common::UUID& compId) const;
   /**\brief Return the index of the given \a component.
@@ -399,6 +413,9 @@ protected:
   /// Construct a link between the attribute that owns this item and \a val.
   Key linkTo(const PersistentObjectPtr& val);
 
+  /// Remove the values whose objects are in \a ids (see removeValues()).
+  std::size_t removeValuesWithIds(const smtk::common::UUIDIndex<bool>& ids);
+
   bool isValidInternal(bool useCategories, const std::set<std::string>& categories) const override;
 
   std::vector<Key> m_keys;
@@ -429,6 +446,16 @@ private:
   void assignToCache(std::size_t i, const PersistentObjectPtr& obj) const;
   void appendToCache(const PersistentObjectPtr& obj) const;
 
+  /// Return the id of the object referenced at position \a i (or a null id).
+  smtk::common::UUID linkedObjectId(std::size_t i) const;
+  /// Record that the object \a id is referenced at position \a i.
+  void indexPosition(std::size_t i, const smtk::common::UUID& id) const;
+  /// Record that the object referenced at position \a i is about to be replaced.
+  void unindexPosition(std::size_t i) const;
+  /// Discard the position index; it is rebuilt by the next find().
+  void invalidatePositions() const;
+  void rebuildPositions() const;
+
   struct Cache;
   mutable std::unique_ptr<Cache> m_cache;
   /// Map of of all children items associated with the item
@@ -440,6 +467,11 @@ private:
   /// Indicates where the next Null location is.  If set to -1 then
   /// there are no null locations in the item.
   std::size_t m_nextUnsetPos;
+  /// The first position of each referenced object, by object id.
+  mutable smtk::common::UUIDIndex<std::size_t> m_positions;
+  mutable bool m_positionsValid{ false };
+  /// The number of set values whose object also appears at an earlier position.
+  mutable std::size_t m_duplicatePositions{ 0 };
 };
 
 template<>
@@ -500,6 +532,20 @@ bool ReferenceItem::appendValues(I vbegin, I vend)
   return this->setValues(vbegin, vend, this->numberOfValues());
 }
 
+template<typename I>
+std::size_t ReferenceItem::removeValues(I vbegin, I vend)
+{
+  smtk::common::UUIDIndex<bool> ids;
+  for (I it = vbegin; it != vend; ++it)
+  {
+    if (*it)
+    {
+      ids.insert((*it)->id(), true);
+    }
+  }
+  return ids.empty() ? 0 : this->removeValuesWithIds(ids);
+}
+
 template<typename I, typename T>
 bool ReferenceItem::setValuesVia(
   I vbegin,
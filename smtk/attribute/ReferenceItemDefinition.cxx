@@ -319,7 +319,7 @@ bool ReferenceItemDefinition::checkCategories(const smtk::resource::Component* c
   auto attRes = att->attributeResource();
   if (attRes && attRes->activeCategoriesEnabled())
   {
-    return att->categories().passes(attRes->activeCategories());
+    return att->categories().passes(attRes->activeCategoryMask());
   }
 
   return true;
@@ -444,6 +444,7 @@ bool ReferenceItemDefinition::addChildItemDefinition(smtk::attribute::ItemDefini
     return false;
   }
   m_itemDefs[cdef->name()] = cdef;
+  ItemDefinition::structureModified();
   return true;
 }
 
@@ -46,12 +46,14 @@ using QueryList = std::tuple<SelectionFootprint>;
 
 Resource::Resource(const smtk::common::UUID& myID, smtk::resource::ManagerPtr manager)
   : smtk::resource::DerivedFrom<Resource, smtk::geometry::Resource>(myID, manager)
+  , m_activeCategoryMask(m_categoryIndex.mask(m_activeCategories))
 {
   queries().registerQueries<QueryList>();
 }
 
 Resource::Resource(smtk::resource::ManagerPtr manager)
   : smtk::resource::DerivedFrom<Resource, smtk::geometry::Resource>(manager)
+  , m_activeCategoryMask(m_categoryIndex.mask(m_activeCategories))
 {
   queries().registerQueries<QueryList>();
 }
@@ -502,6 +504,11 @@ void Resource::finalizeDefinitions()
     std::set<std::string> catNames = it->second->categories().categoryNames();
     m_categories.insert(catNames.begin(), catNames.end());
   }
+  // Assign IDs to the category names up front so masks stay compact.
+  for (const auto& category : m_categories)
+  {
+    m_categoryIndex.insert(category);
+  }
 }
 
 void Resource::derivedDefinitions(
@@ -1113,6 +1120,7 @@ void Resource::setActiveCategoriesEnabled(bool mode)
 void Resource::setActiveCategories(const std::set<std::string>& cats)
 {
   m_activeCategories = cats;
+  m_activeCategoryMask = m_categoryIndex.mask(m_activeCategories);
 }
 
 bool Resource::passActiveCategoryCheck(const smtk::attribute::Categories::Set& cats) const
@@ -1130,7 +1138,7 @@ bool Resource::passActiveCategoryCheck(const smtk::attribute::Categories& cats)
   {
     return true;
   }
-  return cats.passes(m_activeCategories);
+  return cats.passes(m_activeCategoryMask);
 }
 
 const std::string& Resource::defaultNameSeparator() const
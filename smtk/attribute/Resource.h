@@ -25,6 +25,7 @@
 #include "smtk/attribute/Analyses.h"
 #include "smtk/attribute/AssociationRules.h"
 #include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/CategoryIndex.h"
 #include "smtk/attribute/Definition.h"
 #include "smtk/attribute/DirectoryInfo.h"
 #include "smtk/attribute/Evaluator.h"
@@ -234,6 +235,16 @@ public:
   const std::set<std::string>& activeCategories() const { return m_activeCategories; }
   ///@}
 
+  ///@{
+  ///\brief Return the active categories as a mask over categoryIndex().
+  ///
+  /// Checking Categories against the mask rather than activeCategories() avoids
+  /// comparing category names.
+  const CategoryIndex::Mask& activeCategoryMask() const { return m_activeCategoryMask; }
+  ///\brief Return the index that assigns IDs to the category names used by this resource.
+  CategoryIndex& categoryIndex() const { return m_categoryIndex; }
+  ///@}
+
   bool passActiveCategoryCheck(const smtk::attribute::Categories::Set& cats) const;
   bool passActiveCategoryCheck(const smtk::attribute::Categories& cats) const;
 
@@ -405,6 +416,8 @@ protected:
   std::set<std::string> m_categories;
   std::set<std::string> m_activeCategories;
   bool m_activeCategoriesEnabled = false;
+  mutable CategoryIndex m_categoryIndex;
+  CategoryIndex::Mask m_activeCategoryMask;
   smtk::attribute::Analyses m_analyses;
   std::map<std::string, smtk::view::ConfigurationPtr> m_views;
   std::map<std::string, std::map<std::string, smtk::view::Configuration::Component>> m_styles;
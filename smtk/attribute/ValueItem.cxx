@@ -630,6 +630,8 @@ std::vector<std::string> ValueItem::relevantEnums(
       auto aResource = myAttribute->attributeResource();
       if (aResource && aResource->activeCategoriesEnabled())
       {
+        CategoryIndex::Scope scope(
+          aResource->activeCategories(), aResource->activeCategoryMask());
         return def->relevantEnums(
           true, aResource->activeCategories(), includeReadAccess, readAccessLevel);
       }
@@ -184,6 +184,7 @@ bool ValueItemDefinition::addChildItemDefinition(smtk::attribute::ItemDefinition
     return false;
   }
   m_itemDefs[cdef->name()] = cdef;
+  ItemDefinition::structureModified();
   return true;
 }
 
@@ -481,6 +482,7 @@ bool ValueItemDefinition::addItemDefinition(smtk::attribute::ItemDefinitionPtr c
     return false;
   }
   m_itemDefs[cdef->name()] = cdef;
+  ItemDefinition::structureModified();
   return true;
 }
 
@@ -178,6 +178,7 @@ public:
     }
     item = SharedTypes::RawPointerType::New(idName);
     m_itemDefs[item->name()] = item;
+    ItemDefinition::structureModified();
     return item;
   }
 
@@ -10,6 +10,7 @@
 #include "jsonGroupItem.h"
 #include "smtk/PublicPointerDefs.h"
 #include "smtk/attribute/GroupItem.h"
+#include "smtk/attribute/GroupItemDefinition.h"
 #include "smtk/attribute/json/jsonHelperFunction.h"
 #include "smtk/attribute/json/jsonItem.h"
 #include "smtk/io/Logger.h"
@@ -21,6 +22,47 @@
 
 using json = nlohmann::json;
 
+namespace
+{
+// Columnar groups are written one column per child: each holds the values of
+// the child in every sub-group (with null in place of unset values).
+template<typename T>
+json columnToJson(const smtk::attribute::GroupItem& item, std::size_t ith)
+{
+  std::vector<T> values;
+  std::vector<bool> isSet;
+  item.columnValues(ith, values, &isSet);
+  json column = json::array();
+  for (std::size_t i = 0; i < values.size(); ++i)
+  {
+    if (isSet[i])
+    {
+      column.push_back(values[i]);
+    }
+    else
+    {
+      column.push_back(nullptr);
+    }
+  }
+  return column;
+}
+
+template<typename T>
+bool columnFromJson(const json& column, smtk::attribute::GroupItem& item, std::size_t ith)
+{
+  std::vector<T> values;
+  std::vector<bool> isSet;
+  values.reserve(column.size());
+  isSet.reserve(column.size());
+  for (const auto& value : column)
+  {
+    isSet.push_back(!value.is_null());
+    values.push_back(value.is_null() ? T() : value.get<T>());
+  }
+  return item.setColumnValues(ith, values, &isSet);
+}
+} // namespace
+
 /**\brief Provide a way to serialize GroupItemPtr
   */
 namespace smtk
@@ -40,6 +82,28 @@ SMTKCORE_EXPORT void to_json(json& j, const smtk::attribute::GroupItemPtr& itemP
   if (itemPtr->isExtensible())
   {
     j["NumberOfGroups"] = n;
+    if (itemPtr->isColumnar())
+    {
+      json columns = json::array();
+      const auto* def = static_cast<const GroupItemDefinition*>(itemPtr->definition().get());
+      for (size_t itemPGIter = 0; itemPGIter < m; itemPGIter++)
+      {
+        switch (def->itemDefinition(static_cast<int>(itemPGIter))->type())
+        {
+          case Item::IntType:
+            columns.push_back(columnToJson<int>(*itemPtr, itemPGIter));
+            break;
+          case Item::DoubleType:
+            columns.push_back(columnToJson<double>(*itemPtr, itemPGIter));
+            break;
+          default:
+            columns.push_back(columnToJson<std::string>(*itemPtr, itemPGIter));
+            break;
+        }
+      }
+      j["Columns"] = columns;
+      return;
+    }
   }
 
   // Optimize for number of required groups = 1
@@ -133,6 +197,41 @@ SMTKCORE_EXPORT void from_json(
   {
     return;
   }
+  auto columns = j.find("Columns");
+  if (columns != j.end())
+  {
+    const auto* def = static_cast<const GroupItemDefinition*>(itemPtr->definition().get());
+    for (size_t itemPGIter = 0; itemPGIter < m && itemPGIter < columns->size(); itemPGIter++)
+    {
+      const json& column = (*columns)[itemPGIter];
+      bool ok = column.size() == n;
+      if (ok)
+      {
+        switch (def->itemDefinition(static_cast<int>(itemPGIter))->type())
+        {
+          case Item::IntType:
+            ok = columnFromJson<int>(column, *itemPtr, itemPGIter);
+            break;
+          case Item::DoubleType:
+            ok = columnFromJson<double>(column, *itemPtr, itemPGIter);
+            break;
+          case Item::StringType:
+            ok = columnFromJson<std::string>(column, *itemPtr, itemPGIter);
+            break;
+          default:
+            ok = false;
+            break;
+        }
+      }
+      if (!ok)
+      {
+        smtkErrorMacro(
+          smtk::io::Logger::instance(),
+          "JSON column " << itemPGIter << " could not be set for group item: " << itemPtr->name());
+      }
+    }
+    return;
+  }
   // There are 2 formats - one is for any number of sub groups and the other
   // is a custon case is for 1 subGroup. They share the same logic here
   auto groupClusters = j.find("GroupClusters");
@@ -38,6 +38,10 @@ SMTKCORE_EXPORT void to_json(json& j, const smtk::attribute::GroupItemDefinition
       j["MaxNumberOfGroups"] = defPtr->maxNumberOfGroups();
     }
   }
+  if (defPtr->usesColumnarStorage())
+  {
+    j["Columnar"] = true;
+  }
 
   if (defPtr->isConditional())
   {
@@ -111,6 +115,12 @@ SMTKCORE_EXPORT void from_json(
     defPtr->setIsExtensible(*result);
   }
 
+  result = j.find("Columnar");
+  if (result != j.end())
+  {
+    defPtr->setUsesColumnarStorage(*result);
+  }
+
   result = j.find("IsConditional");
   if (result != j.end())
   {
@@ -0,0 +1,185 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/attribute/Categories.h"
+#include "smtk/attribute/CategoryIndex.h"
+#include "smtk/attribute/Resource.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <random>
+
+using namespace smtk::attribute;
+
+namespace
+{
+const std::vector<std::string> g_names = { "a", "b", "c", "d", "e", "f" };
+
+Categories::CombinationMode randomMode(std::mt19937& rng)
+{
+  return (rng() % 2) ? Categories::CombinationMode::And : Categories::CombinationMode::Or;
+}
+
+std::set<std::string> randomNames(std::mt19937& rng)
+{
+  std::set<std::string> result;
+  for (const auto& name : g_names)
+  {
+    if (rng() % 3 == 0)
+    {
+      result.insert(name);
+    }
+  }
+  return result;
+}
+
+Categories randomCategories(std::mt19937& rng)
+{
+  Categories result;
+  std::size_t numberOfStacks = 1 + rng() % 3;
+  for (std::size_t ii = 0; ii < numberOfStacks; ++ii)
+  {
+    Categories::Stack stack;
+    std::size_t depth = 1 + rng() % 3;
+    for (std::size_t jj = 0; jj < depth; ++jj)
+    {
+      Categories::Set set;
+      set.setCombinationMode(randomMode(rng));
+      set.setInclusions(randomNames(rng), randomMode(rng));
+      set.setExclusions(randomNames(rng), randomMode(rng));
+      Categories::CombinationMode mode =
+        (rng() % 4 == 0) ? Categories::CombinationMode::LocalOnly : randomMode(rng);
+      stack.append(mode, set);
+    }
+    result.insert(stack);
+  }
+  return result;
+}
+
+// Every subset of g_names.
+std::vector<std::set<std::string>> allInputs()
+{
+  std::vector<std::set<std::string>> result;
+  for (std::size_t bits = 0; bits < (std::size_t(1) << g_names.size()); ++bits)
+  {
+    std::set<std::string> input;
+    for (std::size_t ii = 0; ii < g_names.size(); ++ii)
+    {
+      if (bits & (std::size_t(1) << ii))
+      {
+        input.insert(g_names[ii]);
+      }
+    }
+    result.push_back(input);
+  }
+  return result;
+}
+
+void testMask()
+{
+  CategoryIndex index;
+  CategoryIndex::Mask empty = index.mask(std::set<std::string>());
+  CategoryIndex::Mask ab = index.mask({ "a", "b" });
+  CategoryIndex::Mask bc = index.mask({ "b", "c" });
+  CategoryIndex::Mask abc = index.mask({ "a", "b", "c" });
+  smtkTest(index.size() == 3, "Expected 3 names, found " << index.size() << ".");
+  smtkTest(empty.empty() && !ab.empty(), "Unexpected emptiness.");
+  smtkTest(ab.intersects(bc) && !empty.intersects(ab), "Unexpected intersection.");
+  smtkTest(ab.isSubsetOf(abc) && !ab.isSubsetOf(bc), "Unexpected containment.");
+  smtkTest(empty.isSubsetOf(ab), "The empty mask should be a subset of every mask.");
+  smtkTest(index.mask({ "b", "a" }) == ab, "Equal name sets should produce equal masks.");
+  smtkTest(index.insert("a") == 0, "IDs should not be reassigned.");
+
+  // Masks wider than a single word.
+  std::set<std::string> many;
+  for (int ii = 0; ii < 200; ++ii)
+  {
+    many.insert("category" + std::to_string(ii));
+  }
+  CategoryIndex::Mask wide = index.mask(many);
+  smtkTest(!ab.intersects(wide) && ab.isSubsetOf(abc), "Masks of differing width misbehave.");
+  smtkTest(!wide.isSubsetOf(abc), "A wide mask should not be a subset of a narrow one.");
+
+  CategoryIndex other;
+  smtkTest(other.serial() != index.serial(), "Each index should have its own serial.");
+}
+
+void testPasses()
+{
+  std::mt19937 rng(12345);
+  auto inputs = allInputs();
+  CategoryIndex index;
+  CategoryIndex otherIndex;
+  // Assign IDs in a different order in the second index.
+  otherIndex.insert("f");
+  otherIndex.insert("c");
+  for (int trial = 0; trial < 500; ++trial)
+  {
+    Categories cats = randomCategories(rng);
+    for (const auto& input : inputs)
+    {
+      bool expected = cats.passes(input);
+      CategoryIndex::Mask mask = index.mask(input);
+      smtkTest(
+        cats.passes(mask) == expected,
+        "Mask result differs for " << cats.convertToString() << " given " << input.size()
+                                   << " categories.");
+      smtkTest(cats.passes(otherIndex.mask(input)) == expected, "Second index result differs.");
+      {
+        CategoryIndex::Scope scope(input, mask);
+        smtkTest(cats.passes(input) == expected, "Scoped result differs.");
+      }
+      if (input.size() == 1)
+      {
+        smtkTest(
+          cats.passes(*input.begin()) == expected,
+          "Single category result differs for " << *input.begin() << ".");
+      }
+    }
+
+    // Modifying the categories must discard the compiled form.
+    Categories copy = cats;
+    copy.insert(randomCategories(rng));
+    for (const auto& input : inputs)
+    {
+      smtkTest(
+        copy.passes(index.mask(input)) == copy.passes(input), "Stale compiled categories used.");
+    }
+  }
+}
+
+void testResource()
+{
+  auto resource = Resource::create();
+  Categories::Set set;
+  set.setInclusions({ "a", "b" }, Categories::CombinationMode::And);
+  Categories::Stack stack;
+  stack.append(Categories::CombinationMode::LocalOnly, set);
+  Categories cats;
+  cats.insert(stack);
+
+  resource->setActiveCategoriesEnabled(true);
+  smtkTest(!resource->passActiveCategoryCheck(cats), "No active categories should fail.");
+  resource->setActiveCategories({ "a", "b", "c" });
+  smtkTest(
+    resource->activeCategoryMask() == resource->categoryIndex().mask({ "c", "b", "a" }),
+    "Active category mask does not match the active categories.");
+  smtkTest(resource->passActiveCategoryCheck(cats), "Expected {a, b, c} to pass.");
+  resource->setActiveCategories({ "a", "c" });
+  smtkTest(!resource->passActiveCategoryCheck(cats), "Expected {a, c} to fail.");
+}
+} // namespace
+
+int unitCategoryIndex(int /*unused*/, char* /*unused*/[])
+{
+  testMask();
+  testPasses();
+  testResource();
+  return 0;
+}
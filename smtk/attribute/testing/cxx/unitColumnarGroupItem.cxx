@@ -0,0 +1,216 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+/*!\file unitColumnarGroupItem.cxx - Unit tests for columnar group item storage. */
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/DoubleItem.h"
+#include "smtk/attribute/DoubleItemDefinition.h"
+#include "smtk/attribute/GroupItem.h"
+#include "smtk/attribute/GroupItemDefinition.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/IntItemDefinition.h"
+#include "smtk/attribute/Resource.h"
+#include "smtk/attribute/StringItem.h"
+#include "smtk/attribute/StringItemDefinition.h"
+#include "smtk/attribute/json/jsonResource.h"
+
+#include "smtk/io/AttributeReader.h"
+#include "smtk/io/AttributeWriter.h"
+#include "smtk/io/Logger.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <nlohmann/json.hpp>
+
+#include <string>
+
+using namespace smtk::attribute;
+
+namespace
+{
+// Build a definition with a columnar group "table" of (id: int, x: double, tag: string).
+ResourcePtr buildResource(bool columnar)
+{
+  auto resource = Resource::create();
+  auto def = resource->createDefinition("test");
+  auto group = def->addItemDefinition<GroupItemDefinition>("table");
+  group->setIsExtensible(true);
+  group->setNumberOfRequiredGroups(0);
+  group->setUsesColumnarStorage(columnar);
+  group->addItemDefinition<IntItemDefinition>("id")->setDefaultValue(-1);
+  auto x = group->addItemDefinition<DoubleItemDefinition>("x");
+  x->setMinRange(0.0, true);
+  group->addItemDefinition<StringItemDefinition>("tag")->setDefaultValue("none");
+  resource->finalizeDefinitions();
+  resource->createAttribute("att", def);
+  return resource;
+}
+
+GroupItemPtr table(const ResourcePtr& resource)
+{
+  return resource->findAttribute("att")->findGroup("table");
+}
+
+void fill(const GroupItemPtr& group, std::size_t n)
+{
+  std::vector<int> ids(n);
+  std::vector<double> xs(n);
+  std::vector<std::string> tags(n);
+  std::vector<bool> isSet(n, true);
+  for (std::size_t ii = 0; ii < n; ++ii)
+  {
+    ids[ii] = static_cast<int>(ii);
+    xs[ii] = 0.5 * ii;
+    tags[ii] = "tag " + std::to_string(ii);
+  }
+  isSet[3] = false;
+  smtkTest(group->setNumberOfGroups(n), "Could not resize the group.");
+  smtkTest(group->setColumnValues(0, ids), "Could not set ids.");
+  smtkTest(group->setColumnValues(1, xs, &isSet), "Could not set xs.");
+  smtkTest(group->setColumnValues(2, tags), "Could not set tags.");
+}
+
+void testDefinition()
+{
+  auto def = GroupItemDefinition::New("g");
+  def->addItemDefinition<IntItemDefinition>("i");
+  def->setUsesColumnarStorage(true);
+  smtkTest(!def->isColumnar(), "Non-extensible groups should not be columnar.");
+  def->setIsExtensible(true);
+  smtkTest(def->isColumnar(), "Expected a columnar definition.");
+  def->addItemDefinition<IntItemDefinition>("optional")->setIsOptional(true);
+  smtkTest(!def->isColumnar(), "Groups with optional children should not be columnar.");
+}
+
+void testColumns()
+{
+  auto resource = buildResource(true);
+  auto group = table(resource);
+  smtkTest(group->isColumnar(), "Expected a columnar group.");
+  smtkTest(group->numberOfGroups() == 0, "Expected no groups.");
+  const std::size_t n = 1000;
+  fill(group, n);
+
+  std::vector<int> ids;
+  std::vector<double> xs;
+  std::vector<std::string> tags;
+  std::vector<bool> isSet;
+  smtkTest(group->columnValues(0, ids) && ids.size() == n && ids[7] == 7, "Bad id column.");
+  smtkTest(group->columnValues(1, xs, &isSet) && !isSet[3] && isSet[4], "Bad x column.");
+  smtkTest(!group->columnValues(1, ids), "Column type should be checked.");
+  smtkTest(!group->isValid(), "Unset values should make the group invalid.");
+
+  // Items are built on demand and share their values with the columns.
+  auto tag = std::dynamic_pointer_cast<StringItem>(group->item(10, 2));
+  smtkTest(tag && tag->value() == "tag 10", "Item does not hold the column value.");
+  smtkTest(!group->item(3, 1)->isValid(), "Unset value should be unset in the item.");
+  tag->setValue("changed");
+  smtkTest(group->columnValues(2, tags) && tags[10] == "changed", "Item change not seen.");
+  smtkTest(group->findAs<IntItem>(20, "id")->value() == 20, "find() did not build items.");
+  smtkTest(group->releaseItems() == 2, "Expected the unreferenced sub-groups to be released.");
+  tag.reset();
+  smtkTest(group->releaseItems() == 1, "Expected the remaining sub-group to be released.");
+  smtkTest(group->columnValues(2, tags) && tags[10] == "changed", "Released value lost.");
+
+  // Invalid values are rejected.
+  xs.assign(n, 1.0);
+  xs[5] = -1.0;
+  smtkTest(!group->setColumnValues(1, xs), "Out-of-range value accepted.");
+  group->columnValues(1, xs, &isSet);
+  smtkTest(xs[5] == 2.5 && isSet[3] && xs[3] == 1.0, "Valid entries should still be set.");
+  smtkTest(group->isValid(), "All values are set.");
+
+  // Structural changes keep the columns aligned.
+  smtkTest(group->insertGroups(2, 2), "Could not insert groups.");
+  group->columnValues(0, ids, &isSet);
+  smtkTest(ids.size() == n + 2 && ids[2] == -1 && ids[4] == 2, "Inserted defaults misplaced.");
+  smtkTest(group->removeGroup(0), "Could not remove a group.");
+  smtkTest(group->rotate(0, 2), "Could not rotate groups.");
+  group->columnValues(0, ids);
+  smtkTest(
+    ids[0] == -1 && ids[1] == -1 && ids[2] == 1 && ids[3] == 2, "Unexpected order after rotation.");
+  smtkTest(group->findAs<IntItem>(2, "id")->value() == 1, "Item does not match rotation.");
+
+  // Assignment copies values whether or not items have been built.
+  auto other = buildResource(true);
+  ConstItemPtr source = group;
+  smtkTest(table(other)->assign(source), "Could not assign.");
+  std::vector<int> copied;
+  table(other)->columnValues(0, copied);
+  smtkTest(copied == ids, "Assignment did not copy values.");
+
+  group->reset();
+  smtkTest(group->numberOfGroups() == 0, "Reset should remove optional groups.");
+}
+
+void testIterators()
+{
+  auto columnar = buildResource(true);
+  auto itemized = buildResource(false);
+  fill(table(columnar), 5);
+  fill(table(itemized), 5);
+  smtkTest(!table(itemized)->isColumnar(), "Expected an itemized group.");
+
+  std::vector<std::string> a;
+  std::vector<std::string> b;
+  table(itemized)->columnValues(2, b);
+  for (const auto& items : *table(columnar))
+  {
+    a.push_back(std::dynamic_pointer_cast<StringItem>(items[2])->value());
+  }
+  smtkTest(a == b, "Iteration and columns disagree.");
+}
+
+void testIO()
+{
+  auto resource = buildResource(true);
+  fill(table(resource), 50);
+  table(resource)->findAs<StringItem>(4, "tag")->setValue("a, b; c");
+
+  smtk::io::AttributeWriter writer;
+  smtk::io::AttributeReader reader;
+  smtk::io::Logger log;
+  std::string xml1;
+  writer.writeContents(resource, xml1, log, false);
+  smtkTest(xml1.find("<Columns>") != std::string::npos, "Expected columns in the XML.");
+  auto xmlResource = Resource::create();
+  smtkTest(!reader.readContents(xmlResource, xml1, log), "Could not read XML.");
+  smtkTest(table(xmlResource)->isColumnar(), "Columnar flag lost in XML.");
+  std::string xml2;
+  writer.writeContents(xmlResource, xml2, log, false);
+  smtkTest(xml1 == xml2, "Expected XML exports to be equal.");
+
+  nlohmann::json json1;
+  smtk::attribute::to_json(json1, resource);
+  auto jsonResource = Resource::create();
+  smtk::attribute::from_json(json1, jsonResource);
+  nlohmann::json json2;
+  smtk::attribute::to_json(json2, jsonResource);
+  smtkTest(nlohmann::json::diff(json1, json2).empty(), "Expected JSON exports to be equal.");
+
+  std::vector<std::string> tags;
+  std::vector<double> xs;
+  std::vector<bool> isSet;
+  table(jsonResource)->columnValues(2, tags);
+  table(jsonResource)->columnValues(1, xs, &isSet);
+  smtkTest(tags[4] == "a, b; c", "String value lost.");
+  smtkTest(!isSet[3] && xs[5] == 2.5, "Double values lost.");
+}
+} // namespace
+
+int unitColumnarGroupItem(int /*unused*/, char* /*unused*/[])
+{
+  testDefinition();
+  testColumns();
+  testIterators();
+  testIO();
+  return 0;
+}
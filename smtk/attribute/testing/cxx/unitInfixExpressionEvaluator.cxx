@@ -9,6 +9,7 @@
 //=========================================================================
 /*!\file unitInfixExpressionEvaluator.cxx - Unit tests for InfixExpressionEvaluator. */
 
+#include "smtk/attribute/InfixExpressionCache.h"
 #include "smtk/attribute/InfixExpressionEvaluator.h"
 
 #include "smtk/attribute/DoubleItem.h"
@@ -313,6 +314,89 @@ void testNumberOfEvaluatableElements()
     "Expected to have 2 evalutable elements after appending a string.")
 }
 
+// Expressions are compiled once and recompiled only when edited.
+void testCompiledExpressionCache()
+{
+  smtk::attribute::ResourcePtr attRes = createResourceForTest();
+  smtk::attribute::DefinitionPtr infixExpDef = attRes->findDefinition("infixExpression");
+  smtk::attribute::AttributePtr expressionAtt = attRes->createAttribute("a", infixExpDef);
+  smtk::attribute::StringItemPtr expressionItem = expressionAtt->findString("expression");
+  expressionItem->setValue("2 * 3");
+
+  smtk::attribute::InfixExpressionCache& cache =
+    attRes->queries().cache<smtk::attribute::InfixExpressionCache>();
+  smtk::common::InfixExpressionError err;
+  auto program = cache.program(expressionItem, 0, err);
+  smtkTest(!!program, "Expected \"2 * 3\" to compile.");
+  smtkTest(
+    cache.program(expressionItem, 0, err) == program,
+    "Expected an unchanged expression to reuse its program.");
+
+  smtk::attribute::InfixExpressionEvaluator infixEvaluator(expressionAtt);
+  smtk::attribute::Evaluator::ValueType result;
+  smtk::io::Logger log;
+  smtkTest(
+    infixEvaluator.evaluate(
+      result, log, 0, smtk::attribute::Evaluator::DependentEvaluationMode::EVALUATE_DEPENDENTS),
+    "Failed to evaluate 2 * 3.");
+  smtkTest(boost::get<double>(result) == 6.0, "Incorrectly computed 2 * 3.");
+
+  expressionItem->setValue("2 * 4");
+  smtkTest(
+    cache.program(expressionItem, 0, err) != program,
+    "Expected an edited expression to be recompiled.");
+  smtkTest(
+    infixEvaluator.evaluate(
+      result, log, 0, smtk::attribute::Evaluator::DependentEvaluationMode::EVALUATE_DEPENDENTS),
+    "Failed to evaluate 2 * 4.");
+  smtkTest(boost::get<double>(result) == 8.0, "Evaluated a stale program for 2 * 4.");
+
+  expressionItem->setValue("2 *");
+  smtkTest(!cache.program(expressionItem, 0, err), "Expected \"2 *\" not to compile.");
+  smtkTest(
+    err == smtk::common::InfixExpressionError::ERROR_INVALID_SYNTAX,
+    "Expected a syntax error from \"2 *\".");
+}
+
+// Batch evaluation supplies per-row values for some subsymbols.
+void testBatchEvaluation()
+{
+  smtk::attribute::ResourcePtr attRes = createResourceForTest();
+  smtk::attribute::DefinitionPtr infixExpDef = attRes->findDefinition("infixExpression");
+  smtk::attribute::AttributePtr expressionA = attRes->createAttribute("a", infixExpDef);
+  smtk::attribute::AttributePtr expressionB = attRes->createAttribute("b", infixExpDef);
+  smtk::attribute::AttributePtr expressionT = attRes->createAttribute("t", infixExpDef);
+
+  expressionA->findString("expression")->setValue("{b} * {t} + {b}");
+  expressionB->findString("expression")->setValue("10");
+  expressionT->findString("expression")->setValue("0");
+
+  const std::size_t numberOfRows = 1000;
+  std::map<std::string, std::vector<double>> symbolValues;
+  std::vector<double>& t = symbolValues["t"];
+  for (std::size_t ii = 0; ii < numberOfRows; ++ii)
+  {
+    t.push_back(static_cast<double>(ii) / 10.0);
+  }
+
+  smtk::attribute::InfixExpressionEvaluator infixEvaluator(expressionA);
+  std::vector<double> results;
+  smtk::io::Logger log;
+  smtkTest(
+    infixEvaluator.evaluateBatch(results, log, symbolValues), "Failed to evaluate a batch.");
+  smtkTest(results.size() == numberOfRows, "Expected one result per row.");
+  for (std::size_t ii = 0; ii < numberOfRows; ++ii)
+  {
+    smtkTest(results[ii] == 10.0 * t[ii] + 10.0, "Incorrect result for row " << ii << ".");
+  }
+
+  t.push_back(0.0);
+  symbolValues["b"] = std::vector<double>(numberOfRows, 1.0);
+  smtkTest(
+    !infixEvaluator.evaluateBatch(results, log, symbolValues),
+    "Expected rows of mismatched length to fail.");
+}
+
 int unitInfixExpressionEvaluator(int /*argc*/, char** const /*argv*/)
 {
   testSimpleEvaluation();
@@ -325,6 +409,8 @@ int unitInfixExpressionEvaluator(int /*argc*/, char** const /*argv*/)
   testSetMultipleExpressionsOnSingleAttribute();
   testDoesEvaluate();
   testNumberOfEvaluatableElements();
+  testCompiledExpressionCache();
+  testBatchEvaluation();
 
   return 0;
 }
@@ -0,0 +1,177 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+/*!\file unitItemLookup.cxx - Unit tests for precomputed item lookups. */
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/DoubleItem.h"
+#include "smtk/attribute/DoubleItemDefinition.h"
+#include "smtk/attribute/GroupItem.h"
+#include "smtk/attribute/GroupItemDefinition.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/IntItemDefinition.h"
+#include "smtk/attribute/ItemAccessor.h"
+#include "smtk/attribute/Resource.h"
+#include "smtk/attribute/StringItem.h"
+#include "smtk/attribute/StringItemDefinition.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+using namespace smtk::attribute;
+
+namespace
+{
+// Build a definition with items
+//   a           (double)
+//   g           (group)   : x (int), dup (string), 7 (int)
+//   v           (string)  : c1 (double, active for "one"), c2 (group, active for "two")
+//     c2        (group)   : dup (int), deep (double)
+DefinitionPtr buildDefinition(const ResourcePtr& resource)
+{
+  auto def = resource->createDefinition("test");
+  def->addItemDefinition<DoubleItemDefinition>("a");
+  auto group = def->addItemDefinition<GroupItemDefinition>("g");
+  group->addItemDefinition<IntItemDefinition>("x");
+  group->addItemDefinition<StringItemDefinition>("dup");
+  group->addItemDefinition<IntItemDefinition>("7");
+
+  auto value = def->addItemDefinition<StringItemDefinition>("v");
+  value->addDiscreteValue("one");
+  value->addDiscreteValue("two");
+  value->addItemDefinition<DoubleItemDefinition>("c1");
+  auto nested = value->addItemDefinition<GroupItemDefinition>("c2");
+  nested->addItemDefinition<IntItemDefinition>("dup");
+  nested->addItemDefinition<DoubleItemDefinition>("deep");
+  value->addConditionalItem("one", "c1");
+  value->addConditionalItem("two", "c2");
+  value->setDefaultDiscreteIndex(0);
+  resource->finalizeDefinitions();
+  return def;
+}
+
+void testFind()
+{
+  auto resource = Resource::create();
+  auto def = buildDefinition(resource);
+  auto att = resource->createAttribute("att", def);
+  auto group = att->findGroup("g");
+  auto value = att->findString("v");
+  smtkTest(group && value, "Could not find top-level items.");
+
+  const auto& lookup = def->itemLookup();
+  smtkTest(lookup.isComplete(), "Lookup should know every item.");
+  smtkTest(lookup.findName("x") && lookup.findName("x")->unique, "Expected a unique entry for x.");
+  smtkTest(lookup.findName("dup") && !lookup.findName("dup")->unique, "Expected dup to be shared.");
+  smtkTest(!lookup.findName("nope"), "Unexpected entry.");
+  smtkTest(&def->itemLookup() == &lookup, "Lookup rebuilt without changes.");
+
+  // Children of groups are found in the first group.
+  smtkTest(att->find("x") == group->item(0, 0), "Could not find x.");
+  smtkTest(att->findInt("x") == group->item(0, 0), "Could not find x as an int.");
+  smtkTest(!att->find("x", IMMEDIATE), "IMMEDIATE searches should not include children.");
+  smtkTest(att->find("x", IMMEDIATE_ACTIVE) == group->item(0, 0), "Could not find x (2).");
+  smtkTest(!att->find("nope"), "Found a nonexistent item.");
+  smtkTest(att->find("dup") == group->item(0, 1), "Shared names should match the first item.");
+
+  // Conditional children follow the discrete value.
+  auto c1 = value->childrenItems().at("c1");
+  auto c2 = std::dynamic_pointer_cast<GroupItem>(value->childrenItems().at("c2"));
+  smtkTest(att->find("c1") == c1, "Active child c1 not found.");
+  smtkTest(!att->find("c2"), "Inactive child c2 found.");
+  smtkTest(att->find("c2", RECURSIVE) == c2, "RECURSIVE should find inactive children.");
+  smtkTest(!att->find("deep"), "Child of inactive child found.");
+  value->setDiscreteIndex(1);
+  smtkTest(!att->find("c1"), "Inactive child c1 found.");
+  smtkTest(att->find("c2") == c2, "Active child c2 not found.");
+  smtkTest(att->find("deep") == c2->item(0, 1), "Nested child not found.");
+  smtkTest(!att->find("deep", IMMEDIATE_ACTIVE), "IMMEDIATE_ACTIVE should stop at depth 2.");
+
+  // Groups without entries have no children to find.
+  group->setNumberOfGroups(0);
+  smtkTest(!att->find("x"), "Found x with no groups.");
+  group->setNumberOfGroups(1);
+  smtkTest(att->find("x") == group->item(0, 0), "Could not find x after adding a group.");
+
+  // Paths.
+  smtkTest(att->itemAtPath("g/x") == group->item(0, 0), "Could not find g/x.");
+  smtkTest(att->itemAtPath("/g/x") == group->item(0, 0), "Could not find /g/x.");
+  smtkTest(att->itemAtPath("g/0/x") == group->item(0, 0), "Could not find g/0/x.");
+  smtkTest(!att->itemAtPath("g/7"), "Integer names should be taken as group indices.");
+  smtkTest(att->itemAtPath("v/c2/deep", "/", true) == c2->item(0, 1), "Could not find v/c2/deep.");
+  value->setDiscreteIndex(0);
+  smtkTest(!att->itemAtPath("v/c2/deep", "/", true), "Found inactive v/c2/deep.");
+  smtkTest(att->itemAtPath("v/c2/deep") == c2->item(0, 1), "Could not find v/c2/deep (2).");
+  smtkTest(att->itemAtPath("v.c1", ".") == c1, "Could not find v.c1.");
+}
+
+void testAccessor()
+{
+  auto resource = Resource::create();
+  auto def = buildDefinition(resource);
+  ItemAccessor<IntItem> x(def, "x");
+  ItemAccessor<DoubleItem> c1(def, "c1");
+  ItemAccessor<Item> dup(def, "dup");
+  ItemAccessor<DoubleItem> wrongType(def, "x");
+  for (int ii = 0; ii < 10; ++ii)
+  {
+    auto att = resource->createAttribute(def);
+    if (ii % 2)
+    {
+      att->findString("v")->setDiscreteIndex(1);
+    }
+    smtkTest(x(att) && x(att) == att->findInt("x"), "Accessor did not find x.");
+    smtkTest(c1(att) == att->findDouble("c1"), "Accessor result for c1 differs.");
+    smtkTest(dup(att) == att->find("dup"), "Accessor result for dup differs.");
+    smtkTest(!wrongType(att), "Accessor should check the item type.");
+    ConstAttributePtr constAtt = att;
+    smtkTest(x(constAtt) == att->findInt("x"), "Const accessor did not find x.");
+  }
+
+  // Attributes of derived definitions are searched.
+  auto derived = resource->createDefinition("derived", def);
+  derived->addItemDefinition<IntItemDefinition>("extra");
+  auto att = resource->createAttribute(derived);
+  smtkTest(x(att) == att->findInt("x"), "Accessor did not find x in a derived attribute.");
+}
+
+void testModifiedDefinition()
+{
+  auto resource = Resource::create();
+  auto def = buildDefinition(resource);
+  auto before = resource->createAttribute(def);
+  const ItemLookup* original = &def->itemLookup();
+
+  // Changing an unrelated definition keeps the lookup.
+  auto other = resource->createDefinition("other");
+  other->addItemDefinition<IntItemDefinition>("i");
+  smtkTest(&def->itemLookup() == original, "Lookup replaced by an unrelated change.");
+
+  // Adding an item to a nested group rebuilds it.
+  auto group = std::dynamic_pointer_cast<GroupItemDefinition>(
+    def->itemDefinition(def->findItemPosition("g")));
+  group->addItemDefinition<IntItemDefinition>("z");
+  smtkTest(&def->itemLookup() != original, "Lookup not rebuilt.");
+
+  auto after = resource->createAttribute(def);
+  smtkTest(after->find("z") != nullptr, "New item not found.");
+  smtkTest(before->find("z") == nullptr, "Item found in an attribute built before it existed.");
+  smtkTest(before->find("x") == before->findGroup("g")->item(0, 0), "Old attribute lookup failed.");
+  ItemAccessor<IntItem> z(def, "z");
+  smtkTest(z(after) && !z(before), "Accessor misbehaves after a change.");
+}
+} // namespace
+
+int unitItemLookup(int /*unused*/, char* /*unused*/[])
+{
+  testFind();
+  testAccessor();
+  testModifiedDefinition();
+  return 0;
+}
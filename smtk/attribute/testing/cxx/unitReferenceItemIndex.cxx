@@ -0,0 +1,144 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+/*!\file unitReferenceItemIndex.cxx - Unit tests for ReferenceItem position lookups. */
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/ComponentItem.h"
+#include "smtk/attribute/ComponentItemDefinition.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/Resource.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <vector>
+
+using namespace smtk::attribute;
+
+namespace
+{
+// The linear search that find() used to perform.
+std::ptrdiff_t scan(const ComponentItemPtr& item, const smtk::common::UUID& uid)
+{
+  for (std::size_t i = 0; i < item->numberOfValues(); ++i)
+  {
+    if (item->isSet(i) && item->value(i) && item->value(i)->id() == uid)
+    {
+      return static_cast<std::ptrdiff_t>(i);
+    }
+  }
+  return -1;
+}
+
+void compare(
+  const ComponentItemPtr& item,
+  const std::vector<AttributePtr>& targets,
+  const std::string& when)
+{
+  for (const auto& target : targets)
+  {
+    smtkTest(
+      item->find(target->id()) == scan(item, target->id()),
+      "Position of " << target->name() << " differs from a scan " << when << ".");
+  }
+}
+} // namespace
+
+int unitReferenceItemIndex(int /*unused*/, char* /*unused*/[])
+{
+  auto resource = Resource::create();
+  auto targetDef = resource->createDefinition("target");
+  auto holderDef = resource->createDefinition("holder");
+  auto refsDef = holderDef->addItemDefinition<ComponentItemDefinition>("refs");
+  refsDef->setIsExtensible(true);
+  refsDef->setNumberOfRequiredValues(0);
+  refsDef->setMaxNumberOfValues(0);
+  refsDef->setAcceptsEntries(
+    smtk::common::typeName<Resource>(), Resource::createAttributeQuery(targetDef), true);
+  resource->finalizeDefinitions();
+
+  std::vector<AttributePtr> targets;
+  for (int ii = 0; ii < 64; ++ii)
+  {
+    targets.push_back(resource->createAttribute(targetDef));
+  }
+  auto holder = resource->createAttribute(holderDef);
+  auto refs = holder->findComponent("refs");
+  smtkTest(!!refs, "No reference item.");
+
+  compare(refs, targets, "when empty");
+  for (std::size_t ii = 0; ii < targets.size(); ii += 2)
+  {
+    smtkTest(refs->appendValue(targets[ii]), "Could not append " << targets[ii]->name());
+  }
+  compare(refs, targets, "after appending");
+  for (std::size_t ii = 0; ii < targets.size(); ii += 2)
+  {
+    smtkTest(
+      refs->find(targets[ii]) == static_cast<std::ptrdiff_t>(ii / 2),
+      "Unexpected position for " << targets[ii]->name());
+    smtkTest(refs->contains(targets[ii]), "Item should contain " << targets[ii]->name());
+    smtkTest(
+      !refs->contains(targets[ii + 1]), "Item should not contain " << targets[ii + 1]->name());
+  }
+
+  // Appending a member without duplicates does nothing.
+  std::size_t count = refs->numberOfValues();
+  smtkTest(refs->appendValue(targets[4], false), "Could not append a present value.");
+  smtkTest(refs->numberOfValues() == count, "Duplicate appended.");
+  // Duplicates report the first position.
+  smtkTest(refs->appendValue(targets[4]), "Could not append a duplicate.");
+  compare(refs, targets, "after appending a duplicate");
+
+  // Overwriting and unsetting values.
+  smtkTest(refs->setValue(0, targets[1]), "Could not overwrite a value.");
+  compare(refs, targets, "after overwriting");
+  refs->unset(1);
+  compare(refs, targets, "after unsetting");
+  smtkTest(refs->appendValue(targets[3]), "Could not fill an unset value.");
+  smtkTest(refs->find(targets[3]) == 1, "Unset value was not reused.");
+  compare(refs, targets, "after filling an unset value");
+
+  // Removing values shifts the positions of those after them.
+  smtkTest(refs->removeValue(3), "Could not remove a value.");
+  compare(refs, targets, "after removing a value");
+  smtkTest(refs->removeValue(refs->numberOfValues() - 1), "Could not remove the last value.");
+  compare(refs, targets, "after removing the last value");
+
+  // Bulk removal.
+  std::vector<AttributePtr> doomed;
+  for (std::size_t ii = 0; ii < targets.size(); ii += 3)
+  {
+    doomed.push_back(targets[ii]);
+  }
+  std::size_t present = 0;
+  for (const auto& target : doomed)
+  {
+    present += refs->contains(target) ? 1 : 0;
+  }
+  count = refs->numberOfValues();
+  std::size_t removed = refs->removeValues(doomed.begin(), doomed.end());
+  smtkTest(removed == present, "Removed " << removed << " values, expected " << present << ".");
+  smtkTest(refs->numberOfValues() == count - removed, "Unexpected number of values.");
+  for (const auto& target : doomed)
+  {
+    smtkTest(!refs->contains(target), "Removed value " << target->name() << " still present.");
+  }
+  compare(refs, targets, "after bulk removal");
+
+  // Links removed elsewhere are noticed.
+  auto id = refs->value(0)->id();
+  smtkTest(refs->find(id) == 0, "Expected a unique value at position 0.");
+  holder->guardedLinks()->removeLink(refs->objectKey(0));
+  smtkTest(refs->find(id) == -1, "Value with a removed link was found.");
+
+  refs->reset();
+  compare(refs, targets, "after reset");
+  return 0;
+}
@@ -11,6 +11,7 @@
 
 #include "smtk/common/CompilerInformation.h"
 
+#include <fstream>
 #include <map>
 
 #include <sys/stat.h>
@@ -43,12 +44,133 @@ struct Archive::Internals
   {
   }
 
+  // Return the archived files' paths and sizes, reading them from the
+  // archive's headers the first time they are requested.
+  const std::map<std::string, la_int64_t>& members() const;
+
+  // Extract a single file into a temporary directory and return its location.
+  std::string extractMember(const std::string& archivedFilePath);
+
   std::string archivePath;
   std::map<std::string, std::string> filePaths;
+  std::set<std::string> compressed;
   bool archived;
   mutable std::set<std::string> temporaryDirectories;
+
+  // Files extracted individually (see location()). They are not written by
+  // archive() since the remaining files have not been extracted.
+  std::map<std::string, std::string> extracted;
+  std::string extractionDirectory;
+
+  mutable std::map<std::string, la_int64_t> memberSizes;
+  mutable bool indexed = false;
 };
 
+namespace
+{
+// Open an archive for reading, returning nullptr if it cannot be read.
+struct archive* openArchive(const std::string& archivePath)
+{
+  struct archive* a = archive_read_new();
+  archive_read_support_filter_all(a);
+  archive_read_support_format_all(a);
+  if (archive_read_open_filename(a, archivePath.c_str(), 10240) != ARCHIVE_OK)
+  {
+    archive_read_free(a);
+    return nullptr;
+  }
+  return a;
+}
+
+// Advance an archive opened for reading to the header of a file. The data of
+// the files before it is skipped rather than decompressed where the format
+// allows it.
+bool seekMember(struct archive* a, const std::string& archivedFilePath)
+{
+  struct archive_entry* entry;
+  while (archive_read_next_header(a, &entry) == ARCHIVE_OK)
+  {
+    if (archivedFilePath == archive_entry_pathname(entry))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+} // namespace
+
+const std::map<std::string, la_int64_t>& Archive::Internals::members() const
+{
+  if (!this->indexed && this->archived)
+  {
+    this->indexed = true;
+    struct archive* a = openArchive(this->archivePath);
+    if (a)
+    {
+      struct archive_entry* entry;
+      while (archive_read_next_header(a, &entry) == ARCHIVE_OK)
+      {
+        this->memberSizes[archive_entry_pathname(entry)] = archive_entry_size(entry);
+      }
+      archive_read_free(a);
+    }
+  }
+  return this->memberSizes;
+}
+
+std::string Archive::Internals::extractMember(const std::string& archivedFilePath)
+{
+  if (this->members().find(archivedFilePath) == this->memberSizes.end())
+  {
+    return std::string();
+  }
+
+  struct archive* a = openArchive(this->archivePath);
+  if (!a)
+  {
+    return std::string();
+  }
+  if (!seekMember(a, archivedFilePath))
+  {
+    archive_read_free(a);
+    return std::string();
+  }
+
+  if (this->extractionDirectory.empty())
+  {
+    boost::filesystem::path temp =
+      boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    if (!boost::filesystem::create_directories(temp))
+    {
+      archive_read_free(a);
+      return std::string();
+    }
+    this->extractionDirectory = temp.string();
+    this->temporaryDirectories.insert(this->extractionDirectory);
+  }
+
+  boost::filesystem::path fullOutputPath =
+    boost::filesystem::path(this->extractionDirectory) / boost::filesystem::path(archivedFilePath);
+  boost::system::error_code err;
+  boost::filesystem::create_directories(fullOutputPath.parent_path(), err);
+
+  std::ofstream file(fullOutputPath.string(), std::ios::binary);
+  char buff[8192];
+  la_ssize_t len = 0;
+  while (file && (len = archive_read_data(a, buff, sizeof(buff))) > 0)
+  {
+    file.write(buff, len);
+  }
+  archive_read_free(a);
+  if (!file || len < 0)
+  {
+    return std::string();
+  }
+
+  this->extracted[archivedFilePath] = fullOutputPath.string();
+  return fullOutputPath.string();
+}
+
 Archive::Archive(const std::string& archivePath)
   : m_internals(
       new Internals(archivePath, boost::filesystem::exists(boost::filesystem::path(archivePath))))
@@ -72,7 +194,7 @@ bool Archive::isArchive(const std::string& archivePath)
   return !Archive(archivePath).contents().empty();
 }
 
-bool Archive::insert(const std::string& filePath, const std::string& archivedPath)
+bool Archive::insert(const std::string& filePath, const std::string& archivedPath, bool compress)
 {
   if (m_internals->filePaths.find(archivedPath) != m_internals->filePaths.end())
   {
@@ -80,6 +202,10 @@ bool Archive::insert(const std::string& filePath, const std::string& archivedPat
   }
 
   m_internals->filePaths[archivedPath] = filePath;
+  if (compress)
+  {
+    m_internals->compressed.insert(archivedPath);
+  }
   return true;
 }
 
@@ -94,19 +220,31 @@ bool Archive::archive() const
 
   a = archive_write_new();
 
-  // do not use compression
-  archive_write_add_filter_none(a);
-
-  // from libarchive's doc
-  // (https://github.com/libarchive/libarchive/wiki/Examples):
-  //
-  // Libarchive's "pax restricted" format is a tar format that uses pax
-  // extensions only when absolutely necessary. Most of the time, it will write
-  // plain ustar entries. This is the recommended tar format for most uses. You
-  // should explicitly use ustar format only when you have to create archives
-  // that will be readable on older systems; you should explicitly request pax
-  // format only when you need to preserve as many attributes as possible.
-  archive_write_set_format_pax_restricted(a);
+  // Compression is requested per file, which tar cannot express (a tar file
+  // can only be compressed as a whole). Zip compresses each file separately,
+  // so members that were not marked for compression are simply stored and
+  // can still be read without decompressing the others.
+  const bool zip = !m_internals->compressed.empty();
+  if (zip)
+  {
+    archive_write_set_format_zip(a);
+  }
+  else
+  {
+    // do not use compression
+    archive_write_add_filter_none(a);
+
+    // from libarchive's doc
+    // (https://github.com/libarchive/libarchive/wiki/Examples):
+    //
+    // Libarchive's "pax restricted" format is a tar format that uses pax
+    // extensions only when absolutely necessary. Most of the time, it will write
+    // plain ustar entries. This is the recommended tar format for most uses. You
+    // should explicitly use ustar format only when you have to create archives
+    // that will be readable on older systems; you should explicitly request pax
+    // format only when you need to preserve as many attributes as possible.
+    archive_write_set_format_pax_restricted(a);
+  }
 
   // check that the archive can be created
   if (archive_write_open_filename(a, m_internals->archivePath.c_str()) != ARCHIVE_OK)
@@ -139,6 +277,18 @@ bool Archive::archive() const
     // file permissions: user can read/write, everybody else can read
     archive_entry_set_perm(entry, 0644);
 
+    if (zip)
+    {
+      if (m_internals->compressed.find(filepath.first) != m_internals->compressed.end())
+      {
+        archive_write_zip_set_compression_deflate(a);
+      }
+      else
+      {
+        archive_write_zip_set_compression_store(a);
+      }
+    }
+
     // write the file's description into the archive
     archive_write_header(a, entry);
 
@@ -150,11 +300,11 @@ bool Archive::archive() const
 #endif
 
     // transfer the file's contents into the archive
-    len = read(fd, buff, sizeof(buff));
+    len = ::read(fd, buff, sizeof(buff));
     while (len > 0)
     {
       archive_write_data(a, buff, len);
-      len = read(fd, buff, sizeof(buff));
+      len = ::read(fd, buff, sizeof(buff));
     }
 
 #ifdef _WIN32
@@ -226,7 +376,8 @@ bool Archive::extract()
   // instance
   a = archive_read_new();
 
-  // read all supported filter types
+  // read all supported filter and format types
+  archive_read_support_filter_all(a);
   archive_read_support_format_all(a);
 
   // the second "archive" is a disk archive (i.e. it restores the files to disk)
@@ -238,6 +389,8 @@ bool Archive::extract()
   // open the first archive
   if ((r = archive_read_open_filename(a, m_internals->archivePath.c_str(), 10240)))
   {
+    archive_read_free(a);
+    archive_write_free(ext);
     return false;
   }
 
@@ -324,26 +477,13 @@ std::set<std::string> Archive::contents() const
   std::set<std::string> filenames;
 
   // if the contents of the archive are not yet extracted, we can gather the
-  // archive's contained file information from the archive's header
+  // archive's contained file information from the archive's headers (which
+  // are only read once)
   if (m_internals->archived)
   {
-    struct archive* a;
-    struct archive_entry* entry;
-
-    a = archive_read_new();
-    archive_read_support_filter_all(a);
-    archive_read_support_format_all(a);
-
-    // open the archive for query
-    if (archive_read_open_filename(a, m_internals->archivePath.c_str(), 10240) == ARCHIVE_OK)
+    for (const auto& member : m_internals->members())
     {
-      // for each file, extract its filename and copy it to our list of
-      // filenames
-      while (archive_read_next_header(a, &entry) == ARCHIVE_OK)
-      {
-        filenames.insert(archive_entry_pathname(entry));
-      }
-      archive_read_free(a);
+      filenames.insert(member.first);
     }
   }
 
@@ -357,6 +497,72 @@ std::set<std::string> Archive::contents() const
   return filenames;
 }
 
+bool Archive::read(const std::string& archivedFilePath, std::string& contents) const
+{
+  contents.clear();
+
+  // files that are already on disk are read directly
+  const std::string* location = nullptr;
+  auto filepath = m_internals->filePaths.find(archivedFilePath);
+  if (filepath != m_internals->filePaths.end())
+  {
+    location = &filepath->second;
+  }
+  else
+  {
+    filepath = m_internals->extracted.find(archivedFilePath);
+    if (filepath != m_internals->extracted.end())
+    {
+      location = &filepath->second;
+    }
+  }
+  if (location)
+  {
+    std::ifstream file(*location, std::ios::binary);
+    if (!file)
+    {
+      return false;
+    }
+    contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return !file.bad();
+  }
+
+  if (!m_internals->archived)
+  {
+    return false;
+  }
+  const auto& members = m_internals->members();
+  auto member = members.find(archivedFilePath);
+  if (member == members.end())
+  {
+    return false;
+  }
+
+  struct archive* a = openArchive(m_internals->archivePath);
+  if (!a)
+  {
+    return false;
+  }
+  if (!seekMember(a, archivedFilePath))
+  {
+    archive_read_free(a);
+    return false;
+  }
+
+  if (member->second > 0)
+  {
+    contents.reserve(static_cast<std::size_t>(member->second));
+  }
+  char buff[8192];
+  la_ssize_t len;
+  while ((len = archive_read_data(a, buff, sizeof(buff))) > 0)
+  {
+    contents.append(buff, static_cast<std::size_t>(len));
+  }
+  archive_read_free(a);
+  return len == 0;
+}
+
 std::ifstream Archive::get(const std::string& archivedFilePath)
 {
 #if !defined(SMTK_GCC) || (__GNUC__ >= 5)
@@ -383,12 +589,6 @@ void Archive::get(const std::string& archivedFilePath, std::ifstream& stream)
 
 std::string Archive::location(const std::string& archivedFilePath)
 {
-  // if there are any files archived, extract them first
-  if (m_internals->archived)
-  {
-    this->extract();
-  }
-
   // find the file whose filename corresponds to the query
   auto filepath = m_internals->filePaths.find(archivedFilePath);
 
@@ -398,6 +598,17 @@ std::string Archive::location(const std::string& archivedFilePath)
     return filepath->second;
   }
 
+  // if the archive has not been extracted, extract only the requested file
+  if (m_internals->archived)
+  {
+    filepath = m_internals->extracted.find(archivedFilePath);
+    if (filepath != m_internals->extracted.end())
+    {
+      return filepath->second;
+    }
+    return m_internals->extractMember(archivedFilePath);
+  }
+
   // we were unable to find an associated file; return an empty string
   return std::string();
 }
@@ -33,6 +33,13 @@ namespace common
   * the archive, and acquire file streams to these files by accessing them via
   * their name. An archive can be considered a directory containing files;
   * as such, each file in the archive must be assigned a unique path.
+  *
+  * Files in an existing archive can be read without extracting the archive:
+  * read() copies a single file into memory and location() (along with get())
+  * extracts only the requested file. The archive's table of contents is
+  * read once and reused. Access is not random, however: each call reopens
+  * the archive and scans its entry headers in order until the requested
+  * file is found, so reading many files one at a time costs a scan apiece.
   */
 class SMTKCORE_EXPORT Archive
 {
@@ -47,12 +54,17 @@ public:
 
   /// Add a file (identified by its path) to the archive. Once in the archive,
   /// a stream to the file is accessible using the file's archived path. Each
-  /// file in the archive must therefore have a unique path. Return true upon
-  /// success.
-  bool insert(const std::string& filePath, const std::string& archivedPath);
+  /// file in the archive must therefore have a unique path. If \a compress is
+  /// true, the file is compressed within the archive (see archive()). Return
+  /// true upon success.
+  bool insert(const std::string& filePath, const std::string& archivedPath, bool compress = false);
 
   /// Serialize the files that comprise the archive to a contiguous block of
   /// memory on disk (located at \a archivePath ). Return true upon success.
+  ///
+  /// Archives are written in the (uncompressed) tar format unless some file
+  /// was inserted with compression requested. In that case a zip archive is
+  /// written in which only the requested files are compressed.
   bool archive() const;
 
   /// Deserialize the files that comprise the archive into a temporary
@@ -65,6 +77,13 @@ public:
   // can be called without requiring that the archive be extracted.
   std::set<std::string> contents() const;
 
+  /// Copy the contents of a file in the archive, accessed by its archived file
+  /// path, into \a contents. Other files in the archive are skipped rather
+  /// than extracted and nothing is written to disk. Each call scans the
+  /// archive's entry headers sequentially from its start. Return true upon
+  /// success.
+  bool read(const std::string& archivedFilePath, std::string& contents) const;
+
   /// Acquire a stream to a file in the archive, accessed by its archived file
   /// path.
   ///
@@ -83,6 +102,10 @@ public:
   /// Acquire the path to the file in the archive, accessed by its archived file
   /// path. Return the empty string if the archived file path is not in the
   /// archive.
+  ///
+  /// If the archive has not been extracted, only the requested file is
+  /// extracted (into a temporary directory that is removed along with the
+  /// archive).
   std::string location(const std::string& archivedFilePath);
 
 private:
@@ -52,72 +52,90 @@ SubsymbolVisitor InfixExpressionGrammar::subsymbolVisitor() const
 double InfixExpressionGrammar::evaluate(const std::string& expression, InfixExpressionError& err)
   const
 {
-  // Freshen up |err|.
-  err = InfixExpressionError::ERROR_NONE;
-
-  InfixOperators ops;
-  EvaluationStacks s;
-
-  err = testExpressionSyntax(expression, ops, s);
+  std::shared_ptr<InfixExpressionProgram> program = this->compile(expression, err);
+  if (!program)
+  {
+    return std::nan("");
+  }
+  return this->evaluate(*program, err);
+}
 
+double InfixExpressionGrammar::evaluate(
+  const InfixExpressionProgram& program,
+  InfixExpressionError& err) const
+{
+  std::vector<double> values;
+  err = this->resolveSymbols(program, values);
   if (err != InfixExpressionError::ERROR_NONE)
   {
     return std::nan("");
   }
 
-  double result = s.finish();
   // It's important to note that we can check global |errno| to learn of a more
   // specific math-related error code (EDOM or ERANGE). ONLY AS LONG AS NOTHING
   // ELSE SETS |errno| BETWEEN THEN AND NOW.
-  if (std::isnan(result) || std::isinf(result))
-  {
-    err = InfixExpressionError::ERROR_MATH_ERROR;
-  }
-
-  return result;
+  return program.evaluate(values, err);
 }
 
 InfixExpressionError InfixExpressionGrammar::testExpressionSyntax(
   const std::string& expression) const
 {
-  InfixOperators ops;
-  EvaluationStacks s;
+  InfixExpressionError err = InfixExpressionError::ERROR_NONE;
+  std::shared_ptr<InfixExpressionProgram> program = this->compile(expression, err);
+  if (!program)
+  {
+    return err;
+  }
 
-  return testExpressionSyntax(expression, ops, s);
+  std::vector<double> values;
+  return this->resolveSymbols(*program, values);
 }
 
-InfixExpressionError InfixExpressionGrammar::testExpressionSyntax(
+std::shared_ptr<InfixExpressionProgram> InfixExpressionGrammar::compile(
   const std::string& expression,
-  InfixOperators& ops,
-  EvaluationStacks& stacks) const
+  InfixExpressionError& err) const
 {
-  InfixExpressionError err = InfixExpressionError::ERROR_NONE;
+  err = InfixExpressionError::ERROR_NONE;
 
+  InfixOperators ops;
+  expression_internal::ProgramBuilder builder;
   tao::pegtl::string_input<> in(expression, "ExpressionParser");
 
   try
   {
-    tao::pegtl::
-      parse<expression_internal::expression_grammar, expression_internal::ExpressionAction>(
-        in, ops, stacks, m_functions, m_subsymbolVisitor, err);
+    tao::pegtl::parse<expression_internal::expression_grammar, expression_internal::CompileAction>(
+      in, ops, builder, m_functions, err);
   }
   catch (tao::pegtl::parse_error& /*parse_err*/)
   {
-    //    const auto p = parse_err.positions.front();
-    //    std::cout << "ExpressionParser: " << parse_err.what() << "\n"
-    //              << in.line_as_string(p) << "\n"
-    //              << std::string(p.byte_in_line, ' ') << "^\n"
-    //              << std::endl;
-
-    // We caught a parse_error and |err| was not set by any ExpressionAction,
+    // We caught a parse_error and |err| was not set by any CompileAction,
     // making this a syntax error.
     if (err == InfixExpressionError::ERROR_NONE)
     {
       err = InfixExpressionError::ERROR_INVALID_SYNTAX;
     }
+    return nullptr;
   }
 
-  return err;
+  return builder.finish(expression);
+}
+
+InfixExpressionError InfixExpressionGrammar::resolveSymbols(
+  const InfixExpressionProgram& program,
+  std::vector<double>& values) const
+{
+  values.clear();
+  values.reserve(program.symbols().size());
+  for (const auto& symbol : program.symbols())
+  {
+    std::pair<double, bool> result = m_subsymbolVisitor(symbol);
+    if (!result.second || std::isnan(result.first) || std::isinf(result.first))
+    {
+      return InfixExpressionError::ERROR_SUBEVALUATION_FAILED;
+    }
+    values.push_back(result.first);
+  }
+  return InfixExpressionError::ERROR_NONE;
 }
 
 } // namespace common
@@ -13,12 +13,14 @@
 
 #include <functional>
 #include <map>
+#include <memory>
 #include <string>
 
 #include "smtk/CoreExports.h"
 
 #include "smtk/common/InfixExpressionError.h"
 #include "smtk/common/InfixExpressionEvaluation.h"
+#include "smtk/common/InfixExpressionProgram.h"
 
 namespace smtk
 {
@@ -44,6 +46,18 @@ public:
   // ERROR_MATH_ERROR.
   double evaluate(const std::string& expression, InfixExpressionError& err) const;
 
+  // Evaluates a previously compiled |program|, resolving its subsymbols with
+  // the subsymbol visitor. Sets |err| as evaluate(expression, err) does.
+  double evaluate(const InfixExpressionProgram& program, InfixExpressionError& err) const;
+
+  // Parses |expression| into a program that can be evaluated repeatedly without
+  // parsing it again. Subsymbols are not visited; they become the program's
+  // slots. Returns nullptr and sets |err| to ERROR_INVALID_SYNTAX,
+  // ERROR_UNKNOWN_FUNCTION, or ERROR_UNKNOWN_OPERATOR on failure.
+  std::shared_ptr<InfixExpressionProgram> compile(
+    const std::string& expression,
+    InfixExpressionError& err) const;
+
   // Tests |expression| for possible errors, without computing its result.
   // Returns:
   //      ERROR_NONE if successful.
@@ -53,10 +67,11 @@ public:
   InfixExpressionError testExpressionSyntax(const std::string& expression) const;
 
 private:
-  InfixExpressionError testExpressionSyntax(
-    const std::string& expression,
-    InfixOperators& ops,
-    EvaluationStacks& stacks) const;
+  // Calls |m_subsymbolVisitor| for each of |program|'s slots in order, stopping
+  // at the first that cannot be evaluated.
+  InfixExpressionError resolveSymbols(
+    const InfixExpressionProgram& program,
+    std::vector<double>& values) const;
 
   InfixFunctions m_functions;
   SubsymbolVisitor m_subsymbolVisitor;
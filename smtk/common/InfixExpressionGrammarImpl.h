@@ -11,15 +11,21 @@
 #define smtk_common_ExpressionGrammarImpl_h
 /*!\file InfixExpressionGrammarImpl.h - PEGTL structures for parsing mathematical expressions. */
 
+#include <algorithm>
 #include <functional>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "smtk/CoreExports.h"
 
 #include "smtk/common/InfixExpressionError.h"
 #include "smtk/common/InfixExpressionEvaluation.h"
+#include "smtk/common/InfixExpressionProgram.h"
 
 #include <tao/pegtl.hpp>
 #include <tao/pegtl/contrib/abnf.hpp>
@@ -252,6 +258,249 @@ struct ExpressionAction<one<')'>>
   }
 };
 
+// ProgramBuilder is the compiling counterpart of EvaluationStacks: instead of
+// computing values as the parser matches them, it emits postfix instructions
+// in the order EvaluationStacks would have computed them.
+class ProgramBuilder
+{
+public:
+  using OpCode = InfixExpressionProgram::OpCode;
+
+  ProgramBuilder() { open(); }
+
+  void open()
+  {
+    m_levels.emplace_back(Level{ {}, m_functionForNextOpen });
+    m_functionForNextOpen = NoFunction;
+  }
+
+  void setFunctionForNextOpen(const std::function<double(double)>& f)
+  {
+    m_functionForNextOpen = m_functions.size();
+    m_functions.push_back(f);
+  }
+
+  void push(double value)
+  {
+    m_instructions.push_back({ OpCode::Constant, m_constants.size() });
+    m_constants.push_back(value);
+  }
+
+  void pushSymbol(const std::string& symbol)
+  {
+    auto it = std::find(m_symbols.begin(), m_symbols.end(), symbol);
+    std::size_t slot = static_cast<std::size_t>(it - m_symbols.begin());
+    if (it == m_symbols.end())
+    {
+      m_symbols.push_back(symbol);
+    }
+    m_instructions.push_back({ OpCode::Symbol, slot });
+  }
+
+  void push(EvaluationOrder p, OpCode op)
+  {
+    auto& operators = m_levels.back().operators;
+    while (!operators.empty() && operators.back().first <= p)
+    {
+      m_instructions.push_back({ operators.back().second, 0 });
+      operators.pop_back();
+    }
+    operators.emplace_back(p, op);
+  }
+
+  void close()
+  {
+    finishLevel();
+    m_levels.pop_back();
+  }
+
+  std::shared_ptr<InfixExpressionProgram> finish(const std::string& source)
+  {
+    while (m_levels.size() > 1)
+    {
+      close();
+    }
+    finishLevel();
+    return std::make_shared<InfixExpressionProgram>(
+      source,
+      std::move(m_instructions),
+      std::move(m_constants),
+      std::move(m_symbols),
+      std::move(m_functions));
+  }
+
+private:
+  static constexpr std::size_t NoFunction = static_cast<std::size_t>(-1);
+
+  struct Level
+  {
+    std::vector<std::pair<EvaluationOrder, OpCode>> operators;
+    std::size_t function;
+  };
+
+  void finishLevel()
+  {
+    Level& level = m_levels.back();
+    while (!level.operators.empty())
+    {
+      m_instructions.push_back({ level.operators.back().second, 0 });
+      level.operators.pop_back();
+    }
+    if (level.function != NoFunction)
+    {
+      m_instructions.push_back({ OpCode::Function, level.function });
+    }
+  }
+
+  std::vector<Level> m_levels;
+  std::size_t m_functionForNextOpen{ NoFunction };
+  std::vector<InfixExpressionProgram::Instruction> m_instructions;
+  std::vector<double> m_constants;
+  std::vector<std::string> m_symbols;
+  std::vector<std::function<double(double)>> m_functions;
+};
+
+// CompileAction mirrors ExpressionAction, but records instructions in a
+// ProgramBuilder. Subsymbols are not visited during compilation; each is
+// assigned a slot to be resolved when the program is evaluated.
+template<typename Rule>
+struct CompileAction : nothing<Rule>
+{
+};
+
+template<>
+struct CompileAction<number>
+{
+  template<typename ActionInput>
+  static void apply(
+    const ActionInput& in,
+    const InfixOperators& /* unused */,
+    ProgramBuilder& b,
+    const InfixFunctions& /* unused */,
+    InfixExpressionError& /* unused */)
+  {
+    std::stringstream ss(in.string());
+    double v;
+    ss >> v;
+    b.push(v);
+  }
+};
+
+template<>
+struct CompileAction<infix_operator>
+{
+  template<typename ActionInput>
+  static void apply(
+    const ActionInput& in,
+    const InfixOperators& ops,
+    ProgramBuilder& b,
+    const InfixFunctions& /* unused */,
+    InfixExpressionError& err)
+  {
+    std::string str = in.string();
+    const std::map<std::string, InfixOperator>::const_iterator it = ops.ops().find(str);
+    if (it == ops.ops().end())
+    {
+      err = InfixExpressionError::ERROR_UNKNOWN_OPERATOR;
+      throw parse_error("Invalid operator.", in);
+    }
+    ProgramBuilder::OpCode op;
+    switch (str[0])
+    {
+      case '+':
+        op = ProgramBuilder::OpCode::Add;
+        break;
+      case '-':
+        op = ProgramBuilder::OpCode::Subtract;
+        break;
+      case '*':
+        op = ProgramBuilder::OpCode::Multiply;
+        break;
+      case '/':
+        op = ProgramBuilder::OpCode::Divide;
+        break;
+      case '^':
+        op = ProgramBuilder::OpCode::Power;
+        break;
+      default:
+        err = InfixExpressionError::ERROR_UNKNOWN_OPERATOR;
+        throw parse_error("Operator cannot be compiled.", in);
+    }
+    b.push(it->second.p, op);
+  }
+};
+
+template<>
+struct CompileAction<function_name>
+{
+  template<typename ActionInput>
+  static void apply(
+    const ActionInput& in,
+    const InfixOperators& /* unused */,
+    ProgramBuilder& b,
+    const InfixFunctions& funcs,
+    InfixExpressionError& err)
+  {
+    std::string str = in.string();
+    std::size_t openingParenIdx = str.find_first_of('(');
+    std::string functionName = str.substr(0, openingParenIdx);
+
+    const std::map<std::string, InfixFunction>::const_iterator it =
+      funcs.funcs().find(functionName);
+    if (it != funcs.funcs().end())
+    {
+      b.setFunctionForNextOpen(it->second.f);
+    }
+    else
+    {
+      err = InfixExpressionError::ERROR_UNKNOWN_FUNCTION;
+      throw parse_error("Invalid function.", in);
+    }
+  }
+};
+
+template<>
+struct CompileAction<subsymbol_reference>
+{
+  template<typename ActionInput>
+  static void apply(
+    const ActionInput& in,
+    const InfixOperators& /* unused */,
+    ProgramBuilder& b,
+    const InfixFunctions& /* unused */,
+    InfixExpressionError& /* unused */)
+  {
+    std::string str = in.string();
+    b.pushSymbol(str.substr(1, str.size() - 2));
+  }
+};
+
+template<>
+struct CompileAction<one<'('>>
+{
+  static void apply0(
+    const InfixOperators& /* unused */,
+    ProgramBuilder& b,
+    const InfixFunctions& /* unused */,
+    InfixExpressionError& /* unused */)
+  {
+    b.open();
+  }
+};
+
+template<>
+struct CompileAction<one<')'>>
+{
+  static void apply0(
+    const InfixOperators& /* unused */,
+    ProgramBuilder& b,
+    const InfixFunctions& /* unused */,
+    InfixExpressionError& /* unused */)
+  {
+    b.close();
+  }
+};
+
 } // namespace expression_internal
 
 } // namespace common
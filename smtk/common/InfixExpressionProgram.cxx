@@ -0,0 +1,215 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/common/InfixExpressionProgram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+// Combine two rows of the evaluation stack in place. Kept free of aliasing
+// and branches so the loop vectorizes for the arithmetic operators.
+template<typename Functor>
+inline void applyBinary(double* lhs, const double* rhs, std::size_t count, Functor functor)
+{
+  for (std::size_t ii = 0; ii < count; ++ii)
+  {
+    lhs[ii] = functor(lhs[ii], rhs[ii]);
+  }
+}
+} // namespace
+
+namespace smtk
+{
+namespace common
+{
+
+constexpr std::size_t InfixExpressionProgram::BlockSize;
+
+InfixExpressionProgram::InfixExpressionProgram(
+  std::string source,
+  std::vector<Instruction> instructions,
+  std::vector<double> constants,
+  std::vector<std::string> symbols,
+  std::vector<std::function<double(double)>> functions)
+  : m_source(std::move(source))
+  , m_instructions(std::move(instructions))
+  , m_constants(std::move(constants))
+  , m_symbols(std::move(symbols))
+  , m_functions(std::move(functions))
+{
+  std::size_t depth = 0;
+  for (const auto& instruction : m_instructions)
+  {
+    switch (instruction.op)
+    {
+      case OpCode::Constant:
+      case OpCode::Symbol:
+        m_stackDepth = std::max(m_stackDepth, ++depth);
+        break;
+      case OpCode::Function:
+        break;
+      default:
+        --depth;
+        break;
+    }
+  }
+}
+
+double InfixExpressionProgram::evaluate(const double* symbolValues, InfixExpressionError& err) const
+{
+  err = InfixExpressionError::ERROR_NONE;
+  if (m_instructions.empty() || (!m_symbols.empty() && !symbolValues))
+  {
+    err = InfixExpressionError::ERROR_SUBEVALUATION_FAILED;
+    return std::nan("");
+  }
+
+  // Most expressions are shallow; avoid allocating for them.
+  double local[16];
+  std::vector<double> heap;
+  double* stack = local;
+  if (m_stackDepth > sizeof(local) / sizeof(local[0]))
+  {
+    heap.resize(m_stackDepth);
+    stack = heap.data();
+  }
+
+  std::size_t top = 0; // One past the top of the stack.
+  for (const auto& instruction : m_instructions)
+  {
+    switch (instruction.op)
+    {
+      case OpCode::Constant:
+        stack[top++] = m_constants[instruction.operand];
+        break;
+      case OpCode::Symbol:
+        stack[top++] = symbolValues[instruction.operand];
+        break;
+      case OpCode::Add:
+        --top;
+        stack[top - 1] += stack[top];
+        break;
+      case OpCode::Subtract:
+        --top;
+        stack[top - 1] -= stack[top];
+        break;
+      case OpCode::Multiply:
+        --top;
+        stack[top - 1] *= stack[top];
+        break;
+      case OpCode::Divide:
+        --top;
+        stack[top - 1] /= stack[top];
+        break;
+      case OpCode::Power:
+        --top;
+        stack[top - 1] = std::pow(stack[top - 1], stack[top]);
+        break;
+      case OpCode::Function:
+        stack[top - 1] = m_functions[instruction.operand](stack[top - 1]);
+        break;
+    }
+  }
+
+  const double result = stack[0];
+  if (std::isnan(result) || std::isinf(result))
+  {
+    err = InfixExpressionError::ERROR_MATH_ERROR;
+  }
+  return result;
+}
+
+InfixExpressionError InfixExpressionProgram::evaluate(
+  std::size_t count,
+  const std::vector<const double*>& symbolColumns,
+  double* results) const
+{
+  if (count == 0)
+  {
+    return InfixExpressionError::ERROR_NONE;
+  }
+  bool missingColumn = symbolColumns.size() < m_symbols.size();
+  for (std::size_t ii = 0; !missingColumn && ii < m_symbols.size(); ++ii)
+  {
+    missingColumn = symbolColumns[ii] == nullptr;
+  }
+  if (m_instructions.empty() || !results || missingColumn)
+  {
+    return InfixExpressionError::ERROR_SUBEVALUATION_FAILED;
+  }
+
+  // One row of BlockSize values per stack entry.
+  std::vector<double> stack(m_stackDepth * BlockSize);
+  for (std::size_t begin = 0; begin < count; begin += BlockSize)
+  {
+    const std::size_t n = std::min(BlockSize, count - begin);
+    std::size_t top = 0;
+    for (const auto& instruction : m_instructions)
+    {
+      // The rows holding the top of the stack and the entry beneath it.
+      double* top0 = stack.data() + (top > 0 ? top - 1 : 0) * BlockSize;
+      double* top1 = top > 1 ? top0 - BlockSize : nullptr;
+      switch (instruction.op)
+      {
+        case OpCode::Constant:
+          std::fill_n(stack.data() + top++ * BlockSize, n, m_constants[instruction.operand]);
+          break;
+        case OpCode::Symbol:
+          std::copy_n(
+            symbolColumns[instruction.operand] + begin, n, stack.data() + top++ * BlockSize);
+          break;
+        case OpCode::Add:
+          applyBinary(top1, top0, n, [](double l, double r) { return l + r; });
+          --top;
+          break;
+        case OpCode::Subtract:
+          applyBinary(top1, top0, n, [](double l, double r) { return l - r; });
+          --top;
+          break;
+        case OpCode::Multiply:
+          applyBinary(top1, top0, n, [](double l, double r) { return l * r; });
+          --top;
+          break;
+        case OpCode::Divide:
+          applyBinary(top1, top0, n, [](double l, double r) { return l / r; });
+          --top;
+          break;
+        case OpCode::Power:
+          applyBinary(top1, top0, n, [](double l, double r) { return std::pow(l, r); });
+          --top;
+          break;
+        case OpCode::Function:
+        {
+          const auto& function = m_functions[instruction.operand];
+          for (std::size_t ii = 0; ii < n; ++ii)
+          {
+            top0[ii] = function(top0[ii]);
+          }
+        }
+        break;
+      }
+    }
+    std::copy(stack.data(), stack.data() + n, results + begin);
+  }
+
+  for (std::size_t ii = 0; ii < count; ++ii)
+  {
+    if (std::isnan(results[ii]) || std::isinf(results[ii]))
+    {
+      return InfixExpressionError::ERROR_MATH_ERROR;
+    }
+  }
+  return InfixExpressionError::ERROR_NONE;
+}
+
+} // namespace common
+} // namespace smtk
@@ -0,0 +1,120 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_common_InfixExpressionProgram_h
+#define smtk_common_InfixExpressionProgram_h
+/*!\file InfixExpressionProgram.h - A compiled form of an infix mathematical expression. */
+
+#include "smtk/CoreExports.h"
+
+#include "smtk/common/InfixExpressionError.h"
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace smtk
+{
+namespace common
+{
+
+/**\brief An infix expression compiled into postfix bytecode.
+  *
+  * Programs are produced by InfixExpressionGrammar::compile(). Parsing happens
+  * once; evaluating a program is a single pass over a flat instruction list.
+  *
+  * Each distinct subsymbol reference (e.g., "{abc}") in the expression is
+  * assigned a *slot*, numbered in order of first appearance. Callers resolve
+  * the symbols listed by symbols() to values and pass them, in slot order,
+  * to evaluate().
+  *
+  * Programs are immutable once built, so they may be shared and evaluated
+  * concurrently.
+  */
+class SMTKCORE_EXPORT InfixExpressionProgram
+{
+public:
+  enum class OpCode : unsigned char
+  {
+    Constant, //!< Push constants()[operand].
+    Symbol,   //!< Push the value of slot \a operand.
+    Add,      //!< Pop r, l; push l + r.
+    Subtract, //!< Pop r, l; push l - r.
+    Multiply, //!< Pop r, l; push l * r.
+    Divide,   //!< Pop r, l; push l / r.
+    Power,    //!< Pop r, l; push l ^ r.
+    Function  //!< Replace the top of the stack x with functions()[operand](x).
+  };
+
+  struct Instruction
+  {
+    OpCode op;
+    std::size_t operand;
+  };
+
+  /// The number of rows processed at a time by the batch form of evaluate().
+  static constexpr std::size_t BlockSize = 256;
+
+  InfixExpressionProgram(
+    std::string source,
+    std::vector<Instruction> instructions,
+    std::vector<double> constants,
+    std::vector<std::string> symbols,
+    std::vector<std::function<double(double)>> functions);
+
+  /// The expression this program was compiled from.
+  const std::string& source() const { return m_source; }
+
+  const std::vector<Instruction>& instructions() const { return m_instructions; }
+  const std::vector<double>& constants() const { return m_constants; }
+  const std::vector<std::function<double(double)>>& functions() const { return m_functions; }
+
+  /// The names of the subsymbols referenced by the expression, in slot order.
+  const std::vector<std::string>& symbols() const { return m_symbols; }
+
+  /// The maximum number of values held on the stack during evaluation.
+  std::size_t stackDepth() const { return m_stackDepth; }
+
+  /// Evaluate the program with \a symbolValues holding one value per slot.
+  /// Sets \a err to ERROR_MATH_ERROR if the result is not finite.
+  double evaluate(const double* symbolValues, InfixExpressionError& err) const;
+  double evaluate(const std::vector<double>& symbolValues, InfixExpressionError& err) const
+  {
+    return this->evaluate(symbolValues.data(), err);
+  }
+
+  /**\brief Evaluate the program \a count times.
+    *
+    * \a symbolColumns holds one array of \a count values per slot; row i of
+    * the result is computed from element i of each column and written to
+    * \a results[i]. Instructions are applied to blocks of BlockSize rows at a
+    * time so that arithmetic runs in tight loops the compiler can vectorize.
+    *
+    * Returns ERROR_MATH_ERROR if any result is not finite (all rows are still
+    * computed) and ERROR_SUBEVALUATION_FAILED if a column is missing.
+    */
+  InfixExpressionError evaluate(
+    std::size_t count,
+    const std::vector<const double*>& symbolColumns,
+    double* results) const;
+
+private:
+  std::string m_source;
+  std::vector<Instruction> m_instructions;
+  std::vector<double> m_constants;
+  std::vector<std::string> m_symbols;
+  std::vector<std::function<double(double)>> m_functions;
+  std::size_t m_stackDepth{ 0 };
+};
+
+} // namespace common
+} // namespace smtk
+
+#endif // smtk_common_InfixExpressionProgram_h
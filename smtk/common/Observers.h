@@ -10,6 +10,7 @@
 #ifndef smtk_common_Observers_h
 #define smtk_common_Observers_h
 
+#include <chrono>
 #include <functional>
 #include <iostream>
 #include <limits>
@@ -19,6 +20,7 @@
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #define ADD_OBSERVER(key, observers, observer, priority, initialize)                               \
   key = (observers)->insert(                                                                       \
@@ -62,6 +64,10 @@ namespace common
 /// goes out of scope, the Observer functor is removed from the Observers
 /// instance) by default. To decouple the Key's lifetime from that of the
 /// Observer functor, use the Key's release() method.
+///
+/// The time spent in each Observer functor can be measured at run time (see
+/// setTimingEnabled()) in order to find observers that slow down the events
+/// they observe.
 template<typename Observer, bool DebugObservers = false>
 class Observers
 {
@@ -186,6 +192,14 @@ public:
   /// Observers instance.
   typedef std::function<void(Observer&)> Initializer;
 
+  /// The time spent in an Observer functor (see setTimingEnabled()).
+  struct Timing
+  {
+    std::size_t calls = 0;
+    std::chrono::nanoseconds total{ 0 };
+    std::chrono::nanoseconds longest{ 0 };
+  };
+
   Observers()
     : m_initializer()
   {
@@ -230,7 +244,7 @@ public:
       // other observers. Rather than directly remove them from the map and
       // invalidate the iteration loop, we cache these requests and prevent
       // these observers from being called (as though they were erased).
-      if (m_toErase.find(entry.first) == m_toErase.end())
+      if (m_toErase.empty() || m_toErase.find(entry.first) == m_toErase.end())
       {
         if (DebugObservers)
         {
@@ -239,6 +253,7 @@ public:
         }
         if (entry.first.assigned())
         {
+          Timer timer(m_timingEnabled ? this : nullptr, entry.first);
           result |= entry.second(std::forward<Types>(args)...);
         }
       }
@@ -282,7 +297,7 @@ public:
       // other observers. Rather than directly remove them from the map and
       // invalidate the iteration loop, we cache these requests and prevent
       // these observers from being called (as though they were erased).
-      if (m_toErase.find(entry.first) == m_toErase.end())
+      if (m_toErase.empty() || m_toErase.find(entry.first) == m_toErase.end())
       {
         if (DebugObservers)
         {
@@ -291,6 +306,7 @@ public:
         }
         if (entry.first.assigned())
         {
+          Timer timer(m_timingEnabled ? this : nullptr, entry.first);
           entry.second(std::forward<Types>(args)...);
         }
       }
@@ -439,6 +455,45 @@ public:
 
   std::string description(Key handle) const { return m_descriptions[handle]; }
 
+  /// Measure the time spent in each Observer functor when it is called.
+  /// Timing is disabled by default; disabling it discards the measurements.
+  /// Measurements are guarded by their own mutex, so they may be gathered and
+  /// queried while observers are called on other threads.
+  void setTimingEnabled(bool enabled)
+  {
+    m_timingEnabled = enabled;
+    if (!enabled)
+    {
+      std::unique_lock<std::mutex> lock(m_timingMutex);
+      m_timings.clear();
+    }
+  }
+  bool timingEnabled() const { return m_timingEnabled; }
+
+  /// Return the description and timing of each Observer functor that has been
+  /// called since timing was enabled, in the order they are called.
+  std::vector<std::pair<std::string, Timing>> timings() const
+  {
+    std::vector<std::pair<std::string, Timing>> result;
+    std::unique_lock<std::mutex> lock(m_timingMutex);
+    result.reserve(m_timings.size());
+    for (const auto& timing : m_timings)
+    {
+      auto description = m_descriptions.find(timing.first);
+      result.push_back(std::make_pair(
+        description == m_descriptions.end() ? std::string() : description->second,
+        timing.second));
+    }
+    return result;
+  }
+
+  /// Discard the timings gathered so far.
+  void resetTimings()
+  {
+    std::unique_lock<std::mutex> lock(m_timingMutex);
+    m_timings.clear();
+  }
+
 protected:
   // A map of observers. The observers are held in a map so that they can be
   // referenced (and therefore removed) at a later time using the observer's
@@ -457,14 +512,60 @@ protected:
   Initializer m_initializer;
 
 private:
+  // Record the time spent in an observer from construction to destruction.
+  class Timer
+  {
+  public:
+    Timer(Observers* observers, const InternalKey& key)
+      : m_observers(observers)
+      , m_key(key)
+    {
+      if (m_observers)
+      {
+        m_start = std::chrono::steady_clock::now();
+      }
+    }
+    Timer(const Timer&) = delete;
+    Timer& operator=(const Timer&) = delete;
+
+    ~Timer()
+    {
+      if (m_observers)
+      {
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - m_start);
+        std::unique_lock<std::mutex> lock(m_observers->m_timingMutex);
+        Timing& timing = m_observers->m_timings[m_key];
+        ++timing.calls;
+        timing.total += elapsed;
+        if (timing.longest < elapsed)
+        {
+          timing.longest = elapsed;
+        }
+      }
+    }
+
+  private:
+    Observers* m_observers;
+    const InternalKey& m_key;
+    std::chrono::steady_clock::time_point m_start;
+  };
+
   std::size_t erase(const InternalKey& key)
   {
     std::unique_lock<std::mutex> lock(m_mutex);
     m_keys.erase(key);
+    {
+      std::unique_lock<std::mutex> timingLock(m_timingMutex);
+      m_timings.erase(key);
+    }
     return m_observers.erase(key);
   }
 
   bool m_observing{ false };
+  bool m_timingEnabled{ false };
+  std::map<InternalKey, Timing> m_timings;
+  mutable std::mutex m_timingMutex;
   std::set<InternalKey> m_toErase;
 
   std::mutex m_mutex;
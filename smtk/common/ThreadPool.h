@@ -14,13 +14,12 @@
 #include "smtk/CoreExports.h"
 
 #include "smtk/common/CompilerInformation.h"
+#include "smtk/common/WorkStealingPool.h"
 
-#include <atomic>
-#include <condition_variable>
 #include <functional>
 #include <future>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include <type_traits>
 #include <vector>
@@ -33,6 +32,10 @@ namespace common
 /// the number of threads to build at construction, and waits for all tasks to
 /// complete before being destroyed. The \a ReturnType is a default-constructible
 /// type that tasks return via std::future.
+///
+/// Tasks are executed by a WorkStealingPool, so submissions from many threads
+/// do not contend on a single queue and tasks submitted from inside a running
+/// task are queued on the submitting worker.
 template<typename ReturnType = void>
 class SMTK_ALWAYS_EXPORT ThreadPool
 {
@@ -51,122 +54,70 @@ public:
   template<typename Function, typename... Types>
   std::future<ReturnType> operator()(Function&& function, Types&&... args)
   {
-    return appendToQueue(std::bind(function, std::forward<Types>(args)...));
+    return this->enqueue(std::packaged_task<ReturnType()>(
+      std::bind(std::forward<Function>(function), std::forward<Types>(args)...)));
   }
 
 protected:
   void initialize();
 
-  /// Append a functor with no inputs to the task queue. This is used in tandem
-  /// with std::bind to construct the class's call method.
+  /// Append a functor with no inputs to the task queue.
   std::future<ReturnType> appendToQueue(std::function<ReturnType()>&& task);
 
-  /// Run by a worker thread: poll the task queue for tasks to perform.
-  /// NOTE: the single layer of misdirection ensures that we launch a thread
-  ///       using the correct method address.
-  void execute() { return this->exec(); }
-  virtual void exec();
-
-  std::condition_variable m_condition;
-  std::mutex m_queueMutex;
-  std::vector<std::thread> m_threads;
-  std::queue<std::packaged_task<ReturnType()>> m_queue;
-  bool m_initialized{ false };
-  std::atomic<bool> m_active;
+  /// Hand a packaged task to the worker threads and return its future.
+  std::future<ReturnType> enqueue(std::packaged_task<ReturnType()>&& task);
+
+  /// Run by a worker thread to execute a single task. Derived pools may
+  /// override this to customize how (or whether) queued tasks are run;
+  /// the task must be invoked or destroyed so its future becomes ready.
+  virtual void exec(std::packaged_task<ReturnType()>& task) { task(); }
+
+  std::unique_ptr<WorkStealingPool> m_workers;
+  std::once_flag m_initialized;
   unsigned int m_maxThreads;
 };
 
 template<typename ReturnType>
 ThreadPool<ReturnType>::ThreadPool(unsigned int maxThreads)
-  : m_active(true)
-  , m_maxThreads(maxThreads == 0 ? std::thread::hardware_concurrency() : maxThreads)
+  : m_maxThreads(maxThreads == 0 ? std::thread::hardware_concurrency() : maxThreads)
 {
 }
 
 template<typename ReturnType>
 ThreadPool<ReturnType>::~ThreadPool()
 {
-  // Change the state of the thread pool to signify that threads should no
-  // longer run.
-  m_active = false;
-
-  // For each thread in the pool, send a task that will cause it to exit its
-  // infinite loop.
-  for (std::size_t i = 0; i < m_threads.size(); i++)
-  {
-    (*this)([] { return ReturnType(); });
-  }
-
-  // Now that all of the threads have exited, join each thread with the parent
-  // thread.
-  for (auto& thread : m_threads)
-  {
-    thread.join();
-  }
+  // Destroying the workers runs every queued task and then joins each thread
+  // with the parent thread.
+  m_workers.reset();
 }
 
 template<typename ReturnType>
 void ThreadPool<ReturnType>::initialize()
 {
-  for (unsigned int i = 0; i < m_maxThreads; ++i)
-  {
-    m_threads.push_back(std::thread(&ThreadPool<ReturnType>::execute, this));
-  }
+  m_workers.reset(new WorkStealingPool(m_maxThreads));
 }
 
 template<typename ReturnType>
 std::future<ReturnType> ThreadPool<ReturnType>::appendToQueue(std::function<ReturnType()>&& task)
 {
-  std::future<ReturnType> future;
-
-  // Scope access to the queue.
-  {
-    std::unique_lock<std::mutex> queueLock(m_queueMutex);
-
-    // If the thread pool is not yet active, initialize it.
-    // NOTE: we use lazy initialization here to allow derived thread pools to
-    //       have custom exec() logic, which is called upon the construction of
-    //       std::thread. The derived methods will only be available after
-    //       the base constructor has returned, so we cannot construct
-    //       std::thread instances in this class's constructor.
-    if (!m_initialized)
-    {
-      m_initialized = true;
-      this->initialize();
-    }
-
-    // Construct a packaged_task to launch the input task and access its
-    // future.
-    m_queue.emplace(task);
-    future = m_queue.back().get_future();
-  }
-  // Signal to the next thread that the queue is ready for access.
-  m_condition.notify_one();
-
-  // Return the future associated with the promise created above.
-  return future;
+  return this->enqueue(std::packaged_task<ReturnType()>(std::move(task)));
 }
 
 template<typename ReturnType>
-void ThreadPool<ReturnType>::exec()
+std::future<ReturnType> ThreadPool<ReturnType>::enqueue(std::packaged_task<ReturnType()>&& task)
 {
-  // Always check if the containing class has signaled that the thread pool
-  // should no longer be active.
-  while (m_active)
-  {
-    std::packaged_task<ReturnType()> task;
-    // Scope access to the queue.
-    {
-      std::unique_lock<std::mutex> queueLock(m_queueMutex);
-
-      // Access a task from the queue.
-      m_condition.wait(queueLock, [this] { return !m_queue.empty(); });
-      task = std::move(m_queue.front());
-      m_queue.pop();
-    }
-    // Execute the task.
-    task();
-  }
+  // If the thread pool is not yet active, initialize it.
+  // NOTE: we use lazy initialization so that pools which are never handed a
+  //       task never spawn threads.
+  std::call_once(m_initialized, [this]() { this->initialize(); });
+
+  std::future<ReturnType> future = task.get_future();
+
+  // WorkStealingPool tasks must be copyable, so the packaged task is shared.
+  auto shared = std::make_shared<std::packaged_task<ReturnType()>>(std::move(task));
+  m_workers->submit([this, shared]() { this->exec(*shared); });
+
+  return future;
 }
 } // namespace common
 } // namespace smtk
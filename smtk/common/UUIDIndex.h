@@ -0,0 +1,204 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_common_UUIDIndex_h
+#define smtk_common_UUIDIndex_h
+
+#include "smtk/common/UUID.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace smtk
+{
+namespace common
+{
+
+/**\brief An open-addressing hash table from UUIDs to small values.
+  *
+  * UUIDIndex stores its entries inline in a single power-of-two array and
+  * resolves collisions by linear probing; erasures shift subsequent entries
+  * back rather than leaving tombstones. Lookups therefore never allocate and
+  * touch a few adjacent cache lines at most.
+  *
+  * The value type should be cheap to copy (a pointer or an index); find()
+  * returns a pointer to the stored value that is invalidated by any insertion
+  * or erasure.
+  */
+template<typename Value>
+class UUIDIndex
+{
+public:
+  UUIDIndex() = default;
+
+  /// Return the number of entries.
+  std::size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+
+  /// Remove every entry (retaining the allocated capacity).
+  void clear()
+  {
+    for (auto& slot : m_slots)
+    {
+      slot.used = false;
+    }
+    m_size = 0;
+  }
+
+  /// Ensure that \a count entries can be held without rehashing.
+  void reserve(std::size_t count)
+  {
+    std::size_t capacity = MinimumCapacity;
+    while (capacity * MaxLoadNumerator < count * MaxLoadDenominator)
+    {
+      capacity *= 2;
+    }
+    if (capacity > m_slots.size())
+    {
+      this->rehash(capacity);
+    }
+  }
+
+  /// Insert \a value for \a uid. Returns false (leaving the existing value in
+  /// place) if \a uid is already present.
+  bool insert(const UUID& uid, const Value& value)
+  {
+    if ((m_size + 1) * MaxLoadDenominator > m_slots.size() * MaxLoadNumerator)
+    {
+      this->reserve(m_size + 1);
+    }
+    std::size_t mask = m_slots.size() - 1;
+    for (std::size_t ii = UUIDIndex::hash(uid) & mask;; ii = (ii + 1) & mask)
+    {
+      Slot& slot = m_slots[ii];
+      if (!slot.used)
+      {
+        slot.id = uid;
+        slot.value = value;
+        slot.used = true;
+        ++m_size;
+        return true;
+      }
+      if (slot.id == uid)
+      {
+        return false;
+      }
+    }
+  }
+
+  /// Return a pointer to the value stored for \a uid or nullptr.
+  const Value* find(const UUID& uid) const
+  {
+    if (m_size == 0)
+    {
+      return nullptr;
+    }
+    std::size_t mask = m_slots.size() - 1;
+    for (std::size_t ii = UUIDIndex::hash(uid) & mask;; ii = (ii + 1) & mask)
+    {
+      const Slot& slot = m_slots[ii];
+      if (!slot.used)
+      {
+        return nullptr;
+      }
+      if (slot.id == uid)
+      {
+        return &slot.value;
+      }
+    }
+  }
+
+  /// Remove the entry for \a uid, returning true if one was present.
+  bool erase(const UUID& uid)
+  {
+    if (m_size == 0)
+    {
+      return false;
+    }
+    std::size_t mask = m_slots.size() - 1;
+    std::size_t hole = UUIDIndex::hash(uid) & mask;
+    for (;; hole = (hole + 1) & mask)
+    {
+      if (!m_slots[hole].used)
+      {
+        return false;
+      }
+      if (m_slots[hole].id == uid)
+      {
+        break;
+      }
+    }
+    // Shift later members of the probe sequence back into the hole so that
+    // lookups can continue to stop at the first empty slot.
+    for (std::size_t ii = (hole + 1) & mask; m_slots[ii].used; ii = (ii + 1) & mask)
+    {
+      std::size_t home = UUIDIndex::hash(m_slots[ii].id) & mask;
+      // Move the entry unless its home lies cyclically within (hole, ii].
+      if (((ii - home) & mask) >= ((ii - hole) & mask))
+      {
+        m_slots[hole] = m_slots[ii];
+        hole = ii;
+      }
+    }
+    m_slots[hole].used = false;
+    --m_size;
+    return true;
+  }
+
+  /// Mix all 128 bits of \a uid into a hash. Unlike std::hash<UUID>, this
+  /// remains well distributed for UUIDs that differ only in their leading
+  /// bytes (e.g., time-based or sequential identifiers).
+  static std::size_t hash(const UUID& uid)
+  {
+    std::uint64_t words[2];
+    std::memcpy(words, uid.begin(), sizeof(words));
+    std::uint64_t h = words[0] ^ (words[1] * 0x9e3779b97f4a7c15ULL);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return static_cast<std::size_t>(h);
+  }
+
+private:
+  struct Slot
+  {
+    UUID id;
+    Value value{};
+    bool used{ false };
+  };
+
+  static constexpr std::size_t MinimumCapacity = 16;
+  // Keep the table at most 5/8 full.
+  static constexpr std::size_t MaxLoadNumerator = 5;
+  static constexpr std::size_t MaxLoadDenominator = 8;
+
+  void rehash(std::size_t capacity)
+  {
+    std::vector<Slot> slots(capacity);
+    std::swap(slots, m_slots);
+    m_size = 0;
+    for (const auto& slot : slots)
+    {
+      if (slot.used)
+      {
+        this->insert(slot.id, slot.value);
+      }
+    }
+  }
+
+  std::vector<Slot> m_slots;
+  std::size_t m_size{ 0 };
+};
+
+} // namespace common
+} // namespace smtk
+
+#endif
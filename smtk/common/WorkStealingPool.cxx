@@ -0,0 +1,263 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/common/WorkStealingPool.h"
+
+#include <chrono>
+
+namespace
+{
+// The pool (if any) whose worker is the current thread, and that worker's index.
+thread_local smtk::common::WorkStealingPool* s_currentPool = nullptr;
+thread_local std::size_t s_currentIndex = 0;
+} // namespace
+
+namespace smtk
+{
+namespace common
+{
+
+WorkStealingPool::WorkStealingPool(unsigned int numberOfWorkers)
+{
+  if (numberOfWorkers == 0)
+  {
+    numberOfWorkers = std::thread::hardware_concurrency();
+    if (numberOfWorkers == 0)
+    {
+      numberOfWorkers = 1;
+    }
+  }
+  m_workers.reserve(numberOfWorkers);
+  for (unsigned int ii = 0; ii < numberOfWorkers; ++ii)
+  {
+    m_workers.emplace_back(new Worker);
+  }
+  m_threads.reserve(numberOfWorkers);
+  for (unsigned int ii = 0; ii < numberOfWorkers; ++ii)
+  {
+    m_threads.emplace_back(&WorkStealingPool::run, this, ii);
+  }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+  {
+    std::unique_lock<std::mutex> lock(m_sleepMutex);
+    m_active = false;
+  }
+  m_wakeup.notify_all();
+  for (auto& thread : m_threads)
+  {
+    thread.join();
+  }
+}
+
+WorkStealingPool& WorkStealingPool::instance()
+{
+  static WorkStealingPool pool;
+  return pool;
+}
+
+void WorkStealingPool::submit(Task&& task)
+{
+  if (!task)
+  {
+    return;
+  }
+  std::size_t index = (s_currentPool == this)
+    ? s_currentIndex
+    : m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_workers.size();
+  this->push(index, std::move(task));
+}
+
+bool WorkStealingPool::runPendingTask()
+{
+  Task task;
+  int index = this->currentWorkerIndex();
+  if (index >= 0)
+  {
+    if (!this->pop(static_cast<std::size_t>(index), task) &&
+        !this->steal(static_cast<std::size_t>(index), task))
+    {
+      return false;
+    }
+  }
+  else if (!this->steal(m_workers.size(), task))
+  {
+    return false;
+  }
+  task();
+  return true;
+}
+
+int WorkStealingPool::currentWorkerIndex() const
+{
+  return s_currentPool == this ? static_cast<int>(s_currentIndex) : -1;
+}
+
+void WorkStealingPool::push(std::size_t index, Task&& task)
+{
+  {
+    Worker& worker = *m_workers[index];
+    std::lock_guard<std::mutex> lock(worker.m_mutex);
+    worker.m_tasks.push_back(std::move(task));
+  }
+  ++m_pending;
+  // Only touch the shared sleep mutex when some worker may be idle. A worker
+  // registers itself in m_sleeping before re-checking m_pending, so either it
+  // sees the new task or we see it and wake it.
+  if (m_sleeping.load() > 0)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_sleepMutex);
+    }
+    m_wakeup.notify_one();
+  }
+}
+
+bool WorkStealingPool::pop(std::size_t index, Task& task)
+{
+  Worker& worker = *m_workers[index];
+  std::lock_guard<std::mutex> lock(worker.m_mutex);
+  if (worker.m_tasks.empty())
+  {
+    return false;
+  }
+  task = std::move(worker.m_tasks.back());
+  worker.m_tasks.pop_back();
+  --m_pending;
+  return true;
+}
+
+bool WorkStealingPool::steal(std::size_t thief, Task& task)
+{
+  std::size_t numberOfWorkers = m_workers.size();
+  // Start with the victim after the thief so that thieves spread out.
+  for (std::size_t ii = 1; ii <= numberOfWorkers; ++ii)
+  {
+    std::size_t victim = (thief + ii) % numberOfWorkers;
+    if (victim == thief)
+    {
+      continue;
+    }
+    Worker& worker = *m_workers[victim];
+    std::unique_lock<std::mutex> lock(worker.m_mutex, std::try_to_lock);
+    if (!lock.owns_lock() || worker.m_tasks.empty())
+    {
+      continue;
+    }
+    task = std::move(worker.m_tasks.front());
+    worker.m_tasks.pop_front();
+    --m_pending;
+    return true;
+  }
+  return false;
+}
+
+void WorkStealingPool::run(std::size_t index)
+{
+  s_currentPool = this;
+  s_currentIndex = index;
+  while (true)
+  {
+    Task task;
+    if (this->pop(index, task) || this->steal(index, task))
+    {
+      task();
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(m_sleepMutex);
+    ++m_sleeping;
+    while (m_pending.load() == 0 && m_active)
+    {
+      m_wakeup.wait(lock);
+    }
+    --m_sleeping;
+    if (!m_active && m_pending.load() == 0)
+    {
+      break;
+    }
+  }
+  s_currentPool = nullptr;
+}
+
+WorkStealingPool::TaskGroup::TaskGroup(WorkStealingPool& pool)
+  : m_pool(pool)
+{
+}
+
+WorkStealingPool::TaskGroup::~TaskGroup()
+{
+  try
+  {
+    this->wait();
+  }
+  catch (...)
+  {
+  }
+}
+
+void WorkStealingPool::TaskGroup::spawn(Task&& task)
+{
+  ++m_outstanding;
+  m_pool.submit([this, task]() {
+    try
+    {
+      task();
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!m_exception)
+      {
+        m_exception = std::current_exception();
+      }
+    }
+    this->finish();
+  });
+}
+
+void WorkStealingPool::TaskGroup::wait()
+{
+  while (m_outstanding.load() > 0)
+  {
+    if (m_pool.runPendingTask())
+    {
+      continue;
+    }
+    // Nothing to help with: our tasks are running elsewhere. Sleep briefly,
+    // but wake up periodically in case new tasks become available to run.
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait_for(
+      lock, std::chrono::microseconds(200), [this]() { return m_outstanding.load() == 0; });
+  }
+  std::exception_ptr exception;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::swap(exception, m_exception);
+  }
+  if (exception)
+  {
+    std::rethrow_exception(exception);
+  }
+}
+
+void WorkStealingPool::TaskGroup::finish()
+{
+  // Decrement while holding the mutex: wait() takes it before returning, so
+  // the group cannot be destroyed while we still reference it.
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (--m_outstanding == 0)
+  {
+    m_done.notify_all();
+  }
+}
+} // namespace common
+} // namespace smtk
@@ -0,0 +1,275 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_common_WorkStealingPool_h
+#define smtk_common_WorkStealingPool_h
+
+#include "smtk/CoreExports.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace smtk
+{
+namespace common
+{
+/**\brief A work-stealing executor for small, independent tasks.
+  *
+  * Each worker thread owns a double-ended queue of tasks guarded by
+  * its own mutex. Workers pop tasks from the back of their own queue
+  * (so nested tasks run depth-first and stay cache-warm) and, when
+  * their queue is empty, steal from the front of other workers' queues.
+  * Tasks submitted from outside the pool are distributed round-robin
+  * across the worker queues, so no single lock is shared by every
+  * submission.
+  *
+  * Tasks submitted from inside a task running on one of this pool's
+  * workers are pushed onto that worker's own queue; use a TaskGroup
+  * to spawn nested tasks and wait for them. Waiting inside a worker
+  * does not block it: the waiting thread executes other pending tasks
+  * until its group completes.
+  *
+  * The destructor runs every task that has been submitted before
+  * joining the worker threads.
+  */
+class SMTKCORE_EXPORT WorkStealingPool
+{
+public:
+  using Task = std::function<void()>;
+
+  class TaskGroup;
+
+  /// Construct a pool with \a numberOfWorkers threads (or the hardware's
+  /// concurrency when 0 is passed).
+  WorkStealingPool(unsigned int numberOfWorkers = 0);
+  ~WorkStealingPool();
+
+  WorkStealingPool(const WorkStealingPool&) = delete;
+  WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+  /// Return a process-wide pool sized to the hardware concurrency.
+  ///
+  /// This is the pool used by parallelFor and parallelReduce when no
+  /// pool is provided.
+  static WorkStealingPool& instance();
+
+  /// The number of worker threads owned by this pool.
+  unsigned int numberOfWorkers() const { return static_cast<unsigned int>(m_workers.size()); }
+
+  /// Queue \a task for execution. When called from one of this pool's
+  /// workers, the task is pushed onto the calling worker's queue.
+  /// Tasks must not throw; use a TaskGroup (or a std::packaged_task) to
+  /// propagate exceptions.
+  void submit(Task&& task);
+
+  /// Remove one pending task from the pool and run it on the calling thread.
+  ///
+  /// Returns false when no task was available. This is how threads that
+  /// wait on a TaskGroup contribute to progress instead of blocking.
+  bool runPendingTask();
+
+  /// Return the index of the calling thread among this pool's workers,
+  /// or -1 when the caller is not one of them.
+  int currentWorkerIndex() const;
+
+  /// The number of tasks queued but not yet started.
+  std::size_t numberOfPendingTasks() const { return m_pending.load(); }
+
+private:
+  struct Worker
+  {
+    std::mutex m_mutex;
+    std::deque<Task> m_tasks;
+  };
+
+  void push(std::size_t index, Task&& task);
+  bool pop(std::size_t index, Task& task);
+  bool steal(std::size_t thief, Task& task);
+  void run(std::size_t index);
+
+  std::vector<std::unique_ptr<Worker>> m_workers;
+  std::vector<std::thread> m_threads;
+  std::atomic<std::size_t> m_pending{ 0 };
+  std::atomic<std::size_t> m_nextQueue{ 0 };
+  std::atomic<std::size_t> m_sleeping{ 0 };
+  std::mutex m_sleepMutex;
+  std::condition_variable m_wakeup;
+  bool m_active{ true };
+};
+
+/**\brief A set of tasks spawned together and waited upon as a unit.
+  *
+  * Tasks spawned into a group may themselves spawn more tasks into the
+  * same group. If any task throws, the first exception is rethrown by
+  * wait() once every task in the group has finished.
+  */
+class SMTKCORE_EXPORT WorkStealingPool::TaskGroup
+{
+public:
+  TaskGroup(WorkStealingPool& pool = WorkStealingPool::instance());
+  /// Waits for outstanding tasks; exceptions are discarded.
+  ~TaskGroup();
+
+  TaskGroup(const TaskGroup&) = delete;
+  TaskGroup& operator=(const TaskGroup&) = delete;
+
+  /// Queue \a task as a member of this group.
+  void spawn(Task&& task);
+
+  /// Block until every task in the group has completed, running pending
+  /// tasks from the pool on the calling thread in the meantime.
+  void wait();
+
+  WorkStealingPool& pool() const { return m_pool; }
+
+private:
+  void finish();
+
+  WorkStealingPool& m_pool;
+  std::atomic<std::size_t> m_outstanding{ 0 };
+  std::mutex m_mutex;
+  std::condition_variable m_done;
+  std::exception_ptr m_exception;
+};
+
+namespace detail
+{
+template<typename Index, typename Functor>
+void splitRange(
+  WorkStealingPool::TaskGroup& group,
+  Index begin,
+  Index end,
+  Index grain,
+  const Functor& functor)
+{
+  // Keep the first half and hand the second half to the pool so that
+  // idle workers steal large blocks first.
+  while (end - begin > grain)
+  {
+    Index middle = begin + (end - begin) / 2;
+    group.spawn([&group, middle, end, grain, &functor]() {
+      splitRange(group, middle, end, grain, functor);
+    });
+    end = middle;
+  }
+  functor(begin, end);
+}
+} // namespace detail
+
+/**\brief Invoke \a functor(first, last) over subranges of [\a begin, \a end).
+  *
+  * The range is recursively halved until subranges hold at most \a grain
+  * indices; halves are spawned on \a pool so that idle workers steal them.
+  * The call returns once every subrange has been processed; it may be
+  * made from inside another task running on the same pool.
+  */
+template<typename Index, typename Functor>
+void parallelFor(
+  WorkStealingPool& pool,
+  Index begin,
+  Index end,
+  Index grain,
+  const Functor& functor)
+{
+  if (end <= begin)
+  {
+    return;
+  }
+  if (grain < 1)
+  {
+    grain = 1;
+  }
+  WorkStealingPool::TaskGroup group(pool);
+  group.spawn([&group, begin, end, grain, &functor]() {
+    detail::splitRange(group, begin, end, grain, functor);
+  });
+  group.wait();
+}
+
+/// Invoke parallelFor on the process-wide pool.
+template<typename Index, typename Functor>
+void parallelFor(Index begin, Index end, Index grain, const Functor& functor)
+{
+  parallelFor(WorkStealingPool::instance(), begin, end, grain, functor);
+}
+
+/**\brief Reduce [\a begin, \a end) in parallel.
+  *
+  * The range is cut into blocks of \a grain indices; \a functor(first, last, init)
+  * reduces each block starting from \a identity and \a combine(lhs, rhs) merges
+  * the block results in index order, so the result is deterministic even
+  * for non-commutative combinations.
+  */
+template<typename Index, typename Value, typename Functor, typename Combine>
+Value parallelReduce(
+  WorkStealingPool& pool,
+  Index begin,
+  Index end,
+  Index grain,
+  const Value& identity,
+  const Functor& functor,
+  const Combine& combine)
+{
+  if (end <= begin)
+  {
+    return identity;
+  }
+  if (grain < 1)
+  {
+    grain = 1;
+  }
+  std::size_t numberOfBlocks = static_cast<std::size_t>((end - begin + grain - 1) / grain);
+  std::vector<Value> partial(numberOfBlocks, identity);
+  parallelFor(
+    pool,
+    std::size_t(0),
+    numberOfBlocks,
+    std::size_t(1),
+    [&](std::size_t first, std::size_t last) {
+      for (std::size_t block = first; block < last; ++block)
+      {
+        Index blockBegin = begin + static_cast<Index>(block) * grain;
+        Index blockEnd = (end - blockBegin > grain) ? blockBegin + grain : end;
+        partial[block] = functor(blockBegin, blockEnd, identity);
+      }
+    });
+  Value result = identity;
+  for (const auto& value : partial)
+  {
+    result = combine(result, value);
+  }
+  return result;
+}
+
+/// Invoke parallelReduce on the process-wide pool.
+template<typename Index, typename Value, typename Functor, typename Combine>
+Value parallelReduce(
+  Index begin,
+  Index end,
+  Index grain,
+  const Value& identity,
+  const Functor& functor,
+  const Combine& combine)
+{
+  return parallelReduce(
+    WorkStealingPool::instance(), begin, end, grain, identity, functor, combine);
+}
+} // namespace common
+} // namespace smtk
+
+#endif // smtk_common_WorkStealingPool_h
@@ -14,6 +14,8 @@
 
 #include "smtk/common/testing/cxx/helpers.h"
 
+#include <fstream>
+#include <iterator>
 #include <map>
 #include <string>
 #include <utility>
@@ -105,12 +107,67 @@ int TestArchive(int /*unused*/, char** const /*unused*/)
     }
   }
 
+  // Files can be read and located without extracting the archive.
+  {
+    smtk::common::Archive archive(archivePath);
+    for (const auto& fileAndContents : filesAndContents)
+    {
+      std::string contents;
+      smtkTest(
+        archive.read(fileAndContents.first, contents), "Could not read " << fileAndContents.first);
+      smtkTest(
+        contents == fileAndContents.second.second, "Read file content differs from original file.");
+    }
+    std::string missing;
+    smtkTest(!archive.read("path/to/nothing", missing), "Read a file not in the archive.");
+
+    const auto& first = *filesAndContents.begin();
+    std::string location = archive.location(first.first);
+    smtkTest(!location.empty(), "Could not locate " << first.first);
+    std::ifstream readFile(location);
+    std::string contents(
+      (std::istreambuf_iterator<char>(readFile)), std::istreambuf_iterator<char>());
+    smtkTest(contents == first.second.second, "Located file content differs from original file.");
+    path directory = path(location).parent_path();
+    smtkTest(
+      std::distance(directory_iterator(directory), directory_iterator()) == 1,
+      "Locating one file extracted others.");
+  }
+
+  // Files may be compressed individually.
+  std::string compressedPath = write_root + "/compressed-archive";
+  {
+    smtk::common::Archive archive(compressedPath);
+    bool compress = false;
+    for (auto& fileAndContents : filesAndContents)
+    {
+      archive.insert(fileAndContents.second.first, fileAndContents.first, compress);
+      compress = !compress;
+    }
+    smtkTest(archive.archive(), "Archive failed to archive compressed files");
+  }
+  {
+    smtk::common::Archive archive(compressedPath);
+    smtkTest(
+      archive.contents().size() == filesAndContents.size(),
+      "Incorrect number of compressed files.");
+    for (const auto& fileAndContents : filesAndContents)
+    {
+      std::string contents;
+      smtkTest(
+        archive.read(fileAndContents.first, contents) &&
+          contents == fileAndContents.second.second,
+        "Compressed file content differs from original file.");
+    }
+  }
+
   for (auto& fileAndContents : filesAndContents)
   {
     cleanup(fileAndContents.second.first);
   }
 
   cleanup(archivePath);
+  cleanup(compressedPath);
 
   return 0;
 }
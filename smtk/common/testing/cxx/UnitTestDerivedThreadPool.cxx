@@ -11,6 +11,7 @@
 
 #include "smtk/common/testing/cxx/helpers.h"
 
+#include <atomic>
 #include <chrono>
 #include <cstring>
 
@@ -42,36 +43,17 @@ public:
   void start() { m_stopped = false; }
 
 private:
-  NO_UBSAN_VPTR void exec() override
+  NO_UBSAN_VPTR void exec(std::packaged_task<bool()>& task) override
   {
-    while (this->m_active)
+    // When stopped, the task is dropped unexecuted; its future then
+    // reports a broken promise instead of a value.
+    if (!m_stopped)
     {
-      std::packaged_task<bool()> task;
-      {
-        std::unique_lock<std::mutex> queueLock(this->m_queueMutex);
-
-        // Access a task from the queue.
-        this->m_condition.wait(queueLock, [this] { return !this->m_queue.empty(); });
-
-        if (!m_stopped)
-        {
-          task = std::move(this->m_queue.front());
-        }
-        else
-        {
-          std::packaged_task<bool()> emptyTask([]() { return bool(); });
-          task = std::move(emptyTask);
-        }
-
-        this->m_queue.pop();
-      }
-
-      // Execute the task.
       task();
     }
   }
 
-  bool m_stopped{ false };
+  std::atomic<bool> m_stopped{ false };
 };
 } // namespace
 
@@ -17,6 +17,7 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
 
 void testSimpleExpression()
 {
@@ -79,6 +80,44 @@ void testAddFunction()
     smtkTest(err == smtk::common::InfixExpressionError::ERROR_NONE, "Expected err to be ERROR_NONE")
 }
 
+void testCompiledProgram()
+{
+  smtk::common::InfixExpressionGrammar infix;
+  smtk::common::InfixExpressionError err = smtk::common::InfixExpressionError::ERROR_NONE;
+
+  auto program = infix.compile("2 * {x} + sqrt({y}) - {x}", err);
+  smtkTest(!!program, "Failed to compile 2 * {x} + sqrt({y}) - {x}.");
+  smtkTest(err == smtk::common::InfixExpressionError::ERROR_NONE, "Expected err to be ERROR_NONE");
+  smtkTest(
+    program->symbols() == std::vector<std::string>({ "x", "y" }),
+    "Expected one slot per distinct subsymbol, in order of appearance.");
+
+  smtkTest(program->evaluate({ 3.0, 16.0 }, err) == 7.0, "Failed to evaluate the program.");
+  smtkTest(program->evaluate({ 1.0, 4.0 }, err) == 3.0, "Failed to re-evaluate the program.");
+
+  // Evaluate the same program over a batch larger than one block.
+  const std::size_t count = 3 * smtk::common::InfixExpressionProgram::BlockSize + 7;
+  std::vector<double> x(count);
+  std::vector<double> y(count);
+  for (std::size_t ii = 0; ii < count; ++ii)
+  {
+    x[ii] = static_cast<double>(ii);
+    y[ii] = static_cast<double>(ii * ii);
+  }
+  std::vector<double> results(count);
+  err = program->evaluate(count, { x.data(), y.data() }, results.data());
+  smtkTest(err == smtk::common::InfixExpressionError::ERROR_NONE, "Expected err to be ERROR_NONE");
+  for (std::size_t ii = 0; ii < count; ++ii)
+  {
+    smtkTest(results[ii] == 2.0 * ii, "Incorrect batch result at " << ii << ".");
+  }
+
+  smtkTest(
+    !infix.compile("foo(7)", err) &&
+      err == smtk::common::InfixExpressionError::ERROR_UNKNOWN_FUNCTION,
+    "Expected compiling foo(7) to fail with ERROR_UNKNOWN_FUNCTION.");
+}
+
 int UnitTestInfixExpressionGrammar(int, char** const)
 {
   testSimpleExpression();
@@ -87,6 +126,7 @@ int UnitTestInfixExpressionGrammar(int, char** const)
   testFailsForInvalidSyntax();
   testFailsForInvalidFunction();
   testAddFunction();
+  testCompiledProgram();
 
   return 0;
 }
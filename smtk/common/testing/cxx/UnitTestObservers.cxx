@@ -11,6 +11,9 @@
 
 #include "smtk/common/testing/cxx/helpers.h"
 
+#include <chrono>
+#include <thread>
+
 namespace
 {
 class Observed
@@ -59,9 +62,44 @@ void TestPriority()
   return;
 }
 
+void TestTiming()
+{
+  Observed observed;
+
+  auto fast = observed.observers().insert([]() {}, 0, false, "fast");
+  auto slow = observed.observers().insert(
+    []() { std::this_thread::sleep_for(std::chrono::milliseconds(2)); }, 0, false, "slow");
+
+  observed();
+  smtkTest(observed.observers().timings().empty(), "timings gathered while disabled");
+
+  observed.observers().setTimingEnabled(true);
+  observed();
+  observed();
+
+  auto timings = observed.observers().timings();
+  smtkTest(timings.size() == 2, "expected timings for 2 observers, got " << timings.size());
+  for (const auto& timing : timings)
+  {
+    smtkTest(timing.second.calls == 2, "expected 2 calls to " << timing.first);
+    smtkTest(timing.second.longest <= timing.second.total, "inconsistent timing");
+    if (timing.first == "slow")
+    {
+      smtkTest(
+        timing.second.longest >= std::chrono::milliseconds(2), "slow observer was not timed");
+    }
+  }
+
+  observed.observers().resetTimings();
+  smtkTest(observed.observers().timings().empty(), "timings were not reset");
+
+  return;
+}
+
 int UnitTestObservers(int /*unused*/, char** const /*unused*/)
 {
   TestPriority();
+  TestTiming();
 
   return 0;
 }
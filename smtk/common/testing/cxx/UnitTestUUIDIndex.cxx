@@ -0,0 +1,109 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/common/UUIDIndex.h"
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+// Generate identifiers that differ only in their leading bytes, which would
+// all collide if the index hashed only the trailing bytes.
+smtk::common::UUID sequentialId(std::uint32_t counter)
+{
+  std::uint8_t bytes[smtk::common::UUID::SIZE] = {};
+  std::memcpy(bytes, &counter, sizeof(counter));
+  return smtk::common::UUID(bytes, bytes + smtk::common::UUID::SIZE);
+}
+
+void checkAgainst(
+  const smtk::common::UUIDIndex<int>& index,
+  const std::map<smtk::common::UUID, int>& expected,
+  const std::vector<smtk::common::UUID>& ids)
+{
+  smtkTest(index.size() == expected.size(), "Index has the wrong size.");
+  for (const auto& id : ids)
+  {
+    auto it = expected.find(id);
+    const int* value = index.find(id);
+    if (it == expected.end())
+    {
+      smtkTest(value == nullptr, "Index holds an erased id.");
+    }
+    else
+    {
+      smtkTest(value && *value == it->second, "Index is missing an id.");
+    }
+  }
+}
+
+void testRandomOperations(bool sequential)
+{
+  std::mt19937 generator(sequential ? 11 : 13);
+  std::vector<smtk::common::UUID> ids;
+  for (std::uint32_t ii = 0; ii < 5000; ++ii)
+  {
+    ids.push_back(sequential ? sequentialId(ii) : smtk::common::UUID::random());
+  }
+
+  smtk::common::UUIDIndex<int> index;
+  std::map<smtk::common::UUID, int> expected;
+  std::uniform_int_distribution<std::size_t> pick(0, ids.size() - 1);
+  for (int ii = 0; ii < 20000; ++ii)
+  {
+    const auto& id = ids[pick(generator)];
+    if (ii % 3 == 2)
+    {
+      smtkTest(
+        index.erase(id) == (expected.erase(id) > 0), "Erase should report whether id was held.");
+    }
+    else
+    {
+      bool inserted = expected.insert(std::make_pair(id, ii)).second;
+      smtkTest(index.insert(id, ii) == inserted, "Insert should reject duplicate ids.");
+    }
+  }
+  checkAgainst(index, expected, ids);
+
+  // Erase everything; every slot must be reusable afterward.
+  for (const auto& id : ids)
+  {
+    index.erase(id);
+  }
+  expected.clear();
+  checkAgainst(index, expected, ids);
+  smtkTest(index.empty(), "Index should be empty.");
+
+  index.reserve(ids.size());
+  for (std::size_t ii = 0; ii < ids.size(); ++ii)
+  {
+    index.insert(ids[ii], static_cast<int>(ii));
+    expected[ids[ii]] = static_cast<int>(ii);
+  }
+  checkAgainst(index, expected, ids);
+
+  index.clear();
+  smtkTest(index.find(ids[0]) == nullptr, "Cleared index should be empty.");
+}
+} // namespace
+
+int UnitTestUUIDIndex(int /*unused*/, char** const /*unused*/)
+{
+  smtk::common::UUIDIndex<int> empty;
+  smtkTest(empty.find(smtk::common::UUID::random()) == nullptr, "Empty index found an id.");
+  smtkTest(!empty.erase(smtk::common::UUID::random()), "Empty index erased an id.");
+
+  testRandomOperations(false);
+  testRandomOperations(true);
+  return 0;
+}
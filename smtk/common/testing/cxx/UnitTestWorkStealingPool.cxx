@@ -0,0 +1,148 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/common/ThreadPool.h"
+#include "smtk/common/WorkStealingPool.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+// Recursively spawn a binary tree of tasks, counting the leaves.
+void spawnTree(
+  smtk::common::WorkStealingPool::TaskGroup& group,
+  int depth,
+  std::atomic<int>& leaves)
+{
+  if (depth == 0)
+  {
+    ++leaves;
+    return;
+  }
+  group.spawn([&group, depth, &leaves]() { spawnTree(group, depth - 1, leaves); });
+  group.spawn([&group, depth, &leaves]() { spawnTree(group, depth - 1, leaves); });
+}
+} // namespace
+
+int UnitTestWorkStealingPool(int /*unused*/, char** const /*unused*/)
+{
+  smtk::common::WorkStealingPool pool(4);
+  smtkTest(pool.numberOfWorkers() == 4, "Expected 4 workers, got " << pool.numberOfWorkers());
+  smtkTest(pool.currentWorkerIndex() == -1, "The main thread is not a worker.");
+
+  // Nested task spawning.
+  {
+    std::atomic<int> leaves(0);
+    smtk::common::WorkStealingPool::TaskGroup group(pool);
+    spawnTree(group, 12, leaves);
+    group.wait();
+    smtkTest(leaves == (1 << 12), "Expected " << (1 << 12) << " leaves, got " << leaves);
+  }
+
+  // parallelFor must visit each index exactly once.
+  {
+    std::vector<int> visits(100000, 0);
+    smtk::common::parallelFor(
+      pool,
+      std::size_t(0),
+      visits.size(),
+      std::size_t(64),
+      [&visits](std::size_t b, std::size_t e) {
+        for (std::size_t ii = b; ii < e; ++ii)
+        {
+          ++visits[ii];
+        }
+      });
+    for (std::size_t ii = 0; ii < visits.size(); ++ii)
+    {
+      smtkTest(visits[ii] == 1, "Index " << ii << " visited " << visits[ii] << " times.");
+    }
+  }
+
+  // parallelReduce combines blocks in order.
+  {
+    long long sum = smtk::common::parallelReduce(
+      pool,
+      0,
+      100001,
+      1000,
+      0LL,
+      [](int b, int e, long long init) {
+        for (int ii = b; ii < e; ++ii)
+        {
+          init += ii;
+        }
+        return init;
+      },
+      [](long long a, long long b) { return a + b; });
+    smtkTest(sum == 5000050000LL, "Bad sum " << sum);
+
+    std::string concatenated = smtk::common::parallelReduce(
+      pool,
+      0,
+      26,
+      3,
+      std::string(),
+      [](int b, int e, std::string init) {
+        for (int ii = b; ii < e; ++ii)
+        {
+          init.push_back(static_cast<char>('a' + ii));
+        }
+        return init;
+      },
+      [](const std::string& a, const std::string& b) { return a + b; });
+    smtkTest(concatenated == "abcdefghijklmnopqrstuvwxyz", "Bad ordering " << concatenated);
+  }
+
+  // Nested parallel loops from inside worker tasks.
+  {
+    std::atomic<int> count(0);
+    smtk::common::parallelFor(pool, 0, 16, 1, [&pool, &count](int b, int e) {
+      for (int ii = b; ii < e; ++ii)
+      {
+        smtk::common::parallelFor(pool, 0, 100, 10, [&count](int bb, int ee) { count += ee - bb; });
+      }
+    });
+    smtkTest(count == 1600, "Nested loops counted " << count);
+  }
+
+  // Exceptions thrown by tasks are rethrown by wait().
+  {
+    bool caught = false;
+    smtk::common::WorkStealingPool::TaskGroup group(pool);
+    group.spawn([]() { throw std::runtime_error("expected"); });
+    try
+    {
+      group.wait();
+    }
+    catch (const std::runtime_error&)
+    {
+      caught = true;
+    }
+    smtkTest(caught, "Task exception was not propagated.");
+  }
+
+  // ThreadPool tasks may enqueue more tasks on the same pool.
+  {
+    smtk::common::ThreadPool<int> threadPool(2);
+    std::future<int> outer = threadPool([&threadPool]() {
+      std::future<int> inner = threadPool([]() { return 2; });
+      // Waiting on a plain future blocks this worker; the other worker
+      // steals the inner task.
+      return inner.get() + 1;
+    });
+    smtkTest(outer.get() == 3, "Nested ThreadPool task returned wrong value.");
+  }
+
+  return 0;
+}
@@ -0,0 +1,206 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/common/ThreadPool.h"
+#include "smtk/common/WorkStealingPool.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <future>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+// Measure task throughput (tasks/sec) for many small tasks.
+//
+// The SingleQueuePool below reproduces the previous ThreadPool implementation
+// (one std::queue of std::packaged_task guarded by one mutex and condition
+// variable) so that it can be compared against the work-stealing pool.
+
+namespace
+{
+class SingleQueuePool
+{
+public:
+  SingleQueuePool(unsigned int numberOfThreads)
+  {
+    for (unsigned int ii = 0; ii < numberOfThreads; ++ii)
+    {
+      m_threads.emplace_back([this]() { this->exec(); });
+    }
+  }
+
+  ~SingleQueuePool()
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_active = false;
+    }
+    m_condition.notify_all();
+    for (auto& thread : m_threads)
+    {
+      thread.join();
+    }
+  }
+
+  std::future<void> operator()(std::function<void()>&& task)
+  {
+    std::future<void> future;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_queue.emplace(task);
+      future = m_queue.back().get_future();
+    }
+    m_condition.notify_one();
+    return future;
+  }
+
+private:
+  void exec()
+  {
+    while (true)
+    {
+      std::packaged_task<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(lock, [this] { return !m_queue.empty() || !m_active; });
+        if (m_queue.empty())
+        {
+          return;
+        }
+        task = std::move(m_queue.front());
+        m_queue.pop();
+      }
+      task();
+    }
+  }
+
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  std::queue<std::packaged_task<void()>> m_queue;
+  std::vector<std::thread> m_threads;
+  bool m_active{ true };
+};
+
+class Timer
+{
+public:
+  Timer()
+    : m_start(std::chrono::steady_clock::now())
+  {
+  }
+  double elapsed() const
+  {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+  }
+
+private:
+  std::chrono::steady_clock::time_point m_start;
+};
+
+// A small amount of work so that queue overhead dominates.
+void work(std::atomic<long>& counter)
+{
+  counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+void report(const std::string& label, long numberOfTasks, double deltaT)
+{
+  std::cout << "  " << label << ": " << numberOfTasks << " tasks " << deltaT << " seconds "
+            << (numberOfTasks / deltaT) << " tasks/sec\n";
+}
+
+// Submit tasks from several producer threads at once, as happens when many
+// operations are launched concurrently.
+template<typename Submit>
+double produce(unsigned int numberOfProducers, long tasksPerProducer, Submit submit)
+{
+  Timer timer;
+  std::vector<std::thread> producers;
+  for (unsigned int pp = 0; pp < numberOfProducers; ++pp)
+  {
+    producers.emplace_back([&submit, tasksPerProducer]() {
+      std::vector<std::future<void>> futures;
+      futures.reserve(static_cast<std::size_t>(tasksPerProducer));
+      for (long ii = 0; ii < tasksPerProducer; ++ii)
+      {
+        futures.push_back(submit());
+      }
+      for (auto& future : futures)
+      {
+        future.wait();
+      }
+    });
+  }
+  for (auto& producer : producers)
+  {
+    producer.join();
+  }
+  return timer.elapsed();
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  long numberOfTasks = argc > 1 ? std::atol(argv[1]) : 200000;
+  unsigned int numberOfThreads = std::thread::hardware_concurrency();
+  unsigned int numberOfProducers = numberOfThreads > 1 ? numberOfThreads / 2 : 1;
+  long tasksPerProducer = numberOfTasks / numberOfProducers;
+  std::atomic<long> counter(0);
+
+  std::cout << numberOfThreads << " workers, " << numberOfProducers << " producers\n";
+
+  {
+    SingleQueuePool pool(numberOfThreads);
+    double deltaT = produce(numberOfProducers, tasksPerProducer, [&]() {
+      return pool([&counter]() { work(counter); });
+    });
+    report("single-queue pool", tasksPerProducer * numberOfProducers, deltaT);
+  }
+
+  {
+    smtk::common::ThreadPool<void> pool(numberOfThreads);
+    double deltaT = produce(numberOfProducers, tasksPerProducer, [&]() {
+      return pool([&counter]() { work(counter); });
+    });
+    report("smtk::common::ThreadPool", tasksPerProducer * numberOfProducers, deltaT);
+  }
+
+  {
+    smtk::common::WorkStealingPool pool(numberOfThreads);
+    Timer timer;
+    {
+      smtk::common::WorkStealingPool::TaskGroup group(pool);
+      for (long ii = 0; ii < numberOfTasks; ++ii)
+      {
+        group.spawn([&counter]() { work(counter); });
+      }
+      group.wait();
+    }
+    report("WorkStealingPool::TaskGroup", numberOfTasks, timer.elapsed());
+  }
+
+  {
+    smtk::common::WorkStealingPool pool(numberOfThreads);
+    Timer timer;
+    smtk::common::parallelFor(pool, 0L, numberOfTasks, 1L, [&counter](long b, long e) {
+      for (long ii = b; ii < e; ++ii)
+      {
+        work(counter);
+      }
+    });
+    report("parallelFor (grain 1)", numberOfTasks, timer.elapsed());
+  }
+
+  return counter.load() > 0 ? 0 : 1;
+}
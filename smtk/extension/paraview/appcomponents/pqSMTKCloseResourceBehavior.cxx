@@ -49,6 +49,7 @@
 #include <QMenu>
 #include <QMenuBar>
 
+#include <set>
 #include <stdexcept>
 #include <string>
 
@@ -160,10 +161,12 @@ void pqCloseResourceReaction::closeResource()
     }
     // Remove it from the active selection
     {
-      smtk::view::Selection::SelectionMap& selections =
-        const_cast<smtk::view::Selection::SelectionMap&>(
-          smtk::view::Selection::instance()->currentSelection());
-      selections.erase(resource);
+      std::set<smtk::resource::ResourcePtr> removed{ resource };
+      smtk::view::Selection::instance()->modifySelection(
+        removed,
+        "pqSMTKCloseResourceBehavior",
+        0,
+        smtk::view::SelectionAction::UNFILTERED_SUBTRACT);
     }
   }
 
@@ -383,16 +383,15 @@ void pqSMTKOperationPanel::operationListDoubleClicked(QListWidgetItem* item)
     auto index = qvariant_cast<smtk::operation::Operation::Index>(opIdx);
     auto opInstance = m_availableOperations->operationManager()->create(index);
     auto seln = m_availableOperations->selection();
-    const auto& smap = seln->currentSelection();
     auto params = opInstance->parameters();
     bool anyAssociations = false;
-    for (const auto& entry : smap)
+    for (const auto& entry : seln->entries())
     {
       if (
-        (entry.second & 0x01) ==
+        (entry.value & 0x01) ==
         0x01) // FIXME: properly select entities from the map based on a specific bit flag
       {
-        params->associate(entry.first);
+        params->associate(entry.object);
         anyAssociations = true;
       }
     }
@@ -104,7 +104,7 @@ void vtkSMTKEncodeSelection::ProcessRawSelection(
   int selnValue = vtkSMPropertyHelper(wrapper->getProxy(), "SelectedValue").GetAsInt();
   auto smtkSelection = wrapper->smtkSelection();
   if (
-    !smtkSelection->currentSelection().empty() &&
+    !smtkSelection->entries().empty() &&
     modifier == pqView::SelectionModifier::PV_SELECTION_DEFAULT)
   {
     std::set<smtk::resource::PersistentObjectPtr> blank;
@@ -651,9 +651,9 @@ bool vtkSMTKResourceRepresentation::ApplyDefaultStyle(
 {
   bool atLeastOneSelected = false;
   smtk::attribute::Attribute::Ptr attr;
-  for (const auto& item : seln->currentSelection())
+  for (const auto& item : seln->entries())
   {
-    if (item.second <= 0)
+    if (item.value <= 0)
     {
       // Should never happen.
       continue;
@@ -661,7 +661,7 @@ bool vtkSMTKResourceRepresentation::ApplyDefaultStyle(
 
     // If the selected item is a resource, ask for its footprint directly.
     std::unordered_set<smtk::resource::PersistentObject*> footprint;
-    auto resource = std::dynamic_pointer_cast<smtk::resource::Resource>(item.first);
+    auto resource = std::dynamic_pointer_cast<smtk::resource::Resource>(item.object);
     if (resource)
     {
       if (resource->queries().contains<smtk::geometry::SelectionFootprint>())
@@ -677,7 +677,7 @@ bool vtkSMTKResourceRepresentation::ApplyDefaultStyle(
     }
 
     // If the selected item is a component, ask its resource for the footprint.
-    auto component = std::dynamic_pointer_cast<smtk::resource::Component>(item.first);
+    auto component = std::dynamic_pointer_cast<smtk::resource::Component>(item.object);
     if (component && component->resource())
     {
       if (component->resource()->queries().contains<smtk::geometry::SelectionFootprint>())
@@ -930,7 +930,7 @@ void vtkSMTKResourceRepresentation::UpdateSelection(
     return;
   }
 
-  auto selection = sm->currentSelection();
+  const auto& selection = sm->entries();
   if (selection.empty())
   {
     actor->SetVisibility(0);
@@ -942,19 +942,19 @@ void vtkSMTKResourceRepresentation::UpdateSelection(
   // FIXME: This is the wrong thing to loop over -- since we don't have a map
   //        from component (or UUID) to block ID, the call to FindNode is slow.
   //        If we loop over blocks instead, we can search the selection map quickly!
-  for (auto& item : selection)
+  for (const auto& item : selection)
   {
-    if (item.second <= 0)
+    if (item.value <= 0)
     {
       continue;
     }
-    auto* matchedBlock = this->FindNode(data, item.first->id().toString());
+    auto* matchedBlock = this->FindNode(data, item.object->id().toString());
     if (matchedBlock)
     {
       propVis = 1;
       blockAttr->SetBlockVisibility(matchedBlock, true);
       blockAttr->SetBlockColor(
-        matchedBlock, item.second > 1 ? this->HoverColor : this->SelectionColor);
+        matchedBlock, item.value > 1 ? this->HoverColor : this->SelectionColor);
     }
   }
   actor->SetVisibility(propVis);
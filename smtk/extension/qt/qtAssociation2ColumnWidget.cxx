@@ -847,9 +847,7 @@ void qtAssociation2ColumnWidget::hoverRow(const QModelIndex& idx)
   }
   // Add new hover state
   auto hoverMask = uiManager->hoverBit();
-  const auto& selnMap = selection->currentSelection();
-  auto cvit = selnMap.find(obj);
-  int sv = (cvit == selnMap.end() ? 0 : cvit->second) | hoverMask;
+  int sv = selection->selectionValue(obj.get()) | hoverMask;
   smtk::resource::PersistentObjectSet objs;
   objs.insert(obj);
   selection->modifySelection(
@@ -58,7 +58,7 @@ public:
     QList<smtk::attribute::DefinitionPtr> defs;
     Q_FOREACH (DefinitionPtr attDef, this->AllDefs)
     {
-      if (attDef->categories().passes(attResource->activeCategories()))
+      if (attDef->categories().passes(attResource->activeCategoryMask()))
       {
         defs.push_back(attDef);
       }
@@ -606,13 +606,13 @@ void qtOperationTypeModel::updateSelectionAssociability(
       {
         std::size_t mismatches = 0;
         std::size_t matches = 0;
-        for (const auto& entry : selection->currentSelection())
+        for (const auto& entry : selection->entries())
         {
           if (
-            (m_selectionExact && entry.second == m_selectionValue) ||
-            (!m_selectionExact && (entry.second & m_selectionValue) == m_selectionValue))
+            (m_selectionExact && entry.value == m_selectionValue) ||
+            (!m_selectionExact && (entry.value & m_selectionValue) == m_selectionValue))
           {
-            if (associations->isValueValid(entry.first))
+            if (associations->isValueValid(entry.object))
             {
               ++matches;
             }
@@ -521,9 +521,7 @@ void qtReferenceItemEditor::highlightItem(int index)
   }
   // Add new hover state
   auto hoverMask = uiManager->hoverBit();
-  const auto& selnMap = selection->currentSelection();
-  auto cvit = selnMap.find(selectedObject);
-  int sv = (cvit == selnMap.end() ? 0 : cvit->second) | hoverMask;
+  int sv = selection->selectionValue(selectedObject.get()) | hoverMask;
   smtk::resource::PersistentObjectSet objs;
   objs.insert(selectedObject);
   selection->modifySelection(
@@ -251,8 +251,7 @@ void qtResourceBrowser::sendSMTKSelectionToPanel(
         smtk::resource::PersistentObjectPtr obj = phrase->relatedObject();
         if (obj)
         {
-          auto it = seln->currentSelection().find(obj);
-          if (it != seln->currentSelection().end() && (it->second & 0x01))
+          if (seln->selectionValue(obj.get()) & 0x01)
           {
             auto qidx = qmodel->indexFromPath(path);
             qseln.select(qidx, qidx);
@@ -335,9 +334,7 @@ void qtResourceBrowser::hoverRow(const QModelIndex& idx)
   }
 
   // Add new hover state
-  const auto& selnMap = m_p->m_seln->currentSelection();
-  auto cvit = selnMap.find(comp);
-  int sv = (cvit == selnMap.end() ? 0 : cvit->second) | m_p->m_hoverValue;
+  int sv = m_p->m_seln->selectionValue(comp.get()) | m_p->m_hoverValue;
   csetAdd.clear();
   csetAdd.insert(comp);
   m_p->m_seln->modifySelection(
@@ -24,6 +24,22 @@ bool NodeSet::Compare::operator()(
   return (!lhs ? true : (!rhs ? false : lhs->id() < rhs->id()));
 }
 
+NodeSet::NodeSet(const NodeSet& other)
+  : m_nodes(other.m_nodes)
+{
+  this->reindex();
+}
+
+NodeSet& NodeSet::operator=(const NodeSet& other)
+{
+  if (this != &other)
+  {
+    m_nodes = other.m_nodes;
+    this->reindex();
+  }
+  return *this;
+}
+
 const NodeSet::Container& NodeSet::nodes() const
 {
   return m_nodes;
@@ -39,64 +55,47 @@ void NodeSet::visit(std::function<void(const smtk::resource::ComponentPtr&)>& v)
 
 NodeSet::NodeType NodeSet::find(const smtk::common::UUID& uuid) const
 {
-  struct QueryKey : resource::Component
-  {
-    QueryKey(const smtk::common::UUID& id)
-      : m_id(id)
-    {
-    }
-    const smtk::common::UUID& id() const final { return m_id; }
-    bool setId(const smtk::common::UUID&) final { return false; }
-    const smtk::resource::ResourcePtr resource() const final
-    {
-      return smtk::resource::ResourcePtr();
-    }
-
-    const smtk::common::UUID& m_id;
-  };
-
-  auto it = m_nodes.find(std::make_shared<QueryKey>(uuid));
-  if (it != m_nodes.end())
-  {
-    return *it;
-  }
-  return std::shared_ptr<smtk::resource::Component>();
+  const NodeType* const* node = m_index.find(uuid);
+  return node ? **node : NodeType();
 }
 
 smtk::resource::Component* NodeSet::component(const smtk::common::UUID& uuid) const
 {
-  struct QueryKey : resource::Component
-  {
-    QueryKey(const smtk::common::UUID& id)
-      : m_id(id)
-    {
-    }
-    const smtk::common::UUID& id() const final { return m_id; }
-    bool setId(const smtk::common::UUID&) final { return false; }
-    const smtk::resource::ResourcePtr resource() const final
-    {
-      return smtk::resource::ResourcePtr();
-    }
-
-    const smtk::common::UUID& m_id;
-  };
+  const NodeType* const* node = m_index.find(uuid);
+  return node ? (*node)->get() : nullptr;
+}
 
-  auto it = m_nodes.find(std::make_shared<QueryKey>(uuid));
-  if (it != m_nodes.end())
+std::size_t NodeSet::eraseNodes(const smtk::graph::ComponentPtr& node)
+{
+  std::size_t count = m_nodes.erase(node);
+  if (count > 0 && node)
   {
-    return it->get();
+    m_index.erase(node->id());
   }
-  return nullptr;
+  return count;
 }
 
-std::size_t NodeSet::eraseNodes(const smtk::graph::ComponentPtr& node)
+bool NodeSet::insertNode(const smtk::graph::ComponentPtr& node)
 {
-  return m_nodes.erase(node);
+  auto result = m_nodes.insert(node);
+  if (result.second && node)
+  {
+    m_index.insert(node->id(), &*result.first);
+  }
+  return result.second;
 }
 
-bool NodeSet::insertNode(const smtk::graph::ComponentPtr& node)
+void NodeSet::reindex()
 {
-  return m_nodes.insert(node).second;
+  m_index.clear();
+  m_index.reserve(m_nodes.size());
+  for (const auto& node : m_nodes)
+  {
+    if (node)
+    {
+      m_index.insert(node->id(), &node);
+    }
+  }
 }
 
 } // namespace graph
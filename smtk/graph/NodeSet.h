@@ -13,6 +13,7 @@
 
 #include "smtk/PublicPointerDefs.h"
 #include "smtk/common/UUID.h"
+#include "smtk/common/UUIDIndex.h"
 
 #include <functional>
 #include <memory>
@@ -23,6 +24,12 @@ namespace smtk
 namespace graph
 {
 
+/**\brief The default node storage for graph resources.
+  *
+  * Nodes are held in a set ordered by UUID. A hash index from UUID to each
+  * element of the set is kept alongside it so that find() and component()
+  * run in constant time without allocating.
+  */
 class SMTKCORE_EXPORT NodeSet
 {
   struct SMTKCORE_EXPORT Compare
@@ -36,6 +43,12 @@ class SMTKCORE_EXPORT NodeSet
   using Container = std::set<NodeType, Compare>;
 
 public:
+  NodeSet() = default;
+  NodeSet(const NodeSet& other);
+  NodeSet(NodeSet&&) = default;
+  NodeSet& operator=(const NodeSet& other);
+  NodeSet& operator=(NodeSet&&) = default;
+
   const Container& nodes() const;
 
   void visit(std::function<void(const smtk::resource::ComponentPtr&)>& v) const;
@@ -47,7 +60,11 @@ protected:
   bool insertNode(const smtk::graph::ComponentPtr& node);
 
 private:
+  void reindex();
+
   Container m_nodes;
+  // Elements of a std::set never move, so the index may point into m_nodes.
+  smtk::common::UUIDIndex<const NodeType*> m_index;
 };
 
 } // namespace graph
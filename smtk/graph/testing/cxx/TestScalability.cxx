@@ -172,6 +172,43 @@ int TestScalability(int argc, char* argv[])
   std::cout << "Visited " << num_node * degree_node << " arc(s) in " << timer.elapsed() << "("
             << timer.units() << ")\n";
 
+  // Look up every node by its UUID.
+  std::vector<smtk::common::UUID> ids(num_node);
+  for (int ii = 0; ii < num_node; ii++)
+  {
+    ids[ii] = nodes[ii]->id();
+  }
+
+  Timer<std::chrono::microseconds> lookupTimer;
+  lookupTimer.tic();
+  int nfound = 0;
+  for (const auto& id : ids)
+  {
+    nfound += (resource->component(id) != nullptr) ? 1 : 0;
+  }
+  lookupTimer.toc();
+  std::cout << "Looked up " << num_node << " component(s) in " << lookupTimer.elapsed() << "("
+            << lookupTimer.units() << ")\n";
+
+  lookupTimer.tic();
+  for (const auto& id : ids)
+  {
+    nfound += resource->find(id) ? 1 : 0;
+  }
+  lookupTimer.toc();
+  std::cout << "Found " << num_node << " node(s) in " << lookupTimer.elapsed() << "("
+            << lookupTimer.units() << ")\n";
+  if (nfound != 2 * num_node)
+  {
+    std::cerr << "Only " << nfound << " of " << 2 * num_node << " lookups succeeded.\n";
+    return 1;
+  }
+  if (resource->component(smtk::common::UUID::random()))
+  {
+    std::cerr << "Found a node with an unused UUID.\n";
+    return 1;
+  }
+
   std::cout << std::endl;
   // Remove half of the nodes
   timer.tic();
@@ -185,6 +222,29 @@ int TestScalability(int argc, char* argv[])
   std::cout << "Removed " << k << " node(s) in " << timer.elapsed() << "(" << timer.units()
             << ")\n";
 
+  // Removed nodes must no longer resolve; the remaining ones must.
+  for (int ii = 0; ii < num_node; ii++)
+  {
+    if ((resource->component(ids[ii]) == nullptr) != (ii % 2 == 0))
+    {
+      std::cerr << "Node " << ii << " was not " << (ii % 2 ? "found" : "removed") << ".\n";
+      return 1;
+    }
+  }
+
+  // Changing a node's UUID must re-index it.
+  if (num_node > 1)
+  {
+    smtk::common::UUID newId = smtk::common::UUID::random();
+    if (
+      !nodes[1]->setId(newId) || resource->component(ids[1]) ||
+      resource->component(newId) != nodes[1].get())
+    {
+      std::cerr << "Node was not re-indexed after its UUID changed.\n";
+      return 1;
+    }
+  }
+
   nodes.resize(0);
   nodes.shrink_to_fit();
 
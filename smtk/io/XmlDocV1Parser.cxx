@@ -1524,6 +1524,12 @@ void XmlDocV1Parser::processGroupDef(pugi::xml_node& node, attribute::GroupItemD
     }
   }
 
+  xatt = node.attribute("Columnar");
+  if (xatt)
+  {
+    def->setUsesColumnarStorage(xatt.as_bool());
+  }
+
   xatt = node.attribute("IsConditional");
   if (xatt)
   {
@@ -2316,10 +2322,15 @@ void XmlDocV1Parser::processGroupItem(pugi::xml_node& node, attribute::GroupItem
   {
     return;
   }
-  // There are 2 formats - one is for any number of sub groups and the other
-  // is a custom case is for 1 subGroup
+  // There are 3 formats - one is for any number of sub groups, another is a
+  // custom case for 1 subGroup, and the last holds the values of columnar groups
   xml_node cluster, clusters = node.child("GroupClusters");
-  if (clusters)
+  xml_node columns = node.child("Columns");
+  if (columns)
+  {
+    this->processGroupColumns(columns, item);
+  }
+  else if (clusters)
   {
     for (cluster = clusters.first_child(), i = 0; cluster; cluster = cluster.next_sibling(), ++i)
     {
@@ -2363,6 +2374,73 @@ void XmlDocV1Parser::processGroupItem(pugi::xml_node& node, attribute::GroupItem
   }
 }
 
+void XmlDocV1Parser::processGroupColumns(pugi::xml_node& node, attribute::GroupItemPtr item)
+{
+  const auto* def = static_cast<const GroupItemDefinition*>(item->definition().get());
+  std::size_t n = item->numberOfGroups();
+  for (xml_node column = node.child("Column"); column; column = column.next_sibling("Column"))
+  {
+    std::size_t ith = column.attribute("Ith").as_uint();
+    auto itemDef = def->itemDefinition(static_cast<int>(ith));
+    if (!itemDef)
+    {
+      smtkErrorMacro(
+        m_logger, "Invalid column: " << ith << " for Group Item: " << item->name());
+      continue;
+    }
+    xml_attribute xatt = column.attribute("Sep");
+    std::string sep = xatt ? xatt.value() : ",";
+    std::vector<bool> isSet(n, true);
+    xatt = column.attribute("Unset");
+    if (xatt)
+    {
+      for (const auto& unset : smtk::common::StringUtil::split(xatt.value(), ",", true, true))
+      {
+        std::size_t index = std::strtoul(unset.c_str(), nullptr, 10);
+        if (index < n)
+        {
+          isSet[index] = false;
+        }
+      }
+    }
+    bool ok = false;
+    switch (itemDef->type())
+    {
+      case attribute::Item::IntType:
+      {
+        auto values = getValueFromXMLElement(column, sep, std::vector<int>());
+        ok = item->setColumnValues(ith, values, &isSet);
+      }
+      break;
+      case attribute::Item::DoubleType:
+      {
+        auto values = getValueFromXMLElement(column, sep, std::vector<double>());
+        ok = item->setColumnValues(ith, values, &isSet);
+      }
+      break;
+      case attribute::Item::StringType:
+      {
+        auto values = getValueFromXMLElement(column, sep, std::vector<std::string>());
+        // A single empty string is written as empty text.
+        if (values.empty() && n == 1)
+        {
+          values.emplace_back();
+        }
+        ok = item->setColumnValues(ith, values, &isSet);
+      }
+      break;
+      default:
+        break;
+    }
+    if (!ok)
+    {
+      smtkErrorMacro(
+        m_logger,
+        "Column: " << ith << " could not be set for Group Item: " << item->name());
+    }
+  }
+}
+
 bool XmlDocV1Parser::getColor(xml_node& node, double color[4], const std::string& colorName)
 {
   std::string s = node.text().get();
@@ -112,6 +112,7 @@ protected:
   virtual void processFileItem(pugi::xml_node& node, smtk::attribute::FileItemPtr item);
   virtual void processFileDef(pugi::xml_node& node, smtk::attribute::FileItemDefinitionPtr idef);
   void processGroupItem(pugi::xml_node& node, smtk::attribute::GroupItemPtr item);
+  void processGroupColumns(pugi::xml_node& node, smtk::attribute::GroupItemPtr item);
   void processGroupDef(pugi::xml_node& node, smtk::attribute::GroupItemDefinitionPtr idef);
   void processIntItem(pugi::xml_node& node, smtk::attribute::IntItemPtr item);
   void processIntDef(pugi::xml_node& node, smtk::attribute::IntItemDefinitionPtr idef);
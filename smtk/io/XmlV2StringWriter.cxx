@@ -1045,6 +1045,10 @@ void XmlV2StringWriter::processGroupDef(
         static_cast<unsigned int>(idef->maxNumberOfGroups());
     }
   }
+  if (idef->usesColumnarStorage())
+  {
+    node.append_attribute("Columnar").set_value("true");
+  }
 
   // Write out the condition information if needed
   if (idef->isConditional())
@@ -1433,6 +1437,11 @@ void XmlV2StringWriter::processGroupItem(pugi::xml_node& node, attribute::GroupI
   if (item->isExtensible())
   {
     node.append_attribute("NumberOfGroups").set_value(static_cast<unsigned int>(n));
+    if (item->isColumnar())
+    {
+      this->processGroupColumns(node, item);
+      return;
+    }
   }
   // Optimize for number of required groups = 1
   else if (numRequiredGroups == 1)
@@ -1459,6 +1468,61 @@ void XmlV2StringWriter::processGroupItem(pugi::xml_node& node, attribute::GroupI
   }
 }
 
+void XmlV2StringWriter::processGroupColumns(pugi::xml_node& node, attribute::GroupItemPtr item)
+{
+  const auto* def = static_cast<const GroupItemDefinition*>(item->definition().get());
+  xml_node columns = node.append_child("Columns");
+  std::size_t m = item->numberOfItemsPerGroup();
+  for (std::size_t j = 0; j < m; j++)
+  {
+    xml_node column = columns.append_child("Column");
+    column.append_attribute("Ith").set_value(static_cast<unsigned int>(j));
+    std::vector<bool> isSet;
+    std::string sep;
+    std::string text;
+    switch (def->itemDefinition(static_cast<int>(j))->type())
+    {
+      case Item::IntType:
+      {
+        std::vector<int> values;
+        item->columnValues(j, values, &isSet);
+        text = this->concatenate(values, sep, &m_logger);
+      }
+      break;
+      case Item::DoubleType:
+      {
+        std::vector<double> values;
+        item->columnValues(j, values, &isSet);
+        text = this->concatenate(values, sep, &m_logger);
+      }
+      break;
+      default:
+      {
+        std::vector<std::string> values;
+        item->columnValues(j, values, &isSet);
+        text = this->concatenate(values, sep, &m_logger);
+      }
+      break;
+    }
+    column.append_attribute("Sep").set_value(sep.c_str());
+    std::vector<std::size_t> unset;
+    for (std::size_t i = 0; i < isSet.size(); i++)
+    {
+      if (!isSet[i])
+      {
+        unset.push_back(i);
+      }
+    }
+    if (!unset.empty())
+    {
+      std::string unsetSep = ",";
+      column.append_attribute("Unset").set_value(
+        this->concatenate(unset, unsetSep, &m_logger).c_str());
+    }
+    column.text().set(text.c_str());
+  }
+}
+
 void XmlV2StringWriter::processStyles()
 {
   // Since Styles don't have directory information (actually it can't since style can be
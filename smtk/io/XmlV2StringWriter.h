@@ -93,6 +93,7 @@ protected:
     pugi::xml_node& node,
     smtk::attribute::FileSystemItemDefinitionPtr idef);
   void processGroupItem(pugi::xml_node& node, smtk::attribute::GroupItemPtr item);
+  void processGroupColumns(pugi::xml_node& node, smtk::attribute::GroupItemPtr item);
   void processGroupDef(pugi::xml_node& node, smtk::attribute::GroupItemDefinitionPtr idef);
   void processIntItem(pugi::xml_node& node, smtk::attribute::IntItemPtr item);
   void processIntDef(pugi::xml_node& node, smtk::attribute::IntItemDefinitionPtr idef);
@@ -58,6 +58,7 @@ CellSet& CellSet::operator=(const CellSet& other)
 {
   m_parent = other.m_parent;
   m_range = other.m_range;
+  m_index = other.m_index;
   return *this;
 }
 
@@ -79,6 +80,7 @@ bool CellSet::append(const CellSet& other)
   if (can_append)
   {
     m_range += other.m_range;
+    m_index.reset();
   }
   return can_append;
 }
@@ -109,7 +111,7 @@ smtk::mesh::PointSet CellSet::points(bool boundary_only) const
 smtk::mesh::PointSet CellSet::points(std::size_t position) const
 {
   smtk::mesh::HandleRange singleIndex;
-  singleIndex.insert(smtk::mesh::rangeElement(m_range, position));
+  singleIndex.insert(this->indexedRange().element(position));
 
   const smtk::mesh::InterfacePtr& iface = m_parent->interface();
   smtk::mesh::HandleRange range = iface->getPoints(singleIndex);
@@ -124,10 +126,15 @@ smtk::mesh::PointConnectivity CellSet::pointConnectivity() const
 smtk::mesh::PointConnectivity CellSet::pointConnectivity(std::size_t position) const
 {
   smtk::mesh::HandleRange singleIndex;
-  singleIndex.insert(smtk::mesh::rangeElement(m_range, position));
+  singleIndex.insert(this->indexedRange().element(position));
   return smtk::mesh::PointConnectivity(m_parent, singleIndex);
 }
 
+const smtk::mesh::IndexedHandleRange& CellSet::indexedRange() const
+{
+  return smtk::mesh::cachedIndex(m_index, m_range);
+}
+
 /**\brief Get the parent resource that this meshset belongs to.
   *
   */
@@ -144,8 +151,11 @@ CellSet set_intersect(const CellSet& a, const CellSet& b)
     return smtk::mesh::CellSet(a.m_parent, smtk::mesh::HandleRange());
   }
 
-  smtk::mesh::HandleRange result = a.m_range & b.m_range;
-  return smtk::mesh::CellSet(a.m_parent, result);
+  smtk::mesh::IndexedHandleRange index =
+    smtk::mesh::rangeIntersect(a.indexedRange(), b.indexedRange());
+  smtk::mesh::CellSet result(a.m_parent, index.range());
+  result.m_index = std::make_shared<const smtk::mesh::IndexedHandleRange>(std::move(index));
+  return result;
 }
 
 //subtract mesh b from a, placing the results in the return mesh set
@@ -156,8 +166,11 @@ CellSet set_difference(const CellSet& a, const CellSet& b)
     return smtk::mesh::CellSet(a.m_parent, smtk::mesh::HandleRange());
   }
 
-  smtk::mesh::HandleRange result = a.m_range - b.m_range;
-  return smtk::mesh::CellSet(a.m_parent, result);
+  smtk::mesh::IndexedHandleRange index =
+    smtk::mesh::rangeSubtract(a.indexedRange(), b.indexedRange());
+  smtk::mesh::CellSet result(a.m_parent, index.range());
+  result.m_index = std::make_shared<const smtk::mesh::IndexedHandleRange>(std::move(index));
+  return result;
 }
 
 //union two mesh sets, placing the results in the return mesh set
@@ -168,8 +181,11 @@ CellSet set_union(const CellSet& a, const CellSet& b)
     return smtk::mesh::CellSet(a.m_parent, smtk::mesh::HandleRange());
   }
 
-  smtk::mesh::HandleRange result = a.m_range | b.m_range;
-  return smtk::mesh::CellSet(a.m_parent, result);
+  smtk::mesh::IndexedHandleRange index =
+    smtk::mesh::rangeUnion(a.indexedRange(), b.indexedRange());
+  smtk::mesh::CellSet result(a.m_parent, index.range());
+  result.m_index = std::make_shared<const smtk::mesh::IndexedHandleRange>(std::move(index));
+  return result;
 }
 
 //intersect two cell sets at the point id level, all cells from b which
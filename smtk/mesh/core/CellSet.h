@@ -16,6 +16,7 @@
 
 #include "smtk/mesh/core/DimensionTypes.h"
 #include "smtk/mesh/core/Handle.h"
+#include "smtk/mesh/core/IndexedHandleRange.h"
 #include "smtk/mesh/core/PointConnectivity.h"
 #include "smtk/mesh/core/PointSet.h"
 #include "smtk/mesh/core/QueryTypes.h"
@@ -97,12 +98,17 @@ public:
   //get the underlying HandleRange that this CellSet represents
   const smtk::mesh::HandleRange& range() const { return m_range; }
 
+  //get a random-access index over the underlying HandleRange. The index is
+  //built on first use and shared with copies of this CellSet.
+  const smtk::mesh::IndexedHandleRange& indexedRange() const;
+
   //get the underlying resource that this CellSet belongs to
   const smtk::mesh::ResourcePtr& resource() const;
 
 private:
   smtk::mesh::ResourcePtr m_parent;
   smtk::mesh::HandleRange m_range; //range of cell ids
+  mutable std::shared_ptr<const smtk::mesh::IndexedHandleRange> m_index;
 };
 
 //Function that provide set operations on CellSets
@@ -10,6 +10,8 @@
 
 #include "smtk/mesh/core/Handle.h"
 
+#include <limits>
+
 namespace smtk
 {
 namespace mesh
@@ -27,7 +29,19 @@ const_element_iterator rangeElementsEnd(const HandleRange& range)
 
 Handle rangeElement(const HandleRange& range, std::size_t i)
 {
-  return *std::next(boost::icl::elements_begin(range), i);
+  // Skip whole intervals rather than individual elements. For repeated
+  // lookups, use an IndexedHandleRange instead.
+  for (const auto& interval : range)
+  {
+    std::size_t length = (interval.upper() - interval.lower()) + 1;
+    if (i < length)
+    {
+      return interval.lower() + i;
+    }
+    i -= length;
+  }
+  // \a i is out of range.
+  return std::numeric_limits<Handle>::max();
 }
 
 bool rangeContains(const HandleRange& range, Handle i)
@@ -53,7 +53,9 @@ SMTKCORE_EXPORT const_element_iterator rangeElementsBegin(const HandleRange&);
 /// Return an iterator to the last element in the range
 SMTKCORE_EXPORT const_element_iterator rangeElementsEnd(const HandleRange&);
 
-/// Given a handle range and an index \a i, return the i-th handle in the range
+/// Given a handle range and an index \a i, return the i-th handle in the range.
+/// This is linear in the number of intervals; use IndexedHandleRange when
+/// performing many lookups on the same range.
 SMTKCORE_EXPORT Handle rangeElement(const HandleRange&, std::size_t);
 
 /// Return true if the handle is contained within the handle range
@@ -66,7 +68,8 @@ SMTKCORE_EXPORT bool rangeContains(const HandleRange&, const HandleInterval&);
 /// handle range
 SMTKCORE_EXPORT bool rangeContains(const HandleRange& super, const HandleRange& sub);
 
-/// Return the element index of a handle value
+/// Return the element index of a handle value. This is linear in the number
+/// of intervals; use IndexedHandleRange when performing many lookups.
 SMTKCORE_EXPORT std::size_t rangeIndex(const HandleRange&, Handle);
 
 /// Return the number of intervals in the range
@@ -0,0 +1,166 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/core/InMemoryPointLocatorImpl.h"
+
+namespace smtk
+{
+namespace mesh
+{
+
+InMemoryPointLocatorImpl::InMemoryPointLocatorImpl(
+  std::size_t numPoints,
+  const std::function<std::array<double, 3>(std::size_t)>& coordinates,
+  Structure structure)
+  : m_numPoints(numPoints)
+{
+  if (structure == Structure::HashGrid)
+  {
+    m_hashGrid.reset(new smtk::mesh::PointHashGrid(numPoints, coordinates));
+  }
+  else
+  {
+    m_kdTree.reset(new smtk::mesh::KDTree(numPoints, coordinates));
+  }
+}
+
+InMemoryPointLocatorImpl::~InMemoryPointLocatorImpl() = default;
+
+smtk::mesh::HandleRange InMemoryPointLocatorImpl::range() const
+{
+  smtk::mesh::HandleRange ids;
+  if (m_numPoints > 0)
+  {
+    ids.insert(smtk::mesh::HandleInterval(0, m_numPoints - 1));
+  }
+  return ids;
+}
+
+std::array<double, 3> InMemoryPointLocatorImpl::point(std::size_t id) const
+{
+  return m_kdTree ? m_kdTree->point(id) : m_hashGrid->point(id);
+}
+
+template<typename ResultsType>
+void InMemoryPointLocatorImpl::fill(
+  std::vector<std::size_t>& ids,
+  std::vector<double>& sqDistances,
+  ResultsType& results) const
+{
+  results.pointIds.swap(ids);
+  if (results.want_sqDistances)
+  {
+    results.sqDistances.swap(sqDistances);
+  }
+  else
+  {
+    results.sqDistances.clear();
+  }
+  results.x_s.clear();
+  results.y_s.clear();
+  results.z_s.clear();
+  if (results.want_Coordinates)
+  {
+    results.x_s.reserve(results.pointIds.size());
+    results.y_s.reserve(results.pointIds.size());
+    results.z_s.reserve(results.pointIds.size());
+    for (std::size_t id : results.pointIds)
+    {
+      std::array<double, 3> x = this->point(id);
+      results.x_s.push_back(x[0]);
+      results.y_s.push_back(x[1]);
+      results.z_s.push_back(x[2]);
+    }
+  }
+}
+
+void InMemoryPointLocatorImpl::locatePointsWithinRadius(
+  double x,
+  double y,
+  double z,
+  double radius,
+  Results& results)
+{
+  std::vector<std::size_t> ids;
+  std::vector<double> sqDistances;
+  const std::array<double, 3> p = { { x, y, z } };
+  if (m_kdTree)
+  {
+    m_kdTree->withinRadius(p, radius, ids, sqDistances);
+  }
+  else
+  {
+    m_hashGrid->withinRadius(p, radius, ids, sqDistances);
+  }
+  this->fill(ids, sqDistances, results);
+}
+
+bool InMemoryPointLocatorImpl::locateNearestPoints(
+  double x,
+  double y,
+  double z,
+  std::size_t k,
+  Results& results)
+{
+  std::vector<std::size_t> ids;
+  std::vector<double> sqDistances;
+  const std::array<double, 3> p = { { x, y, z } };
+  if (m_kdTree)
+  {
+    m_kdTree->nearest(p, k, ids, sqDistances);
+  }
+  else
+  {
+    m_hashGrid->nearest(p, k, ids, sqDistances);
+  }
+  this->fill(ids, sqDistances, results);
+  return true;
+}
+
+void InMemoryPointLocatorImpl::batchLocatePointsWithinRadius(
+  std::size_t numQueries,
+  const double* xyz,
+  double radius,
+  BatchResults& results)
+{
+  std::vector<std::size_t> ids;
+  std::vector<double> sqDistances;
+  if (m_kdTree)
+  {
+    m_kdTree->withinRadius(numQueries, xyz, radius, results.offsets, ids, sqDistances);
+  }
+  else
+  {
+    m_hashGrid->withinRadius(numQueries, xyz, radius, results.offsets, ids, sqDistances);
+  }
+  this->fill(ids, sqDistances, results);
+}
+
+bool InMemoryPointLocatorImpl::batchLocateNearestPoints(
+  std::size_t numQueries,
+  const double* xyz,
+  std::size_t k,
+  BatchResults& results)
+{
+  std::vector<std::size_t> ids;
+  std::vector<double> sqDistances;
+  if (m_kdTree)
+  {
+    m_kdTree->nearest(numQueries, xyz, k, results.offsets, ids, sqDistances);
+  }
+  else
+  {
+    m_hashGrid->nearest(numQueries, xyz, k, results.offsets, ids, sqDistances);
+  }
+  this->fill(ids, sqDistances, results);
+  return true;
+}
+} // namespace mesh
+} // namespace smtk
@@ -0,0 +1,89 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_mesh_core_InMemoryPointLocatorImpl_h
+#define smtk_mesh_core_InMemoryPointLocatorImpl_h
+
+#include "smtk/CoreExports.h"
+
+#include "smtk/mesh/core/Interface.h"
+#include "smtk/mesh/core/KDTree.h"
+#include "smtk/mesh/core/PointHashGrid.h"
+
+#include <functional>
+#include <memory>
+
+namespace smtk
+{
+namespace mesh
+{
+
+/**\brief A point locator that indexes coordinates in memory, independent of
+   any mesh backend.
+
+   Points are indexed by either a KDTree or a PointHashGrid; neither copies
+   the points into a mesh resource. Point ids reported in query results are
+   the indices passed to the coordinate functor, and range() holds the ids
+   [0, numPoints).
+  */
+class SMTKCORE_EXPORT InMemoryPointLocatorImpl : public smtk::mesh::PointLocatorImpl
+{
+public:
+  /// The spatial index used to locate points.
+  enum class Structure
+  {
+    KDTree,  //!< A kd-tree; robust to clustered points.
+    HashGrid //!< A hashed uniform grid; fast for evenly distributed points.
+  };
+
+  InMemoryPointLocatorImpl(
+    std::size_t numPoints,
+    const std::function<std::array<double, 3>(std::size_t)>& coordinates,
+    Structure structure = Structure::KDTree);
+
+  ~InMemoryPointLocatorImpl() override;
+
+  smtk::mesh::HandleRange range() const override;
+
+  void locatePointsWithinRadius(double x, double y, double z, double radius, Results& results)
+    override;
+
+  bool locateNearestPoints(double x, double y, double z, std::size_t k, Results& results) override;
+
+  /// Queries are evaluated in parallel.
+  void batchLocatePointsWithinRadius(
+    std::size_t numQueries,
+    const double* xyz,
+    double radius,
+    BatchResults& results) override;
+  bool batchLocateNearestPoints(
+    std::size_t numQueries,
+    const double* xyz,
+    std::size_t k,
+    BatchResults& results) override;
+
+  Structure structure() const { return m_kdTree ? Structure::KDTree : Structure::HashGrid; }
+
+private:
+  template<typename ResultsType>
+  void fill(
+    std::vector<std::size_t>& ids,
+    std::vector<double>& sqDistances,
+    ResultsType& results) const;
+  std::array<double, 3> point(std::size_t id) const;
+
+  std::size_t m_numPoints;
+  std::unique_ptr<smtk::mesh::KDTree> m_kdTree;
+  std::unique_ptr<smtk::mesh::PointHashGrid> m_hashGrid;
+};
+} // namespace mesh
+} // namespace smtk
+
+#endif
@@ -0,0 +1,234 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/core/IndexedHandleRange.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+
+namespace smtk
+{
+namespace mesh
+{
+
+IndexedHandleRange::IndexedHandleRange()
+  : m_offsets(1, 0)
+{
+}
+
+IndexedHandleRange::IndexedHandleRange(const HandleRange& range)
+  : m_offsets(1, 0)
+{
+  std::size_t numberOfIntervals = smtk::mesh::rangeIntervalCount(range);
+  m_lower.reserve(numberOfIntervals);
+  m_upper.reserve(numberOfIntervals);
+  m_offsets.reserve(numberOfIntervals + 1);
+  for (const auto& interval : range)
+  {
+    this->append(interval.lower(), interval.upper());
+  }
+}
+
+IndexedHandleRange::IndexedHandleRange(
+  const std::vector<Handle>& lower,
+  const std::vector<Handle>& upper)
+  : m_offsets(1, 0)
+{
+  assert(lower.size() == upper.size());
+  m_lower.reserve(lower.size());
+  m_upper.reserve(lower.size());
+  m_offsets.reserve(lower.size() + 1);
+  for (std::size_t i = 0; i < lower.size(); ++i)
+  {
+    this->append(lower[i], upper[i]);
+  }
+}
+
+void IndexedHandleRange::append(Handle lower, Handle upper)
+{
+  // Intervals arrive in sorted order; coalesce those that touch or overlap
+  // the last interval so that the representation stays canonical.
+  if (!m_upper.empty() && lower <= m_upper.back() + 1)
+  {
+    if (upper > m_upper.back())
+    {
+      m_offsets.back() += upper - m_upper.back();
+      m_upper.back() = upper;
+    }
+    return;
+  }
+  m_lower.push_back(lower);
+  m_upper.push_back(upper);
+  m_offsets.push_back(m_offsets.back() + (upper - lower) + 1);
+}
+
+Handle IndexedHandleRange::element(std::size_t i) const
+{
+  assert(i < this->size());
+  // The interval holding the i-th element is the last one whose offset is <= i.
+  std::size_t interval =
+    static_cast<std::size_t>(std::upper_bound(m_offsets.begin() + 1, m_offsets.end(), i) -
+                             (m_offsets.begin() + 1));
+  return m_lower[interval] + (i - m_offsets[interval]);
+}
+
+std::size_t IndexedHandleRange::findInterval(Handle handle) const
+{
+  auto it = std::upper_bound(m_lower.begin(), m_lower.end(), handle);
+  if (it == m_lower.begin())
+  {
+    return m_lower.size();
+  }
+  std::size_t interval = static_cast<std::size_t>(it - m_lower.begin()) - 1;
+  return handle <= m_upper[interval] ? interval : m_lower.size();
+}
+
+std::size_t IndexedHandleRange::index(Handle handle) const
+{
+  std::size_t interval = this->findInterval(handle);
+  if (interval == m_lower.size())
+  {
+    return this->size();
+  }
+  return m_offsets[interval] + (handle - m_lower[interval]);
+}
+
+bool IndexedHandleRange::contains(Handle handle) const
+{
+  return this->findInterval(handle) != m_lower.size();
+}
+
+HandleRange IndexedHandleRange::range() const
+{
+  HandleRange result;
+  // Intervals are sorted, so hinting each insertion at the end keeps the
+  // conversion linear in the number of intervals.
+  for (std::size_t i = 0; i < m_lower.size(); ++i)
+  {
+    result.insert(result.end(), HandleInterval(m_lower[i], m_upper[i]));
+  }
+  return result;
+}
+
+IndexedHandleRange rangeUnion(const IndexedHandleRange& a, const IndexedHandleRange& b)
+{
+  IndexedHandleRange result;
+  result.m_lower.reserve(a.numberOfIntervals() + b.numberOfIntervals());
+  result.m_upper.reserve(a.numberOfIntervals() + b.numberOfIntervals());
+  result.m_offsets.reserve(a.numberOfIntervals() + b.numberOfIntervals() + 1);
+
+  std::size_t i = 0, j = 0;
+  while (i < a.m_lower.size() || j < b.m_lower.size())
+  {
+    if (j == b.m_lower.size() || (i < a.m_lower.size() && a.m_lower[i] <= b.m_lower[j]))
+    {
+      result.append(a.m_lower[i], a.m_upper[i]);
+      ++i;
+    }
+    else
+    {
+      result.append(b.m_lower[j], b.m_upper[j]);
+      ++j;
+    }
+  }
+  return result;
+}
+
+IndexedHandleRange rangeIntersect(const IndexedHandleRange& a, const IndexedHandleRange& b)
+{
+  IndexedHandleRange result;
+  std::size_t i = 0, j = 0;
+  while (i < a.m_lower.size() && j < b.m_lower.size())
+  {
+    Handle lower = std::max(a.m_lower[i], b.m_lower[j]);
+    Handle upper = std::min(a.m_upper[i], b.m_upper[j]);
+    if (lower <= upper)
+    {
+      result.append(lower, upper);
+    }
+    // Advance past whichever interval ends first.
+    if (a.m_upper[i] < b.m_upper[j])
+    {
+      ++i;
+    }
+    else
+    {
+      ++j;
+    }
+  }
+  return result;
+}
+
+IndexedHandleRange rangeSubtract(const IndexedHandleRange& a, const IndexedHandleRange& b)
+{
+  IndexedHandleRange result;
+  result.m_lower.reserve(a.numberOfIntervals());
+  result.m_upper.reserve(a.numberOfIntervals());
+  result.m_offsets.reserve(a.numberOfIntervals() + 1);
+
+  std::size_t j = 0;
+  for (std::size_t i = 0; i < a.m_lower.size(); ++i)
+  {
+    Handle lower = a.m_lower[i];
+    const Handle upper = a.m_upper[i];
+
+    // Skip intervals of b that end before this interval of a begins.
+    while (j < b.m_lower.size() && b.m_upper[j] < lower)
+    {
+      ++j;
+    }
+
+    // Carve out every interval of b that overlaps [lower, upper].
+    bool exhausted = false;
+    std::size_t k = j;
+    for (; k < b.m_lower.size() && b.m_lower[k] <= upper; ++k)
+    {
+      if (b.m_lower[k] > lower)
+      {
+        result.append(lower, b.m_lower[k] - 1);
+      }
+      if (b.m_upper[k] >= upper)
+      {
+        exhausted = true;
+        break;
+      }
+      lower = b.m_upper[k] + 1;
+    }
+    if (!exhausted)
+    {
+      result.append(lower, upper);
+    }
+    // An interval of b may also overlap the next interval of a, so only
+    // skip the ones that were consumed entirely.
+    j = k;
+  }
+  return result;
+}
+
+const IndexedHandleRange& cachedIndex(
+  std::shared_ptr<const IndexedHandleRange>& cache,
+  const HandleRange& range)
+{
+  std::shared_ptr<const IndexedHandleRange> index = std::atomic_load(&cache);
+  if (!index)
+  {
+    auto built = std::make_shared<const IndexedHandleRange>(range);
+    // If another thread won the race, use its index so that the returned
+    // reference remains owned by \a cache.
+    if (std::atomic_compare_exchange_strong(&cache, &index, built))
+    {
+      index = built;
+    }
+  }
+  return *index;
+}
+} // namespace mesh
+} // namespace smtk
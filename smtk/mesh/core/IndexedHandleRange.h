@@ -0,0 +1,123 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_mesh_core_IndexedHandleRange_h
+#define smtk_mesh_core_IndexedHandleRange_h
+
+#include "smtk/CoreExports.h"
+
+#include "smtk/mesh/core/Handle.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace smtk
+{
+namespace mesh
+{
+/**\brief A flat, immutable copy of a HandleRange that supports random access.
+ *
+ * A HandleRange is a balanced tree of closed intervals, so finding the i-th
+ * handle (or the position of a handle) requires walking every interval that
+ * precedes it. An IndexedHandleRange stores the same intervals in sorted
+ * arrays alongside a prefix sum of their sizes, so that element() and index()
+ * are O(log k) in the number of intervals k. The set operations below run in
+ * O(k_a + k_b) over the sorted arrays.
+ */
+class SMTKCORE_EXPORT IndexedHandleRange
+{
+public:
+  /// Construct an empty range.
+  IndexedHandleRange();
+
+  /// Construct an index for the intervals of \a range.
+  explicit IndexedHandleRange(const HandleRange& range);
+
+  /// Construct a range from the bounds of closed intervals. The intervals must
+  /// be sorted and must not overlap; adjacent intervals are merged.
+  IndexedHandleRange(const std::vector<Handle>& lower, const std::vector<Handle>& upper);
+
+  /// Return the number of handles in the range.
+  std::size_t size() const { return m_offsets.back(); }
+
+  /// Return true if the range holds no handles.
+  bool empty() const { return m_lower.empty(); }
+
+  /// Return the number of (maximal) intervals in the range.
+  std::size_t numberOfIntervals() const { return m_lower.size(); }
+
+  /// Access the bounds of the i-th interval and the number of handles that
+  /// precede it.
+  Handle lower(std::size_t interval) const { return m_lower[interval]; }
+  Handle upper(std::size_t interval) const { return m_upper[interval]; }
+  std::size_t offset(std::size_t interval) const { return m_offsets[interval]; }
+
+  /// Return the i-th handle in the range. \a i must be less than size().
+  Handle element(std::size_t i) const;
+
+  /// Return the position of \a handle in the range, or size() if the range
+  /// does not contain \a handle.
+  std::size_t index(Handle handle) const;
+
+  /// Return true if the range contains \a handle.
+  bool contains(Handle handle) const;
+
+  /// Return the index of the interval containing \a handle, or
+  /// numberOfIntervals() if no interval contains it.
+  std::size_t findInterval(Handle handle) const;
+
+  /// Convert back to a HandleRange.
+  HandleRange range() const;
+
+  bool operator==(const IndexedHandleRange& other) const
+  {
+    return m_lower == other.m_lower && m_upper == other.m_upper;
+  }
+  bool operator!=(const IndexedHandleRange& other) const { return !(*this == other); }
+
+private:
+  void append(Handle lower, Handle upper);
+
+  friend SMTKCORE_EXPORT IndexedHandleRange
+  rangeUnion(const IndexedHandleRange&, const IndexedHandleRange&);
+  friend SMTKCORE_EXPORT IndexedHandleRange
+  rangeIntersect(const IndexedHandleRange&, const IndexedHandleRange&);
+  friend SMTKCORE_EXPORT IndexedHandleRange
+  rangeSubtract(const IndexedHandleRange&, const IndexedHandleRange&);
+
+  std::vector<Handle> m_lower;
+  std::vector<Handle> m_upper;
+  // m_offsets[i] is the number of handles in intervals [0, i); it holds one
+  // more entry than there are intervals so that m_offsets.back() is the size.
+  std::vector<std::size_t> m_offsets;
+};
+
+/// Return the handles in either \a a or \a b.
+SMTKCORE_EXPORT IndexedHandleRange
+rangeUnion(const IndexedHandleRange& a, const IndexedHandleRange& b);
+
+/// Return the handles in both \a a and \a b.
+SMTKCORE_EXPORT IndexedHandleRange
+rangeIntersect(const IndexedHandleRange& a, const IndexedHandleRange& b);
+
+/// Return the handles in \a a that are not in \a b.
+SMTKCORE_EXPORT IndexedHandleRange
+rangeSubtract(const IndexedHandleRange& a, const IndexedHandleRange& b);
+
+/// Return the index held by \a cache, first building it from \a range if
+/// \a cache is null. Concurrent callers all receive the same index.
+SMTKCORE_EXPORT const IndexedHandleRange& cachedIndex(
+  std::shared_ptr<const IndexedHandleRange>& cache,
+  const HandleRange& range);
+} // namespace mesh
+} // namespace smtk
+
+#endif
@@ -213,6 +213,21 @@ public:
     bool want_Coordinates{ false };
   };
 
+  //results of a batch of queries. The points found for query i are
+  //pointIds[offsets[i]] through pointIds[offsets[i + 1] - 1], and likewise
+  //for the squared distances and coordinates if they were requested.
+  struct BatchResults
+  {
+    BatchResults() = default;
+
+    std::vector<std::size_t> offsets;
+    std::vector<std::size_t> pointIds;
+    std::vector<double> sqDistances;
+    std::vector<double> x_s, y_s, z_s;
+    bool want_sqDistances{ false };
+    bool want_Coordinates{ false };
+  };
+
   virtual ~PointLocatorImpl() = default;
 
   //returns all the point ids that are inside the locator
@@ -220,6 +235,93 @@ public:
 
   virtual void
   locatePointsWithinRadius(double x, double y, double z, double radius, Results& results) = 0;
+
+  //find the k points nearest to a single point, ordered from nearest to
+  //farthest. Returns false if the backend does not support the query.
+  virtual bool
+  locateNearestPoints(double /*x*/, double /*y*/, double /*z*/, std::size_t /*k*/, Results& results)
+  {
+    results.pointIds.clear();
+    results.sqDistances.clear();
+    results.x_s.clear();
+    results.y_s.clear();
+    results.z_s.clear();
+    return false;
+  }
+
+  //find the points within the radius of each of numQueries points whose
+  //coordinates are interleaved in xyz. The default implementation performs
+  //one query at a time.
+  virtual void batchLocatePointsWithinRadius(
+    std::size_t numQueries,
+    const double* xyz,
+    double radius,
+    BatchResults& results)
+  {
+    Results single;
+    single.want_sqDistances = results.want_sqDistances;
+    single.want_Coordinates = results.want_Coordinates;
+    results.offsets.assign(1, 0);
+    results.pointIds.clear();
+    results.sqDistances.clear();
+    results.x_s.clear();
+    results.y_s.clear();
+    results.z_s.clear();
+    for (std::size_t i = 0; i < numQueries; ++i)
+    {
+      single.pointIds.clear();
+      single.sqDistances.clear();
+      single.x_s.clear();
+      single.y_s.clear();
+      single.z_s.clear();
+      this->locatePointsWithinRadius(xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2], radius, single);
+      results.pointIds.insert(
+        results.pointIds.end(), single.pointIds.begin(), single.pointIds.end());
+      results.sqDistances.insert(
+        results.sqDistances.end(), single.sqDistances.begin(), single.sqDistances.end());
+      results.x_s.insert(results.x_s.end(), single.x_s.begin(), single.x_s.end());
+      results.y_s.insert(results.y_s.end(), single.y_s.begin(), single.y_s.end());
+      results.z_s.insert(results.z_s.end(), single.z_s.begin(), single.z_s.end());
+      results.offsets.push_back(results.pointIds.size());
+    }
+  }
+
+  //find the k points nearest to each of numQueries points whose coordinates
+  //are interleaved in xyz. Returns false if the backend does not support
+  //nearest-point queries.
+  virtual bool batchLocateNearestPoints(
+    std::size_t numQueries,
+    const double* xyz,
+    std::size_t k,
+    BatchResults& results)
+  {
+    Results single;
+    single.want_sqDistances = results.want_sqDistances;
+    single.want_Coordinates = results.want_Coordinates;
+    results.offsets.assign(1, 0);
+    results.pointIds.clear();
+    results.sqDistances.clear();
+    results.x_s.clear();
+    results.y_s.clear();
+    results.z_s.clear();
+    for (std::size_t i = 0; i < numQueries; ++i)
+    {
+      if (!this->locateNearestPoints(xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2], k, single))
+      {
+        results.offsets.assign(1, 0);
+        return false;
+      }
+      results.pointIds.insert(
+        results.pointIds.end(), single.pointIds.begin(), single.pointIds.end());
+      results.sqDistances.insert(
+        results.sqDistances.end(), single.sqDistances.begin(), single.sqDistances.end());
+      results.x_s.insert(results.x_s.end(), single.x_s.begin(), single.x_s.end());
+      results.y_s.insert(results.y_s.end(), single.y_s.begin(), single.y_s.end());
+      results.z_s.insert(results.z_s.end(), single.z_s.begin(), single.z_s.end());
+      results.offsets.push_back(results.pointIds.size());
+    }
+    return true;
+  }
 };
 
 class SMTKCORE_EXPORT Interface
@@ -0,0 +1,409 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/core/KDTree.h"
+#include "smtk/mesh/core/detail/BatchPointQuery.h"
+
+#include "smtk/common/WorkStealingPool.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+// Nodes with at most this many points are not split further.
+const std::size_t LeafSize = 16;
+
+// Subtrees with more than this many points are built as separate tasks.
+const std::size_t ParallelBuildSize = 1 << 15;
+
+// Return the number of nodes in the trees built over n and n + 1 points.
+//
+// Nodes are split at their median, so the shape of a tree depends only upon
+// its number of points; the halves of n and n + 1 points all hold either
+// n / 2 or n / 2 + 1 points, so both counts follow from those of n / 2.
+std::pair<std::size_t, std::size_t> numberOfNodes(std::size_t n)
+{
+  if (n + 1 <= LeafSize)
+  {
+    return std::make_pair(std::size_t(1), std::size_t(1));
+  }
+  std::size_t half = n / 2;
+  std::pair<std::size_t, std::size_t> halves = numberOfNodes(half);
+  auto count = [&](std::size_t m) {
+    if (m <= LeafSize)
+    {
+      return std::size_t(1);
+    }
+    std::size_t left = m / 2;
+    std::size_t right = m - left;
+    return 1 + (left == half ? halves.first : halves.second) +
+      (right == half ? halves.first : halves.second);
+  };
+  return std::make_pair(count(n), count(n + 1));
+}
+} // namespace
+
+namespace smtk
+{
+namespace mesh
+{
+
+KDTree::KDTree()
+  : m_dimension(3)
+{
+}
+
+KDTree::KDTree(
+  std::size_t numberOfPoints,
+  const std::function<std::array<double, 3>(std::size_t)>& coordinates,
+  const std::function<bool(std::size_t)>& include,
+  int dimension)
+  : m_dimension(dimension == 2 ? 2 : 3)
+{
+  std::vector<std::array<double, 3>> points;
+  points.reserve(numberOfPoints);
+  m_ids.reserve(numberOfPoints);
+  for (std::size_t i = 0; i < numberOfPoints; ++i)
+  {
+    if (!include || include(i))
+    {
+      points.push_back(this->project(coordinates(i)));
+      m_ids.push_back(i);
+    }
+  }
+
+  std::vector<std::size_t> order(points.size());
+  for (std::size_t i = 0; i < order.size(); ++i)
+  {
+    order[i] = i;
+  }
+  this->build(order, points);
+
+  m_positions.assign(numberOfPoints, static_cast<std::size_t>(-1));
+  for (std::size_t i = 0; i < m_ids.size(); ++i)
+  {
+    m_positions[m_ids[i]] = i;
+  }
+}
+
+KDTree::KDTree(std::size_t numberOfPoints, const double* xyz, int dimension)
+  : KDTree(
+      numberOfPoints,
+      [xyz](std::size_t i) {
+        return std::array<double, 3>{ { xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2] } };
+      },
+      nullptr,
+      dimension)
+{
+}
+
+void KDTree::build(std::vector<std::size_t>& order, std::vector<std::array<double, 3>>& points)
+{
+  m_nodes.clear();
+  if (points.empty())
+  {
+    return;
+  }
+  // Node indices are assigned in depth-first order, and the size of each
+  // subtree is known in advance, so subtrees may be built concurrently.
+  m_nodes.resize(numberOfNodes(points.size()).first);
+  if (points.size() > ParallelBuildSize)
+  {
+    smtk::common::WorkStealingPool::TaskGroup group;
+    group.spawn([&]() { this->buildNode(0, order, points, 0, points.size()); });
+    group.wait();
+  }
+  else
+  {
+    this->buildNode(0, order, points, 0, points.size());
+  }
+
+  // Store coordinates in tree order so each leaf is a contiguous run.
+  std::vector<std::size_t> ids(order.size());
+  m_x.resize(order.size());
+  m_y.resize(order.size());
+  m_z.resize(order.size());
+  for (std::size_t i = 0; i < order.size(); ++i)
+  {
+    const std::array<double, 3>& p = points[order[i]];
+    m_x[i] = p[0];
+    m_y[i] = p[1];
+    m_z[i] = p[2];
+    ids[i] = m_ids[order[i]];
+  }
+  m_ids = std::move(ids);
+}
+
+void KDTree::buildNode(
+  std::size_t index,
+  std::vector<std::size_t>& order,
+  const std::vector<std::array<double, 3>>& points,
+  std::size_t begin,
+  std::size_t end)
+{
+  Node& node = m_nodes[index];
+  node.begin = begin;
+  node.end = end;
+  node.left = node.right = 0;
+  node.lower = node.upper = points[order[begin]];
+  for (std::size_t i = begin + 1; i < end; ++i)
+  {
+    const std::array<double, 3>& p = points[order[i]];
+    for (int j = 0; j < 3; ++j)
+    {
+      node.lower[j] = std::min(node.lower[j], p[j]);
+      node.upper[j] = std::max(node.upper[j], p[j]);
+    }
+  }
+
+  if (end - begin <= LeafSize)
+  {
+    return;
+  }
+
+  // Split the widest axis at its median.
+  int axis = 0;
+  for (int j = 1; j < m_dimension; ++j)
+  {
+    if (node.upper[j] - node.lower[j] > node.upper[axis] - node.lower[axis])
+    {
+      axis = j;
+    }
+  }
+  std::size_t middle = begin + (end - begin) / 2;
+  std::nth_element(
+    order.begin() + begin,
+    order.begin() + middle,
+    order.begin() + end,
+    [&points, axis](std::size_t a, std::size_t b) { return points[a][axis] < points[b][axis]; });
+  node.left = index + 1;
+  node.right = node.left + numberOfNodes(middle - begin).first;
+
+  std::size_t left = node.left;
+  std::size_t right = node.right;
+  if (end - begin > ParallelBuildSize)
+  {
+    smtk::common::WorkStealingPool::TaskGroup group;
+    group.spawn([=, &order, &points]() { this->buildNode(left, order, points, begin, middle); });
+    this->buildNode(right, order, points, middle, end);
+    group.wait();
+  }
+  else
+  {
+    this->buildNode(left, order, points, begin, middle);
+    this->buildNode(right, order, points, middle, end);
+  }
+}
+
+double KDTree::sqDistanceToBox(const Node& node, const std::array<double, 3>& point) const
+{
+  double sqDistance = 0.;
+  for (int j = 0; j < 3; ++j)
+  {
+    double d = 0.;
+    if (point[j] < node.lower[j])
+    {
+      d = node.lower[j] - point[j];
+    }
+    else if (point[j] > node.upper[j])
+    {
+      d = point[j] - node.upper[j];
+    }
+    sqDistance += d * d;
+  }
+  return sqDistance;
+}
+
+void KDTree::nearest(
+  const std::array<double, 3>& query,
+  std::size_t k,
+  std::vector<std::size_t>& ids,
+  std::vector<double>& sqDistances,
+  double maxRadius) const
+{
+  ids.clear();
+  sqDistances.clear();
+  if (m_nodes.empty() || k == 0)
+  {
+    return;
+  }
+
+  const std::array<double, 3> point = this->project(query);
+  const double sqMaxRadius = maxRadius * maxRadius;
+
+  // A max-heap of the best candidates found so far.
+  std::vector<std::pair<double, std::size_t>> best;
+  best.reserve(k + 1);
+  auto bound = [&]() { return best.size() < k ? sqMaxRadius : best.front().first; };
+
+  std::vector<std::size_t> stack;
+  stack.push_back(0);
+  while (!stack.empty())
+  {
+    const Node& node = m_nodes[stack.back()];
+    stack.pop_back();
+    if (this->sqDistanceToBox(node, point) > bound())
+    {
+      continue;
+    }
+    if (node.left == 0)
+    {
+      for (std::size_t i = node.begin; i < node.end; ++i)
+      {
+        double d = this->sqDistanceTo(i, point);
+        if (d <= bound())
+        {
+          best.emplace_back(d, i);
+          std::push_heap(best.begin(), best.end());
+          if (best.size() > k)
+          {
+            std::pop_heap(best.begin(), best.end());
+            best.pop_back();
+          }
+        }
+      }
+      continue;
+    }
+    // Visit the nearer child first by pushing it last.
+    const Node& left = m_nodes[node.left];
+    const Node& right = m_nodes[node.right];
+    if (this->sqDistanceToBox(left, point) < this->sqDistanceToBox(right, point))
+    {
+      stack.push_back(node.right);
+      stack.push_back(node.left);
+    }
+    else
+    {
+      stack.push_back(node.left);
+      stack.push_back(node.right);
+    }
+  }
+
+  std::sort_heap(best.begin(), best.end());
+  ids.reserve(best.size());
+  sqDistances.reserve(best.size());
+  for (const auto& candidate : best)
+  {
+    ids.push_back(m_ids[candidate.second]);
+    sqDistances.push_back(candidate.first);
+  }
+}
+
+void KDTree::withinRadius(
+  const std::array<double, 3>& query,
+  double radius,
+  std::vector<std::size_t>& ids,
+  std::vector<double>& sqDistances) const
+{
+  ids.clear();
+  sqDistances.clear();
+  if (m_nodes.empty())
+  {
+    return;
+  }
+
+  const std::array<double, 3> point = this->project(query);
+  const double sqRadius = radius * radius;
+
+  std::vector<std::size_t> stack;
+  stack.push_back(0);
+  while (!stack.empty())
+  {
+    const Node& node = m_nodes[stack.back()];
+    stack.pop_back();
+    if (this->sqDistanceToBox(node, point) > sqRadius)
+    {
+      continue;
+    }
+    if (node.left == 0)
+    {
+      for (std::size_t i = node.begin; i < node.end; ++i)
+      {
+        double d = this->sqDistanceTo(i, point);
+        if (d <= sqRadius)
+        {
+          ids.push_back(m_ids[i]);
+          sqDistances.push_back(d);
+        }
+      }
+      continue;
+    }
+    stack.push_back(node.left);
+    stack.push_back(node.right);
+  }
+}
+
+std::size_t KDTree::closest(const std::array<double, 3>& point, double& sqDistance) const
+{
+  std::vector<std::size_t> ids;
+  std::vector<double> sqDistances;
+  this->nearest(point, 1, ids, sqDistances);
+  if (ids.empty())
+  {
+    sqDistance = std::numeric_limits<double>::infinity();
+    return static_cast<std::size_t>(-1);
+  }
+  sqDistance = sqDistances[0];
+  return ids[0];
+}
+
+void KDTree::nearest(
+  std::size_t numberOfQueries,
+  const double* xyz,
+  std::size_t k,
+  std::vector<std::size_t>& offsets,
+  std::vector<std::size_t>& ids,
+  std::vector<double>& sqDistances,
+  double maxRadius) const
+{
+  smtk::mesh::detail::batchPointQuery(
+    numberOfQueries,
+    xyz,
+    offsets,
+    ids,
+    sqDistances,
+    [&](
+      const std::array<double, 3>& point,
+      std::vector<std::size_t>& queryIds,
+      std::vector<double>& querySqDistances) {
+      this->nearest(point, k, queryIds, querySqDistances, maxRadius);
+    });
+}
+
+void KDTree::withinRadius(
+  std::size_t numberOfQueries,
+  const double* xyz,
+  double radius,
+  std::vector<std::size_t>& offsets,
+  std::vector<std::size_t>& ids,
+  std::vector<double>& sqDistances) const
+{
+  smtk::mesh::detail::batchPointQuery(
+    numberOfQueries,
+    xyz,
+    offsets,
+    ids,
+    sqDistances,
+    [&](
+      const std::array<double, 3>& point,
+      std::vector<std::size_t>& queryIds,
+      std::vector<double>& querySqDistances) {
+      this->withinRadius(point, radius, queryIds, querySqDistances);
+    });
+}
+
+std::array<double, 3> KDTree::point(std::size_t id) const
+{
+  std::size_t position = m_positions[id];
+  return std::array<double, 3>{ { m_x[position], m_y[position], m_z[position] } };
+}
+} // namespace mesh
+} // namespace smtk
@@ -0,0 +1,162 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_mesh_core_KDTree_h
+#define smtk_mesh_core_KDTree_h
+
+#include "smtk/CoreExports.h"
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace smtk
+{
+namespace mesh
+{
+
+/**\brief An in-memory kd-tree for nearest-neighbor and radius queries.
+
+   The tree is built once from a set of points and is immutable afterwards,
+   so it may be queried concurrently from multiple threads. Coordinates are
+   stored as separate x, y and z arrays, reordered so that the points of each
+   leaf are contiguous in memory.
+
+   Query results report the index each point had in the input (the value
+   passed to the coordinate functor), not its position in the tree.
+
+   A tree constructed with a \a dimension of 2 ignores z coordinates (both of
+   its points and of query points), measuring distances in the x-y plane.
+
+   Large trees are built in parallel: once the coordinates have been gathered
+   (the coordinate functor is always called from the constructing thread),
+   independent subtrees are partitioned on smtk::common::WorkStealingPool.
+   The batch forms of nearest() and withinRadius() also run in parallel.
+  */
+class SMTKCORE_EXPORT KDTree
+{
+public:
+  /// Construct an empty tree.
+  KDTree();
+
+  /// Construct a tree from \a numberOfPoints points whose coordinates are
+  /// returned by \a coordinates. If \a include is provided, only points for
+  /// which it returns true are inserted.
+  KDTree(
+    std::size_t numberOfPoints,
+    const std::function<std::array<double, 3>(std::size_t)>& coordinates,
+    const std::function<bool(std::size_t)>& include = nullptr,
+    int dimension = 3);
+
+  /// Construct a tree from an array of interleaved xyz coordinates.
+  KDTree(std::size_t numberOfPoints, const double* xyz, int dimension = 3);
+
+  /// The number of points in the tree.
+  std::size_t size() const { return m_ids.size(); }
+  bool empty() const { return m_ids.empty(); }
+  int dimension() const { return m_dimension; }
+
+  /// Find the (at most) \a k points nearest \a point that are no farther than
+  /// \a maxRadius from it. On return, \a ids and \a sqDistances hold the
+  /// points' input indices and squared distances ordered from nearest to
+  /// farthest.
+  void nearest(
+    const std::array<double, 3>& point,
+    std::size_t k,
+    std::vector<std::size_t>& ids,
+    std::vector<double>& sqDistances,
+    double maxRadius = std::numeric_limits<double>::infinity()) const;
+
+  /// Find all points within \a radius of \a point (in no particular order).
+  void withinRadius(
+    const std::array<double, 3>& point,
+    double radius,
+    std::vector<std::size_t>& ids,
+    std::vector<double>& sqDistances) const;
+
+  /// Return the input index of the point closest to \a point (or size_t(-1)
+  /// if the tree is empty), setting \a sqDistance to its squared distance.
+  std::size_t closest(const std::array<double, 3>& point, double& sqDistance) const;
+
+  /// Perform nearest() for \a numberOfQueries points with interleaved
+  /// coordinates \a xyz. Results are returned in compressed form: the
+  /// neighbors of query i are ids[offsets[i]] to ids[offsets[i + 1] - 1].
+  void nearest(
+    std::size_t numberOfQueries,
+    const double* xyz,
+    std::size_t k,
+    std::vector<std::size_t>& offsets,
+    std::vector<std::size_t>& ids,
+    std::vector<double>& sqDistances,
+    double maxRadius = std::numeric_limits<double>::infinity()) const;
+
+  /// Perform withinRadius() for \a numberOfQueries points with interleaved
+  /// coordinates \a xyz, returning results in the compressed form used by
+  /// the batch form of nearest().
+  void withinRadius(
+    std::size_t numberOfQueries,
+    const double* xyz,
+    double radius,
+    std::vector<std::size_t>& offsets,
+    std::vector<std::size_t>& ids,
+    std::vector<double>& sqDistances) const;
+
+  /// The coordinates of the point with input index \a id (which must be in
+  /// the tree), as stored in the tree.
+  std::array<double, 3> point(std::size_t id) const;
+
+private:
+  struct Node
+  {
+    // The points of this node are [begin, end) in the coordinate arrays.
+    std::size_t begin;
+    std::size_t end;
+    // Children (0 for a leaf; the root is never a child).
+    std::size_t left;
+    std::size_t right;
+    std::array<double, 3> lower;
+    std::array<double, 3> upper;
+  };
+
+  void build(std::vector<std::size_t>& order, std::vector<std::array<double, 3>>& points);
+  void buildNode(
+    std::size_t index,
+    std::vector<std::size_t>& order,
+    const std::vector<std::array<double, 3>>& points,
+    std::size_t begin,
+    std::size_t end);
+  double sqDistanceToBox(const Node& node, const std::array<double, 3>& point) const;
+  double sqDistanceTo(std::size_t index, const std::array<double, 3>& point) const
+  {
+    double dx = m_x[index] - point[0];
+    double dy = m_y[index] - point[1];
+    double dz = m_z[index] - point[2];
+    return dx * dx + dy * dy + dz * dz;
+  }
+  std::array<double, 3> project(const std::array<double, 3>& point) const
+  {
+    return m_dimension == 2 ? std::array<double, 3>{ { point[0], point[1], 0. } } : point;
+  }
+
+  int m_dimension;
+  std::vector<double> m_x;
+  std::vector<double> m_y;
+  std::vector<double> m_z;
+  std::vector<std::size_t> m_ids;
+  // The position in the tree of each input index (or size_t(-1)).
+  std::vector<std::size_t> m_positions;
+  std::vector<Node> m_nodes;
+};
+} // namespace mesh
+} // namespace smtk
+
+#endif
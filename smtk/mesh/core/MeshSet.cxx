@@ -68,6 +68,7 @@ MeshSet::MeshSet(const smtk::mesh::MeshSet& other)
   : m_parent(other.m_parent)
   , m_handle(other.m_handle)
   , m_range(other.m_range)
+  , m_index(other.m_index)
 {
 }
 
@@ -78,6 +79,7 @@ MeshSet& MeshSet::operator=(const MeshSet& other)
   m_parent = other.m_parent;
   m_handle = other.m_handle;
   m_range = other.m_range;
+  m_index = other.m_index;
   return *this;
 }
 
@@ -157,6 +159,7 @@ bool MeshSet::append(const MeshSet& other)
   if (can_append)
   {
     m_range += other.m_range;
+    m_index.reset();
   }
   return can_append;
 }
@@ -421,14 +424,20 @@ smtk::mesh::MeshSet MeshSet::subset(const smtk::mesh::Neumann& n) const
 smtk::mesh::MeshSet MeshSet::subset(std::size_t ith) const
 {
   smtk::mesh::HandleRange singleHandleRange;
-  if (!m_range.empty() && ith < m_range.size())
+  const smtk::mesh::IndexedHandleRange& index = this->indexedRange();
+  if (ith < index.size())
   {
-    singleHandleRange.insert(smtk::mesh::rangeElement(m_range, ith));
+    singleHandleRange.insert(index.element(ith));
   }
   smtk::mesh::MeshSet singleMesh(m_parent, m_handle, singleHandleRange);
   return singleMesh;
 }
 
+const smtk::mesh::IndexedHandleRange& MeshSet::indexedRange() const
+{
+  return smtk::mesh::cachedIndex(m_index, m_range);
+}
+
 smtk::mesh::MeshSet MeshSet::extractShell() const
 {
   bool created;
@@ -627,8 +636,11 @@ MeshSet set_intersect(const MeshSet& a, const MeshSet& b)
     return smtk::mesh::MeshSet(a.m_parent, a.m_handle, smtk::mesh::HandleRange());
   }
 
-  smtk::mesh::HandleRange result = a.m_range & b.m_range;
-  return smtk::mesh::MeshSet(a.m_parent, a.m_handle, result);
+  smtk::mesh::IndexedHandleRange index =
+    smtk::mesh::rangeIntersect(a.indexedRange(), b.indexedRange());
+  smtk::mesh::MeshSet result(a.m_parent, a.m_handle, index.range());
+  result.m_index = std::make_shared<const smtk::mesh::IndexedHandleRange>(std::move(index));
+  return result;
 }
 
 //subtract mesh b from a, placing the results in the return mesh set
@@ -639,8 +651,11 @@ MeshSet set_difference(const MeshSet& a, const MeshSet& b)
     return smtk::mesh::MeshSet(a.m_parent, a.m_handle, smtk::mesh::HandleRange());
   }
 
-  smtk::mesh::HandleRange result = a.m_range - b.m_range;
-  return smtk::mesh::MeshSet(a.m_parent, a.m_handle, result);
+  smtk::mesh::IndexedHandleRange index =
+    smtk::mesh::rangeSubtract(a.indexedRange(), b.indexedRange());
+  smtk::mesh::MeshSet result(a.m_parent, a.m_handle, index.range());
+  result.m_index = std::make_shared<const smtk::mesh::IndexedHandleRange>(std::move(index));
+  return result;
 }
 
 //union two mesh sets, placing the results in the return mesh set
@@ -651,8 +666,11 @@ MeshSet set_union(const MeshSet& a, const MeshSet& b)
     return smtk::mesh::MeshSet(a.m_parent, a.m_handle, smtk::mesh::HandleRange());
   }
 
-  smtk::mesh::HandleRange result = a.m_range | b.m_range;
-  return smtk::mesh::MeshSet(a.m_parent, a.m_handle, result);
+  smtk::mesh::IndexedHandleRange index =
+    smtk::mesh::rangeUnion(a.indexedRange(), b.indexedRange());
+  smtk::mesh::MeshSet result(a.m_parent, a.m_handle, index.range());
+  result.m_index = std::make_shared<const smtk::mesh::IndexedHandleRange>(std::move(index));
+  return result;
 }
 
 SMTKCORE_EXPORT void for_each(const MeshSet& a, MeshForEach& filter)
@@ -17,6 +17,7 @@
 #include "smtk/mesh/core/CellSet.h"
 #include "smtk/mesh/core/Component.h"
 #include "smtk/mesh/core/Handle.h"
+#include "smtk/mesh/core/IndexedHandleRange.h"
 #include "smtk/mesh/core/PointSet.h"
 #include "smtk/mesh/core/QueryTypes.h"
 #include "smtk/mesh/core/TypeSet.h"
@@ -212,6 +213,10 @@ public:
   //get the underlying HandleRange that this MeshSet represents
   const smtk::mesh::HandleRange& range() const { return m_range; }
 
+  //get a random-access index over the underlying HandleRange. The index is
+  //built on first use and shared with copies of this MeshSet.
+  const smtk::mesh::IndexedHandleRange& indexedRange() const;
+
   //get the underlying resource that this MeshSet belongs to
   const smtk::mesh::ResourcePtr& resource() const;
 
@@ -224,6 +229,7 @@ private:
   smtk::mesh::ResourcePtr m_parent;
   smtk::mesh::Handle m_handle{};
   smtk::mesh::HandleRange m_range; //range of entity sets
+  mutable std::shared_ptr<const smtk::mesh::IndexedHandleRange> m_index;
   mutable smtk::common::UUID m_id;
 };
 
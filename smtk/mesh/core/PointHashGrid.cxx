@@ -0,0 +1,390 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/core/PointHashGrid.h"
+#include "smtk/mesh/core/detail/BatchPointQuery.h"
+
+#include "smtk/common/WorkStealingPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace
+{
+// The average number of points per cell when the cell size is automatic.
+const double PointsPerCell = 2.;
+
+// Cell indices are clamped to this magnitude so far-away query points do not
+// overflow them.
+const double MaxCellIndex = 1.e15;
+} // namespace
+
+namespace smtk
+{
+namespace mesh
+{
+
+PointHashGrid::PointHashGrid()
+  : m_cellSize(1.)
+  , m_origin({ { 0., 0., 0. } })
+  , m_lower({ { 0., 0., 0. } })
+  , m_upper({ { 0., 0., 0. } })
+  , m_mask(0)
+  , m_offsets(2, 0)
+{
+}
+
+PointHashGrid::PointHashGrid(
+  std::size_t numberOfPoints,
+  const std::function<std::array<double, 3>(std::size_t)>& coordinates,
+  const std::function<bool(std::size_t)>& include,
+  double cellSize)
+  : PointHashGrid()
+{
+  std::vector<double> xyz;
+  xyz.reserve(3 * numberOfPoints);
+  for (std::size_t i = 0; i < numberOfPoints; ++i)
+  {
+    if (!include || include(i))
+    {
+      std::array<double, 3> p = coordinates(i);
+      xyz.insert(xyz.end(), p.begin(), p.end());
+      m_ids.push_back(i);
+    }
+  }
+  std::size_t n = m_ids.size();
+  m_positions.assign(numberOfPoints, static_cast<std::size_t>(-1));
+  if (n == 0)
+  {
+    return;
+  }
+
+  m_lower = m_upper = { { xyz[0], xyz[1], xyz[2] } };
+  for (std::size_t i = 1; i < n; ++i)
+  {
+    for (int j = 0; j < 3; ++j)
+    {
+      m_lower[j] = std::min(m_lower[j], xyz[3 * i + j]);
+      m_upper[j] = std::max(m_upper[j], xyz[3 * i + j]);
+    }
+  }
+  m_origin = m_lower;
+
+  if (cellSize > 0.)
+  {
+    m_cellSize = cellSize;
+  }
+  else
+  {
+    // Choose cells holding PointsPerCell points on average, measuring the
+    // volume of only the non-degenerate dimensions of the bounding box.
+    double measure = 1.;
+    int dimension = 0;
+    double largest = 0.;
+    for (int j = 0; j < 3; ++j)
+    {
+      double length = m_upper[j] - m_lower[j];
+      largest = std::max(largest, length);
+      if (length > 0.)
+      {
+        measure *= length;
+        ++dimension;
+      }
+    }
+    m_cellSize = dimension > 0 ? std::pow(measure * PointsPerCell / n, 1. / dimension) : 1.;
+    if (!(m_cellSize > largest * 1.e-9) || !std::isfinite(m_cellSize))
+    {
+      m_cellSize = largest > 0. ? largest : 1.;
+    }
+  }
+
+  // Use a power-of-two table with at least as many buckets as points.
+  std::size_t numberOfBuckets = 1;
+  while (numberOfBuckets < n)
+  {
+    numberOfBuckets <<= 1;
+  }
+  m_mask = numberOfBuckets - 1;
+
+  std::vector<std::size_t> buckets(n);
+  smtk::common::parallelFor(
+    std::size_t(0), n, std::size_t(4096), [&](std::size_t first, std::size_t last) {
+      for (std::size_t i = first; i < last; ++i)
+      {
+        buckets[i] = this->bucket(this->cell(xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2]));
+      }
+    });
+
+  // Counting sort the points by bucket.
+  m_offsets.assign(numberOfBuckets + 1, 0);
+  for (std::size_t b : buckets)
+  {
+    ++m_offsets[b + 1];
+  }
+  for (std::size_t b = 0; b < numberOfBuckets; ++b)
+  {
+    m_offsets[b + 1] += m_offsets[b];
+  }
+  std::vector<std::size_t> next(m_offsets.begin(), m_offsets.end() - 1);
+  std::vector<std::size_t> ids(n);
+  m_x.resize(n);
+  m_y.resize(n);
+  m_z.resize(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    std::size_t position = next[buckets[i]]++;
+    m_x[position] = xyz[3 * i];
+    m_y[position] = xyz[3 * i + 1];
+    m_z[position] = xyz[3 * i + 2];
+    ids[position] = m_ids[i];
+    m_positions[m_ids[i]] = position;
+  }
+  m_ids = std::move(ids);
+}
+
+PointHashGrid::PointHashGrid(std::size_t numberOfPoints, const double* xyz, double cellSize)
+  : PointHashGrid(
+      numberOfPoints,
+      [xyz](std::size_t i) {
+        return std::array<double, 3>{ { xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2] } };
+      },
+      nullptr,
+      cellSize)
+{
+}
+
+std::array<std::int64_t, 3> PointHashGrid::cell(double x, double y, double z) const
+{
+  const double p[3] = { x, y, z };
+  std::array<std::int64_t, 3> result;
+  for (int j = 0; j < 3; ++j)
+  {
+    double index = std::floor((p[j] - m_origin[j]) / m_cellSize);
+    result[j] = static_cast<std::int64_t>(std::max(-MaxCellIndex, std::min(MaxCellIndex, index)));
+  }
+  return result;
+}
+
+std::size_t PointHashGrid::bucket(const std::array<std::int64_t, 3>& cell) const
+{
+  std::uint64_t hash = static_cast<std::uint64_t>(cell[0]) * 73856093u ^
+    static_cast<std::uint64_t>(cell[1]) * 19349663u ^
+    static_cast<std::uint64_t>(cell[2]) * 83492791u;
+  return static_cast<std::size_t>(hash) & m_mask;
+}
+
+template<typename Visitor>
+void PointHashGrid::visitCells(
+  const std::array<std::int64_t, 3>& lower,
+  const std::array<std::int64_t, 3>& upper,
+  const Visitor& visit) const
+{
+  // If the query covers more cells than there are buckets, it is cheaper to
+  // test every point once.
+  double numberOfCells = 1.;
+  for (int j = 0; j < 3; ++j)
+  {
+    numberOfCells *= static_cast<double>(upper[j] - lower[j] + 1);
+  }
+  if (numberOfCells > static_cast<double>(m_mask + 1))
+  {
+    for (std::size_t position = 0; position < m_ids.size(); ++position)
+    {
+      visit(position);
+    }
+    return;
+  }
+
+  std::array<std::int64_t, 3> c;
+  for (c[0] = lower[0]; c[0] <= upper[0]; ++c[0])
+  {
+    for (c[1] = lower[1]; c[1] <= upper[1]; ++c[1])
+    {
+      for (c[2] = lower[2]; c[2] <= upper[2]; ++c[2])
+      {
+        std::size_t b = this->bucket(c);
+        for (std::size_t position = m_offsets[b]; position < m_offsets[b + 1]; ++position)
+        {
+          // Buckets are shared by colliding cells; skip points of other cells
+          // so that no point is visited twice.
+          if (this->cell(m_x[position], m_y[position], m_z[position]) == c)
+          {
+            visit(position);
+          }
+        }
+      }
+    }
+  }
+}
+
+void PointHashGrid::withinRadius(
+  const std::array<double, 3>& point,
+  double radius,
+  std::vector<std::size_t>& ids,
+  std::vector<double>& sqDistances) const
+{
+  ids.clear();
+  sqDistances.clear();
+  if (m_ids.empty() || radius < 0.)
+  {
+    return;
+  }
+
+  // Restrict the search to the cells overlapping both the query sphere and
+  // the bounding box of the points.
+  std::array<double, 3> lower, upper;
+  for (int j = 0; j < 3; ++j)
+  {
+    lower[j] = std::max(point[j] - radius, m_lower[j]);
+    upper[j] = std::min(point[j] + radius, m_upper[j]);
+    if (lower[j] > upper[j])
+    {
+      return;
+    }
+  }
+
+  const double sqRadius = radius * radius;
+  this->visitCells(
+    this->cell(lower[0], lower[1], lower[2]),
+    this->cell(upper[0], upper[1], upper[2]),
+    [&](std::size_t position) {
+      double dx = m_x[position] - point[0];
+      double dy = m_y[position] - point[1];
+      double dz = m_z[position] - point[2];
+      double d = dx * dx + dy * dy + dz * dz;
+      if (d <= sqRadius)
+      {
+        ids.push_back(m_ids[position]);
+        sqDistances.push_back(d);
+      }
+    });
+}
+
+void PointHashGrid::nearest(
+  const std::array<double, 3>& point,
+  std::size_t k,
+  std::vector<std::size_t>& ids,
+  std::vector<double>& sqDistances,
+  double maxRadius) const
+{
+  ids.clear();
+  sqDistances.clear();
+  if (m_ids.empty() || k == 0)
+  {
+    return;
+  }
+
+  // Any point lies within this distance of the query point.
+  double farthest = 0.;
+  for (int j = 0; j < 3; ++j)
+  {
+    double d = std::max(std::abs(point[j] - m_lower[j]), std::abs(point[j] - m_upper[j]));
+    farthest += d * d;
+  }
+  farthest = std::sqrt(farthest);
+
+  // Search spheres of doubling radius until one holds k points. Every point
+  // within the radius is found, so the k nearest of them are the k nearest.
+  double radius = std::min(m_cellSize, maxRadius);
+  std::vector<std::size_t> found;
+  std::vector<double> foundSqDistances;
+  while (true)
+  {
+    this->withinRadius(point, radius, found, foundSqDistances);
+    if (found.size() >= k || radius >= maxRadius || radius >= farthest)
+    {
+      break;
+    }
+    radius = std::min(2. * radius, maxRadius);
+  }
+
+  std::vector<std::pair<double, std::size_t>> candidates(found.size());
+  for (std::size_t i = 0; i < found.size(); ++i)
+  {
+    candidates[i] = std::make_pair(foundSqDistances[i], found[i]);
+  }
+  std::size_t count = std::min(k, candidates.size());
+  std::partial_sort(candidates.begin(), candidates.begin() + count, candidates.end());
+  ids.reserve(count);
+  sqDistances.reserve(count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    sqDistances.push_back(candidates[i].first);
+    ids.push_back(candidates[i].second);
+  }
+}
+
+std::size_t PointHashGrid::closest(const std::array<double, 3>& point, double& sqDistance) const
+{
+  std::vector<std::size_t> ids;
+  std::vector<double> sqDistances;
+  this->nearest(point, 1, ids, sqDistances);
+  if (ids.empty())
+  {
+    sqDistance = std::numeric_limits<double>::infinity();
+    return static_cast<std::size_t>(-1);
+  }
+  sqDistance = sqDistances[0];
+  return ids[0];
+}
+
+void PointHashGrid::nearest(
+  std::size_t numberOfQueries,
+  const double* xyz,
+  std::size_t k,
+  std::vector<std::size_t>& offsets,
+  std::vector<std::size_t>& ids,
+  std::vector<double>& sqDistances,
+  double maxRadius) const
+{
+  smtk::mesh::detail::batchPointQuery(
+    numberOfQueries,
+    xyz,
+    offsets,
+    ids,
+    sqDistances,
+    [&](
+      const std::array<double, 3>& point,
+      std::vector<std::size_t>& queryIds,
+      std::vector<double>& querySqDistances) {
+      this->nearest(point, k, queryIds, querySqDistances, maxRadius);
+    });
+}
+
+void PointHashGrid::withinRadius(
+  std::size_t numberOfQueries,
+  const double* xyz,
+  double radius,
+  std::vector<std::size_t>& offsets,
+  std::vector<std::size_t>& ids,
+  std::vector<double>& sqDistances) const
+{
+  smtk::mesh::detail::batchPointQuery(
+    numberOfQueries,
+    xyz,
+    offsets,
+    ids,
+    sqDistances,
+    [&](
+      const std::array<double, 3>& point,
+      std::vector<std::size_t>& queryIds,
+      std::vector<double>& querySqDistances) {
+      this->withinRadius(point, radius, queryIds, querySqDistances);
+    });
+}
+
+std::array<double, 3> PointHashGrid::point(std::size_t id) const
+{
+  std::size_t position = m_positions[id];
+  return std::array<double, 3>{ { m_x[position], m_y[position], m_z[position] } };
+}
+} // namespace mesh
+} // namespace smtk
@@ -0,0 +1,136 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_mesh_core_PointHashGrid_h
+#define smtk_mesh_core_PointHashGrid_h
+
+#include "smtk/CoreExports.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace smtk
+{
+namespace mesh
+{
+
+/**\brief A uniform grid of hashed cells for radius and nearest-neighbor
+   queries.
+
+   Points are binned into cubic cells of a fixed size, and cells are hashed
+   into a table with (about) one bucket per point, so memory use does not
+   depend upon the extent of the points. Radius queries visit only the cells
+   overlapping the query sphere, making the grid a good choice for evenly
+   distributed points queried with a radius comparable to the cell size.
+   For strongly clustered points, prefer KDTree.
+
+   The query interface matches that of KDTree: results report the index each
+   point had in the input, and the grid is immutable once built so it may be
+   queried concurrently. Cell keys are computed in parallel during
+   construction, and the batch query forms run in parallel.
+  */
+class SMTKCORE_EXPORT PointHashGrid
+{
+public:
+  /// Construct an empty grid.
+  PointHashGrid();
+
+  /// Construct a grid from \a numberOfPoints points whose coordinates are
+  /// returned by \a coordinates. If \a include is provided, only points for
+  /// which it returns true are inserted. If \a cellSize is not positive, a
+  /// cell size holding a few points per cell on average is chosen.
+  PointHashGrid(
+    std::size_t numberOfPoints,
+    const std::function<std::array<double, 3>(std::size_t)>& coordinates,
+    const std::function<bool(std::size_t)>& include = nullptr,
+    double cellSize = 0.);
+
+  /// Construct a grid from an array of interleaved xyz coordinates.
+  PointHashGrid(std::size_t numberOfPoints, const double* xyz, double cellSize = 0.);
+
+  /// The number of points in the grid.
+  std::size_t size() const { return m_ids.size(); }
+  bool empty() const { return m_ids.empty(); }
+
+  /// The edge length of each grid cell.
+  double cellSize() const { return m_cellSize; }
+
+  /// Find the (at most) \a k points nearest \a point that are no farther than
+  /// \a maxRadius from it, ordered from nearest to farthest.
+  void nearest(
+    const std::array<double, 3>& point,
+    std::size_t k,
+    std::vector<std::size_t>& ids,
+    std::vector<double>& sqDistances,
+    double maxRadius = std::numeric_limits<double>::infinity()) const;
+
+  /// Find all points within \a radius of \a point (in no particular order).
+  void withinRadius(
+    const std::array<double, 3>& point,
+    double radius,
+    std::vector<std::size_t>& ids,
+    std::vector<double>& sqDistances) const;
+
+  /// Return the input index of the point closest to \a point (or size_t(-1)
+  /// if the grid is empty), setting \a sqDistance to its squared distance.
+  std::size_t closest(const std::array<double, 3>& point, double& sqDistance) const;
+
+  /// Batch forms of nearest() and withinRadius(); see KDTree.
+  void nearest(
+    std::size_t numberOfQueries,
+    const double* xyz,
+    std::size_t k,
+    std::vector<std::size_t>& offsets,
+    std::vector<std::size_t>& ids,
+    std::vector<double>& sqDistances,
+    double maxRadius = std::numeric_limits<double>::infinity()) const;
+  void withinRadius(
+    std::size_t numberOfQueries,
+    const double* xyz,
+    double radius,
+    std::vector<std::size_t>& offsets,
+    std::vector<std::size_t>& ids,
+    std::vector<double>& sqDistances) const;
+
+  /// The coordinates of the point with input index \a id (which must be in
+  /// the grid).
+  std::array<double, 3> point(std::size_t id) const;
+
+private:
+  std::array<std::int64_t, 3> cell(double x, double y, double z) const;
+  std::size_t bucket(const std::array<std::int64_t, 3>& cell) const;
+  // Call visit(position) for each point whose cell lies in [lower, upper].
+  template<typename Visitor>
+  void visitCells(
+    const std::array<std::int64_t, 3>& lower,
+    const std::array<std::int64_t, 3>& upper,
+    const Visitor& visit) const;
+
+  double m_cellSize;
+  std::array<double, 3> m_origin;
+  std::array<double, 3> m_lower;
+  std::array<double, 3> m_upper;
+  std::size_t m_mask;
+  // The points of bucket b are [m_offsets[b], m_offsets[b + 1]).
+  std::vector<std::size_t> m_offsets;
+  std::vector<double> m_x;
+  std::vector<double> m_y;
+  std::vector<double> m_z;
+  std::vector<std::size_t> m_ids;
+  std::vector<std::size_t> m_positions;
+};
+} // namespace mesh
+} // namespace smtk
+
+#endif
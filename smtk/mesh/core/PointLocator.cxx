@@ -29,6 +29,14 @@ PointLocator::PointLocator(
 {
 }
 
+PointLocator::PointLocator(
+  std::size_t numPoints,
+  const std::function<std::array<double, 3>(std::size_t)>& coordinates,
+  Structure structure)
+  : m_locator(std::make_shared<InMemoryPointLocatorImpl>(numPoints, coordinates, structure))
+{
+}
+
 smtk::mesh::HandleRange PointLocator::range() const
 {
   return m_locator->range();
@@ -38,5 +46,28 @@ void PointLocator::find(double x, double y, double z, double radius, LocatorResu
 {
   return m_locator->locatePointsWithinRadius(x, y, z, radius, results);
 }
+
+bool PointLocator::nearest(double x, double y, double z, std::size_t k, LocatorResults& results)
+{
+  return m_locator->locateNearestPoints(x, y, z, k, results);
+}
+
+void PointLocator::find(
+  std::size_t numPoints,
+  const double* xyzs,
+  double radius,
+  BatchLocatorResults& results)
+{
+  m_locator->batchLocatePointsWithinRadius(numPoints, xyzs, radius, results);
+}
+
+bool PointLocator::nearest(
+  std::size_t numPoints,
+  const double* xyzs,
+  std::size_t k,
+  BatchLocatorResults& results)
+{
+  return m_locator->batchLocateNearestPoints(numPoints, xyzs, k, results);
+}
 } // namespace mesh
 } // namespace smtk
@@ -14,6 +14,7 @@
 #include "smtk/CoreExports.h"
 #include "smtk/PublicPointerDefs.h"
 
+#include "smtk/mesh/core/InMemoryPointLocatorImpl.h"
 #include "smtk/mesh/core/Interface.h"
 #include "smtk/mesh/core/PointSet.h"
 
@@ -34,6 +35,8 @@ class SMTKCORE_EXPORT PointLocator
 {
 public:
   typedef smtk::mesh::PointLocatorImpl::Results LocatorResults;
+  typedef smtk::mesh::PointLocatorImpl::BatchResults BatchLocatorResults;
+  typedef smtk::mesh::InMemoryPointLocatorImpl::Structure Structure;
 
   //Construct a point locator given an existing set of points
   //These are the points you will be searching against
@@ -67,6 +70,26 @@ public:
   {
   }
 
+  //Construct a point locator given a coordinate generating function, without
+  //involving a mesh backend. The points are indexed in memory by the given
+  //structure and are never added to a resource.
+  PointLocator(
+    std::size_t numPoints,
+    const std::function<std::array<double, 3>(std::size_t)>& coordinates,
+    Structure structure = Structure::KDTree);
+  PointLocator(
+    std::size_t numPoints,
+    const double* const xyzs,
+    Structure structure = Structure::KDTree)
+    : PointLocator(
+        numPoints,
+        [xyzs](std::size_t i) {
+          return std::array<double, 3>({ { xyzs[3 * i], xyzs[3 * i + 1], xyzs[3 * i + 2] } });
+        },
+        structure)
+  {
+  }
+
   //returns all the point ids that are inside the locator
   smtk::mesh::HandleRange range() const;
 
@@ -87,6 +110,21 @@ public:
   //
   void find(double x, double y, double z, double radius, LocatorResults& results);
 
+  //Find the k points nearest to a single point, ordered from nearest to
+  //farthest. Returns false if the locator's backend cannot answer
+  //nearest-point queries.
+  bool nearest(double x, double y, double z, std::size_t k, LocatorResults& results);
+
+  //Batch forms of find() and nearest() for numPoints query points whose
+  //coordinates are interleaved in xyzs. In-memory locators answer the
+  //queries in parallel.
+  void find(std::size_t numPoints, const double* xyzs, double radius, BatchLocatorResults& results);
+  bool nearest(
+    std::size_t numPoints,
+    const double* xyzs,
+    std::size_t k,
+    BatchLocatorResults& results);
+
 private:
   smtk::mesh::PointLocatorImplPtr m_locator;
 };
@@ -62,6 +62,7 @@ PointSet& PointSet::operator=(const PointSet& other)
 {
   m_parent = other.m_parent;
   m_points = other.m_points;
+  m_index = other.m_index;
   return *this;
 }
 
@@ -97,7 +98,12 @@ bool PointSet::contains(const smtk::mesh::Handle& pointId) const
 
 std::size_t PointSet::find(const smtk::mesh::Handle& pointId) const
 {
-  return smtk::mesh::rangeIndex(m_points, pointId);
+  return this->indexedRange().index(pointId);
+}
+
+const smtk::mesh::IndexedHandleRange& PointSet::indexedRange() const
+{
+  return smtk::mesh::cachedIndex(m_index, m_points);
 }
 
 bool PointSet::get(double* xyz) const
@@ -179,8 +185,11 @@ PointSet set_intersect(const PointSet& a, const PointSet& b)
     return smtk::mesh::PointSet(a.m_parent, smtk::mesh::HandleRange());
   }
 
-  smtk::mesh::HandleRange result = a.m_points & b.m_points;
-  return smtk::mesh::PointSet(a.m_parent, result);
+  smtk::mesh::IndexedHandleRange index =
+    smtk::mesh::rangeIntersect(a.indexedRange(), b.indexedRange());
+  smtk::mesh::PointSet result(a.m_parent, index.range());
+  result.m_index = std::make_shared<const smtk::mesh::IndexedHandleRange>(std::move(index));
+  return result;
 }
 
 PointSet set_difference(const PointSet& a, const PointSet& b)
@@ -190,8 +199,11 @@ PointSet set_difference(const PointSet& a, const PointSet& b)
     return smtk::mesh::PointSet(a.m_parent, smtk::mesh::HandleRange());
   }
 
-  smtk::mesh::HandleRange result = a.m_points - b.m_points;
-  return smtk::mesh::PointSet(a.m_parent, result);
+  smtk::mesh::IndexedHandleRange index =
+    smtk::mesh::rangeSubtract(a.indexedRange(), b.indexedRange());
+  smtk::mesh::PointSet result(a.m_parent, index.range());
+  result.m_index = std::make_shared<const smtk::mesh::IndexedHandleRange>(std::move(index));
+  return result;
 }
 
 PointSet set_union(const PointSet& a, const PointSet& b)
@@ -201,8 +213,11 @@ PointSet set_union(const PointSet& a, const PointSet& b)
     return smtk::mesh::PointSet(a.m_parent, smtk::mesh::HandleRange());
   }
 
-  smtk::mesh::HandleRange result = a.m_points | b.m_points;
-  return smtk::mesh::PointSet(a.m_parent, result);
+  smtk::mesh::IndexedHandleRange index =
+    smtk::mesh::rangeUnion(a.indexedRange(), b.indexedRange());
+  smtk::mesh::PointSet result(a.m_parent, index.range());
+  result.m_index = std::make_shared<const smtk::mesh::IndexedHandleRange>(std::move(index));
+  return result;
 }
 
 void for_each(const PointSet& a, PointForEach& filter)
@@ -15,6 +15,7 @@
 #include "smtk/PublicPointerDefs.h"
 
 #include "smtk/mesh/core/Handle.h"
+#include "smtk/mesh/core/IndexedHandleRange.h"
 #include "smtk/mesh/core/QueryTypes.h"
 
 namespace smtk
@@ -110,12 +111,17 @@ public:
   //get the underlying HandleRange that this PointSet represents
   const smtk::mesh::HandleRange& range() const { return m_points; }
 
+  //get a random-access index over the underlying HandleRange. The index is
+  //built on first use and shared with copies of this PointSet.
+  const smtk::mesh::IndexedHandleRange& indexedRange() const;
+
   //get the underlying resource that this PointSet belongs to
   const smtk::mesh::ResourcePtr& resource() const;
 
 private:
   smtk::mesh::ResourcePtr m_parent;
   smtk::mesh::HandleRange m_points;
+  mutable std::shared_ptr<const smtk::mesh::IndexedHandleRange> m_index;
 };
 
 //intersect two set of points, placing the results in the return points object.
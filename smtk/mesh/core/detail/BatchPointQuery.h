@@ -0,0 +1,78 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_mesh_core_detail_BatchPointQuery_h
+#define smtk_mesh_core_detail_BatchPointQuery_h
+
+#include "smtk/common/WorkStealingPool.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace smtk
+{
+namespace mesh
+{
+namespace detail
+{
+// Queries are distributed across threads in blocks of this size.
+const std::size_t BatchQueryGrain = 64;
+
+// Run \a query for each of \a numberOfQueries points and concatenate the
+// results into compressed (offset) form.
+template<typename Query>
+void batchPointQuery(
+  std::size_t numberOfQueries,
+  const double* xyz,
+  std::vector<std::size_t>& offsets,
+  std::vector<std::size_t>& ids,
+  std::vector<double>& sqDistances,
+  const Query& query)
+{
+  std::vector<std::vector<std::size_t>> queryIds(numberOfQueries);
+  std::vector<std::vector<double>> querySqDistances(numberOfQueries);
+  smtk::common::parallelFor(
+    std::size_t(0), numberOfQueries, BatchQueryGrain, [&](std::size_t first, std::size_t last) {
+      for (std::size_t i = first; i < last; ++i)
+      {
+        query(
+          std::array<double, 3>{ { xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2] } },
+          queryIds[i],
+          querySqDistances[i]);
+      }
+    });
+
+  offsets.resize(numberOfQueries + 1);
+  offsets[0] = 0;
+  for (std::size_t i = 0; i < numberOfQueries; ++i)
+  {
+    offsets[i + 1] = offsets[i] + queryIds[i].size();
+  }
+  ids.resize(offsets.back());
+  sqDistances.resize(offsets.back());
+  smtk::common::parallelFor(
+    std::size_t(0), numberOfQueries, BatchQueryGrain, [&](std::size_t first, std::size_t last) {
+      for (std::size_t i = first; i < last; ++i)
+      {
+        std::copy(queryIds[i].begin(), queryIds[i].end(), ids.begin() + offsets[i]);
+        std::copy(
+          querySqDistances[i].begin(),
+          querySqDistances[i].end(),
+          sqDistances.begin() + offsets[i]);
+      }
+    });
+}
+} // namespace detail
+} // namespace mesh
+} // namespace smtk
+
+#endif
@@ -10,11 +10,30 @@
 
 #include "InverseDistanceWeighting.h"
 
+#include "smtk/mesh/core/KDTree.h"
 #include "smtk/mesh/interpolation/PointCloud.h"
 #include "smtk/mesh/interpolation/StructuredGrid.h"
 
+#include "smtk/common/WorkStealingPool.h"
+
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <utility>
+#include <vector>
+
+namespace smtk
+{
+namespace mesh
+{
+class InverseDistanceWeighting::Interpolator
+{
+public:
+  virtual ~Interpolator() = default;
+  virtual double operator()(const std::array<double, 3>& p) const = 0;
+};
+} // namespace mesh
+} // namespace smtk
 
 namespace
 {
@@ -28,6 +47,7 @@ double euclideanDistance(const std::array<double, 3>& p1, const std::array<doubl
 }
 
 class InverseDistanceWeightingForPointCloud
+  : public smtk::mesh::InverseDistanceWeighting::Interpolator
 {
 public:
   InverseDistanceWeightingForPointCloud(
@@ -41,7 +61,7 @@ public:
   }
 
   // Return the interpolated value at <p> as a weighted sum of the sources
-  double operator()(const std::array<double, 3>& p) const
+  double operator()(const std::array<double, 3>& p) const override
   {
     double d = 0., w = 0., num = 0., denom = 0.;
     for (std::size_t i = 0; i < m_pointcloud.size(); i++)
@@ -71,6 +91,7 @@ private:
 };
 
 class InverseDistanceWeightingForStructuredGrid
+  : public smtk::mesh::InverseDistanceWeighting::Interpolator
 {
 public:
   InverseDistanceWeightingForStructuredGrid(
@@ -84,7 +105,7 @@ public:
   }
 
   // Return the interpolated value at <p> as a weighted sum of the sources
-  double operator()(const std::array<double, 3>& p) const
+  double operator()(const std::array<double, 3>& p) const override
   {
     double d = 0., w = 0., num = 0., denom = 0.;
     for (int i = m_structuredgrid.m_extent[0]; i < m_structuredgrid.m_extent[1]; i++)
@@ -127,6 +148,265 @@ private:
   double m_power;
   std::function<bool(double)> m_prefilter;
 };
+
+// Compute Shepard's interpolant from the values and squared distances of the
+// source points that contribute to it. Returns NaN if there are none.
+double weightedAverage(
+  const std::vector<double>& values,
+  const std::vector<double>& sqDistances,
+  double power)
+{
+  if (values.empty())
+  {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  double num = 0., denom = 0.;
+  for (std::size_t i = 0; i < values.size(); ++i)
+  {
+    double d = std::sqrt(sqDistances[i]);
+    // If d is zero, then return the value associated with the source point.
+    if (d < EPSILON)
+    {
+      return values[i];
+    }
+    double w = std::pow(d, -1. * power);
+    num += w * values[i];
+    denom += w;
+  }
+  return num / denom;
+}
+
+// Inverse distance weighting over the nearest points of a point cloud, found
+// with a kd-tree built once from the valid, prefiltered source points.
+class IndexedInverseDistanceWeightingForPointCloud
+  : public smtk::mesh::InverseDistanceWeighting::Interpolator
+{
+public:
+  IndexedInverseDistanceWeightingForPointCloud(
+    const smtk::mesh::PointCloud& pointcloud,
+    double power,
+    const smtk::mesh::InverseDistanceWeighting::Neighborhood& neighborhood,
+    const std::function<bool(double)>& prefilter)
+    : m_values(pointcloud.size())
+    , m_power(power)
+    , m_neighborhood(neighborhood)
+  {
+    std::vector<bool> include(pointcloud.size());
+    for (std::size_t i = 0; i < pointcloud.size(); ++i)
+    {
+      include[i] = pointcloud.containsIndex(i);
+      if (include[i])
+      {
+        m_values[i] = pointcloud.data()(i);
+        include[i] = prefilter(m_values[i]);
+      }
+    }
+    m_tree = smtk::mesh::KDTree(
+      pointcloud.size(), pointcloud.coordinates(), [&include](std::size_t i) {
+        return include[i];
+      });
+  }
+
+  double operator()(const std::array<double, 3>& p) const override
+  {
+    std::vector<std::size_t> ids;
+    std::vector<double> sqDistances;
+    if (m_neighborhood.numberOfNeighbors > 0)
+    {
+      m_tree.nearest(
+        p,
+        m_neighborhood.numberOfNeighbors,
+        ids,
+        sqDistances,
+        m_neighborhood.radius > 0. ? m_neighborhood.radius
+                                   : std::numeric_limits<double>::infinity());
+    }
+    else
+    {
+      m_tree.withinRadius(p, m_neighborhood.radius, ids, sqDistances);
+    }
+
+    std::vector<double> values(ids.size());
+    for (std::size_t i = 0; i < ids.size(); ++i)
+    {
+      values[i] = m_values[ids[i]];
+    }
+    return weightedAverage(values, sqDistances, m_power);
+  }
+
+private:
+  smtk::mesh::KDTree m_tree;
+  std::vector<double> m_values;
+  double m_power;
+  smtk::mesh::InverseDistanceWeighting::Neighborhood m_neighborhood;
+};
+
+// Inverse distance weighting over a window of grid points surrounding the
+// query point. The window is sized to hold the requested neighborhood and, for
+// k-nearest neighborhoods, is widened until it provably holds the k nearest
+// points (e.g., for query points outside of the grid or near blanked points).
+class WindowedInverseDistanceWeightingForStructuredGrid
+  : public smtk::mesh::InverseDistanceWeighting::Interpolator
+{
+public:
+  WindowedInverseDistanceWeightingForStructuredGrid(
+    const smtk::mesh::StructuredGrid& structuredgrid,
+    double power,
+    const smtk::mesh::InverseDistanceWeighting::Neighborhood& neighborhood,
+    std::function<bool(double)> prefilter)
+    : m_structuredgrid(structuredgrid)
+    , m_power(power)
+    , m_neighborhood(neighborhood)
+    , m_prefilter(prefilter)
+  {
+    for (int axis = 0; axis < 2; ++axis)
+    {
+      int halfWidth = 1;
+      if (neighborhood.radius > 0.)
+      {
+        halfWidth = static_cast<int>(
+          std::ceil(neighborhood.radius / std::abs(m_structuredgrid.m_spacing[axis])));
+      }
+      else if (neighborhood.numberOfNeighbors > 0)
+      {
+        // A disk holding k grid points has a radius of about sqrt(k / pi) cells.
+        halfWidth = static_cast<int>(
+                      std::ceil(std::sqrt(neighborhood.numberOfNeighbors / 3.14159265358979))) +
+          1;
+      }
+      m_halfWidth[axis] = std::max(halfWidth, 1);
+    }
+  }
+
+  double operator()(const std::array<double, 3>& p) const override
+  {
+    const auto& extent = m_structuredgrid.m_extent;
+    const auto& origin = m_structuredgrid.m_origin;
+    const auto& spacing = m_structuredgrid.m_spacing;
+
+    // The grid point nearest to the query point.
+    double fi = std::round((p[0] - origin[0]) / spacing[0]) + extent[0];
+    double fj = std::round((p[1] - origin[1]) / spacing[1]) + extent[2];
+    int ci = static_cast<int>(std::max<double>(extent[0], std::min<double>(extent[1] - 1, fi)));
+    int cj = static_cast<int>(std::max<double>(extent[2], std::min<double>(extent[3] - 1, fj)));
+
+    std::vector<double> values;
+    std::vector<double> sqDistances;
+    const std::size_t k = m_neighborhood.numberOfNeighbors;
+    const double sqRadius = m_neighborhood.radius * m_neighborhood.radius;
+    std::array<int, 2> halfWidth = m_halfWidth;
+    while (true)
+    {
+      values.clear();
+      sqDistances.clear();
+      int iMin = std::max(extent[0], ci - halfWidth[0]);
+      int iMax = std::min(extent[1] - 1, ci + halfWidth[0]);
+      int jMin = std::max(extent[2], cj - halfWidth[1]);
+      int jMax = std::min(extent[3] - 1, cj + halfWidth[1]);
+      for (int i = iMin; i <= iMax; i++)
+      {
+        for (int j = jMin; j <= jMax; j++)
+        {
+          if (!m_structuredgrid.containsIndex(i, j))
+          {
+            continue;
+          }
+          double value = m_structuredgrid.data()(i, j);
+          if (!m_prefilter(value))
+          {
+            continue;
+          }
+          double dx = origin[0] + (i - extent[0]) * spacing[0] - p[0];
+          double dy = origin[1] + (j - extent[2]) * spacing[1] - p[1];
+          double d2 = dx * dx + dy * dy + p[2] * p[2];
+          if (m_neighborhood.radius > 0. && d2 > sqRadius)
+          {
+            continue;
+          }
+          values.push_back(value);
+          sqDistances.push_back(d2);
+        }
+      }
+
+      if (k > 0 && values.size() > k)
+      {
+        // Keep the k nearest points of the window.
+        std::vector<std::size_t> order(values.size());
+        for (std::size_t i = 0; i < order.size(); ++i)
+        {
+          order[i] = i;
+        }
+        std::nth_element(
+          order.begin(), order.begin() + k - 1, order.end(), [&](std::size_t a, std::size_t b) {
+            return sqDistances[a] < sqDistances[b];
+          });
+        std::vector<double> nearestValues(k);
+        std::vector<double> nearestSqDistances(k);
+        for (std::size_t i = 0; i < k; ++i)
+        {
+          nearestValues[i] = values[order[i]];
+          nearestSqDistances[i] = sqDistances[order[i]];
+        }
+        values.swap(nearestValues);
+        sqDistances.swap(nearestSqDistances);
+      }
+
+      // A window sized by radius holds every point of the neighborhood.
+      if (m_neighborhood.radius > 0.)
+      {
+        break;
+      }
+
+      // Points outside of the window are at least this far (in the x-y plane)
+      // from the query point, so the k nearest points of the window are the k
+      // nearest points of the grid if none of them is any farther.
+      double covered = std::numeric_limits<double>::infinity();
+      if (ci - halfWidth[0] > extent[0])
+      {
+        double x = origin[0] + (ci - halfWidth[0] - 1 - extent[0]) * spacing[0];
+        covered = std::min(covered, std::abs(p[0] - x));
+      }
+      if (ci + halfWidth[0] < extent[1] - 1)
+      {
+        double x = origin[0] + (ci + halfWidth[0] + 1 - extent[0]) * spacing[0];
+        covered = std::min(covered, std::abs(p[0] - x));
+      }
+      if (cj - halfWidth[1] > extent[2])
+      {
+        double y = origin[1] + (cj - halfWidth[1] - 1 - extent[2]) * spacing[1];
+        covered = std::min(covered, std::abs(p[1] - y));
+      }
+      if (cj + halfWidth[1] < extent[3] - 1)
+      {
+        double y = origin[1] + (cj + halfWidth[1] + 1 - extent[2]) * spacing[1];
+        covered = std::min(covered, std::abs(p[1] - y));
+      }
+      if (covered == std::numeric_limits<double>::infinity())
+      {
+        break;
+      }
+      if (values.size() == k)
+      {
+        double farthest = *std::max_element(sqDistances.begin(), sqDistances.end()) - p[2] * p[2];
+        if (farthest <= covered * covered)
+        {
+          break;
+        }
+      }
+      halfWidth[0] *= 2;
+      halfWidth[1] *= 2;
+    }
+
+    return weightedAverage(values, sqDistances, m_power);
+  }
+
+private:
+  const smtk::mesh::StructuredGrid m_structuredgrid;
+  double m_power;
+  smtk::mesh::InverseDistanceWeighting::Neighborhood m_neighborhood;
+  std::function<bool(double)> m_prefilter;
+  std::array<int, 2> m_halfWidth;
+};
 } // namespace
 
 namespace smtk
@@ -138,7 +418,8 @@ InverseDistanceWeighting::InverseDistanceWeighting(
   const PointCloud& pointcloud,
   double power,
   std::function<bool(double)> prefilter)
-  : m_function(InverseDistanceWeightingForPointCloud(pointcloud, power, prefilter))
+  : m_interpolator(
+      std::make_shared<InverseDistanceWeightingForPointCloud>(pointcloud, power, prefilter))
 {
 }
 
@@ -146,8 +427,68 @@ InverseDistanceWeighting::InverseDistanceWeighting(
   const StructuredGrid& structuredgrid,
   double power,
   std::function<bool(double)> prefilter)
-  : m_function(InverseDistanceWeightingForStructuredGrid(structuredgrid, power, prefilter))
+  : m_interpolator(std::make_shared<InverseDistanceWeightingForStructuredGrid>(
+      structuredgrid,
+      power,
+      prefilter))
+{
+}
+
+InverseDistanceWeighting::InverseDistanceWeighting(
+  const PointCloud& pointcloud,
+  double power,
+  const Neighborhood& neighborhood,
+  std::function<bool(double)> prefilter)
 {
+  if (neighborhood.numberOfNeighbors == 0 && neighborhood.radius <= 0.)
+  {
+    m_interpolator =
+      std::make_shared<InverseDistanceWeightingForPointCloud>(pointcloud, power, prefilter);
+  }
+  else
+  {
+    m_interpolator = std::make_shared<IndexedInverseDistanceWeightingForPointCloud>(
+      pointcloud, power, neighborhood, prefilter);
+  }
+}
+
+InverseDistanceWeighting::InverseDistanceWeighting(
+  const StructuredGrid& structuredgrid,
+  double power,
+  const Neighborhood& neighborhood,
+  std::function<bool(double)> prefilter)
+{
+  if (neighborhood.numberOfNeighbors == 0 && neighborhood.radius <= 0.)
+  {
+    m_interpolator = std::make_shared<InverseDistanceWeightingForStructuredGrid>(
+      structuredgrid, power, prefilter);
+  }
+  else
+  {
+    m_interpolator = std::make_shared<WindowedInverseDistanceWeightingForStructuredGrid>(
+      structuredgrid, power, neighborhood, prefilter);
+  }
+}
+
+double InverseDistanceWeighting::operator()(std::array<double, 3> x) const
+{
+  return (*m_interpolator)(x);
+}
+
+void InverseDistanceWeighting::operator()(
+  std::size_t numberOfPoints,
+  const double* xyz,
+  double* values) const
+{
+  const Interpolator& interpolator = *m_interpolator;
+  smtk::common::parallelFor(
+    std::size_t(0), numberOfPoints, std::size_t(256), [&](std::size_t first, std::size_t last) {
+      for (std::size_t i = first; i < last; ++i)
+      {
+        values[i] =
+          interpolator(std::array<double, 3>{ { xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2] } });
+      }
+    });
 }
 } // namespace mesh
 } // namespace smtk
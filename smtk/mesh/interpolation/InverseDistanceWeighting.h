@@ -15,7 +15,9 @@
 #include "smtk/PublicPointerDefs.h"
 
 #include <array>
+#include <cstddef>
 #include <functional>
+#include <memory>
 
 namespace smtk
 {
@@ -33,10 +35,27 @@ class StructuredGrid;
    inverse distance weights of the data set. Shepard's method is used to perform
    the computation. Values from the input data set can be masked using the
    prefilter functor.
+
+   By default every source point contributes to every interpolated value, so
+   evaluating the field at M points of an N-point data set costs O(N*M). When
+   constructed with a Neighborhood, only the nearest source points (and/or
+   those within a radius) contribute. Point clouds are then indexed by a
+   kd-tree built once at construction, and structured grids are sampled in a
+   window of grid points around each query point.
   */
 class SMTKCORE_EXPORT InverseDistanceWeighting
 {
 public:
+  /// Limits on the source points that contribute to each interpolated value.
+  struct Neighborhood
+  {
+    /// Use at most this many of the nearest source points (0 for no limit).
+    std::size_t numberOfNeighbors = 0;
+    /// Ignore source points farther than this (0 for no limit). Points with
+    /// no source point within the radius are assigned NaN.
+    double radius = 0.;
+  };
+
   InverseDistanceWeighting(
     const PointCloud& pointcloud,
     double power = 1.,
@@ -46,10 +65,29 @@ public:
     double power = 1.,
     std::function<bool(double)> prefilter = [](double) { return true; });
 
-  double operator()(std::array<double, 3> x) const { return m_function(x); }
+  InverseDistanceWeighting(
+    const PointCloud& pointcloud,
+    double power,
+    const Neighborhood& neighborhood,
+    std::function<bool(double)> prefilter = [](double) { return true; });
+  InverseDistanceWeighting(
+    const StructuredGrid& structuredgrid,
+    double power,
+    const Neighborhood& neighborhood,
+    std::function<bool(double)> prefilter = [](double) { return true; });
+
+  double operator()(std::array<double, 3> x) const;
+
+  /// Evaluate the field at \a numberOfPoints points whose interleaved
+  /// coordinates are \a xyz, writing the results to \a values. Points are
+  /// evaluated in parallel.
+  void operator()(std::size_t numberOfPoints, const double* xyz, double* values) const;
+
+  class Interpolator;
 
 private:
-  std::function<double(std::array<double, 3>)> m_function;
+  // Copies share the (immutable) interpolator and any spatial index it holds.
+  std::shared_ptr<const Interpolator> m_interpolator;
 };
 } // namespace mesh
 } // namespace smtk
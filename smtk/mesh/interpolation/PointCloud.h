@@ -18,6 +18,8 @@
 #include <cassert>
 #include <functional>
 #include <limits>
+#include <memory>
+#include <vector>
 
 namespace smtk
 {
@@ -103,40 +105,46 @@ public:
   }
 
 private:
+  // The vectors are shared so that copies of a PointCloud (and of its
+  // functors) do not duplicate the underlying point data.
   struct Coordinates
   {
-    Coordinates(std::vector<double> coords)
-      : m_coordinates(std::move(coords))
+    Coordinates(std::vector<double>&& coords)
+      : m_coordinates(std::make_shared<const std::vector<double>>(std::move(coords)))
     {
     }
 
     std::array<double, 3> operator()(std::size_t i) const
     {
-      return std::array<double, 3>(
-        { { m_coordinates[3 * i], m_coordinates[3 * i + 1], m_coordinates[3 * i + 2] } });
+      const std::vector<double>& coords = *m_coordinates;
+      return std::array<double, 3>({ { coords[3 * i], coords[3 * i + 1], coords[3 * i + 2] } });
     }
 
-    const std::vector<double> m_coordinates;
+    std::shared_ptr<const std::vector<double>> m_coordinates;
   };
 
   struct Data
   {
-    Data(std::vector<double> data)
-      : m_data(std::move(data))
+    Data(std::vector<double>&& data)
+      : m_data(std::make_shared<const std::vector<double>>(std::move(data)))
     {
     }
 
-    double operator()(std::size_t i) const { return m_data[i]; }
+    double operator()(std::size_t i) const { return (*m_data)[i]; }
 
-    const std::vector<double> m_data;
+    std::shared_ptr<const std::vector<double>> m_data;
   };
 
+  PointCloud(const Coordinates& coordinates, const Data& data)
+    : PointCloud(data.m_data->size(), coordinates, data, [](std::size_t) { return true; })
+  {
+  }
+
 public:
-  /// Constructs a PointCloud from vectors of coordinates and data.
+  /// Constructs a PointCloud from vectors of coordinates and data. The vectors
+  /// are moved into the PointCloud and shared among its copies.
   PointCloud(std::vector<double>&& coordinates, std::vector<double>&& data)
-    : PointCloud(data.size(), Coordinates(coordinates), Data(data), [](std::size_t) {
-      return true;
-    })
+    : PointCloud(Coordinates(std::move(coordinates)), Data(std::move(data)))
   {
   }
 
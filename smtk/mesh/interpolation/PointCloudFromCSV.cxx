@@ -10,29 +10,29 @@
 
 #include "smtk/mesh/interpolation/PointCloudFromCSV.h"
 
-#include "smtk/common/CompilerInformation.h"
 #include "smtk/common/Paths.h"
+#include "smtk/common/WorkStealingPool.h"
 
-// We use either STL regex or Boost regex, depending on support. These flags
-// correspond to the equivalent logic used to determine the inclusion of Boost's
-// regex library.
-#if defined(SMTK_CLANG) ||                                                                         \
-  (defined(SMTK_GCC) && __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)) ||                 \
-  defined(SMTK_MSVC)
-#include <regex>
-using std::regex;
-using std::sregex_token_iterator;
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
 #else
-#include <boost/regex.hpp>
-using boost::regex;
-using boost::regex_match;
-using boost::regex_replace;
-using boost::regex_search;
-using boost::sregex_token_iterator;
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #endif
 
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <iterator>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace smtk
@@ -43,7 +43,417 @@ namespace mesh
 namespace
 {
 bool registered = PointCloudFromCSV::registerClass();
+
+// Chunks handed to a single task are at least this large so that task
+// overhead stays negligible relative to parsing.
+constexpr std::size_t minimumChunkSize = 1 << 20;
+
+// A read-only view of a file's contents. The file is memory-mapped when the
+// platform allows it; otherwise its contents are read into a buffer.
+class MappedFile
+{
+public:
+  explicit MappedFile(const std::string& fileName)
+  {
+#ifdef _WIN32
+    m_file = CreateFileA(
+      fileName.c_str(),
+      GENERIC_READ,
+      FILE_SHARE_READ,
+      nullptr,
+      OPEN_EXISTING,
+      FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+      nullptr);
+    LARGE_INTEGER size;
+    if (m_file != INVALID_HANDLE_VALUE && GetFileSizeEx(m_file, &size))
+    {
+      m_size = static_cast<std::size_t>(size.QuadPart);
+      if (m_size == 0)
+      {
+        return;
+      }
+      m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      if (m_mapping != nullptr)
+      {
+        m_data = static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+        if (m_data != nullptr)
+        {
+          return;
+        }
+      }
+    }
+#else
+    int fd = ::open(fileName.c_str(), O_RDONLY);
+    struct stat info;
+    if (fd >= 0 && ::fstat(fd, &info) == 0 && S_ISREG(info.st_mode))
+    {
+      m_size = static_cast<std::size_t>(info.st_size);
+      if (m_size == 0)
+      {
+        ::close(fd);
+        return;
+      }
+      void* data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      ::close(fd);
+      if (data != MAP_FAILED)
+      {
+#ifdef MADV_SEQUENTIAL
+        ::madvise(data, m_size, MADV_SEQUENTIAL);
+#endif
+        m_data = static_cast<const char*>(data);
+        m_mapped = true;
+        return;
+      }
+    }
+    else if (fd >= 0)
+    {
+      ::close(fd);
+    }
+#endif
+    this->release();
+
+    // Fall back to reading the file into memory.
+    std::ifstream infile(fileName.c_str(), std::ios::binary);
+    if (!infile.good())
+    {
+      throw std::invalid_argument("File cannot be read.");
+    }
+    m_buffer.assign(std::istreambuf_iterator<char>(infile), std::istreambuf_iterator<char>());
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  ~MappedFile() { this->release(); }
+
+  const char* begin() const { return m_data; }
+  const char* end() const { return m_data + m_size; }
+  std::size_t size() const { return m_size; }
+
+private:
+  void release()
+  {
+#ifdef _WIN32
+    if (m_data != nullptr && m_buffer.empty())
+    {
+      UnmapViewOfFile(m_data);
+    }
+    if (m_mapping != nullptr)
+    {
+      CloseHandle(m_mapping);
+      m_mapping = nullptr;
+    }
+    if (m_file != INVALID_HANDLE_VALUE)
+    {
+      CloseHandle(m_file);
+      m_file = INVALID_HANDLE_VALUE;
+    }
+#else
+    if (m_mapped)
+    {
+      ::munmap(const_cast<char*>(m_data), m_size);
+      m_mapped = false;
+    }
+#endif
+    m_data = nullptr;
+    m_size = 0;
+  }
+
+  const char* m_data{ nullptr };
+  std::size_t m_size{ 0 };
+  std::vector<char> m_buffer;
+#ifdef _WIN32
+  HANDLE m_file{ INVALID_HANDLE_VALUE };
+  HANDLE m_mapping{ nullptr };
+#else
+  bool m_mapped{ false };
+#endif
+};
+
+bool isBlank(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r';
+}
+
+bool isDigit(char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+// Convert the field [first, last) by handing a null-terminated copy to strtod.
+double parseDoubleSlow(const char* first, const char* last)
+{
+  char buffer[128];
+  std::string overflow;
+  const char* field;
+  std::size_t length = static_cast<std::size_t>(last - first);
+  if (length < sizeof(buffer))
+  {
+    std::memcpy(buffer, first, length);
+    buffer[length] = '\0';
+    field = buffer;
+  }
+  else
+  {
+    overflow.assign(first, last);
+    field = overflow.c_str();
+  }
+  char* parsed;
+  double value = std::strtod(field, &parsed);
+  if (parsed == field)
+  {
+    throw std::invalid_argument("File contains an invalid value.");
+  }
+  return value;
+}
+
+// Parse a floating-point number from the field [first, last) without
+// allocating. Like std::stod, leading whitespace and trailing characters are
+// ignored. Values whose decimal mantissa and power of ten are both exactly
+// representable as doubles are computed directly (Clinger's fast path), which
+// yields the correctly-rounded result; all others defer to strtod.
+double parseDouble(const char* first, const char* last)
+{
+  static const double powersOfTen[] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                        1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                        1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+  constexpr std::uint64_t maxExactMantissa = std::uint64_t(1) << 53;
+
+  const char* p = first;
+  while (p < last && (*p == ' ' || *p == '\t'))
+  {
+    ++p;
+  }
+  const char* start = p;
+
+  bool negative = false;
+  if (p < last && (*p == '+' || *p == '-'))
+  {
+    negative = (*p == '-');
+    ++p;
+  }
+
+  std::uint64_t mantissa = 0;
+  int significantDigits = 0;
+  int exponent = 0;
+  bool anyDigits = false;
+  for (; p < last && isDigit(*p); ++p)
+  {
+    anyDigits = true;
+    if (mantissa != 0 || *p != '0')
+    {
+      mantissa = mantissa * 10 + static_cast<std::uint64_t>(*p - '0');
+      ++significantDigits;
+    }
+    if (significantDigits > 19)
+    {
+      return parseDoubleSlow(start, last);
+    }
+  }
+  if (p < last && *p == '.')
+  {
+    for (++p; p < last && isDigit(*p); ++p)
+    {
+      anyDigits = true;
+      if (mantissa != 0 || *p != '0')
+      {
+        mantissa = mantissa * 10 + static_cast<std::uint64_t>(*p - '0');
+        ++significantDigits;
+      }
+      --exponent;
+      if (significantDigits > 19)
+      {
+        return parseDoubleSlow(start, last);
+      }
+    }
+  }
+  if (!anyDigits)
+  {
+    // Possibly "inf" or "nan"; let strtod decide (and throw if it is neither).
+    return parseDoubleSlow(start, last);
+  }
+  if (p < last && (*p == 'e' || *p == 'E'))
+  {
+    const char* q = p + 1;
+    bool negativeExponent = false;
+    if (q < last && (*q == '+' || *q == '-'))
+    {
+      negativeExponent = (*q == '-');
+      ++q;
+    }
+    if (q < last && isDigit(*q))
+    {
+      int explicitExponent = 0;
+      for (; q < last && isDigit(*q); ++q)
+      {
+        if (explicitExponent < 100000)
+        {
+          explicitExponent = explicitExponent * 10 + (*q - '0');
+        }
+      }
+      exponent += negativeExponent ? -explicitExponent : explicitExponent;
+    }
+  }
+
+  if (mantissa == 0)
+  {
+    return negative ? -0. : 0.;
+  }
+  if (mantissa > maxExactMantissa || exponent < -22 || exponent > 22)
+  {
+    return parseDoubleSlow(start, last);
+  }
+  double value = static_cast<double>(mantissa);
+  value = exponent < 0 ? value / powersOfTen[-exponent] : value * powersOfTen[exponent];
+  return negative ? -value : value;
+}
+
+// Parse the line [first, last) (excluding its newline) into one point. Lines
+// holding only whitespace are skipped and false is returned.
+bool parseLine(const char* first, const char* last, double* coordinates, double* value)
+{
+  while (last > first && isBlank(*(last - 1)))
+  {
+    --last;
+  }
+  if (first == last)
+  {
+    return false;
+  }
+
+  // We are looking for (x, y, z, value), but we will also accept
+  // (x, y, value). So, we must have at least 3 components. Only the first
+  // four fields are ever read, so we stop looking after the fifth begins.
+  const char* fields[5];
+  std::size_t numberOfFields = 0;
+  fields[numberOfFields++] = first;
+  for (const char* p = first; p < last && numberOfFields < 5; ++p)
+  {
+    if (*p == ',')
+    {
+      fields[numberOfFields++] = p + 1;
+    }
+  }
+  if (fields[numberOfFields - 1] == last)
+  {
+    // A trailing separator does not introduce an (empty) field.
+    --numberOfFields;
+  }
+  if (numberOfFields < 3)
+  {
+    throw std::invalid_argument("File does not contain enough parameters.");
+  }
+  auto fieldEnd = [&](std::size_t i) { return i + 1 < numberOfFields ? fields[i + 1] - 1 : last; };
+
+  coordinates[0] = parseDouble(fields[0], fieldEnd(0));
+  coordinates[1] = parseDouble(fields[1], fieldEnd(1));
+  if (numberOfFields == 4)
+  {
+    coordinates[2] = parseDouble(fields[2], fieldEnd(2));
+    *value = parseDouble(fields[3], fieldEnd(3));
+  }
+  else
+  {
+    coordinates[2] = 0.;
+    *value = parseDouble(fields[2], fieldEnd(2));
+  }
+  return true;
+}
+
+// Return the position just past the first newline at or after \a position.
+const char* nextLine(const char* position, const char* end)
+{
+  const char* newline = static_cast<const char*>(
+    std::memchr(position, '\n', static_cast<std::size_t>(end - position)));
+  return newline == nullptr ? end : newline + 1;
+}
+
+// Parse every line in [begin, end) into \a coordinates and \a values, which
+// are resized to hold exactly the parsed points. The range is split into
+// newline-aligned chunks that are counted, then parsed, in parallel; each
+// chunk writes directly into its slice of the pre-sized output.
+std::size_t parseRange(
+  const char* begin,
+  const char* end,
+  std::vector<double>& coordinates,
+  std::vector<double>& values)
+{
+  std::size_t size = static_cast<std::size_t>(end - begin);
+  std::size_t numberOfWorkers = smtk::common::WorkStealingPool::instance().numberOfWorkers();
+  std::size_t chunkSize =
+    std::max(minimumChunkSize, size / (4 * std::max<std::size_t>(numberOfWorkers, 1)));
+
+  std::vector<const char*> bounds;
+  bounds.push_back(begin);
+  while (bounds.back() < end)
+  {
+    const char* position = bounds.back();
+    bool last = static_cast<std::size_t>(end - position) <= chunkSize;
+    bounds.push_back(last ? end : nextLine(position + chunkSize, end));
+  }
+  std::size_t numberOfChunks = bounds.size() - 1;
+
+  // Count the lines in each chunk and size the output accordingly.
+  std::vector<std::size_t> offsets(numberOfChunks + 1, 0);
+  smtk::common::parallelFor(
+    std::size_t(0), numberOfChunks, std::size_t(1), [&](std::size_t first, std::size_t last) {
+      for (std::size_t i = first; i < last; ++i)
+      {
+        std::size_t lines =
+          static_cast<std::size_t>(std::count(bounds[i], bounds[i + 1], '\n'));
+        if (*(bounds[i + 1] - 1) != '\n')
+        {
+          ++lines;
+        }
+        offsets[i + 1] = lines;
+      }
+    });
+  for (std::size_t i = 0; i < numberOfChunks; ++i)
+  {
+    offsets[i + 1] += offsets[i];
+  }
+  coordinates.resize(3 * offsets.back());
+  values.resize(offsets.back());
+
+  // Parse each chunk into its slot, recording how many points it produced.
+  std::vector<std::size_t> parsed(numberOfChunks, 0);
+  smtk::common::parallelFor(
+    std::size_t(0), numberOfChunks, std::size_t(1), [&](std::size_t first, std::size_t last) {
+      for (std::size_t i = first; i < last; ++i)
+      {
+        std::size_t index = offsets[i];
+        for (const char* line = bounds[i]; line < bounds[i + 1];)
+        {
+          const char* next = nextLine(line, bounds[i + 1]);
+          const char* lineEnd = (next > line && *(next - 1) == '\n') ? next - 1 : next;
+          if (parseLine(line, lineEnd, &coordinates[3 * index], &values[index]))
+          {
+            ++index;
+          }
+          line = next;
+        }
+        parsed[i] = index - offsets[i];
+      }
+    });
+
+  // Close the gaps left by skipped (blank) lines.
+  std::size_t numberOfPoints = 0;
+  for (std::size_t i = 0; i < numberOfChunks; ++i)
+  {
+    if (numberOfPoints != offsets[i])
+    {
+      std::copy_n(&values[offsets[i]], parsed[i], &values[numberOfPoints]);
+      std::copy_n(&coordinates[3 * offsets[i]], 3 * parsed[i], &coordinates[3 * numberOfPoints]);
+    }
+    numberOfPoints += parsed[i];
+  }
+  coordinates.resize(3 * numberOfPoints);
+  values.resize(numberOfPoints);
+  return numberOfPoints;
 }
+} // namespace
 
 bool PointCloudFromCSV::valid(const std::string& fileName) const
 {
@@ -56,35 +466,36 @@ smtk::mesh::PointCloud PointCloudFromCSV::operator()(const std::string& fileName
   std::vector<double> coordinates;
   std::vector<double> values;
 
-  std::ifstream infile(fileName.c_str());
-  if (!infile.good())
   {
-    throw std::invalid_argument("File cannot be read.");
+    MappedFile file(fileName);
+    parseRange(file.begin(), file.end(), coordinates, values);
   }
-  std::string line;
-  regex re(",");
-  while (std::getline(infile, line))
-  {
-    // Passing -1 as the submatch index parameter performs splitting
-    sregex_token_iterator first{ line.begin(), line.end(), re, -1 }, last;
 
-    // We are looking for (x, y, z, value), but we will also accept
-    // (x, y, value). So, we must have at least 3 components.
-    std::size_t dist = std::distance(first, last);
-    if (dist < 3)
+  return smtk::mesh::PointCloud(std::move(coordinates), std::move(values));
+}
+
+void PointCloudFromCSV::stream(
+  const std::string& fileName,
+  const BlockVisitor& visitor,
+  std::size_t blockSize)
+{
+  MappedFile file(fileName);
+  blockSize = std::max<std::size_t>(blockSize, 1);
+
+  std::vector<double> coordinates;
+  std::vector<double> values;
+  for (const char* block = file.begin(); block < file.end();)
+  {
+    const char* blockEnd = static_cast<std::size_t>(file.end() - block) <= blockSize
+      ? file.end()
+      : nextLine(block + blockSize, file.end());
+    std::size_t numberOfPoints = parseRange(block, blockEnd, coordinates, values);
+    if (numberOfPoints > 0)
     {
-      throw std::invalid_argument("File does not contain enough parameters.");
+      visitor(numberOfPoints, coordinates.data(), values.data());
     }
-
-    coordinates.push_back(std::stod(*(first++)));
-    coordinates.push_back(std::stod(*(first++)));
-    coordinates.push_back(dist == 4 ? std::stod(*(first++)) : 0.);
-    values.push_back(std::stod(*(first++)));
+    block = blockEnd;
   }
-
-  infile.close();
-
-  return smtk::mesh::PointCloud(std::move(coordinates), std::move(values));
 }
 } // namespace mesh
 } // namespace smtk
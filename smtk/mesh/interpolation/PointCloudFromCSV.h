@@ -17,6 +17,7 @@
 #include "smtk/common/Generator.h"
 #include "smtk/mesh/interpolation/PointCloud.h"
 
+#include <functional>
 #include <string>
 
 namespace smtk
@@ -26,13 +27,35 @@ namespace mesh
 
 /// A GeneratorType for creating PointClouds from CSV files. This class extends
 /// smtk::mesh::PointCloudGenerator.
+///
+/// Each line of the file holds either (x, y, z, value) or (x, y, value). The
+/// file is memory-mapped and split into newline-aligned chunks that are parsed
+/// in parallel.
 class SMTKCORE_EXPORT PointCloudFromCSV
   : public smtk::common::GeneratorType<std::string, PointCloud, PointCloudFromCSV>
 {
 public:
+  /// A functor that receives \a numberOfPoints points whose interleaved
+  /// coordinates are \a coordinates and whose values are \a values. The arrays
+  /// are only valid for the duration of the call.
+  using BlockVisitor = std::function<
+    void(std::size_t numberOfPoints, const double* coordinates, const double* values)>;
+
+  /// The default amount of file content parsed per block when streaming.
+  static constexpr std::size_t DefaultBlockSize = 1 << 26;
+
   bool valid(const std::string& file) const override;
 
   smtk::mesh::PointCloud operator()(const std::string& file) override;
+
+  /// Parse \a file in blocks of about \a blockSize bytes, passing the points
+  /// of each block to \a visitor in file order. At most one block of points is
+  /// held in memory at a time. Throws std::invalid_argument if the file cannot
+  /// be read or parsed.
+  static void stream(
+    const std::string& file,
+    const BlockVisitor& visitor,
+    std::size_t blockSize = DefaultBlockSize);
 };
 } // namespace mesh
 } // namespace smtk
@@ -25,14 +25,13 @@ namespace
 struct RadialAverageForPointCloud
 {
   RadialAverageForPointCloud(
-    smtk::mesh::ResourcePtr resource,
     const smtk::mesh::PointCloud& pointcloud,
     double radius,
     std::function<bool(double)> prefilter)
     : m_pointcloud(pointcloud)
     , m_radius(radius)
     , m_prefilter(prefilter)
-    , m_locator(resource, pointcloud.size(), pointcloud.coordinates())
+    , m_locator(pointcloud.size(), pointcloud.coordinates())
   {
   }
 
@@ -197,11 +196,19 @@ namespace mesh
 {
 
 RadialAverage::RadialAverage(
-  smtk::mesh::ResourcePtr resource,
+  smtk::mesh::ResourcePtr /*collection*/,
   const PointCloud& pointcloud,
   double radius,
   std::function<bool(double)> prefilter)
-  : m_function(RadialAverageForPointCloud(resource, pointcloud, radius, prefilter))
+  : RadialAverage(pointcloud, radius, prefilter)
+{
+}
+
+RadialAverage::RadialAverage(
+  const PointCloud& pointcloud,
+  double radius,
+  std::function<bool(double)> prefilter)
+  : m_function(RadialAverageForPointCloud(pointcloud, radius, prefilter))
 {
 }
 
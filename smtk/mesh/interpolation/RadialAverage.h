@@ -33,10 +33,18 @@ class StructuredGrid;
    average of the points in the data set within a cylinder of radius \a radius
    axis-aligned with the z axis and centered at the input point. Values from the
    input data set can be masked using the prefilter functor.
+
+   Point clouds are indexed by an in-memory point locator; their points are
+   not added to a mesh resource.
   */
 class SMTKCORE_EXPORT RadialAverage
 {
 public:
+  RadialAverage(
+    const PointCloud&,
+    double radius,
+    std::function<bool(double)> prefilter = [](double) { return true; });
+  /// The resource is no longer used; this form is kept for compatibility.
   RadialAverage(
     ResourcePtr collection,
     const PointCloud&,
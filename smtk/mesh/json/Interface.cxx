@@ -11,6 +11,7 @@
 //=============================================================================
 #include "smtk/mesh/json/Interface.h"
 
+#include "smtk/mesh/core/InMemoryPointLocatorImpl.h"
 #include "smtk/mesh/core/MeshSet.h"
 #include "smtk/mesh/core/QueryTypes.h"
 #include "smtk/mesh/core/Resource.h"
@@ -86,10 +87,12 @@ smtk::mesh::PointLocatorImplPtr Interface::pointLocator(const smtk::mesh::Handle
 }
 
 smtk::mesh::PointLocatorImplPtr Interface::pointLocator(
-  std::size_t /*numPoints*/,
-  const std::function<std::array<double, 3>(std::size_t)>& /*coordinates*/)
+  std::size_t numPoints,
+  const std::function<std::array<double, 3>(std::size_t)>& coordinates)
 {
-  return smtk::mesh::PointLocatorImplPtr();
+  // The json backend holds no coordinates of its own, so index the points in
+  // memory rather than adding them to the resource.
+  return std::make_shared<smtk::mesh::InMemoryPointLocatorImpl>(numPoints, coordinates);
 }
 
 void Interface::registerQueries(smtk::mesh::Resource&) const {}
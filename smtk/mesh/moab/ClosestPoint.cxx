@@ -11,6 +11,7 @@
 
 #include "smtk/mesh/core/CellTypes.h"
 #include "smtk/mesh/core/MeshSet.h"
+#include "smtk/mesh/core/PointSet.h"
 #include "smtk/mesh/core/Resource.h"
 
 #include "smtk/mesh/moab/HandleRangeToRange.h"
@@ -107,6 +108,18 @@ std::array<double, 3> ClosestPoint::operator()(
       returnValue[j] = coords[3 * index + j];
     }
   }
+  else if (meshset.isValid() && !meshset.points().is_empty())
+  {
+    // Otherwise, return the nearest point of the mesh.
+    const PointLocatorCache::PointsForIndex& points =
+      meshset.resource()->queries().cache<PointLocatorCache>().points(meshset);
+    double sqDistance;
+    std::size_t index = points.m_tree.closest(point, sqDistance);
+    if (index != static_cast<std::size_t>(-1))
+    {
+      returnValue = points.m_tree.point(index);
+    }
+  }
 
   return returnValue;
 }
@@ -11,12 +11,15 @@
 
 #include "smtk/mesh/core/CellTypes.h"
 #include "smtk/mesh/core/MeshSet.h"
+#include "smtk/mesh/core/PointSet.h"
 #include "smtk/mesh/core/Resource.h"
 
 #include "smtk/mesh/moab/HandleRangeToRange.h"
 #include "smtk/mesh/moab/Interface.h"
 #include "smtk/mesh/moab/PointLocatorCache.h"
 
+#include <cmath>
+
 namespace smtk
 {
 namespace mesh
@@ -92,6 +95,19 @@ std::pair<double, std::array<double, 3>> DistanceTo::operator()(
     }
     returnValue.first = sqrt(returnValue.first);
   }
+  else if (meshset.isValid() && !meshset.points().is_empty())
+  {
+    // Otherwise, measure the distance to the nearest point of the mesh.
+    const PointLocatorCache::PointsForIndex& points =
+      meshset.resource()->queries().cache<PointLocatorCache>().points(meshset);
+    double sqDistance;
+    std::size_t index = points.m_tree.closest(point, sqDistance);
+    if (index != static_cast<std::size_t>(-1))
+    {
+      returnValue.first = std::sqrt(sqDistance);
+      returnValue.second = points.m_tree.point(index);
+    }
+  }
 
   return returnValue;
 }
@@ -13,6 +13,8 @@
 #include "smtk/attribute/Attribute.h"
 #include "smtk/attribute/ComponentItem.h"
 
+#include "smtk/mesh/core/PointSet.h"
+
 namespace smtk
 {
 namespace mesh
@@ -30,9 +32,24 @@ void PointLocatorCache::synchronize(
     for (std::size_t i = 0; i < component->numberOfValues(); ++i)
     {
       m_caches.erase(component->value(i)->id());
+      m_points.erase(component->value(i)->id());
     }
   }
 }
+
+const PointLocatorCache::PointsForIndex& PointLocatorCache::points(
+  const smtk::mesh::MeshSet& meshset)
+{
+  auto search = m_points.find(meshset.id());
+  if (search == m_points.end())
+  {
+    std::vector<double> coordinates;
+    meshset.points().get(coordinates);
+    std::unique_ptr<PointsForIndex> entry(new PointsForIndex(std::move(coordinates)));
+    search = m_points.emplace(meshset.id(), std::move(entry)).first;
+  }
+  return *search->second;
+}
 } // namespace moab
 } // namespace mesh
 } // namespace smtk
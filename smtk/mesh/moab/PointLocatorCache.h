@@ -13,6 +13,9 @@
 
 #include "smtk/CoreExports.h"
 
+#include "smtk/mesh/core/KDTree.h"
+#include "smtk/mesh/core/MeshSet.h"
+
 #include "smtk/operation/queries/SynchronizedCache.h"
 
 SMTK_THIRDPARTY_PRE_INCLUDE
@@ -46,11 +49,26 @@ struct SMTKCORE_EXPORT PointLocatorCache : public smtk::operation::SynchronizedC
     ::moab::AdaptiveKDTree m_tree;
   };
 
+  // Meshsets without triangles are searched for their nearest point using an
+  // in-memory kd-tree over their points.
+  struct PointsForIndex
+  {
+    PointsForIndex(std::vector<double>&& coordinates)
+      : m_coordinates(std::move(coordinates))
+      , m_tree(m_coordinates.size() / 3, m_coordinates.data())
+    {
+    }
+
+    std::vector<double> m_coordinates;
+    smtk::mesh::KDTree m_tree;
+  };
+
   PointLocatorCache() = default;
   ~PointLocatorCache() override = default;
   PointLocatorCache(const PointLocatorCache&) = delete;
   PointLocatorCache(PointLocatorCache&& rhs) noexcept
     : m_caches(std::move(rhs.m_caches))
+    , m_points(std::move(rhs.m_points))
   {
   }
 
@@ -58,13 +76,18 @@ struct SMTKCORE_EXPORT PointLocatorCache : public smtk::operation::SynchronizedC
   PointLocatorCache& operator=(PointLocatorCache&& rhs) noexcept
   {
     m_caches = std::move(rhs.m_caches);
+    m_points = std::move(rhs.m_points);
     return *this;
   }
 
+  /// Return the (possibly cached) point index for \a meshset.
+  const PointsForIndex& points(const smtk::mesh::MeshSet& meshset);
+
   void synchronize(const smtk::operation::Operation&, const smtk::operation::Operation::Result&)
     override;
 
   std::unordered_map<smtk::common::UUID, std::unique_ptr<CacheForIndex>> m_caches;
+  std::unordered_map<smtk::common::UUID, std::unique_ptr<PointsForIndex>> m_points;
 };
 } // namespace moab
 } // namespace mesh
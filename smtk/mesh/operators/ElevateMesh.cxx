@@ -45,6 +45,7 @@
 #include <array>
 #include <cmath>
 #include <fstream>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -86,12 +87,13 @@ std::function<double(std::array<double, 3>)> radialAverageFrom(
 }
 
 template<typename InputType>
-std::function<double(std::array<double, 3>)> inverseDistanceWeightingFrom(
+std::shared_ptr<smtk::mesh::InverseDistanceWeighting> inverseDistanceWeightingFrom(
   const InputType& input,
   double power,
+  const smtk::mesh::InverseDistanceWeighting::Neighborhood& neighborhood,
   const std::function<bool(double)>& prefilter)
 {
-  std::function<double(std::array<double, 3>)> idw;
+  std::shared_ptr<smtk::mesh::InverseDistanceWeighting> idw;
   {
     // Let's start by trying to make a structured grid, since they can be a
     // subset of point clouds.
@@ -99,7 +101,8 @@ std::function<double(std::array<double, 3>)> inverseDistanceWeightingFrom(
     smtk::mesh::StructuredGrid structuredgrid = sgg(input);
     if (structuredgrid.size() > 0)
     {
-      idw = smtk::mesh::InverseDistanceWeighting(structuredgrid, power, prefilter);
+      idw = std::make_shared<smtk::mesh::InverseDistanceWeighting>(
+        structuredgrid, power, neighborhood, prefilter);
     }
   }
 
@@ -110,7 +113,8 @@ std::function<double(std::array<double, 3>)> inverseDistanceWeightingFrom(
     smtk::mesh::PointCloud pointcloud = pcg(input);
     if (pointcloud.size() > 0)
     {
-      idw = smtk::mesh::InverseDistanceWeighting(pointcloud, power, prefilter);
+      idw = std::make_shared<smtk::mesh::InverseDistanceWeighting>(
+        pointcloud, power, neighborhood, prefilter);
     }
   }
 
@@ -152,6 +156,17 @@ ElevateMesh::Result ElevateMesh::operateInternal()
   // Access the power parameter
   smtk::attribute::DoubleItem::Ptr powerItem = this->parameters()->findDouble("power");
 
+  // Access the neighborhood of source points used by inverse distance weighting
+  smtk::mesh::InverseDistanceWeighting::Neighborhood neighborhood;
+  {
+    smtk::attribute::IntItem::Ptr neighborsItem =
+      this->parameters()->findInt("number of neighbors");
+    if (neighborsItem && neighborsItem->value() > 0)
+    {
+      neighborhood.numberOfNeighbors = static_cast<std::size_t>(neighborsItem->value());
+    }
+  }
+
   // Construct a prefilter for the input data
   std::function<bool(double)> prefilter = [](double /*unused*/) { return true; };
   {
@@ -211,8 +226,12 @@ ElevateMesh::Result ElevateMesh::operateInternal()
     else if (interpolationSchemeItem->value() == "inverse distance weighting")
     {
       // Compute the inverse distance weighting function
-      interpolation = inverseDistanceWeightingFrom<smtk::model::AuxiliaryGeometry>(
-        auxGeo, powerItem->value(), prefilter);
+      auto idw = inverseDistanceWeightingFrom<smtk::model::AuxiliaryGeometry>(
+        auxGeo, powerItem->value(), neighborhood, prefilter);
+      if (idw)
+      {
+        interpolation = *idw;
+      }
     }
 
     if (!interpolation)
@@ -235,8 +254,12 @@ ElevateMesh::Result ElevateMesh::operateInternal()
     else if (interpolationSchemeItem->value() == "inverse distance weighting")
     {
       // Compute the inverse distance weighting function
-      interpolation =
-        inverseDistanceWeightingFrom<std::string>(fileName, powerItem->value(), prefilter);
+      auto idw = inverseDistanceWeightingFrom<std::string>(
+        fileName, powerItem->value(), neighborhood, prefilter);
+      if (idw)
+      {
+        interpolation = *idw;
+      }
     }
 
     if (!interpolation)
@@ -277,7 +300,8 @@ ElevateMesh::Result ElevateMesh::operateInternal()
     else if (interpolationSchemeItem->value() == "inverse distance weighting")
     {
       // Compute the inverse distance weighting function
-      interpolation = smtk::mesh::InverseDistanceWeighting(pointcloud, powerItem->value());
+      interpolation =
+        smtk::mesh::InverseDistanceWeighting(pointcloud, powerItem->value(), neighborhood);
     }
 
     if (!interpolation)
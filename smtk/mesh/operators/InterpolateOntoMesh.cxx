@@ -19,6 +19,8 @@
 #include "smtk/attribute/StringItem.h"
 #include "smtk/attribute/VoidItem.h"
 
+#include "smtk/common/WorkStealingPool.h"
+
 #include "smtk/mesh/InterpolateOntoMesh_xml.h"
 #include "smtk/mesh/core/CellField.h"
 #include "smtk/mesh/core/Component.h"
@@ -28,6 +30,7 @@
 
 #include "smtk/mesh/interpolation/InverseDistanceWeighting.h"
 #include "smtk/mesh/interpolation/PointCloud.h"
+#include "smtk/mesh/interpolation/PointCloudFromCSV.h"
 #include "smtk/mesh/interpolation/PointCloudGenerator.h"
 #include "smtk/mesh/interpolation/RadialAverage.h"
 #include "smtk/mesh/interpolation/StructuredGrid.h"
@@ -43,7 +46,10 @@
 
 #include <array>
 #include <cmath>
+#include <exception>
 #include <fstream>
+#include <limits>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -92,12 +98,13 @@ std::function<double(std::array<double, 3>)> radialAverageFrom(
 }
 
 template<typename InputType>
-std::function<double(std::array<double, 3>)> inverseDistanceWeightingFrom(
+std::shared_ptr<smtk::mesh::InverseDistanceWeighting> inverseDistanceWeightingFrom(
   const InputType& input,
   double power,
+  const smtk::mesh::InverseDistanceWeighting::Neighborhood& neighborhood,
   const std::function<bool(double)>& prefilter)
 {
-  std::function<double(std::array<double, 3>)> idw;
+  std::shared_ptr<smtk::mesh::InverseDistanceWeighting> idw;
   {
     // Let's start by trying to make a structured grid, since they can be a
     // subset of point clouds.
@@ -105,7 +112,8 @@ std::function<double(std::array<double, 3>)> inverseDistanceWeightingFrom(
     smtk::mesh::StructuredGrid structuredgrid = sgg(input);
     if (structuredgrid.size() > 0)
     {
-      idw = smtk::mesh::InverseDistanceWeighting(structuredgrid, power, prefilter);
+      idw = std::make_shared<smtk::mesh::InverseDistanceWeighting>(
+        structuredgrid, power, neighborhood, prefilter);
     }
   }
 
@@ -116,12 +124,87 @@ std::function<double(std::array<double, 3>)> inverseDistanceWeightingFrom(
     smtk::mesh::PointCloud pointcloud = pcg(input);
     if (pointcloud.size() > 0)
     {
-      idw = smtk::mesh::InverseDistanceWeighting(pointcloud, power, prefilter);
+      idw = std::make_shared<smtk::mesh::InverseDistanceWeighting>(
+        pointcloud, power, neighborhood, prefilter);
     }
   }
 
   return idw;
 }
+
+// Inverse distance weighting over every source point of a CSV file. Rather
+// than loading the file, its points are streamed in blocks and each block's
+// contribution is accumulated into every target point, so memory use is
+// bounded by the block size regardless of the size of the file.
+std::function<void(std::size_t, const double*, double*)> streamingInverseDistanceWeighting(
+  const std::string& fileName,
+  double power,
+  const std::function<bool(double)>& prefilter)
+{
+  return [=](std::size_t n, const double* xyz, double* values) {
+    const double epsilon = 1.e-10;
+    std::vector<double> num(n, 0.);
+    std::vector<double> denom(n, 0.);
+    std::vector<char> exact(n, 0);
+    std::vector<double> sourceCoordinates;
+    std::vector<double> sourceValues;
+
+    smtk::mesh::PointCloudFromCSV::stream(
+      fileName, [&](std::size_t nSources, const double* coordinates, const double* data) {
+        sourceCoordinates.clear();
+        sourceValues.clear();
+        for (std::size_t j = 0; j < nSources; ++j)
+        {
+          if (prefilter(data[j]))
+          {
+            sourceCoordinates.insert(
+              sourceCoordinates.end(), coordinates + 3 * j, coordinates + 3 * j + 3);
+            sourceValues.push_back(data[j]);
+          }
+        }
+        if (sourceValues.empty())
+        {
+          return;
+        }
+
+        smtk::common::parallelFor(
+          std::size_t(0), n, std::size_t(64), [&](std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i)
+            {
+              if (exact[i])
+              {
+                continue;
+              }
+              for (std::size_t j = 0; j < sourceValues.size(); ++j)
+              {
+                double dx = xyz[3 * i] - sourceCoordinates[3 * j];
+                double dy = xyz[3 * i + 1] - sourceCoordinates[3 * j + 1];
+                double dz = xyz[3 * i + 2] - sourceCoordinates[3 * j + 2];
+                double d = std::sqrt(dx * dx + dy * dy + dz * dz);
+                // If d is zero, then use the value associated with the source point.
+                if (d < epsilon)
+                {
+                  values[i] = sourceValues[j];
+                  exact[i] = 1;
+                  break;
+                }
+                double w = std::pow(d, -1. * power);
+                num[i] += w * sourceValues[j];
+                denom[i] += w;
+              }
+            }
+          });
+      });
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      if (!exact[i])
+      {
+        values[i] = denom[i] > 0. ? num[i] / denom[i] : std::numeric_limits<double>::quiet_NaN();
+      }
+    }
+  };
+}
 } // namespace
 
 namespace smtk
@@ -158,6 +241,17 @@ InterpolateOntoMesh::Result InterpolateOntoMesh::operateInternal()
   // Access the power parameter
   smtk::attribute::DoubleItem::Ptr powerItem = this->parameters()->findDouble("power");
 
+  // Access the neighborhood of source points used by inverse distance weighting
+  smtk::mesh::InverseDistanceWeighting::Neighborhood neighborhood;
+  {
+    smtk::attribute::IntItem::Ptr neighborsItem =
+      this->parameters()->findInt("number of neighbors");
+    if (neighborsItem && neighborsItem->value() > 0)
+    {
+      neighborhood.numberOfNeighbors = static_cast<std::size_t>(neighborsItem->value());
+    }
+  }
+
   // Access the data set name
   smtk::attribute::StringItem::Ptr nameItem = this->parameters()->findString("dsname");
 
@@ -206,6 +300,12 @@ InterpolateOntoMesh::Result InterpolateOntoMesh::operateInternal()
   // when projected onto the x-y plane, are within a radius of the input
   std::function<double(std::array<double, 3>)> interpolation;
 
+  // Inverse distance weighting can also evaluate many points in parallel.
+  std::shared_ptr<smtk::mesh::InverseDistanceWeighting> idw;
+
+  // Inverse distance weighting that streams its source points from a file.
+  std::function<void(std::size_t, const double*, double*)> streamingIdw;
+
   if (inputDataItem->value() == "auxiliary geometry")
   {
     // Access the external data to use in determining value values
@@ -223,8 +323,12 @@ InterpolateOntoMesh::Result InterpolateOntoMesh::operateInternal()
     else if (interpolationSchemeItem->value() == "inverse distance weighting")
     {
       // Compute the inverse distance weighting function
-      interpolation = inverseDistanceWeightingFrom<smtk::model::AuxiliaryGeometry>(
-        auxGeo, powerItem->value(), prefilter);
+      idw = inverseDistanceWeightingFrom<smtk::model::AuxiliaryGeometry>(
+        auxGeo, powerItem->value(), neighborhood, prefilter);
+      if (idw)
+      {
+        interpolation = *idw;
+      }
     }
 
     if (!interpolation)
@@ -246,12 +350,27 @@ InterpolateOntoMesh::Result InterpolateOntoMesh::operateInternal()
     }
     else if (interpolationSchemeItem->value() == "inverse distance weighting")
     {
-      // Compute the inverse distance weighting function
-      interpolation =
-        inverseDistanceWeightingFrom<std::string>(fileName, powerItem->value(), prefilter);
+      smtk::attribute::VoidItem::Ptr streamItem = this->parameters()->findVoid("stream input");
+      if (
+        streamItem && streamItem->isEnabled() && neighborhood.numberOfNeighbors == 0 &&
+        smtk::mesh::PointCloudFromCSV().valid(fileName))
+      {
+        // Stream the file's points through the interpolator instead of loading them
+        streamingIdw = streamingInverseDistanceWeighting(fileName, powerItem->value(), prefilter);
+      }
+      else
+      {
+        // Compute the inverse distance weighting function
+        idw = inverseDistanceWeightingFrom<std::string>(
+          fileName, powerItem->value(), neighborhood, prefilter);
+        if (idw)
+        {
+          interpolation = *idw;
+        }
+      }
     }
 
-    if (!interpolation)
+    if (!interpolation && !streamingIdw)
     {
       smtkErrorMacro(this->log(), "Could not read file.");
       return this->createResult(smtk::operation::Operation::Outcome::FAILED);
@@ -289,7 +408,9 @@ InterpolateOntoMesh::Result InterpolateOntoMesh::operateInternal()
     else if (interpolationSchemeItem->value() == "inverse distance weighting")
     {
       // Compute the inverse distance weighting function
-      interpolation = smtk::mesh::InverseDistanceWeighting(pointcloud, powerItem->value());
+      idw = std::make_shared<smtk::mesh::InverseDistanceWeighting>(
+        pointcloud, powerItem->value(), neighborhood);
+      interpolation = *idw;
     }
 
     if (!interpolation)
@@ -380,19 +501,65 @@ InterpolateOntoMesh::Result InterpolateOntoMesh::operateInternal()
     return f_x;
   };
 
+  std::function<void(std::size_t, const double*, double*)> evaluate = streamingIdw;
+  if (!evaluate && idw)
+  {
+    evaluate = [&](std::size_t n, const double* xyz, double* values) { (*idw)(n, xyz, values); };
+  }
+
+  std::function<void(std::size_t, const double*, double*)> batchFn;
+  if (evaluate)
+  {
+    batchFn = [&](std::size_t n, const double* xyz, double* values) {
+      evaluate(n, xyz, values);
+      for (std::size_t j = 0; j < n; ++j)
+      {
+        values[j] = postProcess(values[j]);
+        if (std::isnan(values[j]))
+        {
+          values[j] = externalDataPoint(
+            std::array<double, 3>{ { xyz[3 * j], xyz[3 * j + 1], xyz[3 * j + 2] } });
+        }
+      }
+    };
+  }
+
   // apply the interpolator to the meshes and populate the result attributes
   for (std::size_t i = 0; i < meshItem->numberOfValues(); i++)
   {
     smtk::mesh::Component::Ptr meshComponent = meshItem->valueAs<smtk::mesh::Component>(i);
     smtk::mesh::MeshSet mesh = meshComponent->mesh();
 
-    if (modeItem->value(0) == CELL_FIELD)
+    try
     {
-      smtk::mesh::utility::applyScalarCellField(fn, nameItem->value(), mesh);
+      if (modeItem->value(0) == CELL_FIELD)
+      {
+        if (batchFn)
+        {
+          smtk::mesh::utility::applyBatchedScalarCellField(batchFn, nameItem->value(), mesh);
+        }
+        else
+        {
+          smtk::mesh::utility::applyScalarCellField(fn, nameItem->value(), mesh);
+        }
+      }
+      else
+      {
+        if (batchFn)
+        {
+          smtk::mesh::utility::applyBatchedScalarPointField(batchFn, nameItem->value(), mesh);
+        }
+        else
+        {
+          smtk::mesh::utility::applyScalarPointField(fn, nameItem->value(), mesh);
+        }
+      }
     }
-    else
+    catch (const std::exception& e)
     {
-      smtk::mesh::utility::applyScalarPointField(fn, nameItem->value(), mesh);
+      // Streamed input is only read (and therefore validated) here.
+      smtkErrorMacro(this->log(), "Could not interpolate onto mesh: " << e.what());
+      return this->createResult(smtk::operation::Operation::Outcome::FAILED);
     }
 
     modified->appendValue(meshComponent);
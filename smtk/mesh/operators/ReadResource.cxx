@@ -47,20 +47,22 @@ ReadResource::Result ReadResource::operateInternal()
   std::string filename = this->parameters()->findFile("filename")->value();
 
   std::ifstream file;
+  std::string index;
 
   smtk::common::Archive archive(filename);
-  if (!archive.contents().empty())
+  const bool archived = !archive.contents().empty();
+  if (archived)
   {
     std::string smtkFilename = "index.json";
 
-    archive.get(smtkFilename, file);
+    archive.read(smtkFilename, index);
   }
   else
   {
     file.open(filename);
   }
 
-  if (!file.good())
+  if (archived ? index.empty() : !file.good())
   {
     smtkErrorMacro(log(), "Cannot read file \"" << filename << "\".");
     file.close();
@@ -70,7 +72,7 @@ ReadResource::Result ReadResource::operateInternal()
   nlohmann::json j;
   try
   {
-    j = nlohmann::json::parse(file);
+    j = archived ? nlohmann::json::parse(index) : nlohmann::json::parse(file);
   }
   catch (...)
   {
@@ -83,7 +85,7 @@ ReadResource::Result ReadResource::operateInternal()
   std::string meshFilename = j.at("Mesh URL");
 
   smtk::common::FileLocation meshFileLocation;
-  if (!archive.contents().empty())
+  if (archived)
   {
     meshFileLocation = archive.location(meshFilename);
   }
@@ -0,0 +1,99 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/core/IndexedHandleRange.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <random>
+
+namespace
+{
+using namespace smtk::mesh;
+
+HandleRange randomRange(std::mt19937& generator, std::size_t numberOfIntervals)
+{
+  std::uniform_int_distribution<Handle> start(1, 2000);
+  std::uniform_int_distribution<Handle> length(0, 20);
+  HandleRange range;
+  for (std::size_t i = 0; i < numberOfIntervals; ++i)
+  {
+    Handle lower = start(generator);
+    range.insert(HandleInterval(lower, lower + length(generator)));
+  }
+  return range;
+}
+
+void testLookup(const HandleRange& range)
+{
+  IndexedHandleRange index(range);
+  smtkTest(index.size() == range.size(), "Index has the wrong size.");
+  smtkTest(
+    index.numberOfIntervals() == rangeIntervalCount(range), "Index has the wrong interval count.");
+  smtkTest(rangesEqual(index.range(), range), "Index does not convert back to its range.");
+
+  std::size_t i = 0;
+  for (auto it = rangeElementsBegin(range); it != rangeElementsEnd(range); ++it, ++i)
+  {
+    smtkTest(index.element(i) == *it, "Element " << i << " is wrong.");
+    smtkTest(rangeElement(range, i) == *it, "rangeElement(" << i << ") is wrong.");
+    smtkTest(index.index(*it) == i, "Index of " << *it << " is wrong.");
+    smtkTest(index.contains(*it), "Index should contain " << *it << ".");
+  }
+
+  // Handles outside of the range report size() as their index.
+  for (Handle h = 0; h < 2100; ++h)
+  {
+    if (!rangeContains(range, h))
+    {
+      smtkTest(!index.contains(h), "Index should not contain " << h << ".");
+      smtkTest(index.index(h) == index.size(), "Missing handle " << h << " has an index.");
+    }
+  }
+}
+
+void testSetAlgebra(const HandleRange& a, const HandleRange& b)
+{
+  IndexedHandleRange ia(a);
+  IndexedHandleRange ib(b);
+
+  smtkTest(rangesEqual(rangeUnion(ia, ib).range(), a | b), "Union is wrong.");
+  smtkTest(rangesEqual(rangeIntersect(ia, ib).range(), a & b), "Intersection is wrong.");
+  smtkTest(rangesEqual(rangeSubtract(ia, ib).range(), a - b), "Difference is wrong.");
+  smtkTest(rangesEqual(rangeSubtract(ib, ia).range(), b - a), "Difference is wrong.");
+  smtkTest(rangeUnion(ia, ib).size() == (a | b).size(), "Union has the wrong size.");
+  smtkTest(rangeSubtract(ia, ia).empty(), "Difference with self should be empty.");
+  smtkTest(rangeIntersect(ia, ia) == ia, "Intersection with self should be unchanged.");
+}
+} // namespace
+
+int UnitTestIndexedHandleRange(int /*unused*/, char** const /*unused*/)
+{
+  // Adjacent intervals are coalesced just as they are in a HandleRange.
+  IndexedHandleRange adjacent({ 1, 4, 10 }, { 3, 6, 12 });
+  smtkTest(adjacent.numberOfIntervals() == 2, "Adjacent intervals should be merged.");
+  smtkTest(adjacent.size() == 9, "Merged range has the wrong size.");
+  smtkTest(adjacent.element(5) == 6, "Merged range has the wrong element.");
+
+  IndexedHandleRange empty;
+  smtkTest(empty.empty() && empty.size() == 0, "Default range should be empty.");
+  smtkTest(!empty.contains(0), "Empty range should not contain anything.");
+
+  std::mt19937 generator(7);
+  testLookup(HandleRange());
+  for (std::size_t n : { 1, 5, 50, 200 })
+  {
+    testLookup(randomRange(generator, n));
+    testSetAlgebra(randomRange(generator, n), randomRange(generator, n));
+    testSetAlgebra(randomRange(generator, n), HandleRange());
+  }
+
+  return 0;
+}
@@ -0,0 +1,233 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/core/KDTree.h"
+#include "smtk/mesh/interpolation/InverseDistanceWeighting.h"
+#include "smtk/mesh/interpolation/PointCloud.h"
+#include "smtk/mesh/interpolation/StructuredGrid.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+std::vector<double> randomPoints(std::size_t nPoints, std::mt19937& generator)
+{
+  std::uniform_real_distribution<double> distribution(-1., 1.);
+  std::vector<double> xyz(3 * nPoints);
+  for (auto& x : xyz)
+  {
+    x = distribution(generator);
+  }
+  return xyz;
+}
+
+// Return (squared distance, index) pairs for every point, nearest first.
+std::vector<std::pair<double, std::size_t>> sortedByDistance(
+  const std::vector<double>& xyz,
+  const std::array<double, 3>& p,
+  int dimension)
+{
+  std::vector<std::pair<double, std::size_t>> result;
+  for (std::size_t i = 0; i < xyz.size() / 3; ++i)
+  {
+    double dx = xyz[3 * i] - p[0];
+    double dy = xyz[3 * i + 1] - p[1];
+    double dz = dimension == 3 ? xyz[3 * i + 2] - p[2] : 0.;
+    result.emplace_back(dx * dx + dy * dy + dz * dz, i);
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+void testQueries(int dimension)
+{
+  std::mt19937 generator(dimension);
+  const std::size_t nPoints = 2000;
+  std::vector<double> xyz = randomPoints(nPoints, generator);
+  std::vector<double> queries = randomPoints(100, generator);
+
+  smtk::mesh::KDTree tree(nPoints, xyz.data(), dimension);
+  smtkTest(tree.size() == nPoints, "Tree should hold every point.");
+
+  std::vector<std::size_t> ids;
+  std::vector<double> sqDistances;
+  for (std::size_t q = 0; q < queries.size() / 3; ++q)
+  {
+    std::array<double, 3> p = { { queries[3 * q], queries[3 * q + 1], queries[3 * q + 2] } };
+    auto expected = sortedByDistance(xyz, p, dimension);
+
+    tree.nearest(p, 10, ids, sqDistances);
+    smtkTest(ids.size() == 10, "Nearest query should return k points.");
+    for (std::size_t i = 0; i < ids.size(); ++i)
+    {
+      smtkTest(ids[i] == expected[i].second, "Nearest query returned the wrong point.");
+      smtkTest(sqDistances[i] == expected[i].first, "Nearest query returned the wrong distance.");
+    }
+
+    const double radius = 0.25;
+    tree.withinRadius(p, radius, ids, sqDistances);
+    std::size_t count = 0;
+    while (count < expected.size() && expected[count].first <= radius * radius)
+    {
+      ++count;
+    }
+    smtkTest(ids.size() == count, "Radius query returned the wrong number of points.");
+    std::sort(ids.begin(), ids.end());
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      smtkTest(
+        std::binary_search(ids.begin(), ids.end(), expected[i].second),
+        "Radius query missed a point.");
+    }
+
+    tree.nearest(p, 10, ids, sqDistances, radius);
+    smtkTest(ids.size() == std::min<std::size_t>(10, count), "Bounded nearest query failed.");
+
+    double sqDistance;
+    smtkTest(tree.closest(p, sqDistance) == expected[0].second, "Closest query failed.");
+  }
+}
+
+void testEmptyAndFiltered()
+{
+  smtk::mesh::KDTree empty;
+  double sqDistance;
+  smtkTest(empty.empty(), "Default tree should be empty.");
+  smtkTest(
+    empty.closest({ { 0., 0., 0. } }, sqDistance) == static_cast<std::size_t>(-1),
+    "Empty tree should not find a closest point.");
+
+  std::mt19937 generator(7);
+  std::vector<double> xyz = randomPoints(100, generator);
+  smtk::mesh::KDTree evens(
+    100,
+    [&xyz](std::size_t i) {
+      return std::array<double, 3>{ { xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2] } };
+    },
+    [](std::size_t i) { return i % 2 == 0; });
+  smtkTest(evens.size() == 50, "Filtered tree should hold half of the points.");
+  std::vector<std::size_t> ids;
+  std::vector<double> sqDistances;
+  evens.withinRadius({ { 0., 0., 0. } }, 10., ids, sqDistances);
+  smtkTest(ids.size() == 50, "Filtered tree should return all of its points.");
+  for (std::size_t id : ids)
+  {
+    smtkTest(id % 2 == 0, "Filtered tree should only return included points.");
+  }
+}
+
+void testInverseDistanceWeighting()
+{
+  std::mt19937 generator(11);
+  const std::size_t nPoints = 500;
+  std::vector<double> xyz = randomPoints(nPoints, generator);
+  std::vector<double> values(nPoints);
+  for (std::size_t i = 0; i < nPoints; ++i)
+  {
+    values[i] = xyz[3 * i] + 2. * xyz[3 * i + 1];
+  }
+  std::vector<double> targets = randomPoints(200, generator);
+  const std::size_t nTargets = targets.size() / 3;
+
+  smtk::mesh::PointCloud pointcloud(nPoints, xyz.data(), values.data());
+  smtk::mesh::InverseDistanceWeighting bruteForce(pointcloud, 2.);
+
+  // A neighborhood holding every point reproduces the brute-force result.
+  smtk::mesh::InverseDistanceWeighting::Neighborhood everything;
+  everything.numberOfNeighbors = nPoints;
+  smtk::mesh::InverseDistanceWeighting indexed(pointcloud, 2., everything);
+
+  smtk::mesh::InverseDistanceWeighting::Neighborhood nearby;
+  nearby.numberOfNeighbors = 8;
+  smtk::mesh::InverseDistanceWeighting knn(pointcloud, 2., nearby);
+
+  std::vector<double> batch(nTargets);
+  knn(nTargets, targets.data(), batch.data());
+
+  for (std::size_t i = 0; i < nTargets; ++i)
+  {
+    std::array<double, 3> p = { { targets[3 * i], targets[3 * i + 1], targets[3 * i + 2] } };
+    smtkTest(std::abs(bruteForce(p) - indexed(p)) < 1.e-10, "Indexed IDW should be exact.");
+    smtkTest(batch[i] == knn(p), "Batched IDW should match pointwise IDW.");
+  }
+
+  // Query points that coincide with a source point return its value.
+  std::array<double, 3> p0 = { { xyz[0], xyz[1], xyz[2] } };
+  smtkTest(knn(p0) == values[0], "IDW at a source point should return its value.");
+
+  // An empty radius neighborhood yields NaN.
+  smtk::mesh::InverseDistanceWeighting::Neighborhood tiny;
+  tiny.radius = 1.e-6;
+  smtk::mesh::InverseDistanceWeighting radial(pointcloud, 2., tiny);
+  smtkTest(std::isnan(radial({ { 5., 5., 5. } })), "Empty neighborhoods should yield NaN.");
+}
+
+void testWindowedStructuredGrid()
+{
+  const int extent[4] = { 0, 40, 0, 30 };
+  const double origin[2] = { -1., -2. };
+  const double spacing[2] = { 0.1, 0.2 };
+  smtk::mesh::StructuredGrid grid(extent, origin, spacing, [](int i, int j) {
+    return std::sin(0.3 * i) + std::cos(0.2 * j);
+  });
+
+  smtk::mesh::InverseDistanceWeighting bruteForce(grid, 2.);
+  smtk::mesh::InverseDistanceWeighting::Neighborhood everything;
+  everything.numberOfNeighbors = grid.size();
+  smtk::mesh::InverseDistanceWeighting windowed(grid, 2., everything);
+
+  smtk::mesh::InverseDistanceWeighting::Neighborhood nearby;
+  nearby.numberOfNeighbors = 4;
+  smtk::mesh::InverseDistanceWeighting knn(grid, 2., nearby);
+
+  // The same grid as a point cloud, searched with a kd-tree.
+  std::vector<double> coordinates;
+  std::vector<double> values;
+  for (int i = extent[0]; i < extent[1]; ++i)
+  {
+    for (int j = extent[2]; j < extent[3]; ++j)
+    {
+      coordinates.push_back(origin[0] + i * spacing[0]);
+      coordinates.push_back(origin[1] + j * spacing[1]);
+      coordinates.push_back(0.);
+      values.push_back(grid.data()(i, j));
+    }
+  }
+  smtk::mesh::PointCloud pointcloud(std::move(coordinates), std::move(values));
+  smtk::mesh::InverseDistanceWeighting indexed(pointcloud, 2., nearby);
+
+  std::mt19937 generator(13);
+  std::uniform_real_distribution<double> distribution(-3., 7.);
+  for (int i = 0; i < 100; ++i)
+  {
+    std::array<double, 3> p = { { distribution(generator), distribution(generator), 0. } };
+    smtkTest(std::abs(bruteForce(p) - windowed(p)) < 1.e-10, "Windowed IDW should be exact.");
+    smtkTest(
+      std::abs(indexed(p) - knn(p)) < 1.e-10, "Windowed IDW should find the nearest neighbors.");
+  }
+}
+} // namespace
+
+int UnitTestKDTree(int /*unused*/, char** const /*unused*/)
+{
+  testQueries(2);
+  testQueries(3);
+  testEmptyAndFiltered();
+  testInverseDistanceWeighting();
+  testWindowedStructuredGrid();
+  return 0;
+}
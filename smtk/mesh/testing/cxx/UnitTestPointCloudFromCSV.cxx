@@ -0,0 +1,180 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/interpolation/PointCloudFromCSV.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+std::string write_root = SMTK_SCRATCH_DIR;
+
+std::string writeFile(const std::string& name, const std::string& contents)
+{
+  std::string fileName = write_root + "/" + name;
+  std::ofstream file(fileName.c_str(), std::ios::binary);
+  file << contents;
+  return fileName;
+}
+
+bool near(double a, double b)
+{
+  return std::abs(a - b) <= 1.e-14 * std::max(1., std::abs(b));
+}
+
+void testFormats()
+{
+  // Four- and three-field lines, CRLF line endings, padding, exponents, blank
+  // lines and a missing final newline.
+  std::string fileName = writeFile(
+    "UnitTestPointCloudFromCSV-formats.csv",
+    "1,2,3,4\n"
+    " -1.5 , 2.25e1 ,\t3E-2, +.5\r\n"
+    "\n"
+    "5,6,7\r\n"
+    "   \n"
+    "1e300,-0,0.1,123456789012345678901234\n"
+    "0.000001,1,2,3");
+
+  smtk::mesh::PointCloudFromCSV reader;
+  smtkTest(reader.valid(fileName), "Reader should accept .csv files.");
+  smtk::mesh::PointCloud pointcloud = reader(fileName);
+  smtkTest(pointcloud.size() == 5, "Expected 5 points, got " << pointcloud.size() << ".");
+
+  const double expected[5][4] = { { 1., 2., 3., 4. },
+                                  { -1.5, 22.5, 0.03, 0.5 },
+                                  { 5., 6., 0., 7. },
+                                  { 1.e300, 0., 0.1, 123456789012345678901234. },
+                                  { 0.000001, 1., 2., 3. } };
+  for (std::size_t i = 0; i < 5; ++i)
+  {
+    std::array<double, 3> x = pointcloud.coordinates()(i);
+    for (std::size_t j = 0; j < 3; ++j)
+    {
+      smtkTest(
+        near(x[j], expected[i][j]),
+        "Point " << i << " coordinate " << j << " is " << x[j] << ", expected " << expected[i][j]);
+    }
+    smtkTest(near(pointcloud.data()(i), expected[i][3]), "Point " << i << " has the wrong value.");
+  }
+
+  // Copies of the point cloud share its data.
+  smtk::mesh::PointCloud copy = pointcloud;
+  smtkTest(copy.size() == 5 && copy.data()(2) == 7., "Copied point cloud has the wrong data.");
+
+  std::remove(fileName.c_str());
+}
+
+void testErrors()
+{
+  smtk::mesh::PointCloudFromCSV reader;
+
+  std::string fileName = writeFile("UnitTestPointCloudFromCSV-short.csv", "1,2,3,4\n1,2\n");
+  bool threw = false;
+  try
+  {
+    reader(fileName);
+  }
+  catch (const std::invalid_argument&)
+  {
+    threw = true;
+  }
+  smtkTest(threw, "Lines with fewer than 3 fields should be rejected.");
+  std::remove(fileName.c_str());
+
+  fileName = writeFile("UnitTestPointCloudFromCSV-invalid.csv", "1,2,3,4\n1,x,3,4\n");
+  threw = false;
+  try
+  {
+    reader(fileName);
+  }
+  catch (const std::invalid_argument&)
+  {
+    threw = true;
+  }
+  smtkTest(threw, "Non-numeric fields should be rejected.");
+  std::remove(fileName.c_str());
+
+  threw = false;
+  try
+  {
+    reader(write_root + "/UnitTestPointCloudFromCSV-missing.csv");
+  }
+  catch (const std::invalid_argument&)
+  {
+    threw = true;
+  }
+  smtkTest(threw, "Missing files should be rejected.");
+}
+
+void testStream()
+{
+  // Write enough points to span several parsing chunks and streaming blocks.
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<double> distribution(-1.e3, 1.e3);
+  std::ostringstream contents;
+  contents.precision(17);
+  const std::size_t nPoints = 200000;
+  for (std::size_t i = 0; i < nPoints; ++i)
+  {
+    contents << distribution(generator) << "," << distribution(generator) << ",";
+    if (i % 3 == 0)
+    {
+      contents << distribution(generator) << ",";
+    }
+    contents << static_cast<double>(i) << "\n";
+  }
+  std::string fileName = writeFile("UnitTestPointCloudFromCSV-stream.csv", contents.str());
+
+  smtk::mesh::PointCloud pointcloud = smtk::mesh::PointCloudFromCSV()(fileName);
+  smtkTest(pointcloud.size() == nPoints, "Expected " << nPoints << " points.");
+
+  std::size_t count = 0;
+  std::size_t blocks = 0;
+  bool matches = true;
+  smtk::mesh::PointCloudFromCSV::stream(
+    fileName,
+    [&](std::size_t n, const double* coordinates, const double* values) {
+      ++blocks;
+      for (std::size_t i = 0; i < n; ++i, ++count)
+      {
+        std::array<double, 3> x = pointcloud.coordinates()(count);
+        matches &= (x[0] == coordinates[3 * i] && x[1] == coordinates[3 * i + 1] &&
+                    x[2] == coordinates[3 * i + 2] && values[i] == pointcloud.data()(count) &&
+                    values[i] == static_cast<double>(count));
+      }
+    },
+    1 << 20);
+  smtkTest(count == nPoints, "Streamed " << count << " points, expected " << nPoints << ".");
+  smtkTest(blocks > 1, "Expected the file to be streamed in several blocks.");
+  smtkTest(matches, "Streamed points do not match loaded points.");
+
+  std::remove(fileName.c_str());
+}
+} // namespace
+
+int UnitTestPointCloudFromCSV(int /*unused*/, char** const /*unused*/)
+{
+  testFormats();
+  testErrors();
+  testStream();
+  return 0;
+}
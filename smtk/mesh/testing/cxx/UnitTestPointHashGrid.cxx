@@ -0,0 +1,157 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/core/KDTree.h"
+#include "smtk/mesh/core/PointHashGrid.h"
+#include "smtk/mesh/core/PointLocator.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+std::vector<double> randomPoints(std::size_t nPoints, std::mt19937& generator, bool planar)
+{
+  std::uniform_real_distribution<double> distribution(-1., 1.);
+  std::vector<double> xyz(3 * nPoints);
+  for (std::size_t i = 0; i < nPoints; ++i)
+  {
+    xyz[3 * i] = distribution(generator);
+    xyz[3 * i + 1] = distribution(generator);
+    xyz[3 * i + 2] = planar ? 0. : distribution(generator);
+  }
+  return xyz;
+}
+
+// Compare a hash grid's results against those of a kd-tree over the same points.
+void testAgainstKDTree(bool planar, double cellSize)
+{
+  std::mt19937 generator(planar ? 1 : 2);
+  const std::size_t nPoints = 5000;
+  std::vector<double> xyz = randomPoints(nPoints, generator, planar);
+  std::vector<double> queries = randomPoints(200, generator, false);
+  // Include some queries far outside of the points' bounds.
+  queries.push_back(50.);
+  queries.push_back(-30.);
+  queries.push_back(10.);
+  const std::size_t nQueries = queries.size() / 3;
+
+  smtk::mesh::KDTree tree(nPoints, xyz.data());
+  smtk::mesh::PointHashGrid grid(nPoints, xyz.data(), cellSize);
+  smtkTest(grid.size() == nPoints, "Grid should hold every point.");
+  smtkTest(cellSize <= 0. || grid.cellSize() == cellSize, "Grid should use the given cell size.");
+
+  std::vector<std::size_t> treeIds, gridIds;
+  std::vector<double> treeSqDistances, gridSqDistances;
+  for (std::size_t q = 0; q < nQueries; ++q)
+  {
+    std::array<double, 3> p = { { queries[3 * q], queries[3 * q + 1], queries[3 * q + 2] } };
+
+    tree.nearest(p, 5, treeIds, treeSqDistances);
+    grid.nearest(p, 5, gridIds, gridSqDistances);
+    smtkTest(gridIds == treeIds, "Nearest query disagrees with kd-tree.");
+
+    tree.withinRadius(p, 0.2, treeIds, treeSqDistances);
+    grid.withinRadius(p, 0.2, gridIds, gridSqDistances);
+    std::sort(treeIds.begin(), treeIds.end());
+    std::sort(gridIds.begin(), gridIds.end());
+    smtkTest(gridIds == treeIds, "Radius query disagrees with kd-tree.");
+
+    double treeSqDistance, gridSqDistance;
+    smtkTest(
+      grid.closest(p, gridSqDistance) == tree.closest(p, treeSqDistance),
+      "Closest query disagrees with kd-tree.");
+  }
+
+  // Batch queries match individual ones.
+  std::vector<std::size_t> offsets, ids;
+  std::vector<double> sqDistances;
+  grid.nearest(nQueries, queries.data(), 3, offsets, ids, sqDistances);
+  smtkTest(offsets.size() == nQueries + 1, "Batch query should return one range per query.");
+  for (std::size_t q = 0; q < nQueries; ++q)
+  {
+    std::array<double, 3> p = { { queries[3 * q], queries[3 * q + 1], queries[3 * q + 2] } };
+    grid.nearest(p, 3, gridIds, gridSqDistances);
+    smtkTest(
+      std::equal(gridIds.begin(), gridIds.end(), ids.begin() + offsets[q]) &&
+        offsets[q + 1] - offsets[q] == gridIds.size(),
+      "Batch nearest query disagrees with single query.");
+  }
+  grid.withinRadius(nQueries, queries.data(), 0.3, offsets, ids, sqDistances);
+  tree.withinRadius(nQueries, queries.data(), 0.3, offsets, treeIds, treeSqDistances);
+  smtkTest(ids.size() == treeIds.size(), "Batch radius query disagrees with kd-tree.");
+}
+
+void testPointLocator(smtk::mesh::PointLocator::Structure structure)
+{
+  std::mt19937 generator(3);
+  const std::size_t nPoints = 1000;
+  std::vector<double> xyz = randomPoints(nPoints, generator, false);
+
+  smtk::mesh::PointLocator locator(nPoints, xyz.data(), structure);
+  smtkTest(locator.range().size() == nPoints, "Locator should report every point.");
+
+  // Each point finds itself.
+  smtk::mesh::PointLocator::LocatorResults results;
+  results.want_Coordinates = true;
+  for (std::size_t i = 0; i < nPoints; ++i)
+  {
+    locator.find(xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2], 0.0, results);
+    smtkTest(results.pointIds.size() == 1, "Point should find only itself.");
+    smtkTest(results.pointIds[0] == i, "Point should find itself.");
+    smtkTest(results.x_s[0] == xyz[3 * i], "Located point has the wrong coordinates.");
+    smtkTest(results.sqDistances.empty(), "Distances were not requested.");
+  }
+
+  results.want_sqDistances = true;
+  smtkTest(locator.nearest(0., 0., 0., 4, results), "In-memory locators find nearest points.");
+  smtkTest(results.pointIds.size() == 4, "Nearest query should return k points.");
+  smtkTest(
+    std::is_sorted(results.sqDistances.begin(), results.sqDistances.end()),
+    "Nearest points should be ordered by distance.");
+
+  smtk::mesh::PointLocator::BatchLocatorResults batch;
+  batch.want_sqDistances = true;
+  locator.find(nPoints, xyz.data(), 0.0, batch);
+  smtkTest(batch.offsets.size() == nPoints + 1, "Batch query should return one range per query.");
+  smtkTest(batch.pointIds.size() == nPoints, "Each point should find only itself.");
+  smtkTest(batch.sqDistances.size() == nPoints, "Batch query should return distances.");
+  for (std::size_t i = 0; i < nPoints; ++i)
+  {
+    smtkTest(batch.pointIds[batch.offsets[i]] == i, "Batch query should find each point.");
+  }
+
+  smtkTest(locator.nearest(nPoints, xyz.data(), 2, batch), "Batch nearest query failed.");
+  smtkTest(batch.pointIds.size() == 2 * nPoints, "Batch nearest query returned too few points.");
+}
+} // namespace
+
+int UnitTestPointHashGrid(int /*unused*/, char** const /*unused*/)
+{
+  testAgainstKDTree(false, 0.);
+  testAgainstKDTree(true, 0.);
+  testAgainstKDTree(false, 0.01);
+  testAgainstKDTree(false, 10.);
+
+  smtk::mesh::PointHashGrid empty(0, nullptr);
+  double sqDistance;
+  smtkTest(
+    empty.closest({ { 0., 0., 0. } }, sqDistance) == static_cast<std::size_t>(-1),
+    "Empty grid should not find a closest point.");
+
+  testPointLocator(smtk::mesh::PointLocator::Structure::KDTree);
+  testPointLocator(smtk::mesh::PointLocator::Structure::HashGrid);
+
+  return 0;
+}
@@ -0,0 +1,134 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/mesh/interpolation/InverseDistanceWeighting.h"
+#include "smtk/mesh/interpolation/PointCloud.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Compare the speed and accuracy of inverse distance weighting over all
+// source points (the brute-force default) against neighborhoods found with a
+// spatial index, evaluated both point-by-point and in parallel batches.
+//
+// Usage: benchmarkInverseDistanceWeighting [number of sources] [number of targets]
+
+namespace
+{
+double seconds(
+  const std::chrono::steady_clock::time_point& start,
+  const std::chrono::steady_clock::time_point& end)
+{
+  return std::chrono::duration<double>(end - start).count();
+}
+
+std::vector<double> evaluate(
+  const smtk::mesh::InverseDistanceWeighting& idw,
+  const std::vector<double>& targets,
+  bool batched,
+  double& elapsed)
+{
+  std::size_t nTargets = targets.size() / 3;
+  std::vector<double> values(nTargets);
+  auto start = std::chrono::steady_clock::now();
+  if (batched)
+  {
+    idw(nTargets, targets.data(), values.data());
+  }
+  else
+  {
+    for (std::size_t i = 0; i < nTargets; ++i)
+    {
+      values[i] = idw({ { targets[3 * i], targets[3 * i + 1], targets[3 * i + 2] } });
+    }
+  }
+  elapsed = seconds(start, std::chrono::steady_clock::now());
+  return values;
+}
+
+double maxError(const std::vector<double>& a, const std::vector<double>& b)
+{
+  double error = 0.;
+  for (std::size_t i = 0; i < a.size(); ++i)
+  {
+    error = std::max(error, std::abs(a[i] - b[i]));
+  }
+  return error;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  std::size_t nSources = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+  std::size_t nTargets = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10000;
+
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> distribution(0., 100.);
+  std::vector<double> sources(3 * nSources);
+  std::vector<double> values(nSources);
+  for (std::size_t i = 0; i < nSources; ++i)
+  {
+    sources[3 * i] = distribution(generator);
+    sources[3 * i + 1] = distribution(generator);
+    sources[3 * i + 2] = 0.;
+    values[i] = std::sin(0.1 * sources[3 * i]) * std::cos(0.1 * sources[3 * i + 1]);
+  }
+  std::vector<double> targets(3 * nTargets);
+  for (std::size_t i = 0; i < nTargets; ++i)
+  {
+    targets[3 * i] = distribution(generator);
+    targets[3 * i + 1] = distribution(generator);
+    targets[3 * i + 2] = 0.;
+  }
+
+  smtk::mesh::PointCloud pointcloud(nSources, sources.data(), values.data());
+  const double power = 2.;
+
+  std::cout << nSources << " sources, " << nTargets << " targets\n";
+
+  double elapsed;
+  smtk::mesh::InverseDistanceWeighting bruteForce(pointcloud, power);
+  std::vector<double> exact = evaluate(bruteForce, targets, false, elapsed);
+  std::cout << "  brute force:        " << elapsed << " s\n";
+
+  for (std::size_t k : { 8, 32, 128 })
+  {
+    smtk::mesh::InverseDistanceWeighting::Neighborhood neighborhood;
+    neighborhood.numberOfNeighbors = k;
+    auto start = std::chrono::steady_clock::now();
+    smtk::mesh::InverseDistanceWeighting knn(pointcloud, power, neighborhood);
+    double build = seconds(start, std::chrono::steady_clock::now());
+    std::vector<double> serial = evaluate(knn, targets, false, elapsed);
+    std::cout << "  k = " << k << " (build " << build << " s)\n";
+    std::cout << "    serial:           " << elapsed << " s, max error " << maxError(exact, serial)
+              << "\n";
+    std::vector<double> batched = evaluate(knn, targets, true, elapsed);
+    std::cout << "    batched:          " << elapsed << " s, max error "
+              << maxError(exact, batched) << "\n";
+  }
+
+  for (double radius : { 2., 5. })
+  {
+    smtk::mesh::InverseDistanceWeighting::Neighborhood neighborhood;
+    neighborhood.radius = radius;
+    smtk::mesh::InverseDistanceWeighting withinRadius(pointcloud, power, neighborhood);
+    std::vector<double> batched = evaluate(withinRadius, targets, true, elapsed);
+    std::cout << "  radius = " << radius << "\n";
+    std::cout << "    batched:          " << elapsed << " s, max error "
+              << maxError(exact, batched) << "\n";
+  }
+
+  return 0;
+}
@@ -254,6 +254,93 @@ bool applyScalarCellField(
     .isValid();
 }
 
+namespace
+{
+class GatherPoints : public smtk::mesh::PointForEach
+{
+private:
+  std::vector<double> m_data;
+  std::size_t m_counter;
+
+public:
+  GatherPoints(std::size_t nPoints)
+    : m_data(3 * nPoints)
+    , m_counter(0)
+  {
+  }
+
+  void forPoints(
+    const smtk::mesh::HandleRange& /*pointIds*/,
+    std::vector<double>& xyz,
+    bool& /*coordinatesModified*/) override
+  {
+    std::copy(xyz.begin(), xyz.end(), &m_data[m_counter]);
+    m_counter += xyz.size();
+  }
+
+  const std::vector<double>& data() const { return m_data; }
+};
+
+class GatherCentroids : public smtk::mesh::CellForEach
+{
+private:
+  std::vector<double> m_data;
+  std::size_t m_counter;
+
+public:
+  GatherCentroids(std::size_t nCells)
+    : smtk::mesh::CellForEach(true)
+    , m_data(3 * nCells)
+    , m_counter(0)
+  {
+  }
+
+  void forCell(const smtk::mesh::Handle& /*cellId*/, smtk::mesh::CellType /*cellType*/, int nPts)
+    override
+  {
+    double xyz[3] = { 0., 0., 0. };
+    for (int i = 0; i < 3 * nPts; i += 3)
+    {
+      xyz[0] += this->coordinates()[i];
+      xyz[1] += this->coordinates()[i + 1];
+      xyz[2] += this->coordinates()[i + 2];
+    }
+    for (int i = 0; i < 3; i++)
+    {
+      m_data[m_counter++] = xyz[i] / nPts;
+    }
+  }
+
+  const std::vector<double>& data() const { return m_data; }
+};
+} // namespace
+
+bool applyBatchedScalarPointField(
+  const std::function<void(std::size_t, const double*, double*)>& f,
+  const std::string& name,
+  smtk::mesh::MeshSet& ms)
+{
+  std::size_t nPoints = ms.points().size();
+  GatherPoints gatherPoints(nPoints);
+  smtk::mesh::for_each(ms.points(), gatherPoints);
+  std::vector<double> data(nPoints);
+  f(nPoints, gatherPoints.data().data(), data.data());
+  return ms.createPointField(name, 1, smtk::mesh::FieldType::Double, data.data()).isValid();
+}
+
+bool applyBatchedScalarCellField(
+  const std::function<void(std::size_t, const double*, double*)>& f,
+  const std::string& name,
+  smtk::mesh::MeshSet& ms)
+{
+  std::size_t nCells = ms.cells().size();
+  GatherCentroids gatherCentroids(nCells);
+  smtk::mesh::for_each(ms.cells(), gatherCentroids);
+  std::vector<double> data(nCells);
+  f(nCells, gatherCentroids.data().data(), data.data());
+  return ms.createCellField(name, 1, smtk::mesh::FieldType::Double, data.data()).isValid();
+}
+
 namespace
 {
 class VectorPointField : public smtk::mesh::PointForEach
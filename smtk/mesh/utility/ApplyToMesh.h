@@ -16,6 +16,7 @@
 
 #include "smtk/mesh/core/MeshSet.h"
 
+#include <cstddef>
 #include <string>
 
 namespace smtk
@@ -53,6 +54,24 @@ bool applyScalarCellField(
   const std::string& name,
   smtk::mesh::MeshSet& ms);
 
+// construct a named scalar field defined at each point in a meshset according
+// to a batched R^3->R mapping. The mapping is called once with the number of
+// points, their interleaved coordinates and an array to fill with values, so
+// it may evaluate the points in parallel.
+SMTKCORE_EXPORT
+bool applyBatchedScalarPointField(
+  const std::function<void(std::size_t, const double*, double*)>&,
+  const std::string& name,
+  smtk::mesh::MeshSet& ms);
+
+// construct a named scalar field defined at each cell centroid in a meshset
+// according to a batched R^3->R mapping (see applyBatchedScalarPointField).
+SMTKCORE_EXPORT
+bool applyBatchedScalarCellField(
+  const std::function<void(std::size_t, const double*, double*)>&,
+  const std::string& name,
+  smtk::mesh::MeshSet& ms);
+
 // construct a named vector field defined at each point in a meshset according
 // to an R^3->R^3 mapping.
 SMTKCORE_EXPORT
@@ -230,6 +230,10 @@ void extractMeshConstants(
   smtk::mesh::CellSet remainingCells = cells;
   smtk::mesh::PointSet remainingPoints = points;
 
+  // Positions within <cells> and <points> are looked up once per interval.
+  const smtk::mesh::IndexedHandleRange& cellIndex = cells.indexedRange();
+  const smtk::mesh::IndexedHandleRange& pointIndex = points.indexedRange();
+
   cellRanges.reserve(meshes.size());
   pointRanges.reserve(meshes.size());
   for (auto&& subset : meshes)
@@ -240,16 +244,14 @@ void extractMeshConstants(
     {
       cellRanges.push_back(TaggedRange(
         subset.first,
-        std::make_pair(
-          rangeIndex(cells.range(), range->lower()), rangeIndex(cells.range(), range->upper()))));
+        std::make_pair(cellIndex.index(range->lower()), cellIndex.index(range->upper()))));
     }
 
     for (auto range = subpoints.range().begin(); range != subpoints.range().end(); ++range)
     {
       pointRanges.push_back(TaggedRange(
         subset.first,
-        std::make_pair(
-          rangeIndex(points.range(), range->lower()), rangeIndex(points.range(), range->upper()))));
+        std::make_pair(pointIndex.index(range->lower()), pointIndex.index(range->upper()))));
     }
 
     remainingCells = set_difference(remainingCells, subcells);
@@ -124,6 +124,7 @@ EntityPtr Entity::create(BitFlags entityFlags, int dimension, ResourcePtr resour
   */
 EntityPtr Entity::setup(BitFlags entFlags, int dim, Resource::Ptr resource, bool resetRelations)
 {
+  BitFlags previous = m_entityFlags;
   m_entityFlags = entFlags;
   m_resource = resource;
   // Override the dimension bits if the dimension is specified
@@ -139,6 +140,10 @@ EntityPtr Entity::setup(BitFlags entFlags, int dim, Resource::Ptr resource, bool
     m_firstInvalid = -1;
     m_relations.clear();
   }
+  if (resource && previous != m_entityFlags)
+  {
+    resource->entityFlagsChanged(*this, previous);
+  }
   return shared_from_this();
 }
 
@@ -174,6 +179,7 @@ BitFlags Entity::entityFlags() const
 
 bool Entity::setEntityFlags(BitFlags flags)
 {
+  BitFlags previous = m_entityFlags;
   bool allowed = false;
   if (m_entityFlags == INVALID)
   {
@@ -191,6 +197,13 @@ bool Entity::setEntityFlags(BitFlags flags)
       allowed = true;
     }
   }
+  if (allowed && previous != m_entityFlags)
+  {
+    if (auto* resource = this->rawModelResource())
+    {
+      resource->entityFlagsChanged(*this, previous);
+    }
+  }
   return allowed;
 }
 
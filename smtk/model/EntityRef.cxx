@@ -71,6 +71,7 @@ bool EntityRef::setResource(ResourcePtr rsrc)
     return false;
   }
   m_resource = rsrc;
+  m_record = nullptr;
   return true;
 }
 
@@ -93,6 +94,7 @@ bool EntityRef::setEntity(const smtk::common::UUID& inEntity)
     return false;
 
   m_entity = inEntity;
+  m_record = nullptr;
   return true;
 }
 
@@ -102,6 +104,34 @@ const smtk::common::UUID& EntityRef::entity() const
   return m_entity;
 }
 
+/**\brief Return the record for m_entity held by \a rsrc (or nullptr).
+  *
+  * Navigating a model asks the same entity for its record many times.
+  * The record found is remembered along with the resource's
+  * structureGeneration(), so later calls avoid the lookup until records
+  * are erased or replaced.
+  */
+Entity* EntityRef::findRecord(const ResourcePtr& rsrc, bool trySessions) const
+{
+  if (!rsrc || m_entity.isNull())
+  {
+    return nullptr;
+  }
+  if (m_record && m_recordGeneration == rsrc->structureGeneration())
+  {
+    return m_record;
+  }
+  Entity* record = rsrc->findEntityRecord(m_entity);
+  if (!record && trySessions)
+  {
+    record = rsrc->findEntity(m_entity, true).get();
+  }
+  // Sessions may have modified the resource, so fetch the generation afterward.
+  m_record = record;
+  m_recordGeneration = rsrc->structureGeneration();
+  return record;
+}
+
 /// Return the smtk::model::Entity record for this model entity.
 smtk::model::EntityPtr EntityRef::entityRecord() const
 {
@@ -135,7 +165,7 @@ int EntityRef::dimension() const
   ResourcePtr rsrc = m_resource.lock();
   if (rsrc && !m_entity.isNull())
   {
-    EntityPtr entRec = rsrc->findEntity(m_entity);
+    Entity* entRec = this->findRecord(rsrc);
     if (entRec)
     {
       return entRec->dimension();
@@ -155,7 +185,7 @@ int EntityRef::dimensionBits() const
   ResourcePtr rsrc = m_resource.lock();
   if (rsrc && !m_entity.isNull())
   {
-    EntityPtr entRec = rsrc->findEntity(m_entity);
+    Entity* entRec = this->findRecord(rsrc);
     if (entRec)
     {
       return entRec->dimensionBits();
@@ -174,7 +204,7 @@ void EntityRef::setDimensionBits(BitFlags dimBits)
   ResourcePtr rsrc = m_resource.lock();
   if (rsrc && !m_entity.isNull())
   {
-    EntityPtr entRec = rsrc->findEntity(m_entity);
+    Entity* entRec = this->findRecord(rsrc);
     if (entRec)
     {
       BitFlags old = entRec->entityFlags() & ~ANY_DIMENSION;
@@ -236,7 +266,7 @@ BitFlags EntityRef::entityFlags() const
   ResourcePtr rsrc = m_resource.lock();
   if (rsrc && !m_entity.isNull())
   {
-    EntityPtr entRec = rsrc->findEntity(m_entity);
+    Entity* entRec = this->findRecord(rsrc);
     if (entRec)
     {
       return entRec->entityFlags();
@@ -254,7 +284,7 @@ std::string EntityRef::flagSummary(int form) const
   ResourcePtr rsrc = m_resource.lock();
   if (rsrc)
   {
-    EntityPtr ent = rsrc->findEntity(m_entity);
+    Entity* ent = this->findRecord(rsrc);
     if (ent)
     {
       std::ostringstream summary;
@@ -475,11 +505,15 @@ bool EntityRef::isValid(EntityPtr* entityRecord) const
 {
   ResourcePtr rsrc = m_resource.lock();
   bool status = rsrc && !m_entity.isNull();
-  if (status)
+  if (status && !entityRecord)
+  {
+    status = this->findRecord(rsrc, false) != nullptr;
+  }
+  else if (status)
   {
     EntityPtr rec = rsrc->findEntity(m_entity, false);
     status = static_cast<bool>(rec);
-    if (status && entityRecord)
+    if (status)
     {
       *entityRecord = rec;
     }
@@ -740,7 +774,7 @@ EntityRef& EntityRef::addRawRelation(const EntityRef& ent)
     rsrc && !m_entity.isNull() && rsrc == ent.resource() && !ent.entity().isNull() &&
     ent.entity() != m_entity)
   {
-    EntityPtr entRec = rsrc->findEntity(m_entity);
+    Entity* entRec = this->findRecord(rsrc);
     if (entRec)
       entRec->appendRelation(ent.entity());
   }
@@ -761,7 +795,7 @@ EntityRef& EntityRef::findOrAddRawRelation(const EntityRef& ent)
     rsrc && !m_entity.isNull() && rsrc == ent.resource() && !ent.entity().isNull() &&
     ent.entity() != m_entity)
   {
-    EntityPtr entRec = rsrc->findEntity(m_entity);
+    Entity* entRec = this->findRecord(rsrc);
     if (
       entRec &&
       std::find(entRec->relations().begin(), entRec->relations().end(), ent.entity()) ==
@@ -791,10 +825,10 @@ EntityRef& EntityRef::elideRawRelation(const EntityRef& ent)
     rsrc && !m_entity.isNull() && rsrc == ent.resource() && !ent.entity().isNull() &&
     ent.entity() != m_entity)
   {
-    UUIDWithEntityPtr entRec = rsrc->topology().find(m_entity);
-    if (entRec != rsrc->topology().end())
+    // Avoid the non-const topology(), which invalidates the entity indices.
+    if (Entity* entRec = this->findRecord(rsrc, false))
     {
-      rsrc->elideOneEntityReference(entRec, ent.entity());
+      entRec->invalidateRelation(ent.entity());
     }
   }
   return *this;
@@ -1501,23 +1535,23 @@ std::set<std::string> EntityRef::integerPropertyNames() const
 /// Return the number of arrangements of the given kind \a k.
 int EntityRef::numberOfArrangementsOfKind(ArrangementKind k) const
 {
-  ResourcePtr rsrc = m_resource.lock();
-  const Arrangements* arr = rsrc->hasArrangementsOfKindForEntity(m_entity, k);
+  const Entity* record = this->findRecord(m_resource.lock(), false);
+  const Arrangements* arr = record ? record->hasArrangementsOfKind(k) : nullptr;
   return arr ? static_cast<int>(arr->size()) : 0;
 }
 
 /// Return the \a i-th arrangement of kind \a k (or nullptr).
 Arrangement* EntityRef::findArrangement(ArrangementKind k, int i)
 {
-  ResourcePtr rsrc = m_resource.lock();
-  return rsrc->findArrangement(m_entity, k, i);
+  Entity* record = this->findRecord(m_resource.lock(), false);
+  return record ? record->findArrangement(k, i) : nullptr;
 }
 
 /// Return the \a i-th arrangement of kind \a k (or nullptr).
 const Arrangement* EntityRef::findArrangement(ArrangementKind k, int i) const
 {
-  ResourcePtr rsrc = m_resource.lock();
-  return rsrc->findArrangement(m_entity, k, i);
+  const Entity* record = this->findRecord(m_resource.lock(), false);
+  return record ? record->findArrangement(k, i) : nullptr;
 }
 
 /// Delete all arrangements of this entity with prejudice.
@@ -1534,10 +1568,10 @@ EntityRef EntityRef::relationFromArrangement(ArrangementKind k, int arrangementI
   const
 {
   ResourcePtr rsrc = m_resource.lock();
-  EntityPtr ent = rsrc->findEntity(m_entity);
+  const Entity* ent = this->findRecord(rsrc);
   if (ent)
   {
-    const Arrangement* arr = this->findArrangement(k, arrangementIndex);
+    const Arrangement* arr = ent->findArrangement(k, arrangementIndex);
     if (arr && static_cast<int>(arr->details().size()) > offset)
     {
       int idx = arr->details()[offset];
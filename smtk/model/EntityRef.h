@@ -358,6 +358,12 @@ protected:
 
   smtk::model::WeakResourcePtr m_resource;
   smtk::common::UUID m_entity;
+  // The record of m_entity last found in m_resource and the resource's
+  // structureGeneration() at the time; see findRecord().
+  mutable smtk::model::Entity* m_record{ nullptr };
+  mutable std::size_t m_recordGeneration{ 0 };
+
+  smtk::model::Entity* findRecord(const ResourcePtr& rsrc, bool trySessions = true) const;
 
   // Manage subset_of/superset_of relationships
   EntityRef& addMemberEntity(const EntityRef& memberToAdd);
@@ -381,8 +387,8 @@ T EntityRef::relationsAs() const
 {
   T result;
   ResourcePtr mgr = m_resource.lock();
-  smtk::model::EntityPtr entRec;
-  if (!this->isValid(&entRec))
+  const smtk::model::Entity* entRec = this->findRecord(mgr, false);
+  if (!entRec)
     return result;
 
   smtk::common::UUIDArray::const_iterator it;
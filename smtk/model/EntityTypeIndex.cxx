@@ -0,0 +1,96 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/model/EntityTypeIndex.h"
+
+#include "smtk/model/Entity.h"
+
+namespace smtk
+{
+namespace model
+{
+
+void EntityTypeIndex::insert(const smtk::common::UUID& uid, BitFlags flags)
+{
+  if (m_entities[flags].insert(uid).second)
+  {
+    ++m_size;
+  }
+}
+
+bool EntityTypeIndex::erase(const smtk::common::UUID& uid, BitFlags flags)
+{
+  auto it = m_entities.find(flags);
+  if (it == m_entities.end() || !it->second.erase(uid))
+  {
+    return false;
+  }
+  if (it->second.empty())
+  {
+    m_entities.erase(it);
+  }
+  --m_size;
+  return true;
+}
+
+bool EntityTypeIndex::update(const smtk::common::UUID& uid, BitFlags previous, BitFlags current)
+{
+  if (previous == current || !this->erase(uid, previous))
+  {
+    return false;
+  }
+  this->insert(uid, current);
+  return true;
+}
+
+void EntityTypeIndex::clear()
+{
+  m_entities.clear();
+  m_size = 0;
+}
+
+bool EntityTypeIndex::matches(BitFlags flags, BitFlags mask, bool exactMatch)
+{
+  BitFlags masked = flags & mask;
+  // NB: exactMatch still allows some mismatches; specifically, we want to
+  //     disregard dimension bits set on models and groups when asking for
+  //     exact matches for MODEL_ENTITY and GROUP_ENTITY. Hence the final
+  //     condition that (flags & ENTITY_MASK) == (mask & ENTITY_MASK)
+  //     rather than just flags == mask.
+  return (masked && (mask == ANY_ENTITY)) || (!exactMatch && masked) ||
+    (exactMatch && masked == mask && ((flags & ENTITY_MASK) == (mask & ENTITY_MASK)));
+}
+
+void EntityTypeIndex::entitiesMatchingFlags(
+  BitFlags mask,
+  bool exactMatch,
+  smtk::common::UUIDs& result) const
+{
+  for (const auto& entry : m_entities)
+  {
+    if (EntityTypeIndex::matches(entry.first, mask, exactMatch))
+    {
+      result.insert(entry.second.begin(), entry.second.end());
+    }
+  }
+}
+
+void EntityTypeIndex::entitiesOfDimension(int dim, smtk::common::UUIDs& result) const
+{
+  for (const auto& entry : m_entities)
+  {
+    if (Entity::dimensionBitsToDimension(entry.first & ANY_DIMENSION) == dim)
+    {
+      result.insert(entry.second.begin(), entry.second.end());
+    }
+  }
+}
+
+} // namespace model
+} // namespace smtk
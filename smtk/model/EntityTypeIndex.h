@@ -0,0 +1,80 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_model_EntityTypeIndex_h
+#define smtk_model_EntityTypeIndex_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/SystemConfig.h" // quiet dll-interface warnings on windows
+
+#include "smtk/common/UUID.h"
+#include "smtk/model/EntityTypeBits.h"
+
+#include <map>
+
+namespace smtk
+{
+namespace model
+{
+
+/**\brief Entity IDs grouped by their entity-type bit flags.
+  *
+  * A model resource may hold a great many entities but only a handful of
+  * distinct combinations of entity-type bits (dimension, kind, and so on).
+  * Grouping IDs by their flags lets queries such as
+  * Resource::entitiesMatchingFlags() test each combination once and then
+  * copy the IDs that match, rather than test every entity.
+  *
+  * The model resource updates its index as entity records are inserted,
+  * replaced, or erased and as entities change their flags.
+  */
+class SMTKCORE_EXPORT EntityTypeIndex
+{
+public:
+  /// Add \a uid to the entities with the given \a flags.
+  void insert(const smtk::common::UUID& uid, BitFlags flags);
+  /// Remove \a uid from the entities with the given \a flags; returns true if it was present.
+  bool erase(const smtk::common::UUID& uid, BitFlags flags);
+  /// Move \a uid from \a previous to \a current flags if it is present under \a previous.
+  bool update(const smtk::common::UUID& uid, BitFlags previous, BitFlags current);
+  /// Remove all entries.
+  void clear();
+
+  /// Return the number of indexed entities.
+  std::size_t size() const { return m_size; }
+
+  /// Return true if an entity with the given \a flags satisfies \a mask.
+  ///
+  /// This is the test used by Resource::entitiesMatchingFlags().
+  static bool matches(BitFlags flags, BitFlags mask, bool exactMatch);
+
+  /// Insert the IDs of entities whose flags satisfy \a mask into \a result.
+  void entitiesMatchingFlags(BitFlags mask, bool exactMatch, smtk::common::UUIDs& result) const;
+  /// Insert the IDs of entities of the given dimension into \a result.
+  void entitiesOfDimension(int dim, smtk::common::UUIDs& result) const;
+
+  /// Invoke \a visitor with each distinct combination of flags and the IDs that have it.
+  template<typename Visitor>
+  void visit(Visitor visitor) const
+  {
+    for (const auto& entry : m_entities)
+    {
+      visitor(entry.first, entry.second);
+    }
+  }
+
+private:
+  std::map<BitFlags, smtk::common::UUIDs> m_entities;
+  std::size_t m_size{ 0 };
+};
+
+} // namespace model
+} // namespace smtk
+
+#endif // smtk_model_EntityTypeIndex_h
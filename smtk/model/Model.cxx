@@ -185,16 +185,17 @@ Model& Model::removeCell(const CellEntity& c)
     std::cout << "Unable to remove cell " << c.name() << " from model\n";
     }
     */
-  UUIDWithEntityPtr ent;
-  ent = resource->topology().find(m_entity);
-  if (ent != resource->topology().end())
+  // Look the records up without the non-const topology(), which would
+  // invalidate the resource's entity indices.
+  EntityPtr ent = resource->findEntity(m_entity, false);
+  if (ent)
   {
-    resource->elideOneEntityReference(ent, c.entity());
+    ent->invalidateRelation(c.entity());
   }
-  ent = resource->topology().find(c.entity());
-  if (ent != resource->topology().end())
+  ent = resource->findEntity(c.entity(), false);
+  if (ent)
   {
-    resource->elideOneEntityReference(ent, m_entity);
+    ent->invalidateRelation(m_entity);
   }
   return *this;
 }
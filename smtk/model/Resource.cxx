@@ -126,6 +126,7 @@ Resource::Resource(
 {
   this->queries().registerQueries<QueryList>();
   this->properties().insertPropertyType<smtk::common::UUID>();
+  this->rebuildEntityIndices();
 }
 
 /// Destroying a model resource requires us to release the default attribute resource..
@@ -150,6 +151,9 @@ Resource::~Resource()
 //@{
 UUIDsToEntities& Resource::topology()
 {
+  // Records may be inserted, erased or replaced through the reference.
+  m_entityIndicesValid = false;
+  ++m_structureGeneration;
   return *m_topology;
 }
 
@@ -210,6 +214,9 @@ smtk::mesh::ResourcePtr Resource::meshTessellations() const
 void Resource::clear()
 {
   m_topology->clear();
+  m_entityTypeIndex.clear();
+  m_entityLookup.clear();
+  ++m_structureGeneration;
   m_tessellations->clear();
   m_analysisMesh->clear();
   {
@@ -353,7 +360,7 @@ SessionInfoBits Resource::erase(const UUID& uid, SessionInfoBits flags)
     //       of entities in the class destructor prevent us
     //       from obtaining a shared pointer to the resource
     //       to pass to any observers...
-    m_topology->erase(uid);
+    this->eraseEntityRecord(uid);
   }
 
   return actual;
@@ -398,7 +405,7 @@ SessionInfoBits Resource::hardErase(const EntityRef& eref, SessionInfoBits flags
   UUIDWithEntityPtr ent;
   if (actual & (SESSION_ENTITY_TYPE | SESSION_ENTITY_RELATIONS | SESSION_ARRANGEMENTS))
   {
-    if (!m_topology->erase(uid))
+    if (!this->eraseEntityRecord(uid))
     { // without an Entity record, we cannot erase these things:
       actual &= ~(SESSION_ENTITY_TYPE | SESSION_ENTITY_RELATIONS | SESSION_ARRANGEMENTS);
     }
@@ -582,6 +589,7 @@ Resource::setEntityOfTypeAndDimension(const UUID& uid, BitFlags entityFlags, int
 
   if (result.second)
   {
+    this->indexEntityRecord(result.first);
     this->trigger(
       std::make_pair(ADD_EVENT, ENTITY_ENTRY), EntityRef(this->shared_from_this(), uid));
   }
@@ -614,13 +622,18 @@ Resource::iter_type Resource::setEntity(EntityPtr c)
       throw msg.str();
     }
     this->removeEntityReferences(it);
+    m_entityTypeIndex.erase(it->first, it->second->entityFlags());
     it->second = c;
+    m_entityTypeIndex.insert(it->first, c->entityFlags());
+    // EntityRef instances may hold the replaced record.
+    ++m_structureGeneration;
     this->insertEntityReferences(it);
     return it;
   }
   std::pair<UUID, EntityPtr> entry(c->id(), c);
   this->prepareForEntity(entry);
   it = m_topology->insert(entry).first;
+  this->indexEntityRecord(it);
   this->insertEntityReferences(it);
   return it;
 }
@@ -679,15 +692,15 @@ UUID Resource::addCellOfDimensionWithUUID(const UUID& uid, int dim)
 /// Return the type of entity that the link represents.
 BitFlags Resource::type(const UUID& ofEntity) const
 {
-  UUIDWithEntityPtr it = m_topology->find(ofEntity);
-  return (it == m_topology->end() ? INVALID : it->second->entityFlags());
+  const Entity* entity = this->findEntityRecord(ofEntity);
+  return (entity ? entity->entityFlags() : INVALID);
 }
 
 /// Return the dimension of the manifold that the passed entity represents.
 int Resource::dimension(const UUID& ofEntity) const
 {
-  UUIDWithEntityPtr it = m_topology->find(ofEntity);
-  return (it == m_topology->end() ? -1 : it->second->dimension());
+  const Entity* entity = this->findEntityRecord(ofEntity);
+  return (entity ? entity->dimension() : -1);
 }
 
 /**\brief Return a name for the given entity ID.
@@ -706,12 +719,12 @@ std::string Resource::name(const UUID& ofEntity) const
       return nprop[0];
     }
   }
-  UUIDWithEntityPtr it = m_topology->find(ofEntity);
-  if (it == m_topology->end())
+  const Entity* entity = this->findEntityRecord(ofEntity);
+  if (!entity)
   {
     return "invalid id " + ofEntity.toString();
   }
-  return Resource::shortUUIDName(it->first, it->second->entityFlags());
+  return Resource::shortUUIDName(ofEntity, entity->entityFlags());
 }
 
 /**\brief Return the (Dimension+1 or higher)-entities that are the immediate bordants of the passed entity.
@@ -721,34 +734,31 @@ std::string Resource::name(const UUID& ofEntity) const
 UUIDs Resource::bordantEntities(const UUID& ofEntity, int ofDimension) const
 {
   UUIDs result;
-  UUIDWithConstEntityPtr it = m_topology->find(ofEntity);
-  if (it == m_topology->end())
+  const Entity* entity = this->findEntityRecord(ofEntity);
+  if (!entity)
   {
     return result;
   }
-  if (ofDimension >= 0 && it->second->dimension() >= ofDimension)
+  if (ofDimension >= 0 && entity->dimension() >= ofDimension)
   {
     // can't ask for "higher" dimensional boundaries that are lower than the dimension of this cell.
     return result;
   }
-  UUIDWithConstEntityPtr other;
-  for (UUIDArray::const_iterator ai = it->second->relations().begin();
-       ai != it->second->relations().end();
+  for (UUIDArray::const_iterator ai = entity->relations().begin(); ai != entity->relations().end();
        ++ai)
   {
-    other = m_topology->find(*ai);
-    if (other == m_topology->end())
+    const Entity* other = this->findEntityRecord(*ai);
+    if (!other)
     { // TODO: silently skip bad relations or complain?
       continue;
     }
     if (
-      (ofDimension >= 0 && other->second->dimension() == ofDimension) ||
-      (ofDimension == -2 && other->second->dimension() >= it->second->dimension()))
+      (ofDimension >= 0 && other->dimension() == ofDimension) ||
+      (ofDimension == -2 && other->dimension() >= entity->dimension()))
     { // The dimension is higher, so dumbly push it into the result:
       result.insert(*ai);
     }
-    else if (
-      (it->second->entityFlags() & CELL_ENTITY) && (other->second->entityFlags() & USE_ENTITY))
+    else if ((entity->entityFlags() & CELL_ENTITY) && (other->entityFlags() & USE_ENTITY))
     { // ... or it is a use: follow the use upwards.
       ShellEntities bshells = UseEntity(smtk::const_pointer_cast<Resource>(shared_from_this()), *ai)
                                 .boundingShellEntities<ShellEntities>();
@@ -788,35 +798,31 @@ UUIDs Resource::bordantEntities(const UUIDs& ofEntities, int ofDimension) const
 UUIDs Resource::boundaryEntities(const UUID& ofEntity, int ofDimension) const
 {
   UUIDs result;
-  UUIDWithConstEntityPtr it = m_topology->find(ofEntity);
-  if (it == m_topology->end())
+  const Entity* entity = this->findEntityRecord(ofEntity);
+  if (!entity)
   {
     return result;
   }
-  if (ofDimension >= 0 && it->second->dimension() <= ofDimension)
+  if (ofDimension >= 0 && entity->dimension() <= ofDimension)
   {
     // can't ask for "lower" dimensional boundaries that are higher than the dimension of this cell.
     return result;
   }
-  UUIDWithEntityPtr other;
-  for (UUIDArray::const_iterator ai = it->second->relations().begin();
-       ai != it->second->relations().end();
+  for (UUIDArray::const_iterator ai = entity->relations().begin(); ai != entity->relations().end();
        ++ai)
   {
-    other = m_topology->find(*ai);
-    if (other == m_topology->end())
+    const Entity* other = this->findEntityRecord(*ai);
+    if (!other)
     { // TODO: silently skip bad relations or complain?
       continue;
     }
     if (
-      (ofDimension >= 0 && other->second->dimension() == ofDimension) ||
-      (ofDimension == -2 && other->second->dimension() <= it->second->dimension() &&
-       !other->second->isModel()))
+      (ofDimension >= 0 && other->dimension() == ofDimension) ||
+      (ofDimension == -2 && other->dimension() <= entity->dimension() && !other->isModel()))
     {
       result.insert(*ai);
     }
-    else if (
-      (it->second->entityFlags() & CELL_ENTITY) && (other->second->entityFlags() & USE_ENTITY))
+    else if ((entity->entityFlags() & CELL_ENTITY) && (other->entityFlags() & USE_ENTITY))
     { // ... or it is a use: follow the use downwards.
       ShellEntities shells = UseEntity(smtk::const_pointer_cast<Resource>(shared_from_this()), *ai)
                                .shellEntities<ShellEntities>();
@@ -959,26 +965,11 @@ UUIDs Resource::adjacentEntities(const UUID& ofEntity, int ofDimension)
   return result;
 }
 
-/// Return all entities of the requested dimension that are present in the solid.
+/// Return all entities whose type flags satisfy \a mask (see EntityTypeIndex::matches()).
 UUIDs Resource::entitiesMatchingFlags(BitFlags mask, bool exactMatch)
 {
   UUIDs result;
-  for (UUIDWithEntityPtr it = m_topology->begin(); it != m_topology->end(); ++it)
-  {
-    BitFlags unmasked = it->second->entityFlags();
-    BitFlags masked = unmasked & mask;
-    // NB: exactMatch still allows some mismatches; specifically, we want to
-    //     disregard dimension bits set on models and groups when asking for
-    //     exact matches for MODEL_ENTITY and GROUP_ENTITY. Hence the final
-    //     condition that (unmasked & ENTITY_MASK) == (mask & ENTITY_MASK)
-    //     rather than just unmasked == mask.
-    if (
-      (masked && (mask == ANY_ENTITY)) || (!exactMatch && masked) ||
-      (exactMatch && masked == mask && ((unmasked & ENTITY_MASK) == (mask & ENTITY_MASK))))
-    {
-      result.insert(it->first);
-    }
-  }
+  this->entityTypeIndex().entitiesMatchingFlags(mask, exactMatch, result);
   return result;
 }
 
@@ -986,14 +977,81 @@ UUIDs Resource::entitiesMatchingFlags(BitFlags mask, bool exactMatch)
 UUIDs Resource::entitiesOfDimension(int dim)
 {
   UUIDs result;
-  for (UUIDWithEntityPtr it = m_topology->begin(); it != m_topology->end(); ++it)
+  this->entityTypeIndex().entitiesOfDimension(dim, result);
+  return result;
+}
+
+/**\brief Return the IDs of this resource's entities grouped by their type flags.
+  *
+  * The index is kept up to date as entities are inserted and erased by the
+  * resource. Should records have been edited through topology(), it is
+  * rebuilt.
+  */
+const EntityTypeIndex& Resource::entityTypeIndex()
+{
+  if (!this->entityIndicesValid())
   {
-    if (it->second->dimension() == dim)
-    {
-      result.insert(it->first);
-    }
+    this->rebuildEntityIndices();
   }
-  return result;
+  return m_entityTypeIndex;
+}
+
+/// Called by \a entity when its flags change from \a previous.
+void Resource::entityFlagsChanged(const Entity& entity, BitFlags previous)
+{
+  if (!this->entityIndicesValid())
+  {
+    // The type index will be rebuilt when it is next used.
+    return;
+  }
+  const EntityPtr* const* slot = m_entityLookup.find(entity.id());
+  if (slot && (*slot)->get() == &entity)
+  {
+    m_entityTypeIndex.update(entity.id(), previous, entity.entityFlags());
+  }
+}
+
+/// Add the record at \a it (just inserted into topology()) to the entity indices.
+void Resource::indexEntityRecord(UUIDWithEntityPtr it)
+{
+  m_entityLookup.insert(it->first, &it->second);
+  m_entityTypeIndex.insert(it->first, it->second->entityFlags());
+}
+
+/// Remove the entity record for \a uid from topology(), returning true if one existed.
+bool Resource::eraseEntityRecord(const UUID& uid)
+{
+  auto it = m_topology->find(uid);
+  if (it == m_topology->end())
+  {
+    return false;
+  }
+  m_entityTypeIndex.erase(uid, it->second->entityFlags());
+  m_entityLookup.erase(uid);
+  ++m_structureGeneration;
+  m_topology->erase(it);
+  return true;
+}
+
+/// Return true unless topology() may have been edited since the indices were built.
+bool Resource::entityIndicesValid() const
+{
+  return m_entityIndicesValid && m_entityLookup.size() == m_topology->size();
+}
+
+/// Rebuild the entity indices from topology().
+void Resource::rebuildEntityIndices() const
+{
+  m_entityLookup.clear();
+  m_entityLookup.reserve(m_topology->size());
+  m_entityTypeIndex.clear();
+  for (auto& entry : *m_topology)
+  {
+    m_entityLookup.insert(entry.first, &entry.second);
+    m_entityTypeIndex.insert(entry.first, entry.second->entityFlags());
+  }
+  m_entityIndicesValid = true;
+  ++m_structureGeneration;
 }
 //@}
 
@@ -1009,30 +1067,53 @@ UUIDs Resource::entitiesOfDimension(int dim)
   */
 EntityPtr Resource::findEntity(const UUID& uid, bool trySessions) const
 {
-  UUIDWithEntityPtr it = m_topology->find(uid);
-  if (it == m_topology->end())
+  if (const EntityPtr* slot = this->findEntitySlot(uid))
+  {
+    return *slot;
+  }
+  // Not in storage... is it in any session's dangling entity list?
+  // We use an evil const-cast here because we are working under the fiction
+  // that fetching an entity that exists (even if it hasn't been transcribed
+  // yet) does not affect storage.
+  if (trySessions)
   {
-    // Not in storage... is it in any session's dangling entity list?
-    // We use an evil const-cast here because we are working under the fiction
-    // that fetching an entity that exists (even if it hasn't been transcribed
-    // yet) does not affect storage.
     ResourcePtr self = const_cast<Resource*>(this)->shared_from_this();
-    if (trySessions)
+    UUIDsToSessions::iterator bit;
+    for (bit = self->m_sessions->begin(); bit != self->m_sessions->end(); ++bit)
     {
-      UUIDsToSessions::iterator bit;
-      for (bit = self->m_sessions->begin(); bit != self->m_sessions->end(); ++bit)
+      if (bit->second->transcribe(EntityRef(self, uid), SESSION_ENTITY_ARRANGED, true))
       {
-        if (bit->second->transcribe(EntityRef(self, uid), SESSION_ENTITY_ARRANGED, true))
-        {
-          it = m_topology->find(uid);
-          if (it != m_topology->end())
-            return it->second;
-        }
+        UUIDWithEntityPtr it = m_topology->find(uid);
+        if (it != m_topology->end())
+          return it->second;
       }
     }
-    return nullptr;
   }
-  return it->second;
+  return nullptr;
+}
+
+/**\brief Return the record for \a uid (or nullptr) without consulting sessions.
+  *
+  * Unlike findEntity(), this does not copy a shared pointer; the record is
+  * owned by the resource and remains valid until it is erased or replaced
+  * (see structureGeneration()).
+  */
+Entity* Resource::findEntityRecord(const UUID& uid) const
+{
+  const EntityPtr* slot = this->findEntitySlot(uid);
+  return slot ? slot->get() : nullptr;
+}
+
+/// Return the topology() entry holding the record for \a uid (or nullptr).
+const EntityPtr* Resource::findEntitySlot(const UUID& uid) const
+{
+  if (!this->entityIndicesValid())
+  {
+    // Records may have been edited through topology().
+    this->rebuildEntityIndices();
+  }
+  const EntityPtr* const* slot = m_entityLookup.find(uid);
+  return slot ? *slot : nullptr;
 }
 
 smtk::resource::ComponentPtr Resource::find(const smtk::common::UUID& uid) const
@@ -1709,7 +1790,7 @@ bool Resource::unregisterSession(SessionPtr session, bool expungeSession)
 
     // Remove the session's entity record, properties, and such, but not
     // records, properties, etc. for entities the session owns.
-    m_topology->erase(sessId);
+    this->eraseEntityRecord(sessId);
     this->properties().data().eraseIdForType<FloatProperty>(sessId);
     this->properties().data().eraseIdForType<StringProperty>(sessId);
     this->properties().data().eraseIdForType<IntProperty>(sessId);
@@ -2113,7 +2194,7 @@ int Resource::unarrangeEntity(const UUID& entityId, ArrangementKind k, int index
   // and if the caller has requested it: remove the entity itself.
   if (removeIfLast && eit->second->arrangementMap().empty())
   {
-    m_topology->erase(eit);
+    this->eraseEntityRecord(entityId);
     ++result;
   }
 
@@ -2152,12 +2233,8 @@ bool Resource::clearArrangements(const smtk::common::UUID& entityId)
   */
 Arrangements* Resource::hasArrangementsOfKindForEntity(const UUID& entity, ArrangementKind kind)
 {
-  auto eit = m_topology->find(entity);
-  if (eit == m_topology->end())
-  {
-    return nullptr;
-  }
-  return eit->second->hasArrangementsOfKind(kind);
+  Entity* record = this->findEntityRecord(entity);
+  return record ? record->hasArrangementsOfKind(kind) : nullptr;
 }
 
 /**\brief This is a const version of hasArrangementsOfKindForEntity().
@@ -2166,12 +2243,8 @@ const Arrangements* Resource::hasArrangementsOfKindForEntity(
   const UUID& entity,
   ArrangementKind kind) const
 {
-  auto eit = m_topology->find(entity);
-  if (eit == m_topology->end())
-  {
-    return nullptr;
-  }
-  return eit->second->hasArrangementsOfKind(kind);
+  const Entity* record = this->findEntityRecord(entity);
+  return record ? record->hasArrangementsOfKind(kind) : nullptr;
 }
 
 /**\brief Return an array of arrangements of the given \a kind for the given \a entity.
@@ -2199,13 +2272,8 @@ const Arrangement* Resource::findArrangement(const UUID& entityId, ArrangementKi
     return nullptr;
   }
 
-  auto eit = m_topology->find(entityId);
-  if (eit == m_topology->end())
-  {
-    return nullptr;
-  }
-
-  return eit->second->findArrangement(kind, index);
+  const Entity* record = this->findEntityRecord(entityId);
+  return record ? record->findArrangement(kind, index) : nullptr;
 }
 
 /**\brief Retrieve arrangement information for an entity.
@@ -2219,13 +2287,8 @@ Arrangement* Resource::findArrangement(const UUID& entityId, ArrangementKind kin
     return nullptr;
   }
 
-  auto eit = m_topology->find(entityId);
-  if (eit == m_topology->end())
-  {
-    return nullptr;
-  }
-
-  return eit->second->findArrangement(kind, index);
+  Entity* record = this->findEntityRecord(entityId);
+  return record ? record->findArrangement(kind, index) : nullptr;
 }
 
 /**\brief Find an arrangement of type \a kind that relates \a entityId to \a involvedEntity.
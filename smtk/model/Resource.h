@@ -20,6 +20,7 @@
 #include "smtk/model/AttributeAssignments.h"
 #include "smtk/model/AuxiliaryGeometry.h"
 #include "smtk/model/Entity.h"
+#include "smtk/model/EntityTypeIndex.h"
 #include "smtk/model/Events.h"
 #include "smtk/model/FloatData.h"
 #include "smtk/model/IntegerData.h"
@@ -33,6 +34,7 @@
 #include "smtk/resource/DerivedFrom.h"
 
 #include "smtk/common/UUID.h"
+#include "smtk/common/UUIDIndex.h"
 
 #include "smtk/io/Logger.h"
 
@@ -127,6 +129,13 @@ public:
   Resource(Resource&& rhs) = default;
   ~Resource() override;
 
+  /// Return the map of entity records.
+  ///
+  /// Since records may be inserted, erased or replaced through the non-const
+  /// reference, each call invalidates the resource's entity indices and the
+  /// records cached by EntityRef instances (see structureGeneration()). Call
+  /// it again for each set of edits rather than keeping the reference while
+  /// querying the resource.
   UUIDsToEntities& topology();
   const UUIDsToEntities& topology() const;
 
@@ -151,6 +160,7 @@ public:
   std::string name(const smtk::common::UUID& ofEntity) const;
 
   EntityPtr findEntity(const smtk::common::UUID& uid, bool trySessions = true) const;
+  Entity* findEntityRecord(const smtk::common::UUID& uid) const;
 
   smtk::resource::ComponentPtr find(const smtk::common::UUID& uid) const override;
   std::function<bool(const smtk::resource::Component&)> queryOperation(
@@ -192,6 +202,14 @@ public:
 
   smtk::common::UUIDs entitiesMatchingFlags(BitFlags mask, bool exactMatch = true);
   smtk::common::UUIDs entitiesOfDimension(int dim);
+  const EntityTypeIndex& entityTypeIndex();
+
+  /**\brief Return a counter that changes whenever entity records are erased or replaced
+    *        (or may have been, through the non-const topology()).
+    *
+    * EntityRef uses this to decide whether the record it last looked up is still valid.
+    */
+  std::size_t structureGeneration() const { return m_structureGeneration; }
 
   smtk::common::UUID unusedUUID();
   iter_type insertEntityOfTypeAndDimension(BitFlags entityFlags, int dim);
@@ -555,6 +573,14 @@ public:
 
 protected:
   friend class smtk::attribute::Resource;
+  friend class Entity;
+
+  void entityFlagsChanged(const Entity& entity, BitFlags previous);
+  bool eraseEntityRecord(const smtk::common::UUID& uid);
+  void indexEntityRecord(UUIDWithEntityPtr it);
+  bool entityIndicesValid() const;
+  void rebuildEntityIndices() const;
+  const EntityPtr* findEntitySlot(const smtk::common::UUID& uid) const;
 
   void assignDefaultNamesWithOwner(
     const UUIDWithEntityPtr& irec,
@@ -575,6 +601,11 @@ protected:
 
   // Below are all the different things that can be mapped to a UUID:
   smtk::shared_ptr<UUIDsToEntities> m_topology;
+  // Records in m_topology by ID; the map owns the records and the index points into it.
+  mutable smtk::common::UUIDIndex<const EntityPtr*> m_entityLookup;
+  mutable EntityTypeIndex m_entityTypeIndex; // IDs in m_topology grouped by entity flags
+  mutable std::size_t m_structureGeneration{ 1 };
+  mutable bool m_entityIndicesValid{ false };
   smtk::shared_ptr<UUIDsToTessellations> m_tessellations;
   smtk::shared_ptr<UUIDsToTessellations> m_analysisMesh;
   smtk::shared_ptr<UUIDsToAttributeAssignments> m_attributeAssignments;
@@ -7,12 +7,14 @@
 //  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
 //  PURPOSE.  See the above copyright notice for more information.
 //=========================================================================
+#include "smtk/model/EntityRef.h"
 #include "smtk/model/Resource.h"
 #include "smtk/model/json/jsonResource.h"
 #include "smtk/model/testing/cxx/helpers.h"
 
 #include <fstream>
 #include <iostream>
+#include <vector>
 
 using namespace smtk::common;
 using namespace smtk::model;
@@ -57,11 +59,14 @@ int main(int argc, char* argv[])
             << " missed lookups/sec\n";
 
   // #### Hits
+  // Fetch the (non-const) map once; each call to topology() invalidates the
+  // resource's entity indices.
+  UUIDsToEntities& topology = sm->topology();
   UUIDWithEntityPtr it;
-  it = sm->topology().begin();
+  it = topology.begin();
   do
     ++it;
-  while (it != sm->topology().end() && it->second->relations().empty());
+  while (it != topology.end() && it->second->relations().empty());
   int numHits = 2000000;
   t.mark();
   for (int i = 0; i < numHits; ++i)
@@ -70,14 +75,72 @@ int main(int argc, char* argv[])
     (void)ent;
     do
       ++it;
-    while (it != sm->topology().end() && it->second->relations().empty());
-    if (it == sm->topology().end())
-      it = sm->topology().begin();
+    while (it != topology.end() && it->second->relations().empty());
+    if (it == topology.end())
+      it = topology.begin();
   }
   deltaT = t.elapsed();
   std::cout << numHits << " missed lookups " << deltaT << " seconds " << (numHits / deltaT)
             << " good lookups/sec.\n";
 
+  // ### Benchmark navigation ###
+  // Walk from each volume to its faces, edges, and vertices, asking each
+  // entity for its type along the way. Repeated passes reuse the same
+  // EntityRef objects, as applications navigating a model do.
+  EntityRefs volumes;
+  EntityRef::EntityRefsFromUUIDs(volumes, sm, sm->entitiesMatchingFlags(VOLUME));
+  int numPasses = 100;
+  std::size_t numVisits = 0;
+  std::vector<EntityRefs> faces;
+  for (const auto& volume : volumes)
+  {
+    faces.push_back(volume.relations());
+  }
+  t.mark();
+  for (int pass = 0; pass < numPasses; ++pass)
+  {
+    std::size_t vv = 0;
+    for (const auto& volume : volumes)
+    {
+      numVisits += volume.isVolume() ? 1 : 0;
+      for (const auto& face : faces[vv])
+      {
+        numVisits += face.dimension() == 2 ? 1 : 0;
+        for (const auto& edge : face.relations())
+        {
+          numVisits += edge.isEdge() ? 1 : 0;
+          for (const auto& vertex : edge.relations())
+          {
+            numVisits += vertex.dimension() == 0 ? 1 : 0;
+          }
+        }
+      }
+      ++vv;
+    }
+  }
+  deltaT = t.elapsed();
+  std::cout << numVisits << " entities navigated " << deltaT << " seconds "
+            << (numVisits / deltaT) << " entities/sec\n";
+
+  // #### Repeated queries on the same references
+  std::size_t numQueries = 0;
+  BitFlags flags = 0;
+  t.mark();
+  for (int pass = 0; pass < 20 * numPasses; ++pass)
+  {
+    for (const auto& entries : faces)
+    {
+      for (const auto& entry : entries)
+      {
+        flags |= entry.entityFlags();
+        ++numQueries;
+      }
+    }
+  }
+  deltaT = t.elapsed();
+  std::cout << numQueries << " cached queries " << deltaT << " seconds " << (numQueries / deltaT)
+            << " queries/sec (flags " << flags << ")\n";
+
   // ### Benchmark JSON export ###
   t.mark();
   nlohmann::json json = sm;
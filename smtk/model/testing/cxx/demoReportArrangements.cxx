@@ -87,8 +87,9 @@ int main(int argc, char* argv[])
       if ((mask & maskOrder[section]) != maskOrder[section])
         continue; // skip sections that do not overlap the mask.
       std::cout << "\n## " << Entity::flagSummary(maskOrder[section], 1) << " ##\n\n";
+      UUIDsToEntities& topology = sm->topology();
       UUIDWithEntityPtr eit;
-      for (eit = sm->topology().begin(); eit != sm->topology().end(); ++eit)
+      for (eit = topology.begin(); eit != topology.end(); ++eit)
       {
         if ((eit->second->entityFlags() & maskOrder[section]) != maskOrder[section])
         { // Skip entities that don't overlap our mask
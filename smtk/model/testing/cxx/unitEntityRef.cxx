@@ -334,6 +334,49 @@ void testMiscConstructionMethods()
   std::cout << "testMiscConstructionMethods... done\n\n";
 }
 
+void testCachedRecords()
+{
+  std::cout << "testCachedRecords\n";
+  ResourcePtr sm = Resource::create();
+  Vertex vert = sm->addVertex();
+  Edge edge = sm->addEdge();
+  test(vert.isVertex() && edge.isEdge(), "Unexpected entity types.");
+  std::size_t generation = sm->structureGeneration();
+
+  // Inserting entities and changing flags keep records in place.
+  Face face = sm->addFace();
+  vert.entityRecord()->setEntityFlags(vert.entityFlags() | COVER);
+  test(sm->structureGeneration() == generation, "Insertion should not invalidate records.");
+  test((vert.entityFlags() & COVER) != 0, "Flag change not reported.");
+
+  // Replacing a record must not leave references with the old one.
+  sm->setEntity(Entity::create(vert.entity(), VERTEX | PARTITION, sm));
+  test(sm->structureGeneration() != generation, "Replacement should invalidate records.");
+  test((vert.entityFlags() & PARTITION) != 0, "Reference reported a replaced record.");
+
+  // Nor may erased records be reported.
+  sm->erase(edge);
+  test(!edge.isValid() && edge.entityFlags() == 0, "Reference reported an erased record.");
+  test(face.isFace() && sm->findEntityRecord(face.entity()), "Face lost.");
+
+  // References retargeted at other entities forget their records.
+  EntityRef ref = vert;
+  ref.setEntity(face.entity());
+  test(ref.isFace(), "Reference reported its previous entity.");
+  // Same-size edits made directly through topology() invalidate records too,
+  // whether a record is replaced in place or erased and another inserted.
+  test(vert.isVertex(), "Expected a cached vertex record.");
+  sm->topology()[vert.entity()] = Entity::create(vert.entity(), VERTEX | MODEL_BOUNDARY, sm);
+  test((vert.entityFlags() & MODEL_BOUNDARY) != 0, "Reference reported a replaced record.");
+  test(face.isFace(), "Expected a cached face record.");
+  auto& topology = sm->topology();
+  topology.erase(face.entity());
+  auto vertex = Entity::create(face.entity(), VERTEX, sm);
+  topology.insert(std::make_pair(face.entity(), vertex));
+  test(face.isVertex(), "Reference reported an erased record.");
+  test(sm->findEntityRecord(face.entity()) == vertex.get(), "Index reported an erased record.");
+}
+
 void testVolumeEntityRef()
 {
   std::cout << "testVolumeEntityRef\n";
@@ -774,6 +817,7 @@ int main(int argc, char* argv[])
     std::cout << "testModeling... done\n\n";
 
     testComplexVertexChain();
+    testCachedRecords();
     testMiscConstructionMethods();
     testVolumeEntityRef();
     testModelMethods();
@@ -0,0 +1,134 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/model/Edge.h"
+#include "smtk/model/Entity.h"
+#include "smtk/model/EntityTypeIndex.h"
+#include "smtk/model/Face.h"
+#include "smtk/model/Group.h"
+#include "smtk/model/Model.h"
+#include "smtk/model/Resource.h"
+#include "smtk/model/Vertex.h"
+#include "smtk/model/Volume.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+using namespace smtk::model;
+using smtk::common::UUIDs;
+
+namespace
+{
+// The linear scan that the index replaces.
+UUIDs scanMatchingFlags(const ResourcePtr& resource, BitFlags mask, bool exactMatch)
+{
+  UUIDs result;
+  for (const auto& entry : resource->topology())
+  {
+    if (EntityTypeIndex::matches(entry.second->entityFlags(), mask, exactMatch))
+    {
+      result.insert(entry.first);
+    }
+  }
+  return result;
+}
+
+UUIDs scanDimension(const ResourcePtr& resource, int dim)
+{
+  UUIDs result;
+  for (const auto& entry : resource->topology())
+  {
+    if (entry.second->dimension() == dim)
+    {
+      result.insert(entry.first);
+    }
+  }
+  return result;
+}
+
+void compare(const ResourcePtr& resource, const std::string& when)
+{
+  const BitFlags masks[] = { ANY_ENTITY, CELL_ENTITY, VERTEX,       EDGE,         FACE,
+                             VOLUME,     MODEL_ENTITY, GROUP_ENTITY, ANY_DIMENSION, CELL_2D,
+                             DIMENSION_1 };
+  for (BitFlags mask : masks)
+  {
+    for (bool exact : { true, false })
+    {
+      smtkTest(
+        resource->entitiesMatchingFlags(mask, exact) == scanMatchingFlags(resource, mask, exact),
+        "Index differs from a scan for mask " << std::hex << mask << std::dec << " (exact "
+                                              << exact << ") " << when << ".");
+    }
+  }
+  for (int dim = -1; dim <= 4; ++dim)
+  {
+    smtkTest(
+      resource->entitiesOfDimension(dim) == scanDimension(resource, dim),
+      "Index differs from a scan for dimension " << dim << " " << when << ".");
+  }
+  smtkTest(
+    resource->entityTypeIndex().size() == resource->topology().size(),
+    "Index size differs from topology " << when << ".");
+}
+} // namespace
+
+int unitEntityTypeIndex(int /*unused*/, char* /*unused*/[])
+{
+  auto resource = Resource::create();
+  compare(resource, "when empty");
+
+  auto model = resource->addModel(3, 3, "model");
+  std::vector<Vertex> verts;
+  for (int ii = 0; ii < 8; ++ii)
+  {
+    verts.push_back(resource->addVertex());
+    model.addCell(verts.back());
+  }
+  Edge edge = resource->addEdge();
+  Face face = resource->addFace();
+  Volume volume = resource->addVolume();
+  Group group = resource->addGroup(0, "group");
+  group.addEntity(face);
+  model.addCell(edge);
+  model.addCell(face);
+  model.addCell(volume);
+  compare(resource, "after insertion");
+
+  smtkTest(
+    resource->entitiesMatchingFlags(VERTEX).size() == verts.size(),
+    "Expected " << verts.size() << " vertices.");
+
+  // Changing an entity's flags must move it within the index.
+  BitFlags groupFlags = group.entityFlags();
+  smtkTest(
+    group.entityRecord()->setEntityFlags(groupFlags | PARTITION), "Could not set group flags.");
+  compare(resource, "after changing flags");
+  smtkTest(
+    resource->entitiesMatchingFlags(GROUP_ENTITY | PARTITION, false).count(group.entity()) == 1,
+    "Group not found by its new flags.");
+
+  // Erasing entities must remove them.
+  resource->erase(verts[0]);
+  resource->erase(face);
+  compare(resource, "after erasure");
+
+  // Replacing a record with one of a different type.
+  auto replacement = Entity::create(verts[1].entity(), EDGE, resource);
+  resource->setEntity(replacement);
+  compare(resource, "after replacement");
+
+  // Records added directly to the topology are picked up.
+  auto stray = Entity::create(smtk::common::UUID::random(), FACE, resource);
+  resource->topology()[stray->id()] = stray;
+  compare(resource, "after direct insertion");
+
+  resource->clear();
+  compare(resource, "after clearing");
+  return 0;
+}
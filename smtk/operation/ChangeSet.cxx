@@ -0,0 +1,265 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/operation/ChangeSet.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/ComponentItem.h"
+
+#include "smtk/resource/Component.h"
+#include "smtk/resource/Resource.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace smtk
+{
+namespace operation
+{
+namespace
+{
+const std::string changeSetKey = "smtk.operation.change_set";
+
+const char* const itemNames[] = { "created", "modified", "expunged" };
+
+// Sort and remove duplicates from a vector of ids.
+void makeUnique(std::vector<smtk::common::UUID>& ids)
+{
+  std::sort(ids.begin(), ids.end());
+  ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+}
+
+// Remove the (sorted) ids in \a remove from the (sorted) ids in \a ids.
+void removeAll(std::vector<smtk::common::UUID>& ids, const std::vector<smtk::common::UUID>& remove)
+{
+  if (ids.empty() || remove.empty())
+  {
+    return;
+  }
+  std::vector<smtk::common::UUID> difference;
+  difference.reserve(ids.size());
+  std::set_difference(
+    ids.begin(), ids.end(), remove.begin(), remove.end(), std::back_inserter(difference));
+  ids.swap(difference);
+}
+} // namespace
+
+smtk::resource::PersistentObjectPtr ChangeSet::Changes::object(const smtk::common::UUID& id) const
+{
+  auto held = this->held.find(id);
+  if (held != this->held.end())
+  {
+    return held->second;
+  }
+  if (!this->resource)
+  {
+    return smtk::resource::PersistentObjectPtr();
+  }
+  if (id == this->resource->id())
+  {
+    return this->resource;
+  }
+  return this->resource->find(id);
+}
+
+std::shared_ptr<ChangeSet> ChangeSet::get(const Operation::Result& result)
+{
+  return result ? std::dynamic_pointer_cast<ChangeSet>(result->userData(changeSetKey))
+                : std::shared_ptr<ChangeSet>();
+}
+
+ChangeSet& ChangeSet::attach(const Operation::Result& result)
+{
+  auto changeSet = ChangeSet::get(result);
+  if (!changeSet)
+  {
+    changeSet = std::make_shared<ChangeSet>();
+    result->setUserData(changeSetKey, changeSet);
+  }
+  return *changeSet;
+}
+
+std::shared_ptr<ChangeSet> ChangeSet::of(const Operation::Result& result)
+{
+  if (!result)
+  {
+    return std::make_shared<ChangeSet>();
+  }
+  ChangeSet::attach(result);
+  auto changeSet = ChangeSet::get(result);
+  if (changeSet->m_itemsMerged)
+  {
+    return changeSet;
+  }
+  changeSet->m_itemsMerged = true;
+
+  for (int kind = 0; kind < 3; ++kind)
+  {
+    auto item = result->findComponent(itemNames[kind]);
+    if (!item)
+    {
+      continue;
+    }
+    for (auto it = item->begin(); it != item->end(); ++it)
+    {
+      if (it.isSet())
+      {
+        changeSet->insert(static_cast<Kind>(kind), *it);
+      }
+    }
+  }
+  return changeSet;
+}
+
+ChangeSet::Changes& ChangeSet::changesFor(const smtk::resource::ResourcePtr& resource)
+{
+  auto& changes = m_changes[resource ? resource->id() : smtk::common::UUID::null()];
+  if (!changes.resource)
+  {
+    changes.resource = resource;
+  }
+  return changes;
+}
+
+void ChangeSet::insert(
+  Kind kind,
+  const smtk::resource::ResourcePtr& resource,
+  const smtk::common::UUID& id)
+{
+  this->changesFor(resource).ids[static_cast<int>(kind)].push_back(id);
+}
+
+void ChangeSet::insert(
+  Kind kind,
+  const smtk::resource::ResourcePtr& resource,
+  const std::vector<smtk::common::UUID>& ids)
+{
+  auto& entries = this->changesFor(resource).ids[static_cast<int>(kind)];
+  entries.insert(entries.end(), ids.begin(), ids.end());
+}
+
+void ChangeSet::insert(Kind kind, const smtk::resource::PersistentObjectPtr& object)
+{
+  if (!object)
+  {
+    return;
+  }
+  if (auto resource = std::dynamic_pointer_cast<smtk::resource::Resource>(object))
+  {
+    this->insert(kind, resource, resource->id());
+    return;
+  }
+  auto component = std::dynamic_pointer_cast<smtk::resource::Component>(object);
+  if (!component)
+  {
+    return;
+  }
+  auto& changes = this->changesFor(component->resource());
+  changes.ids[static_cast<int>(kind)].push_back(component->id());
+  changes.held[component->id()] = component;
+}
+
+void ChangeSet::merge(const ChangeSet& other)
+{
+  for (const auto& entry : other.m_changes)
+  {
+    auto& changes = m_changes[entry.first];
+    if (!changes.resource)
+    {
+      changes.resource = entry.second.resource;
+    }
+    for (int kind = 0; kind < 3; ++kind)
+    {
+      const auto& ids = entry.second.ids[kind];
+      changes.ids[kind].insert(changes.ids[kind].end(), ids.begin(), ids.end());
+    }
+    changes.held.insert(entry.second.held.begin(), entry.second.held.end());
+  }
+}
+
+void ChangeSet::compact()
+{
+  const int created = static_cast<int>(Kind::CREATED);
+  const int modified = static_cast<int>(Kind::MODIFIED);
+  const int expunged = static_cast<int>(Kind::EXPUNGED);
+  for (auto& entry : m_changes)
+  {
+    auto& ids = entry.second.ids;
+    for (auto& kindIds : ids)
+    {
+      makeUnique(kindIds);
+    }
+    removeAll(ids[modified], ids[expunged]);
+    removeAll(ids[modified], ids[created]);
+
+    // Objects created and expunged within the set were never visible outside
+    // of it, so they are not reported at all.
+    std::vector<smtk::common::UUID> transient;
+    std::set_intersection(
+      ids[created].begin(),
+      ids[created].end(),
+      ids[expunged].begin(),
+      ids[expunged].end(),
+      std::back_inserter(transient));
+    removeAll(ids[created], transient);
+    removeAll(ids[expunged], transient);
+    for (const auto& id : transient)
+    {
+      entry.second.held.erase(id);
+    }
+  }
+}
+
+smtk::resource::PersistentObjectSet ChangeSet::objects(Kind kind) const
+{
+  smtk::resource::PersistentObjectSet result;
+  for (const auto& entry : m_changes)
+  {
+    for (const auto& id : entry.second[kind])
+    {
+      if (auto object = entry.second.object(id))
+      {
+        result.insert(object);
+      }
+    }
+  }
+  return result;
+}
+
+std::size_t ChangeSet::size(Kind kind) const
+{
+  std::size_t result = 0;
+  for (const auto& entry : m_changes)
+  {
+    result += entry.second[kind].size();
+  }
+  return result;
+}
+
+bool ChangeSet::empty() const
+{
+  for (const auto& entry : m_changes)
+  {
+    for (const auto& ids : entry.second.ids)
+    {
+      if (!ids.empty())
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void ChangeSet::clear()
+{
+  m_changes.clear();
+}
+} // namespace operation
+} // namespace smtk
@@ -0,0 +1,147 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_operation_ChangeSet_h
+#define smtk_operation_ChangeSet_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/PublicPointerDefs.h"
+
+#include "smtk/common/UUID.h"
+
+#include "smtk/operation/Operation.h"
+
+#include "smtk/resource/PersistentObject.h"
+
+#include "smtk/simulation/UserData.h"
+
+#include <array>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace smtk
+{
+namespace operation
+{
+
+/**\brief A compact record of the objects an operation created, modified or expunged.
+  *
+  * Operations report their changes by appending components to the
+  * "created", "modified" and "expunged" items of their result, and those
+  * items remain the authoritative record: many consumers (e.g., the Qt
+  * attribute views) read them directly, so operations should continue to
+  * populate them. A ChangeSet is an addition to the items. It records the
+  * ids of changed objects in one vector per resource and kind of change, so
+  * it is cheap to build, iterate and merge. Changes recorded only in a
+  * ChangeSet are not seen by consumers that read the items.
+  *
+  * A ChangeSet is attached to a result as user data (see attach()).
+  * Consumers that accept change sets should call ChangeSet::of(), which
+  * also folds in the changes reported through the result's items, so that
+  * they see every change regardless of how it was reported.
+  *
+  * Components inserted as objects (including those folded in from a
+  * result's items) are held, so they resolve without a lookup even when
+  * their resource cannot find them (e.g., once expunged). Ids inserted
+  * without an object are resolved by their resource when iterated. An id
+  * equal to its resource's id denotes a change to the resource itself.
+  */
+class SMTKCORE_EXPORT ChangeSet : public smtk::simulation::UserData
+{
+public:
+  enum class Kind
+  {
+    CREATED,
+    MODIFIED,
+    EXPUNGED
+  };
+
+  /// The changes made to objects owned by a single resource.
+  struct Changes
+  {
+    /// The resource owning the changed objects (null for expunged components
+    /// that were no longer owned by a resource).
+    smtk::resource::ResourcePtr resource;
+    /// The ids of changed objects, indexed by Kind.
+    std::array<std::vector<smtk::common::UUID>, 3> ids;
+    /// Components inserted as objects, held so that they resolve without
+    /// asking the resource to find them.
+    std::unordered_map<smtk::common::UUID, smtk::resource::ComponentPtr> held;
+
+    const std::vector<smtk::common::UUID>& operator[](Kind kind) const
+    {
+      return ids[static_cast<int>(kind)];
+    }
+
+    /// Return the object with the given id, or null if it cannot be found.
+    smtk::resource::PersistentObjectPtr object(const smtk::common::UUID& id) const;
+  };
+
+  ChangeSet() = default;
+  ~ChangeSet() override = default;
+
+  /// Return the change set attached to \a result, or null if there is none.
+  static std::shared_ptr<ChangeSet> get(const Operation::Result& result);
+
+  /// Return the change set attached to \a result, attaching a new (empty) one
+  /// if there is none. Operations use this to record changes in addition to
+  /// the result's items.
+  static ChangeSet& attach(const Operation::Result& result);
+
+  /// Return every change reported by \a result: the attached change set
+  /// (attaching one if needed) augmented with the components in the result's
+  /// created, modified and expunged items. Items are only folded in once, so
+  /// consumers of the same result share the cost.
+  static std::shared_ptr<ChangeSet> of(const Operation::Result& result);
+
+  /// Record a change to the object with id \a id owned by \a resource.
+  void insert(Kind kind, const smtk::resource::ResourcePtr& resource, const smtk::common::UUID& id);
+
+  /// Record changes to many objects owned by \a resource.
+  void insert(
+    Kind kind,
+    const smtk::resource::ResourcePtr& resource,
+    const std::vector<smtk::common::UUID>& ids);
+
+  /// Record a change to a component or resource. Components are held.
+  void insert(Kind kind, const smtk::resource::PersistentObjectPtr& object);
+
+  /// Append the changes recorded by \a other.
+  void merge(const ChangeSet& other);
+
+  /// Remove duplicate ids and resolve ids recorded under more than one kind:
+  /// objects both created and expunged are dropped entirely, expunged objects
+  /// are not modified and created objects are not also modified.
+  void compact();
+
+  /// The changes, indexed by the id of their resource (null for expunged
+  /// components without a resource).
+  const std::map<smtk::common::UUID, Changes>& changes() const { return m_changes; }
+
+  /// Return the resolvable objects with the given kind of change.
+  smtk::resource::PersistentObjectSet objects(Kind kind) const;
+
+  /// Return the number of ids with the given kind of change.
+  std::size_t size(Kind kind) const;
+  bool empty() const;
+
+  void clear();
+
+private:
+  Changes& changesFor(const smtk::resource::ResourcePtr& resource);
+
+  std::map<smtk::common::UUID, Changes> m_changes;
+  bool m_itemsMerged{ false };
+};
+} // namespace operation
+} // namespace smtk
+
+#endif // smtk_operation_ChangeSet_h
@@ -10,6 +10,8 @@
 
 #include "smtk/operation/Manager.h"
 
+#include "smtk/operation/groups/InternalGroup.h"
+
 #include "smtk/attribute/Attribute.h"
 #include "smtk/attribute/Item.h"
 #include "smtk/attribute/ResourceItem.h"
@@ -18,6 +20,7 @@
 
 #include "smtk/io/Logger.h"
 
+#include <limits>
 #include <sstream>
 
 namespace smtk
@@ -34,6 +37,13 @@ Manager::Manager()
     }
   })
 {
+  m_subscriptionsObserver = m_observers.insert(
+    [this](const Operation& op, EventType event, Operation::Result result) {
+      return m_subscriptions(op, event, result);
+    },
+    std::numeric_limits<Observers::Priority>::lowest(),
+    false,
+    "smtk::operation::Manager: dispatch to subscriptions");
 }
 
 Manager::~Manager() = default;
@@ -166,6 +176,16 @@ std::shared_ptr<Operation> Manager::create(const Operation::Index& index)
   return op;
 }
 
+std::shared_ptr<Transaction> Manager::createTransaction()
+{
+  if (!this->registered<Transaction>())
+  {
+    this->registerOperation<Transaction>();
+    InternalGroup(shared_from_this()).registerOperation<Transaction>();
+  }
+  return this->create<Transaction>();
+}
+
 bool Manager::registerResourceManager(smtk::resource::ManagerPtr& resourceManager)
 {
   // Only allow one resource manager to manage created resources.
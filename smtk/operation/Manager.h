@@ -24,6 +24,8 @@
 #include "smtk/operation/MetadataContainer.h"
 #include "smtk/operation/Observer.h"
 #include "smtk/operation/Operation.h"
+#include "smtk/operation/Subscriptions.h"
+#include "smtk/operation/Transaction.h"
 
 #include <array>
 #include <string>
@@ -105,6 +107,12 @@ public:
   template<typename OperationType>
   smtk::shared_ptr<OperationType> create();
 
+  /// Construct a transaction, which runs the operations added to it under a
+  /// single acquisition of their resource locks and a single notification of
+  /// this manager's observers. The Transaction operation is registered (as an
+  /// internal operation) the first time this is called.
+  std::shared_ptr<Transaction> createTransaction();
+
   // We expose the underlying containers for metadata; this means of access
   // should not be necessary for most use cases.
 
@@ -119,6 +127,12 @@ public:
   Observers& observers() { return m_observers; }
   const Observers& observers() const { return m_observers; }
 
+  /// Return the subscriptions associated with this manager. Subscribers are
+  /// only called for events involving the operations, resources or component
+  /// types they subscribe to.
+  Subscriptions& subscriptions() { return m_subscriptions; }
+  const Subscriptions& subscriptions() const { return m_subscriptions; }
+
   /// Return the group observers associated with this manager.
   Group::Observers& groupObservers() { return m_groupObservers; }
   const Group::Observers& groupObservers() const { return m_groupObservers; }
@@ -204,6 +218,11 @@ private:
   /// A container for all operation observers.
   Observers m_observers;
 
+  /// Observers indexed by the operations, resources and component types they
+  /// are interested in, along with the observer that dispatches to them.
+  Subscriptions m_subscriptions;
+  Observers::Key m_subscriptionsObserver;
+
   /// A container for all operation group observers.
   Group::Observers m_groupObservers;
 
@@ -153,14 +153,50 @@ void MarkGeometry::markResult(const smtk::operation::Operation::Result& result)
     return;
   }
 
-  auto created = result->findComponent("created");
-  this->markModified(created);
+  this->markChanges(*ChangeSet::of(result));
+}
 
-  auto modified = result->findComponent("modified");
-  this->markModified(modified);
+void MarkGeometry::markChanges(const smtk::operation::ChangeSet& changes)
+{
+  for (const auto& entry : changes.changes())
+  {
+    const auto& resourceChanges = entry.second;
+    auto rsrc = m_resource
+      ? m_resource
+      : std::dynamic_pointer_cast<smtk::geometry::Resource>(resourceChanges.resource);
+    if (!rsrc)
+    {
+      continue;
+    }
 
-  auto expunged = result->findComponent("expunged");
-  this->erase(expunged);
+    std::vector<smtk::resource::PersistentObjectPtr> modified;
+    modified.reserve(
+      resourceChanges[ChangeSet::Kind::CREATED].size() +
+      resourceChanges[ChangeSet::Kind::MODIFIED].size());
+    for (auto kind : { ChangeSet::Kind::CREATED, ChangeSet::Kind::MODIFIED })
+    {
+      for (const auto& id : resourceChanges[kind])
+      {
+        if (auto object = resourceChanges.object(id))
+        {
+          modified.push_back(object);
+        }
+      }
+    }
+    const auto& expunged = resourceChanges[ChangeSet::Kind::EXPUNGED];
+
+    rsrc->visitGeometry(
+      [&modified, &expunged](std::unique_ptr<geometry::Geometry>& provider) {
+        for (const auto& object : modified)
+        {
+          provider->markModified(object);
+        }
+        for (const auto& id : expunged)
+        {
+          provider->erase(id);
+        }
+      });
+  }
 }
 
 } // namespace operation
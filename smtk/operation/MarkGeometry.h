@@ -10,6 +10,7 @@
 #ifndef smtk_operation_MarkGeometry_h
 #define smtk_operation_MarkGeometry_h
 
+#include "smtk/operation/ChangeSet.h"
 #include "smtk/operation/Operation.h"
 
 #include "smtk/geometry/Geometry.h"
@@ -67,6 +68,11 @@ public:
   /// geometry modified or deleted (across all backends).
   void markResult(const smtk::operation::Operation::Result& result);
 
+  /// Mark all created/modified/expunged objects in the change set as having
+  /// their geometry modified or deleted (across all backends). Geometry
+  /// providers are looked up once per resource rather than once per object.
+  void markChanges(const smtk::operation::ChangeSet& changes);
+
 protected:
   smtk::geometry::ResourcePtr m_resource;
 };
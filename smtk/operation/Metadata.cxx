@@ -15,24 +15,126 @@
 
 #include "smtk/attribute/Attribute.h"
 #include "smtk/attribute/Definition.h"
+#include "smtk/attribute/Resource.h"
 
 #include <algorithm>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace smtk
 {
 namespace operation
 {
+namespace
+{
+// Copy the definitions and views of a specification template into a new
+// specification.
+Operation::Specification copySpecification(const Operation::Specification& source)
+{
+  if (!source)
+  {
+    return Operation::Specification();
+  }
+  Operation::Specification specification = smtk::attribute::Resource::create();
+  std::vector<smtk::attribute::DefinitionPtr> definitions;
+  source->definitions(definitions);
+  for (const auto& definition : definitions)
+  {
+    // Copying a derived definition also copies its base definitions.
+    if (!specification->findDefinition(definition->type()))
+    {
+      specification->copyDefinition(definition);
+    }
+  }
+  for (const auto& view : source->views())
+  {
+    specification->addView(view.second);
+  }
+  return specification;
+}
+} // namespace
+
+/// Specifications ready for reuse by new operation instances.
+struct Metadata::SpecificationPool
+{
+  Operation::Specification m_template;
+  Metadata::SpecificationFactory m_factory;
+  std::mutex m_mutex;
+  std::vector<Operation::Specification> m_available;
+  // The number of attributes each specification held when it was built; only
+  // specifications returned in that state are reused.
+  std::unordered_map<const smtk::attribute::Resource*, std::size_t> m_baseline;
+  std::size_t m_capacity;
+
+  SpecificationPool(
+    const Operation::Specification& specificationTemplate,
+    const Metadata::SpecificationFactory& factory)
+    : m_template(specificationTemplate)
+    , m_factory(factory)
+    , m_capacity(std::max(4u, 2 * std::thread::hardware_concurrency()))
+  {
+  }
+
+  Operation::Specification acquire()
+  {
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      if (!m_available.empty())
+      {
+        Operation::Specification specification = m_available.back();
+        m_available.pop_back();
+        return specification;
+      }
+    }
+
+    // Build a new specification outside of the pool's lock.
+    Operation::Specification specification =
+      m_factory ? m_factory() : copySpecification(m_template);
+    if (specification)
+    {
+      std::vector<smtk::attribute::AttributePtr> attributes;
+      specification->attributes(attributes);
+      std::lock_guard<std::mutex> guard(m_mutex);
+      m_baseline[specification.get()] = attributes.size();
+    }
+    return specification;
+  }
+
+  void release(const Operation::Specification& specification)
+  {
+    std::vector<smtk::attribute::AttributePtr> attributes;
+    specification->attributes(attributes);
+    std::lock_guard<std::mutex> guard(m_mutex);
+    auto baseline = m_baseline.find(specification.get());
+    if (baseline == m_baseline.end())
+    {
+      return;
+    }
+    // Discard specifications that were altered (e.g., by restoring a trace)
+    // or that exceed the number we are willing to keep idle.
+    if (attributes.size() != baseline->second || m_available.size() >= m_capacity)
+    {
+      m_baseline.erase(baseline);
+      return;
+    }
+    m_available.push_back(specification);
+  }
+};
 
 Metadata::Metadata(
   const std::string& typeName,
   Operation::Index index,
   Operation::Specification specification,
-  std::function<std::shared_ptr<smtk::operation::Operation>(void)> createFunctor)
+  std::function<std::shared_ptr<smtk::operation::Operation>(void)> createFunctor,
+  SpecificationFactory specificationFactory)
   : create(createFunctor)
   , m_typeName(typeName)
   , m_index(index)
   , m_specification(specification)
   , m_primaryAssociation(nullptr)
+  , m_specificationPool(std::make_shared<SpecificationPool>(specification, specificationFactory))
 {
   // Extract all of the component definitions once, rather than invoking this
   // call every time Metadata::acceptsComponent() is called.
@@ -57,14 +159,30 @@ Metadata::Metadata(
   }
 }
 
+Operation::Specification Metadata::acquireSpecification(SpecificationReleaser& releaser) const
+{
+  std::weak_ptr<SpecificationPool> weakPool = m_specificationPool;
+  releaser = [weakPool](const Operation::Specification& specification) {
+    if (auto pool = weakPool.lock())
+    {
+      pool->release(specification);
+    }
+  };
+  return m_specificationPool->acquire();
+}
+
 std::string Metadata::label() const
 {
   std::string label = this->typeName();
   auto spec = this->specification();
   if (spec)
   {
-    auto parameters = smtk::operation::extractParameters(spec, label);
-    label = parameters->definition()->label();
+    // Consult the definition rather than creating parameters in the template.
+    auto definition = smtk::operation::extractParameterDefinition(spec, label);
+    if (definition)
+    {
+      label = definition->label();
+    }
   }
   return label;
 }
@@ -18,6 +18,7 @@
 #include "smtk/operation/Operation.h"
 
 #include <functional>
+#include <memory>
 #include <set>
 #include <string>
 
@@ -38,16 +39,49 @@ public:
   using Observer = MetadataObserver;
   using Observers = MetadataObservers;
   using Association = smtk::attribute::ConstReferenceItemDefinitionPtr;
+  /// A functor that builds a specification equivalent to the template.
+  using SpecificationFactory = std::function<Operation::Specification()>;
 
+  /// Construct metadata for an operation type.
+  ///
+  /// The \a specificationFactory builds the specifications handed out by
+  /// acquireSpecification(). It should be provided when an operation's
+  /// specification depends upon state configured at registration (e.g., an
+  /// operation's project manager); when it is null, the definitions and
+  /// views of \a specification are copied instead.
   Metadata(
     const std::string& typeName,
     Operation::Index index,
     Operation::Specification specification,
-    std::function<std::shared_ptr<smtk::operation::Operation>(void)> createFunctor);
+    std::function<std::shared_ptr<smtk::operation::Operation>(void)> createFunctor,
+    SpecificationFactory specificationFactory = nullptr);
 
   const std::string& typeName() const { return m_typeName; }
   const Operation::Index& index() const { return m_index; }
+
+  /// Return the operation's specification template.
+  ///
+  /// The template is shared by all users of the metadata and should be
+  /// treated as read-only; operation instances create their parameters and
+  /// results in specifications obtained from acquireSpecification().
   Operation::Specification specification() const { return m_specification; }
+
+  /// A functor that returns a specification to the pool it was acquired from.
+  using SpecificationReleaser = std::function<void(const Operation::Specification&)>;
+
+  /**\brief Return a specification for the exclusive use of one operation instance.
+    *
+    * Specifications are pooled: those released by destroyed operations are
+    * handed out again and new ones are built (by the metadata's specification
+    * factory or by copying the template) only when none is free. Since
+    * concurrently-running instances of an operation type do not share a
+    * specification, creating their parameters and results does not contend
+    * on a shared specification lock.
+    *
+    * The operation must pass the specification to \a releaser once it has
+    * removed its parameters and results.
+    */
+  Operation::Specification acquireSpecification(SpecificationReleaser& releaser) const;
   bool acceptsComponent(const smtk::resource::ComponentPtr& c) const
   {
     return m_acceptsComponent(c);
@@ -75,11 +109,14 @@ public:
   std::function<std::shared_ptr<smtk::operation::Operation>(void)> create;
 
 private:
+  struct SpecificationPool;
+
   std::string m_typeName;
   Operation::Index m_index;
   Operation::Specification m_specification;
   std::function<bool(const smtk::resource::ComponentPtr&)> m_acceptsComponent;
   Association m_primaryAssociation;
+  std::shared_ptr<SpecificationPool> m_specificationPool;
 };
 } // namespace operation
 } // namespace smtk
@@ -31,8 +31,10 @@
 
 #include "nlohmann/json.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <memory>
-#include <mutex>
 #include <sstream>
 
 namespace
@@ -42,6 +44,91 @@ namespace
 // used to create that name. Its value is irrelevant so we don't need to reset
 // it; its uniqueness is what we are after.
 std::atomic<std::size_t> g_uniqueCounter{ 0 };
+
+// Acquire (and release) the locks on every resource an operation accesses.
+//
+// Resources are always locked in order of their UUIDs. Since every operation
+// acquires its locks in the same global order, no two operations can each hold
+// a lock the other is waiting on; this prevents deadlock without serializing
+// lock acquisition behind a global mutex, so operations on disjoint resources
+// lock (and run) concurrently.
+class ResourceLocks
+{
+public:
+  ResourceLocks(const smtk::operation::ResourceAccessMap& resourcesAndLockTypes)
+  {
+    m_resources.reserve(resourcesAndLockTypes.size());
+    for (const auto& resourceAndLockType : resourcesAndLockTypes)
+    {
+      auto resource = resourceAndLockType.first.lock();
+      if (resource && resourceAndLockType.second != smtk::resource::LockType::DoNotLock)
+      {
+        m_resources.emplace_back(resource, resourceAndLockType.second);
+      }
+    }
+    std::sort(
+      m_resources.begin(),
+      m_resources.end(),
+      [](const Entry& a, const Entry& b) { return a.first->id() < b.first->id(); });
+  }
+
+  ~ResourceLocks() { this->release(); }
+
+  /// Block until all locks are held, accumulating the time spent waiting.
+  bool acquire(std::chrono::nanoseconds& waitTime)
+  {
+    auto start = std::chrono::steady_clock::now();
+    for (; m_numberLocked < m_resources.size(); ++m_numberLocked)
+    {
+      auto& entry = m_resources[m_numberLocked];
+      entry.first->lock({}).lock(entry.second);
+    }
+    waitTime = std::chrono::steady_clock::now() - start;
+    return true;
+  }
+
+  /// Attempt to hold all locks by \a deadline. On failure, any locks already
+  /// acquired are released.
+  bool acquire(
+    const std::chrono::steady_clock::time_point& deadline,
+    std::chrono::nanoseconds& waitTime)
+  {
+    auto start = std::chrono::steady_clock::now();
+    for (; m_numberLocked < m_resources.size(); ++m_numberLocked)
+    {
+      auto& entry = m_resources[m_numberLocked];
+      if (!entry.first->lock({}).tryLockUntil(entry.second, deadline))
+      {
+        m_blocker = entry.first->name();
+        this->release();
+        waitTime = std::chrono::steady_clock::now() - start;
+        return false;
+      }
+    }
+    waitTime = std::chrono::steady_clock::now() - start;
+    return true;
+  }
+
+  /// Release held locks in the reverse order of their acquisition.
+  void release()
+  {
+    while (m_numberLocked > 0)
+    {
+      --m_numberLocked;
+      auto& entry = m_resources[m_numberLocked];
+      entry.first->lock({}).unlock(entry.second);
+    }
+  }
+
+  /// The name of the resource whose lock could not be acquired.
+  const std::string& blocker() const { return m_blocker; }
+
+private:
+  using Entry = std::pair<smtk::resource::ResourcePtr, smtk::resource::LockType>;
+  std::vector<Entry> m_resources;
+  std::size_t m_numberLocked{ 0 };
+  std::string m_blocker;
+};
 } // namespace
 
 namespace smtk
@@ -61,27 +148,35 @@ Operation::~Operation()
   // If the specification exists...
   if (m_specification != nullptr)
   {
-    smtk::resource::ScopedLockGuard lock(
-      m_specification->lock({}), smtk::resource::LockType::Write);
-
-    // ...and if the parameters have been generated, remove the parameters from
-    // the specification.
-    if (m_parameters != nullptr)
     {
-      m_specification->removeAttribute(m_parameters);
-    }
+      smtk::resource::ScopedLockGuard lock(
+        m_specification->lock({}), smtk::resource::LockType::Write);
 
-    // Similarly, remove all results from the specification that were generated
-    // by this operation.
-    for (auto& result : m_results)
-    {
-      auto res = result.lock();
-      if (!res)
+      // ...and if the parameters have been generated, remove the parameters from
+      // the specification.
+      if (m_parameters != nullptr)
       {
-        continue;
+        m_specification->removeAttribute(m_parameters);
       }
 
-      m_specification->removeAttribute(res);
+      // Similarly, remove all results from the specification that were generated
+      // by this operation.
+      for (auto& result : m_results)
+      {
+        auto res = result.lock();
+        if (!res)
+        {
+          continue;
+        }
+
+        m_specification->removeAttribute(res);
+      }
+    }
+
+    // Return a pooled specification so another instance may reuse it.
+    if (m_releaseSpecification)
+    {
+      m_releaseSpecification(m_specification);
     }
   }
 }
@@ -100,7 +195,10 @@ Operation::Specification Operation::specification()
       // has a metadata instance for its type. Let's check anyway.
       assert(metadata != manager->metadata().get<IndexTag>().end());
 
-      m_specification = metadata->specification();
+      // Each instance gets a specification of its own (drawn from a pool kept
+      // by the metadata) so that instances of the same operation type do not
+      // serialize on a shared specification's lock.
+      m_specification = metadata->acquireSpecification(m_releaseSpecification);
     }
     else
     {
@@ -125,45 +223,21 @@ bool Operation::ableToOperate()
 
 Operation::Result Operation::operate()
 {
-  // Gather all requested resources and their lock types.
-  auto resourcesAndLockTypes = extractResourcesAndLockTypes(this->parameters());
-
-  // Mutex to prevent multiple Operations from locking resources at the same
-  // time (which could result in deadlock).
-  static std::mutex mutex;
-
-  // Lock the resources.
-  mutex.lock();
-  for (auto& resourceAndLockType : resourcesAndLockTypes)
+  // Gather all requested resources and their lock types, then lock them.
+  ResourceLocks locks(extractResourcesAndLockTypes(this->parameters()));
+  bool locked = m_lockTimeout < std::chrono::milliseconds::zero()
+    ? locks.acquire(m_lockWaitTime)
+    : locks.acquire(std::chrono::steady_clock::now() + m_lockTimeout, m_lockWaitTime);
+  if (!locked)
   {
-    auto resource = resourceAndLockType.first.lock();
-    auto& lockType = resourceAndLockType.second;
-
-// Leave this for debugging, but do not include it in every debug build
-// as it can be quite noisy.
-#if 0
-    // Given the puzzling result of deadlock that can arise if one Operation
-    // calls another Operation using its public API and passes it a Resource
-    // with a Write LockType, we print to the terminal which resources we are
-    // locking. If you are working on an Operation and are trying to debug a
-    // deadlock, consider calling operations using the following syntax:
-    // $
-    // $ op->operate(Key());
-    // $
-    // This will avoid the inner Operation's resource locking and execute it
-    // directly. Be sure to verify the operation's validity prior to execution
-    // (via the ableToOperate() method).
-    std::cout << "Operation \"" << this->typeName() << "\" is locking resource " << resource->name()
-              << " (" << resource->typeName() << ") with lock type \""
-              << (lockType == smtk::resource::LockType::Read
-                     ? "Read"
-                     : (lockType == smtk::resource::LockType::Write ? "Write" : "DoNotLock"))
-              << "\"\n";
-#endif
-
-    resource->lock({}).lock(lockType);
+    smtkErrorMacro(
+      this->log(),
+      "Operation \"" << this->typeName() << "\" timed out waiting to lock resource \""
+                     << locks.blocker() << "\".");
+    Result result = this->createResult(Outcome::UNABLE_TO_OPERATE);
+    this->generateSummary(result);
+    return result;
   }
-  mutex.unlock();
 
   // Remember where the log was so we only serialize messages for this
   // operation:
@@ -252,13 +326,7 @@ Operation::Result Operation::operate()
   }
 
   // Unlock the resources.
-  for (auto& resourceAndLockType : resourcesAndLockTypes)
-  {
-    auto resource = resourceAndLockType.first.lock();
-    auto& lockType = resourceAndLockType.second;
-
-    resource->lock({}).unlock(lockType);
-  }
+  locks.release();
 
   return result;
 }
@@ -14,6 +14,8 @@
 #include "smtk/PublicPointerDefs.h"
 #include "smtk/SharedFromThis.h"
 
+#include <chrono>
+#include <functional>
 #include <string>
 #include <typeindex>
 #include <utility>
@@ -33,6 +35,7 @@ namespace operation
 {
 class ImportPythonOperation;
 class Manager;
+class Transaction;
 
 /// Operation is a base class for all SMTK operations. SMTK operations are
 /// essentially functors that operate on SMTK resources and resource components.
@@ -76,6 +79,7 @@ public:
 
   friend Manager;
   friend ImportPythonOperation;
+  friend Transaction;
 
   virtual ~Operation();
 
@@ -157,6 +161,18 @@ public:
   /// retrieve the resource manager, if available.
   smtk::resource::ManagerPtr resourceManager();
 
+  /// Set how long operate() may wait to acquire the locks on its resources.
+  ///
+  /// A negative timeout (the default) waits indefinitely. Otherwise, if the
+  /// locks cannot all be acquired within \a timeout (zero means "only if they
+  /// are immediately available"), operate() releases any locks it holds and
+  /// returns a result whose outcome is UNABLE_TO_OPERATE.
+  void setLockTimeout(std::chrono::milliseconds timeout) { m_lockTimeout = timeout; }
+  std::chrono::milliseconds lockTimeout() const { return m_lockTimeout; }
+
+  /// The time the most recent call to operate() spent acquiring resource locks.
+  std::chrono::nanoseconds lockWaitTime() const { return m_lockWaitTime; }
+
 protected:
   Operation();
 
@@ -185,6 +201,8 @@ protected:
   Specification createBaseSpecification() const;
 
   int m_debugLevel{ 0 };
+  std::chrono::milliseconds m_lockTimeout{ -1 };
+  std::chrono::nanoseconds m_lockWaitTime{ 0 };
   std::weak_ptr<Manager> m_manager;
   std::shared_ptr<smtk::common::Managers> m_managers;
 
@@ -212,6 +230,7 @@ private:
   virtual Specification createSpecification() = 0;
 
   Specification m_specification;
+  std::function<void(const Specification&)> m_releaseSpecification;
   Parameters m_parameters;
   Definition m_resultDefinition;
   std::vector<std::weak_ptr<smtk::attribute::Attribute>> m_results;
@@ -9,6 +9,8 @@
 //=========================================================================
 #include "smtk/operation/SpecificationOps.h"
 
+#include "smtk/operation/ChangeSet.h"
+
 #include "smtk/attribute/Attribute.h"
 #include "smtk/attribute/ComponentItem.h"
 #include "smtk/attribute/Definition.h"
@@ -242,6 +244,18 @@ extractResources(Operation::Result result)
     resources.insert(resourceAndLockType.first);
   }
 
+  // Also include the resources whose objects were reported in a change set.
+  if (auto changeSet = ChangeSet::get(result))
+  {
+    for (const auto& entry : changeSet->changes())
+    {
+      if (entry.second.resource)
+      {
+        resources.insert(entry.second.resource);
+      }
+    }
+  }
+
   return resources;
 }
 
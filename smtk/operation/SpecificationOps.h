@@ -66,7 +66,8 @@ Operation::Definition extractResultDefinition(
   Operation::Specification specification,
   const std::string& operatorName);
 
-/// Construct a set of all of the resources referenced in the result.
+/// Construct a set of all of the resources referenced in the result (including
+/// those whose objects are recorded in its ChangeSet).
 SMTKCORE_EXPORT
 std::set<
   std::weak_ptr<smtk::resource::Resource>,
@@ -0,0 +1,302 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/operation/Subscriptions.h"
+
+#include "smtk/operation/ChangeSet.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/ReferenceItem.h"
+
+#include "smtk/resource/Component.h"
+#include "smtk/resource/Resource.h"
+
+#include <set>
+
+namespace smtk
+{
+namespace operation
+{
+
+template<typename TopicType>
+Subscriptions::Key Subscriptions::subscribe(
+  Topics<TopicType>& topics,
+  const TopicType& topic,
+  Observer&& fn,
+  std::string&& description,
+  Priority priority)
+{
+  Observers* observers;
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto& entry = topics[topic];
+    if (!entry)
+    {
+      entry.reset(new Observers);
+      entry->setTimingEnabled(m_timingEnabled);
+    }
+    observers = entry.get();
+  }
+  return observers->insert(std::move(fn), priority, false, std::move(description));
+}
+
+template<typename TopicType>
+Observers* Subscriptions::find(const Topics<TopicType>& topics, const TopicType& topic) const
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  auto entry = topics.find(topic);
+  return entry == topics.end() || entry->second->size() == 0 ? nullptr : entry->second.get();
+}
+
+Subscriptions::Key Subscriptions::subscribeToOperation(
+  const Operation::Index& index,
+  Observer fn,
+  std::string description,
+  Priority priority)
+{
+  return this->subscribe(m_operations, index, std::move(fn), std::move(description), priority);
+}
+
+Subscriptions::Key Subscriptions::subscribeToResource(
+  const smtk::common::UUID& resourceId,
+  Observer fn,
+  std::string description,
+  Priority priority)
+{
+  return this->subscribe(m_resources, resourceId, std::move(fn), std::move(description), priority);
+}
+
+Subscriptions::Key Subscriptions::subscribeToComponentType(
+  const std::string& resourceTypeName,
+  const std::string& componentTypeName,
+  Observer fn,
+  std::string description,
+  Priority priority)
+{
+  Topics<std::string>* topics;
+  {
+    // References to the values of an unordered_map remain valid as it grows.
+    std::unique_lock<std::mutex> lock(m_mutex);
+    topics = &m_componentTypes[resourceTypeName];
+  }
+  return this->subscribe(
+    *topics, componentTypeName, std::move(fn), std::move(description), priority);
+}
+
+Subscriptions::ComponentTopics Subscriptions::componentTopics(
+  const smtk::resource::Resource& resource) const
+{
+  ComponentTopics result;
+  std::unique_lock<std::mutex> lock(m_mutex);
+  for (const auto& resourceType : m_componentTypes)
+  {
+    if (resource.isOfType(resourceType.first))
+    {
+      for (const auto& entry : resourceType.second)
+      {
+        if (entry.second->size() > 0)
+        {
+          result.insert(std::make_pair(entry.first, entry.second.get()));
+        }
+      }
+    }
+  }
+  return result;
+}
+
+int Subscriptions::operator()(const Operation& op, EventType event, Operation::Result result)
+{
+  int status = 0;
+  if (Observers* observers = this->find(m_operations, op.index()))
+  {
+    status |= (*observers)(op, event, result);
+  }
+
+  if (event != EventType::DID_OPERATE || !result)
+  {
+    return status;
+  }
+
+  bool resourceTopics;
+  bool componentTopics;
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    resourceTopics = !m_resources.empty();
+    componentTopics = !m_componentTypes.empty();
+  }
+  if (!resourceTopics && !componentTopics)
+  {
+    return status;
+  }
+
+  // The component-type topics that remain unmatched for each resource the
+  // result refers to. Components are only resolved for resources with
+  // unmatched topics, and topics are removed as they are matched.
+  std::unordered_map<smtk::common::UUID, ComponentTopics> unmatched;
+  auto unmatchedFor = [this, &unmatched](const smtk::resource::Resource& resource) {
+    auto entry = unmatched.find(resource.id());
+    if (entry == unmatched.end())
+    {
+      entry =
+        unmatched.insert(std::make_pair(resource.id(), this->componentTopics(resource))).first;
+    }
+    return &entry->second;
+  };
+  std::set<Observers*> matched;
+  std::vector<Observers*> componentObservers;
+  auto match = [&matched, &componentObservers](
+                 ComponentTopics& topics, const smtk::resource::Component& component) {
+    auto range = topics.equal_range(component.typeName());
+    for (auto topic = range.first; topic != range.second; ++topic)
+    {
+      if (matched.insert(topic->second).second)
+      {
+        componentObservers.push_back(topic->second);
+      }
+    }
+    topics.erase(range.first, range.second);
+  };
+
+  // Gather the resources and component types that the result refers to.
+  // Created, modified and expunged objects are reported by the change set.
+  std::set<smtk::common::UUID> resourceIds;
+  auto changes = ChangeSet::of(result);
+  for (const auto& entry : changes->changes())
+  {
+    const auto& resourceChanges = entry.second;
+    if (!resourceChanges.resource)
+    {
+      continue;
+    }
+    if (resourceTopics)
+    {
+      resourceIds.insert(resourceChanges.resource->id());
+    }
+    if (!componentTopics)
+    {
+      continue;
+    }
+    ComponentTopics* topics = unmatchedFor(*resourceChanges.resource);
+    for (const auto& ids : resourceChanges.ids)
+    {
+      for (auto id = ids.begin(); id != ids.end() && !topics->empty(); ++id)
+      {
+        auto component =
+          std::dynamic_pointer_cast<smtk::resource::Component>(resourceChanges.object(*id));
+        if (component)
+        {
+          match(*topics, *component);
+        }
+      }
+    }
+  }
+
+  for (std::size_t ii = 0; ii < result->numberOfItems(); ++ii)
+  {
+    auto item = std::dynamic_pointer_cast<smtk::attribute::ReferenceItem>(
+      result->item(static_cast<int>(ii)));
+    if (
+      !item || item->name() == "created" || item->name() == "modified" ||
+      item->name() == "expunged")
+    {
+      continue;
+    }
+    for (std::size_t jj = 0; jj < item->numberOfValues(); ++jj)
+    {
+      auto object = item->value(jj);
+      if (auto component = std::dynamic_pointer_cast<smtk::resource::Component>(object))
+      {
+        auto resource = component->resource();
+        if (!resource)
+        {
+          continue;
+        }
+        if (resourceTopics)
+        {
+          resourceIds.insert(resource->id());
+        }
+        if (componentTopics)
+        {
+          ComponentTopics* topics = unmatchedFor(*resource);
+          if (!topics->empty())
+          {
+            match(*topics, *component);
+          }
+        }
+      }
+      else if (object && resourceTopics)
+      {
+        resourceIds.insert(object->id());
+      }
+    }
+  }
+
+  for (const auto& resourceId : resourceIds)
+  {
+    if (Observers* observers = this->find(m_resources, resourceId))
+    {
+      status |= (*observers)(op, event, result);
+    }
+  }
+  for (Observers* observers : componentObservers)
+  {
+    status |= (*observers)(op, event, result);
+  }
+  return status;
+}
+
+void Subscriptions::setTimingEnabled(bool enabled)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_timingEnabled = enabled;
+  for (auto& entry : m_operations)
+  {
+    entry.second->setTimingEnabled(enabled);
+  }
+  for (auto& entry : m_resources)
+  {
+    entry.second->setTimingEnabled(enabled);
+  }
+  for (auto& resourceType : m_componentTypes)
+  {
+    for (auto& entry : resourceType.second)
+    {
+      entry.second->setTimingEnabled(enabled);
+    }
+  }
+}
+
+std::vector<std::pair<std::string, Subscriptions::Timing>> Subscriptions::timings() const
+{
+  std::vector<std::pair<std::string, Timing>> result;
+  auto append = [&result](const Observers& observers) {
+    auto timings = observers.timings();
+    result.insert(result.end(), timings.begin(), timings.end());
+  };
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  for (const auto& entry : m_operations)
+  {
+    append(*entry.second);
+  }
+  for (const auto& entry : m_resources)
+  {
+    append(*entry.second);
+  }
+  for (const auto& resourceType : m_componentTypes)
+  {
+    for (const auto& entry : resourceType.second)
+    {
+      append(*entry.second);
+    }
+  }
+  return result;
+}
+} // namespace operation
+} // namespace smtk
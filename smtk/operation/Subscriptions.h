@@ -0,0 +1,159 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_operation_Subscriptions_h
+#define smtk_operation_Subscriptions_h
+
+#include "smtk/CoreExports.h"
+
+#include "smtk/common/TypeName.h"
+#include "smtk/common/UUID.h"
+
+#include "smtk/operation/Observer.h"
+#include "smtk/operation/Operation.h"
+
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace smtk
+{
+namespace operation
+{
+/**\brief Operation observers that are only called for the events they are interested in.
+  *
+  * Observers added to an operation Manager's observers() are called for every
+  * operation event. Subscribers instead register interest in a type of
+  * operation, in a resource, or in a type of component, and the Manager's
+  * Subscriptions call them only for matching events:
+  *
+  * + operation subscribers are called for both events of operations of their type;
+  * + resource subscribers are called when an operation's result refers to
+  *   their resource or to one of its components (e.g., as a created,
+  *   modified or expunged component, or through its ChangeSet);
+  * + component-type subscribers are called when an operation's result
+  *   refers to a component of their type held by a resource of their
+  *   resource type.
+  *
+  * Subscribers are located through hashed indices, so the cost of an event
+  * depends upon the number of interested subscribers rather than upon the
+  * total number of subscribers. Component-type subscriptions are indexed by
+  * resource type, so only the changed components of resources that some
+  * subscriber is interested in are resolved. Each subscription is called at most once per event.
+  * Subscriptions are dispatched by a single lowest-priority observer of the
+  * Manager, so subscribers are called after the Manager's observers with
+  * higher priorities. Priorities order the subscribers to a single topic.
+  */
+class SMTKCORE_EXPORT Subscriptions
+{
+public:
+  using Key = Observers::Key;
+  using Priority = Observers::Priority;
+  using Timing = Observers::Timing;
+
+  Subscriptions() = default;
+  Subscriptions(const Subscriptions&) = delete;
+  Subscriptions& operator=(const Subscriptions&) = delete;
+
+  /// Subscribe to events of operations with the given type index.
+  Key subscribeToOperation(
+    const Operation::Index& index,
+    Observer fn,
+    std::string description = "",
+    Priority priority = std::numeric_limits<Priority>::lowest());
+  template<typename OperationType>
+  Key subscribeToOperation(
+    Observer fn,
+    std::string description = "",
+    Priority priority = std::numeric_limits<Priority>::lowest())
+  {
+    return this->subscribeToOperation(
+      std::type_index(typeid(OperationType)).hash_code(), fn, description, priority);
+  }
+
+  /// Subscribe to results that refer to the resource with the given id.
+  Key subscribeToResource(
+    const smtk::common::UUID& resourceId,
+    Observer fn,
+    std::string description = "",
+    Priority priority = std::numeric_limits<Priority>::lowest());
+
+  /// Subscribe to results that refer to components with the given type name
+  /// held by resources of the given type (or of a type derived from it).
+  Key subscribeToComponentType(
+    const std::string& resourceTypeName,
+    const std::string& componentTypeName,
+    Observer fn,
+    std::string description = "",
+    Priority priority = std::numeric_limits<Priority>::lowest());
+  template<typename ResourceType, typename ComponentType>
+  Key subscribeToComponentType(
+    Observer fn,
+    std::string description = "",
+    Priority priority = std::numeric_limits<Priority>::lowest())
+  {
+    return this->subscribeToComponentType(
+      smtk::common::typeName<ResourceType>(),
+      smtk::common::typeName<ComponentType>(),
+      fn,
+      description,
+      priority);
+  }
+
+  /// Call the subscribers interested in an event. For WILL_OPERATE events, a
+  /// non-zero return value cancels the operation.
+  int operator()(const Operation& op, EventType event, Operation::Result result);
+
+  /// Measure the time spent in each subscriber (see Observers::setTimingEnabled()).
+  void setTimingEnabled(bool enabled);
+  bool timingEnabled() const { return m_timingEnabled; }
+
+  /// Return the description and timing of each subscriber that has been
+  /// called since timing was enabled.
+  std::vector<std::pair<std::string, Timing>> timings() const;
+
+private:
+  template<typename TopicType>
+  using Topics = std::unordered_map<TopicType, std::unique_ptr<Observers>>;
+
+  template<typename TopicType>
+  Key subscribe(
+    Topics<TopicType>& topics,
+    const TopicType& topic,
+    Observer&& fn,
+    std::string&& description,
+    Priority priority);
+
+  template<typename TopicType>
+  Observers* find(const Topics<TopicType>& topics, const TopicType& topic) const;
+
+  // Component type names mapped to the topics (of every resource type that
+  // \a resource is an instance of) interested in them.
+  using ComponentTopics = std::unordered_multimap<std::string, Observers*>;
+  ComponentTopics componentTopics(const smtk::resource::Resource& resource) const;
+
+  // Topics are only ever added, so the Observers they hold may be called
+  // without holding the mutex (which only guards the indices themselves).
+  mutable std::mutex m_mutex;
+  Topics<Operation::Index> m_operations;
+  Topics<smtk::common::UUID> m_resources;
+  // Component type names indexed by the type name of the resources holding them.
+  std::unordered_map<std::string, Topics<std::string>> m_componentTypes;
+  bool m_timingEnabled{ false };
+};
+} // namespace operation
+} // namespace smtk
+
+#endif // smtk_operation_Subscriptions_h
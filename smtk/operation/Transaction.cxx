@@ -0,0 +1,295 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/operation/Transaction.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/ComponentItem.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/Resource.h"
+#include "smtk/attribute/ResourceItem.h"
+#include "smtk/attribute/ResourceItemDefinition.h"
+
+#include "smtk/io/Logger.h"
+
+#include "smtk/resource/Component.h"
+
+#include <set>
+
+namespace smtk
+{
+namespace operation
+{
+
+bool Transaction::add(const Operation::Ptr& operation, Undo undo)
+{
+  if (!operation || operation.get() == this)
+  {
+    return false;
+  }
+  m_steps.push_back({ operation, std::move(undo), nullptr });
+
+  // Extend the transaction's parameters so that operate() locks the union of
+  // the resources accessed by its operations (with the strongest lock type
+  // each is accessed with). Each resource is appended at most once per lock
+  // type.
+  for (const auto& access : extractResourcesAndLockTypes(operation->parameters()))
+  {
+    auto resource = access.first.lock();
+    if (!resource || access.second == smtk::resource::LockType::DoNotLock)
+    {
+      continue;
+    }
+    auto known = m_access.find(access.first);
+    if (known != m_access.end() && known->second >= access.second)
+    {
+      continue;
+    }
+    m_access[access.first] = access.second;
+    this->parameters()
+      ->findResource(access.second == smtk::resource::LockType::Write ? "write" : "read")
+      ->appendValue(resource);
+  }
+  return true;
+}
+
+std::vector<Operation::Ptr> Transaction::operations() const
+{
+  std::vector<Operation::Ptr> result;
+  result.reserve(m_steps.size());
+  for (const auto& step : m_steps)
+  {
+    result.push_back(step.operation);
+  }
+  return result;
+}
+
+void Transaction::clear()
+{
+  m_steps.clear();
+  m_access.clear();
+  this->parameters()->findResource("read")->reset();
+  this->parameters()->findResource("write")->reset();
+}
+
+std::vector<Operation::Result> Transaction::results() const
+{
+  std::vector<Result> result;
+  for (const auto& step : m_steps)
+  {
+    if (step.result)
+    {
+      result.push_back(step.result);
+    }
+  }
+  return result;
+}
+
+Transaction::Result Transaction::operateInternal()
+{
+  m_rolledBack = false;
+  for (auto& step : m_steps)
+  {
+    step.result = nullptr;
+  }
+
+  // The locks held are those computed as operations were added. Refuse to
+  // run if an operation has since been configured to access a resource
+  // that is not locked (or is locked for reading but must be written).
+  for (const auto& step : m_steps)
+  {
+    for (const auto& access : extractResourcesAndLockTypes(step.operation->parameters()))
+    {
+      if (access.first.expired() || access.second == smtk::resource::LockType::DoNotLock)
+      {
+        continue;
+      }
+      auto held = m_access.find(access.first);
+      if (held == m_access.end() || held->second < access.second)
+      {
+        smtkErrorMacro(
+          this->log(),
+          "Operation \"" << step.operation->typeName()
+                         << "\" accesses a resource the transaction does not lock; "
+                            "configure operations before adding them.");
+        return this->createResult(Outcome::FAILED);
+      }
+    }
+  }
+
+  Result result = this->createResult(Outcome::SUCCEEDED);
+  // Fold in the (still empty) result items now; they are filled from the
+  // change set below and must not be folded into it again by consumers.
+  ChangeSet& changes = *ChangeSet::of(result);
+  auto resourcesItem = result->findResource("resources");
+  std::set<smtk::resource::ResourcePtr> resources;
+
+  // Run each operation as Operation::operate() would, minus the locking and
+  // observation that the transaction performs once for all of them.
+  bool failed = false;
+  for (auto& step : m_steps)
+  {
+    Operation& operation = *step.operation;
+    if (!operation.ableToOperate())
+    {
+      smtkErrorMacro(
+        this->log(), "Operation \"" << operation.typeName() << "\" is unable to operate.");
+      failed = true;
+      break;
+    }
+
+    smtk::attribute::IntItem::Ptr debugItem = operation.parameters()->findInt("debug level");
+    operation.m_debugLevel = ((debugItem && debugItem->isEnabled()) ? debugItem->value() : 0);
+
+    step.result = operation.operateInternal();
+    auto outcome = static_cast<Outcome>(step.result->findInt("outcome")->value());
+    if (outcome == Outcome::SUCCEEDED)
+    {
+      operation.postProcessResult(step.result);
+    }
+    if (outcome == Outcome::SUCCEEDED || outcome == Outcome::FAILED)
+    {
+      operation.markModifiedResources(step.result);
+    }
+
+    // Aggregate the operation's changes and the resources its result lists
+    // (so that, e.g., created resources are added to the resource manager).
+    changes.merge(*ChangeSet::of(step.result));
+    std::vector<smtk::attribute::ResourceItemPtr> resourceItems;
+    step.result->filterItems(
+      resourceItems, [](smtk::attribute::ResourceItemPtr /*unused*/) { return true; });
+    for (const auto& item : resourceItems)
+    {
+      if (item->name() == "resourcesToExpunge")
+      {
+        continue;
+      }
+      for (std::size_t ii = 0; ii < item->numberOfValues(); ++ii)
+      {
+        auto resource = item->isSet(ii) ? item->value(ii) : nullptr;
+        if (resource && resources.insert(resource).second)
+        {
+          resourcesItem->appendValue(resource);
+        }
+      }
+    }
+
+    if (outcome != Outcome::SUCCEEDED)
+    {
+      smtkErrorMacro(this->log(), "Operation \"" << operation.typeName() << "\" did not succeed.");
+      failed = true;
+      break;
+    }
+  }
+
+  if (failed && m_rollbackOnFailure)
+  {
+    bool undone = true;
+    for (auto step = m_steps.rbegin(); step != m_steps.rend(); ++step)
+    {
+      if (
+        !step->result ||
+        step->result->findInt("outcome")->value() != static_cast<int>(Outcome::SUCCEEDED))
+      {
+        continue;
+      }
+      if (!step->undo)
+      {
+        smtkErrorMacro(
+          this->log(),
+          "Operation \"" << step->operation->typeName() << "\" cannot be rolled back.");
+        undone = false;
+      }
+      else if (!step->undo(step->result, changes))
+      {
+        smtkErrorMacro(
+          this->log(),
+          "Operation \"" << step->operation->typeName() << "\" failed to roll back.");
+        undone = false;
+      }
+    }
+    m_rolledBack = undone;
+    if (undone)
+    {
+      resourcesItem->reset();
+    }
+  }
+
+  // The result's items remain the authoritative record of changes for most
+  // consumers, so report the aggregated changes through them as well.
+  changes.compact();
+  const char* const itemNames[] = { "created", "modified", "expunged" };
+  for (int kind = 0; kind < 3; ++kind)
+  {
+    std::vector<smtk::resource::ComponentPtr> components;
+    for (const auto& entry : changes.changes())
+    {
+      for (const auto& id : entry.second[static_cast<ChangeSet::Kind>(kind)])
+      {
+        auto component =
+          std::dynamic_pointer_cast<smtk::resource::Component>(entry.second.object(id));
+        if (component)
+        {
+          components.push_back(component);
+        }
+      }
+    }
+    result->findComponent(itemNames[kind])->appendValues(components.begin(), components.end());
+  }
+
+  result->findInt("outcome")->setValue(
+    static_cast<int>(failed ? Outcome::FAILED : Outcome::SUCCEEDED));
+  return result;
+}
+
+bool Transaction::unmanageResources(Result& /*unused*/)
+{
+  if (m_rolledBack)
+  {
+    return true;
+  }
+  bool removed = true;
+  for (auto& step : m_steps)
+  {
+    if (step.result)
+    {
+      removed &= step.operation->unmanageResources(step.result);
+    }
+  }
+  return removed;
+}
+
+Transaction::Specification Transaction::createSpecification()
+{
+  Specification spec = this->createBaseSpecification();
+
+  auto opDef = spec->createDefinition("transaction", "operation");
+  for (auto lockType : { smtk::resource::LockType::Read, smtk::resource::LockType::Write })
+  {
+    auto resourcesDef = smtk::attribute::ResourceItemDefinition::New(
+      lockType == smtk::resource::LockType::Write ? "write" : "read");
+    resourcesDef->setNumberOfRequiredValues(0);
+    resourcesDef->setIsExtensible(true);
+    resourcesDef->setLockType(lockType);
+    resourcesDef->setHoldReference(true);
+    opDef->addItemDefinition(resourcesDef);
+  }
+
+  auto resultDef = spec->createDefinition("result(transaction)", "result");
+  auto resourcesDef = smtk::attribute::ResourceItemDefinition::New("resources");
+  resourcesDef->setNumberOfRequiredValues(0);
+  resourcesDef->setIsExtensible(true);
+  resourcesDef->setHoldReference(true);
+  resultDef->addItemDefinition(resourcesDef);
+
+  return spec;
+}
+} // namespace operation
+} // namespace smtk
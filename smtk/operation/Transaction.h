@@ -0,0 +1,114 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_operation_Transaction_h
+#define smtk_operation_Transaction_h
+
+#include "smtk/operation/ChangeSet.h"
+#include "smtk/operation/Operation.h"
+#include "smtk/operation/SpecificationOps.h"
+
+#include <functional>
+#include <vector>
+
+namespace smtk
+{
+namespace operation
+{
+
+/**\brief Run a sequence of operations as a single operation.
+  *
+  * Each call to Operation::operate() acquires its resource locks, notifies
+  * the manager's observers before and after operating, and releases its
+  * locks. A Transaction runs the operations added to it under a single
+  * acquisition of the union of their locks, and observers are notified once
+  * (with the Transaction as the operation) rather than once per operation.
+  * The operations' changes are merged into the ChangeSet of the
+  * Transaction's result and reported through its "created", "modified" and
+  * "expunged" items, and any resources their results reference are listed
+  * in its "resources" item.
+  *
+  * Since observers are notified only for the Transaction, observers that
+  * filter by operation type (including those added with
+  * Subscriptions::subscribeToOperation<T>()) never see the operations run
+  * inside a transaction.
+  *
+  * Operations run in the order they were added and the Transaction stops
+  * at the first operation that does not succeed, in which case its outcome
+  * is FAILED. If rollback on failure is enabled, the operations that
+  * succeeded are then undone in reverse order by the Undo functors provided
+  * when they were added. Operations added without an Undo functor cannot be
+  * rolled back.
+  *
+  * The resources to lock are determined from each operation's parameters
+  * when it is added, so operations should be configured before they are
+  * added. A Transaction fails without running any of its operations if one
+  * has since been configured to access a resource it does not lock (or to
+  * write one it only locks for reading). Transactions are created with
+  * Manager::createTransaction().
+  */
+class SMTKCORE_EXPORT Transaction : public Operation
+{
+public:
+  smtkTypeMacro(smtk::operation::Transaction);
+  smtkSharedPtrCreateMacro(smtk::operation::Operation);
+  smtkSuperclassMacro(smtk::operation::Operation);
+
+  /// Undo the effects of an operation given its result, recording any
+  /// objects the undo creates, modifies or expunges in \a changes. Return
+  /// true on success.
+  using Undo = std::function<bool(const Operation::Result& result, ChangeSet& changes)>;
+
+  /// Append an operation to the transaction. Return false if the operation
+  /// cannot be added (it is null or is this transaction).
+  bool add(const Operation::Ptr& operation, Undo undo = nullptr);
+
+  /// The operations in the transaction, in the order they run.
+  std::vector<Operation::Ptr> operations() const;
+
+  /// Remove all operations from the transaction.
+  void clear();
+
+  /// Undo the operations that succeeded when a later operation fails.
+  bool rollbackOnFailure() const { return m_rollbackOnFailure; }
+  void setRollbackOnFailure(bool rollback) { m_rollbackOnFailure = rollback; }
+
+  /// The result of each operation that ran during the most recent call to
+  /// operate(), in the order they ran.
+  std::vector<Result> results() const;
+
+  /// True if the most recent call to operate() rolled back its operations.
+  bool rolledBack() const { return m_rolledBack; }
+
+protected:
+  Result operateInternal() override;
+
+  // Un-manage the resources each operation marked for removal (unless the
+  // transaction was rolled back).
+  bool unmanageResources(Result&) override;
+
+private:
+  Specification createSpecification() override;
+
+  struct Step
+  {
+    Operation::Ptr operation;
+    Undo undo;
+    Result result;
+  };
+
+  std::vector<Step> m_steps;
+  ResourceAccessMap m_access;
+  bool m_rollbackOnFailure{ false };
+  bool m_rolledBack{ false };
+};
+} // namespace operation
+} // namespace smtk
+
+#endif // smtk_operation_Transaction_h
@@ -29,6 +29,7 @@
 #include "nlohmann/json.hpp"
 
 #include <fstream>
+#include <sstream>
 
 using json = nlohmann::json;
 
@@ -82,10 +83,21 @@ ReadResource::Result ReadResource::operateInternal()
     // Scope so file is only open for a short time:
     {
       std::ifstream file;
+      std::istringstream index;
+      std::istream* input = &file;
       if (!archive.contents().empty())
       {
         std::string smtkFilename = "index.json";
-        archive.get(smtkFilename, file);
+        std::string contents;
+        if (archive.read(smtkFilename, contents))
+        {
+          index.str(contents);
+        }
+        else
+        {
+          index.setstate(std::ios::failbit);
+        }
+        input = &index;
       }
       else
       {
@@ -93,7 +105,7 @@ ReadResource::Result ReadResource::operateInternal()
       }
 
       {
-        if (!file.good())
+        if (!input->good())
         {
           smtkErrorMacro(this->log(), "Could not open file \"" << filename << "\" for reading.");
           return this->createResult(smtk::operation::Operation::Outcome::FAILED);
@@ -104,7 +116,7 @@ ReadResource::Result ReadResource::operateInternal()
 
         try
         {
-          j = json::parse(file);
+          j = json::parse(*input);
           type = j.at("type").get<std::string>();
           fileTypeKnown = true;
         }
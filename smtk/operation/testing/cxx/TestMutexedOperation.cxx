@@ -274,6 +274,87 @@ WriteOperation::Specification WriteOperation::createSpecification()
 
   return spec;
 }
+
+// The number of SleepOperations currently inside operateInternal().
+std::atomic<int> sleeping(0);
+
+// Hold a write lock on a component's resource for a given time.
+class SleepOperation : public smtk::operation::Operation
+{
+public:
+  smtkTypeMacro(SleepOperation);
+  smtkCreateMacro(SleepOperation);
+  smtkSharedFromThisMacro(smtk::operation::Operation);
+
+  SleepOperation() = default;
+  ~SleepOperation() override = default;
+
+  smtk::io::Logger& log() const override { return m_logger; }
+
+  Result operateInternal() override;
+
+  Specification createSpecification() override;
+
+private:
+  mutable smtk::io::Logger m_logger;
+};
+
+SleepOperation::Result SleepOperation::operateInternal()
+{
+  ++sleeping;
+  int sleep = this->parameters()->findAs<smtk::attribute::IntItem>("sleep")->value();
+  std::this_thread::sleep_for(std::chrono::milliseconds(sleep * 100));
+  --sleeping;
+  return this->createResult(Outcome::SUCCEEDED);
+}
+
+SleepOperation::Specification SleepOperation::createSpecification()
+{
+  Specification spec = smtk::attribute::Resource::create();
+
+  smtk::attribute::DefinitionPtr opDef = spec->createDefinition("operation");
+  opDef->setIsAbstract(true);
+
+  smtk::attribute::DefinitionPtr resDef = spec->createDefinition("result");
+  resDef->setIsAbstract(true);
+
+  smtk::attribute::IntItemDefinitionPtr outcomeDef =
+    smtk::attribute::IntItemDefinition::New("outcome");
+  outcomeDef->setNumberOfRequiredValues(1);
+  resDef->addItemDefinition(outcomeDef);
+
+  smtk::attribute::StringItemDefinitionPtr logDef =
+    smtk::attribute::StringItemDefinition::New("log");
+  logDef->setIsOptional(true);
+  logDef->setNumberOfRequiredValues(0);
+  logDef->setIsExtensible(true);
+  resDef->addItemDefinition(logDef);
+
+  smtk::attribute::DefinitionPtr sleepOpDef = spec->createDefinition("SleepOperation", "operation");
+
+  smtk::attribute::IntItemDefinitionPtr sleepDef = smtk::attribute::IntItemDefinition::New("sleep");
+  sleepDef->setDefaultValue(0);
+  sleepOpDef->addItemDefinition(sleepDef);
+
+  smtk::attribute::ComponentItemDefinitionPtr compDef =
+    smtk::attribute::ComponentItemDefinition::New("component");
+  compDef->setNumberOfRequiredValues(1);
+  compDef->setIsOptional(false);
+  compDef->setLockType(smtk::resource::LockType::Write);
+  sleepOpDef->addItemDefinition(compDef);
+
+  spec->createDefinition("sleep result", "result");
+
+  return spec;
+}
+
+smtk::operation::Operation::Ptr sleepOn(const MyComponent::Ptr& component, int sleepValue)
+{
+  smtk::operation::Operation::Ptr op = SleepOperation::create();
+  op->parameters()->findAs<smtk::attribute::IntItem>("sleep")->setValue(sleepValue);
+  op->parameters()->findAs<smtk::attribute::ComponentItem>("component")->setValue(component);
+  return op;
+}
 } // namespace
 
 int readTest(int sleepValue)
@@ -390,6 +471,71 @@ int writeTest(int sleepValue)
   return 0;
 }
 
+// An operation waiting on a busy resource must not prevent an operation on
+// another resource from acquiring its locks, and operations with a lock
+// timeout must give up rather than wait for a busy resource.
+int disjointTest()
+{
+  auto resource1 = MyResource::create();
+  auto component1 = MyComponent::create();
+  component1->setResource(resource1);
+  auto resource2 = MyResource::create();
+  auto component2 = MyComponent::create();
+  component2->setResource(resource2);
+
+  std::cout << "Disjoint resource test" << std::endl;
+
+  auto holder = sleepOn(component1, 10);
+  std::future<smtk::operation::Operation::Result> held(
+    std::async(std::launch::async, [&]() { return holder->operate(); }));
+  while (sleeping == 0)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  // This operation blocks until the holder releases resource1.
+  auto waiter = sleepOn(component1, 0);
+  std::future<smtk::operation::Operation::Result> waited(
+    std::async(std::launch::async, [&]() { return waiter->operate(); }));
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  // ... but this one should run immediately.
+  auto independent = sleepOn(component2, 0);
+  auto result = independent->operate();
+  smtkTest(
+    result->findInt("outcome")->value() ==
+      static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED),
+    "Operation on an idle resource should succeed.");
+  smtkTest(sleeping == 1, "Operation on an idle resource waited for a busy one.");
+
+  // Lock acquisition with a timeout should give up on the busy resource.
+  auto impatient = sleepOn(component1, 0);
+  impatient->setLockTimeout(std::chrono::milliseconds(50));
+  result = impatient->operate();
+  smtkTest(
+    result->findInt("outcome")->value() ==
+      static_cast<int>(smtk::operation::Operation::Outcome::UNABLE_TO_OPERATE),
+    "Operation should time out waiting for a busy resource.");
+  smtkTest(
+    impatient->lockWaitTime() >= std::chrono::milliseconds(50),
+    "Lock wait time should include the timeout.");
+  smtkTest(sleeping == 1, "Timed out operation should not wait for the busy resource.");
+
+  smtkTest(
+    held.get()->findInt("outcome")->value() ==
+      static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED),
+    "Holding operation should succeed.");
+  smtkTest(
+    waited.get()->findInt("outcome")->value() ==
+      static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED),
+    "Waiting operation should succeed once the resource is free.");
+  smtkTest(
+    waiter->lockWaitTime() > std::chrono::milliseconds(0),
+    "Waiting operation should report time spent waiting for its lock.");
+
+  return 0;
+}
+
 // Test mutexed operations by executing two parallel read operations and two
 // parallel write operations. Each read operation waits for a global semaphore
 // to hold its value, failing after a timeout period, and then switches the
@@ -414,5 +560,8 @@ int TestMutexedOperation(int /*unused*/, char** const /*unused*/)
 
   smtkTest(returnValue == 0, "Mutexed read test failed.");
 
-  return writeTest(sleepValue);
+  returnValue = writeTest(sleepValue);
+  smtkTest(returnValue == 0, "Mutexed write test failed.");
+
+  return disjointTest();
 }
@@ -0,0 +1,145 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/operation/ChangeSet.h"
+#include "smtk/operation/Manager.h"
+#include "smtk/operation/Operation.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/ComponentItem.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/Resource.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <vector>
+
+namespace
+{
+using smtk::operation::ChangeSet;
+
+// Create attributes, reporting them through a change set, and report one
+// modified attribute through the result's "modified" item.
+class CreateAttributes : public smtk::operation::Operation
+{
+public:
+  smtkTypeMacro(CreateAttributes);
+  smtkCreateMacro(CreateAttributes);
+  smtkSharedFromThisMacro(smtk::operation::Operation);
+
+  CreateAttributes() = default;
+  ~CreateAttributes() override = default;
+
+  Result operateInternal() override
+  {
+    auto result = this->createResult(Outcome::SUCCEEDED);
+    auto definition = m_resource->findDefinition("thing");
+    std::vector<smtk::common::UUID> ids;
+    for (int ii = 0; ii < m_count; ++ii)
+    {
+      ids.push_back(m_resource->createAttribute(definition)->id());
+    }
+    ChangeSet::attach(result).insert(ChangeSet::Kind::CREATED, m_resource, ids);
+    if (m_modified)
+    {
+      result->findComponent("modified")->appendValue(m_modified);
+    }
+    return result;
+  }
+
+  Specification createSpecification() override
+  {
+    Specification spec = this->createBaseSpecification();
+    spec->createDefinition("create attributes", "operation");
+    spec->createDefinition("result(create attributes)", "result");
+    return spec;
+  }
+
+  smtk::attribute::ResourcePtr m_resource;
+  smtk::attribute::AttributePtr m_modified;
+  int m_count{ 0 };
+};
+} // namespace
+
+int unitChangeSet(int /*unused*/, char* /*unused*/[])
+{
+  auto resource = smtk::attribute::Resource::create();
+  auto definition = resource->createDefinition("thing");
+  auto existing = resource->createAttribute(definition);
+  resource->setClean(true);
+
+  // Changes reported through change sets and items are both seen by consumers.
+  auto manager = smtk::operation::Manager::create();
+  manager->registerOperation<CreateAttributes>("CreateAttributes");
+  auto op = manager->create<CreateAttributes>();
+  op->m_resource = resource;
+  op->m_modified = existing;
+  op->m_count = 100;
+  auto result = op->operate();
+  smtkTest(
+    result->findInt("outcome")->value() ==
+      static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED),
+    "Operation failed.");
+  smtkTest(!resource->clean(), "Resource in change set was not marked modified.");
+
+  auto changes = ChangeSet::of(result);
+  smtkTest(changes == ChangeSet::get(result), "Change set was not attached.");
+  smtkTest(changes->size(ChangeSet::Kind::CREATED) == 100, "Expected 100 created ids.");
+  smtkTest(changes->size(ChangeSet::Kind::MODIFIED) == 1, "Expected modified item in change set.");
+  smtkTest(changes->changes().size() == 1, "Expected changes to a single resource.");
+  auto created = changes->objects(ChangeSet::Kind::CREATED);
+  smtkTest(created.size() == 100, "Could not resolve created attributes.");
+  smtkTest(
+    changes->objects(ChangeSet::Kind::MODIFIED) ==
+      smtk::resource::PersistentObjectSet({ existing }),
+    "Could not resolve modified attribute.");
+
+  // Components folded in from items are held so they resolve without a lookup.
+  smtkTest(
+    changes->changes().begin()->second.held.count(existing->id()) == 1,
+    "Component folded in from an item was not held.");
+
+  // Items are folded in only once.
+  smtkTest(
+    ChangeSet::of(result)->size(ChangeSet::Kind::MODIFIED) == 1, "Items were folded in twice.");
+
+  // Expunged components are held so that they can be resolved once removed.
+  ChangeSet expunged;
+  auto doomed = std::dynamic_pointer_cast<smtk::attribute::Attribute>(*created.begin());
+  expunged.insert(ChangeSet::Kind::EXPUNGED, doomed);
+  expunged.insert(ChangeSet::Kind::MODIFIED, resource);
+  expunged.insert(ChangeSet::Kind::MODIFIED, existing);
+  resource->removeAttribute(doomed);
+  doomed.reset();
+  smtkTest(
+    expunged.objects(ChangeSet::Kind::EXPUNGED).size() == 1,
+    "Could not resolve expunged attribute.");
+  smtkTest(
+    expunged.objects(ChangeSet::Kind::MODIFIED).count(resource) == 1,
+    "Could not resolve modified resource.");
+
+  // Merged change sets are compacted: objects both created and expunged are
+  // dropped, expunged objects are not modified and created objects are not
+  // modified.
+  ChangeSet merged;
+  merged.merge(*changes);
+  merged.merge(*changes);
+  merged.merge(expunged);
+  smtkTest(merged.size(ChangeSet::Kind::CREATED) == 200, "Expected merge to append.");
+  merged.compact();
+  smtkTest(merged.size(ChangeSet::Kind::CREATED) == 99, "Expected 99 created ids.");
+  smtkTest(merged.size(ChangeSet::Kind::MODIFIED) == 2, "Expected 2 modified ids.");
+  smtkTest(merged.size(ChangeSet::Kind::EXPUNGED) == 0, "Expected no expunged ids.");
+
+  merged.clear();
+  smtkTest(merged.empty(), "Expected an empty change set.");
+
+  return 0;
+}
@@ -193,5 +193,28 @@ int unitOperation(int /*unused*/, char* /*unused*/[])
                    " expected "
                 << (sizeof(expectedObservations) / sizeof(expectedObservations[0])));
 
+  // Managed instances of the same operation type do not share a specification,
+  // and a released specification is reused by the next instance.
+  {
+    auto first = manager->create<TestOp>();
+    auto second = manager->create<TestOp>();
+    smtkTest(first->parameters() && second->parameters(), "Could not create parameters");
+    smtkTest(
+      first->specification() != second->specification(),
+      "Expected concurrent instances to have distinct specifications");
+    auto metadata = manager->metadata().get<smtk::operation::IndexTag>().find(first->index());
+    smtkTest(
+      first->specification() != metadata->specification(),
+      "Expected instances not to modify the specification template");
+
+    auto released = first->specification().get();
+    first.reset();
+    auto third = manager->create<TestOp>();
+    smtkTest(
+      third->specification().get() == released, "Expected a released specification to be reused");
+    smtkTest(
+      third->parameters() != nullptr, "Could not create parameters in a reused specification");
+  }
+
   return 0;
 }
@@ -0,0 +1,199 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/operation/Manager.h"
+#include "smtk/operation/Subscriptions.h"
+#include "smtk/operation/XMLOperation.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/ComponentItem.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/Resource.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+namespace
+{
+class TestOp : public smtk::operation::XMLOperation
+{
+public:
+  smtkTypeMacro(TestOp);
+  smtkCreateMacro(TestOp);
+  smtkSharedFromThisMacro(smtk::operation::Operation);
+
+  TestOp() = default;
+  ~TestOp() override = default;
+
+  Result operateInternal() override
+  {
+    auto result = this->createResult(Outcome::SUCCEEDED);
+    if (m_created)
+    {
+      result->findComponent("created")->appendValue(m_created);
+    }
+    return result;
+  }
+
+  const char* xmlDescription() const override;
+
+  smtk::resource::ComponentPtr m_created;
+};
+
+class OtherOp : public TestOp
+{
+public:
+  smtkTypeMacro(OtherOp);
+  smtkCreateMacro(OtherOp);
+  smtkSharedFromThisMacro(smtk::operation::Operation);
+};
+
+const char testOpXML[] =
+  "<?xml version=\"1.0\" encoding=\"utf-8\" ?>"
+  "<SMTK_AttributeResource Version=\"3\">"
+  "  <Definitions>"
+  "    <AttDef Type=\"operation\" Label=\"operation\" Abstract=\"True\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"debug level\" Optional=\"True\">"
+  "          <DefaultValue>0</DefaultValue>"
+  "        </Int>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"result\" Abstract=\"True\">"
+  "      <ItemDefinitions>"
+  "        <Int Name=\"outcome\" Label=\"outcome\" Optional=\"False\" NumberOfRequiredValues=\"1\">"
+  "        </Int>"
+  "        <Component Name=\"created\" NumberOfRequiredValues=\"0\" Extensible=\"1\"/>"
+  "      </ItemDefinitions>"
+  "    </AttDef>"
+  "    <AttDef Type=\"test op\" BaseType=\"operation\">"
+  "    </AttDef>"
+  "    <AttDef Type=\"result(test op)\" BaseType=\"result\">"
+  "    </AttDef>"
+  "  </Definitions>"
+  "</SMTK_AttributeResource>";
+
+const char* TestOp::xmlDescription() const
+{
+  return testOpXML;
+}
+
+// Count the events seen by a subscriber and optionally cancel operations.
+struct Counter
+{
+  int calls = 0;
+  int cancel = 0;
+
+  smtk::operation::Observer observer()
+  {
+    return [this](
+             const smtk::operation::Operation& /*unused*/,
+             smtk::operation::EventType event,
+             smtk::operation::Operation::Result /*unused*/) -> int {
+      ++this->calls;
+      return event == smtk::operation::EventType::WILL_OPERATE ? this->cancel : 0;
+    };
+  }
+};
+
+bool succeeded(const smtk::operation::Operation::Result& result)
+{
+  return result->findInt("outcome")->value() ==
+    static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED);
+}
+} // namespace
+
+int unitSubscriptions(int /*unused*/, char* /*unused*/[])
+{
+  auto manager = smtk::operation::Manager::create();
+  manager->registerOperation<TestOp>("TestOp");
+  manager->registerOperation<OtherOp>("OtherOp");
+  auto& subscriptions = manager->subscriptions();
+  subscriptions.setTimingEnabled(true);
+
+  auto resource = smtk::attribute::Resource::create();
+  auto other = smtk::attribute::Resource::create();
+  auto attribute = resource->createAttribute(resource->createDefinition("thing"));
+
+  Counter testOps;
+  Counter otherOps;
+  Counter resourceEvents;
+  Counter otherResourceEvents;
+  Counter attributeEvents;
+  Counter baseResourceEvents;
+  Counter otherTypeEvents;
+  auto testOpsKey = subscriptions.subscribeToOperation<TestOp>(testOps.observer(), "test ops");
+  auto otherOpsKey = subscriptions.subscribeToOperation<OtherOp>(otherOps.observer(), "others");
+  auto resourceKey =
+    subscriptions.subscribeToResource(resource->id(), resourceEvents.observer(), "resource");
+  auto otherResourceKey =
+    subscriptions.subscribeToResource(other->id(), otherResourceEvents.observer(), "other");
+  auto attributeKey =
+    subscriptions.subscribeToComponentType<smtk::attribute::Resource, smtk::attribute::Attribute>(
+      attributeEvents.observer(), "attributes");
+  auto baseResourceKey = subscriptions.subscribeToComponentType(
+    smtk::common::typeName<smtk::resource::Resource>(),
+    attribute->typeName(),
+    baseResourceEvents.observer(),
+    "attributes of any resource");
+  auto otherTypeKey = subscriptions.subscribeToComponentType(
+    "smtk::model::Resource", attribute->typeName(), otherTypeEvents.observer(), "model");
+
+  // Operation subscribers see both events of their operations only.
+  auto testOp = manager->create<TestOp>();
+  smtkTest(succeeded(testOp->operate()), "Operation failed.");
+  smtkTest(testOps.calls == 2, "Expected 2 events, got " << testOps.calls << ".");
+  smtkTest(otherOps.calls == 0, "Subscriber called for another operation type.");
+  smtkTest(resourceEvents.calls == 0, "Resource subscriber called for an unrelated result.");
+  smtkTest(attributeEvents.calls == 0, "Component subscriber called for an unrelated result.");
+
+  // Resource and component subscribers see results that refer to them.
+  auto otherOp = manager->create<OtherOp>();
+  otherOp->m_created = attribute;
+  smtkTest(succeeded(otherOp->operate()), "Operation failed.");
+  smtkTest(testOps.calls == 2, "Subscriber called for another operation type.");
+  smtkTest(otherOps.calls == 2, "Expected 2 events, got " << otherOps.calls << ".");
+  smtkTest(resourceEvents.calls == 1, "Expected one resource event.");
+  smtkTest(otherResourceEvents.calls == 0, "Subscriber called for another resource.");
+  smtkTest(attributeEvents.calls == 1, "Expected one component event.");
+  smtkTest(baseResourceEvents.calls == 1, "Expected one event for a base resource type.");
+  smtkTest(otherTypeEvents.calls == 0, "Subscriber called for another resource type.");
+
+  // Subscribers may cancel operations.
+  testOps.cancel = 1;
+  auto result = testOp->operate();
+  smtkTest(
+    result->findInt("outcome")->value() ==
+      static_cast<int>(smtk::operation::Operation::Outcome::CANCELED),
+    "Subscriber could not cancel operation.");
+  testOps.cancel = 0;
+
+  // Timing is gathered per subscriber.
+  bool timed = false;
+  for (const auto& timing : subscriptions.timings())
+  {
+    if (timing.first == "test ops")
+    {
+      timed = true;
+      smtkTest(timing.second.calls == 4, "Expected 4 timed calls, got " << timing.second.calls);
+      smtkTest(timing.second.longest <= timing.second.total, "Inconsistent timing.");
+    }
+  }
+  smtkTest(timed, "No timing was gathered for a subscriber.");
+
+  // Subscriptions end with their keys.
+  {
+    auto released = std::move(resourceKey);
+  }
+  otherOp->operate();
+  smtkTest(resourceEvents.calls == 1, "Subscriber called after its key was destroyed.");
+  smtkTest(attributeEvents.calls == 2, "Expected another component event.");
+
+  return 0;
+}
@@ -0,0 +1,186 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/operation/ChangeSet.h"
+#include "smtk/operation/Manager.h"
+#include "smtk/operation/Transaction.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/ComponentItem.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/Resource.h"
+#include "smtk/attribute/ResourceItem.h"
+#include "smtk/attribute/ResourceItemDefinition.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+namespace
+{
+using smtk::operation::ChangeSet;
+
+// Create an attribute in the "resource" parameter, or fail if asked to.
+class CreateAttribute : public smtk::operation::Operation
+{
+public:
+  smtkTypeMacro(CreateAttribute);
+  smtkCreateMacro(CreateAttribute);
+  smtkSharedFromThisMacro(smtk::operation::Operation);
+
+  CreateAttribute() = default;
+  ~CreateAttribute() override = default;
+
+  Result operateInternal() override
+  {
+    if (m_fail)
+    {
+      return this->createResult(Outcome::FAILED);
+    }
+    auto resource = std::dynamic_pointer_cast<smtk::attribute::Resource>(
+      this->parameters()->findResource("resource")->value());
+    auto attribute = resource->createAttribute(resource->findDefinition("thing"));
+    auto result = this->createResult(Outcome::SUCCEEDED);
+    ChangeSet::attach(result).insert(ChangeSet::Kind::CREATED, attribute);
+    return result;
+  }
+
+  Specification createSpecification() override
+  {
+    Specification spec = this->createBaseSpecification();
+    auto opDef = spec->createDefinition("create attribute", "operation");
+    auto resourceDef = smtk::attribute::ResourceItemDefinition::New("resource");
+    resourceDef->setLockType(smtk::resource::LockType::Write);
+    resourceDef->setHoldReference(true);
+    opDef->addItemDefinition(resourceDef);
+    spec->createDefinition("result(create attribute)", "result");
+    return spec;
+  }
+
+  bool m_fail{ false };
+};
+
+// Remove the attributes an operation created.
+bool removeCreated(const smtk::operation::Operation::Result& result, ChangeSet& changes)
+{
+  for (const auto& entry : ChangeSet::get(result)->changes())
+  {
+    auto resource = std::dynamic_pointer_cast<smtk::attribute::Resource>(entry.second.resource);
+    for (const auto& id : entry.second[ChangeSet::Kind::CREATED])
+    {
+      auto attribute = resource->findAttribute(id);
+      if (!attribute || !resource->removeAttribute(attribute))
+      {
+        return false;
+      }
+      changes.insert(ChangeSet::Kind::EXPUNGED, attribute);
+    }
+  }
+  return true;
+}
+
+int outcome(const smtk::operation::Operation::Result& result)
+{
+  return result->findInt("outcome")->value();
+}
+} // namespace
+
+int unitTransaction(int /*unused*/, char* /*unused*/[])
+{
+  auto resource = smtk::attribute::Resource::create();
+  resource->createDefinition("thing");
+
+  auto manager = smtk::operation::Manager::create();
+  manager->registerOperation<CreateAttribute>("CreateAttribute");
+
+  int willOperate = 0;
+  int didOperate = 0;
+  auto key = manager->observers().insert(
+    [&](
+      const smtk::operation::Operation& op,
+      smtk::operation::EventType event,
+      smtk::operation::Operation::Result /*unused*/) {
+      smtkTest(
+        op.typeName() == "smtk::operation::Transaction",
+        "Observer called for operation " << op.typeName() << ".");
+      ++(event == smtk::operation::EventType::WILL_OPERATE ? willOperate : didOperate);
+      return 0;
+    });
+
+  // Operations in a transaction are observed once and their changes are merged.
+  auto transaction = manager->createTransaction();
+  smtkTest(!!transaction, "Could not create a transaction.");
+  for (int ii = 0; ii < 100; ++ii)
+  {
+    auto op = manager->create<CreateAttribute>();
+    op->parameters()->findResource("resource")->setValue(resource);
+    smtkTest(transaction->add(op), "Could not add operation to transaction.");
+  }
+  smtkTest(!transaction->add(transaction), "A transaction cannot contain itself.");
+  smtkTest(
+    transaction->parameters()->findResource("write")->numberOfValues() == 1,
+    "Expected one resource to lock for writing.");
+
+  auto result = transaction->operate();
+  smtkTest(
+    outcome(result) == static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED),
+    "Transaction failed.");
+  smtkTest(willOperate == 1 && didOperate == 1, "Expected a single notification.");
+  smtkTest(transaction->results().size() == 100, "Expected 100 results.");
+  smtkTest(
+    ChangeSet::of(result)->size(ChangeSet::Kind::CREATED) == 100,
+    "Expected changes to be merged.");
+  smtkTest(
+    result->findComponent("created")->numberOfValues() == 100,
+    "Expected merged changes in the result's items.");
+  std::vector<smtk::attribute::AttributePtr> attributes;
+  resource->attributes(attributes);
+  smtkTest(attributes.size() == 100, "Expected 100 attributes, got " << attributes.size());
+
+  // A failure stops the transaction and, optionally, rolls it back.
+  auto rollback = manager->createTransaction();
+  rollback->setRollbackOnFailure(true);
+  for (int ii = 0; ii < 3; ++ii)
+  {
+    auto op = manager->create<CreateAttribute>();
+    op->parameters()->findResource("resource")->setValue(resource);
+    op->m_fail = (ii == 2);
+    rollback->add(op, removeCreated);
+  }
+  rollback->add(manager->create<CreateAttribute>(), removeCreated);
+
+  result = rollback->operate();
+  smtkTest(
+    outcome(result) == static_cast<int>(smtk::operation::Operation::Outcome::FAILED),
+    "Expected transaction to fail.");
+  smtkTest(willOperate == 2 && didOperate == 2, "Expected a single notification.");
+  smtkTest(rollback->results().size() == 3, "Expected the transaction to stop at its failure.");
+  smtkTest(rollback->rolledBack(), "Expected the transaction to be rolled back.");
+  resource->attributes(attributes);
+  smtkTest(attributes.size() == 100, "Expected rollback to remove created attributes.");
+  smtkTest(ChangeSet::of(result)->empty(), "Expected rolled back changes to cancel out.");
+
+  // Operations reconfigured after they are added to access resources the
+  // transaction does not lock are not run.
+  auto unlocked = smtk::attribute::Resource::create();
+  unlocked->createDefinition("thing");
+  auto stale = manager->createTransaction();
+  auto op = manager->create<CreateAttribute>();
+  op->parameters()->findResource("resource")->setValue(resource);
+  stale->add(op);
+  op->parameters()->findResource("resource")->setValue(unlocked);
+  result = stale->operate();
+  smtkTest(
+    outcome(result) == static_cast<int>(smtk::operation::Operation::Outcome::FAILED),
+    "Expected transaction with unlocked resources to fail.");
+  smtkTest(stale->results().empty(), "Expected no operation to run without its locks.");
+  unlocked->attributes(attributes);
+  smtkTest(attributes.empty(), "Expected no attributes in an unlocked resource.");
+
+  return 0;
+}
@@ -304,12 +304,19 @@ bool Manager::registerOperation()
   auto op = OperationType::create();
   op->setProjectManager(shared_from_this());
   auto specification = op->specification();
+  std::weak_ptr<Manager> weakManager = shared_from_this();
 
   return Manager::registerOperation(smtk::operation::Metadata(
     smtk::common::typeName<OperationType>(),
     std::type_index(typeid(OperationType)).hash_code(),
     specification,
-    []() { return OperationType::create(); }));
+    []() { return OperationType::create(); },
+    [weakManager]() {
+      // Build each instance's specification the same way as the template.
+      auto op = OperationType::create();
+      op->setProjectManager(weakManager);
+      return op->specification();
+    }));
 }
 
 template<typename OperationType>
@@ -172,6 +172,28 @@ smtk::resource::ResourcePtr ResourceContainer::get(const smtk::common::UUID& id)
     return *resourceIt;
   }
 
+  // If the resource's reading was deferred, read it now.
+  auto deferredIt = m_deferred.find(id);
+  auto manager = m_manager.lock();
+  if (deferredIt != m_deferred.end() && manager)
+  {
+    const auto& surrogate = deferredIt->second.surrogate;
+    if (surrogate.fetch(manager))
+    {
+      smtk::resource::ResourcePtr resource = surrogate.resource();
+      std::string role = detail::role(resource);
+      if (role.empty())
+      {
+        role = deferredIt->second.role;
+      }
+      m_deferred.erase(deferredIt);
+      if (this->add(resource, role))
+      {
+        return this->get(id);
+      }
+    }
+  }
+
   return smtk::resource::ResourcePtr();
 }
 
@@ -427,6 +449,19 @@ bool ResourceContainer::add(
   return true;
 }
 
+bool ResourceContainer::defer(
+  const smtk::resource::Surrogate& surrogate,
+  const std::string& role,
+  const std::set<smtk::common::UUID>& dependencies)
+{
+  if (m_resources.get<IdTag>().find(surrogate.id()) != m_resources.get<IdTag>().end())
+  {
+    return false;
+  }
+  Deferred deferred{ surrogate, role, dependencies };
+  return m_deferred.insert(std::make_pair(surrogate.id(), deferred)).second;
+}
+
 bool ResourceContainer::remove(const smtk::resource::ResourcePtr& resource)
 {
   // Find the resource
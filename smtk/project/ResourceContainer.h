@@ -17,9 +17,15 @@
 #include "smtk/common/Deprecation.h"
 #include "smtk/common/TypeName.h"
 
+#include "smtk/project/ResourceIO.h"
 #include "smtk/project/Tags.h"
 
 #include "smtk/resource/Container.h"
+#include "smtk/resource/Surrogate.h"
+
+#include <map>
+#include <set>
+#include <utility>
 
 namespace smtk
 {
@@ -103,7 +109,8 @@ public:
   bool unregisterResource();
 
   /// Returns the resource that relates to the given uuid.  If no association
-  /// exists this will return a null pointer.
+  /// exists this will return a null pointer. If the resource's reading was
+  /// deferred, it is read (by the non-const overload only) and added.
   smtk::resource::ResourcePtr get(const smtk::common::UUID& id);
   smtk::resource::ConstResourcePtr get(const smtk::common::UUID& id) const;
   template<typename ResourceType>
@@ -153,6 +160,32 @@ public:
   /// by the Project.
   bool remove(const smtk::resource::ResourcePtr&);
 
+  /// A resource whose reading has been deferred, along with its role and the
+  /// ids of the resources it links to.
+  struct Deferred
+  {
+    smtk::resource::Surrogate surrogate;
+    std::string role;
+    std::set<smtk::common::UUID> dependencies;
+  };
+
+  /// Hold a resource that has not been read, along with its role and
+  /// dependencies, until it is first requested by id. Returns false if the
+  /// resource is already present.
+  bool defer(
+    const smtk::resource::Surrogate&,
+    const std::string& role = std::string(),
+    const std::set<smtk::common::UUID>& dependencies = std::set<smtk::common::UUID>());
+
+  /// Return the resources whose reading has been deferred (indexed by id).
+  const std::map<smtk::common::UUID, Deferred>& deferred() const { return m_deferred; }
+
+  /// Access the object used to read and write the project's resources, which
+  /// holds the settings (thread count, progress reporting, and deferral) used
+  /// when the project is read or written.
+  const ResourceIO& io() const { return m_io; }
+  ResourceIO& io() { return m_io; }
+
   /// Return a whitelist of typenames of allowed resources. If Empty, all
   /// Resource types are allowed.
   const std::set<std::string>& types() const { return m_types; }
@@ -169,7 +202,11 @@ public:
 
   bool empty() const { return m_resources.empty(); }
   std::size_t size() const { return m_resources.size(); }
-  void clear() { m_resources.clear(); }
+  void clear()
+  {
+    m_resources.clear();
+    m_deferred.clear();
+  }
 
 private:
   ResourceContainer(const smtk::project::Project*, const std::weak_ptr<smtk::resource::Manager>&);
@@ -178,6 +215,8 @@ private:
   std::weak_ptr<smtk::resource::Manager> m_manager;
   std::set<std::string> m_types;
   Container m_resources;
+  std::map<smtk::common::UUID, Deferred> m_deferred;
+  ResourceIO m_io;
   int m_undefinedRoleCounter;
 };
 
@@ -0,0 +1,342 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/project/ResourceIO.h"
+
+#include "smtk/project/ResourceContainer.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/FileItem.h"
+#include "smtk/attribute/IntItem.h"
+
+#include "smtk/common/ThreadPool.h"
+
+#include "smtk/io/Logger.h"
+
+#include "smtk/operation/Manager.h"
+#include "smtk/operation/groups/WriterGroup.h"
+
+#include "smtk/resource/Manager.h"
+#include "smtk/resource/Surrogate.h"
+
+#include <exception>
+#include <future>
+#include <unordered_map>
+#include <utility>
+
+namespace smtk
+{
+namespace project
+{
+namespace
+{
+bool succeeded(const smtk::operation::Operation::Result& result)
+{
+  return result &&
+    result->findInt("outcome")->value() ==
+    static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED);
+}
+
+// Create an unmanaged instance of the writer registered for \a resource's type.
+// Operations without a manager do not call the manager's observers, so the
+// writer may run on a worker thread.
+smtk::operation::Operation::Ptr createWriter(
+  const smtk::resource::ResourcePtr& resource,
+  const smtk::operation::ManagerPtr& manager,
+  smtk::io::Logger& log)
+{
+  smtk::operation::WriterGroup writerGroup(manager);
+  auto indices = writerGroup.operationsForResource(resource->typeName());
+  auto& metadata = manager->metadata().get<smtk::operation::IndexTag>();
+  auto entry = indices.empty() ? metadata.end() : metadata.find(*indices.begin());
+  if (entry == metadata.end())
+  {
+    smtkErrorMacro(log, "Could not find writer for type = " << resource->typeName() << ".");
+    return smtk::operation::Operation::Ptr();
+  }
+
+  auto writer = entry->create();
+  writer->setManagers(manager->managers());
+  auto fileItem =
+    writer->parameters()->findFile(writerGroup.fileItemNameForOperation(writer->index()));
+  if (fileItem)
+  {
+    fileItem->setValue(resource->location());
+  }
+  writer->parameters()->associate(resource);
+  return writer;
+}
+} // namespace
+
+std::set<smtk::common::UUID> ResourceIO::dependencies(const smtk::resource::ResourcePtr& resource)
+{
+  std::set<smtk::common::UUID> result;
+  if (!resource)
+  {
+    return result;
+  }
+
+  // All resource links held by a resource have a lhs = the containing
+  // resource, so the rhs values are the resources it depends upon.
+  typedef smtk::resource::Resource::Links::ResourceLinkData ResourceLinkData;
+  const ResourceLinkData& resourceLinkData = resource->links().data();
+  for (const auto& link : resourceLinkData.get<ResourceLinkData::Right>())
+  {
+    if (link.right != resource->id())
+    {
+      result.insert(link.right);
+    }
+  }
+  return result;
+}
+
+std::vector<std::vector<std::size_t>> ResourceIO::schedule(const std::vector<Entry>& entries)
+{
+  std::vector<std::vector<std::size_t>> waves;
+
+  std::unordered_map<smtk::common::UUID, std::size_t> positions;
+  for (std::size_t ii = 0; ii < entries.size(); ++ii)
+  {
+    positions[entries[ii].id] = ii;
+  }
+
+  // Count the dependencies of each entry upon other entries and record the
+  // reverse relationship so that entries can be released as waves complete.
+  std::vector<std::size_t> waitingOn(entries.size(), 0);
+  std::vector<std::vector<std::size_t>> dependents(entries.size());
+  for (std::size_t ii = 0; ii < entries.size(); ++ii)
+  {
+    for (const auto& id : entries[ii].dependencies)
+    {
+      auto position = positions.find(id);
+      if (position != positions.end() && position->second != ii)
+      {
+        ++waitingOn[ii];
+        dependents[position->second].push_back(ii);
+      }
+    }
+  }
+
+  std::vector<bool> scheduled(entries.size(), false);
+  std::vector<std::size_t> wave;
+  for (std::size_t ii = 0; ii < entries.size(); ++ii)
+  {
+    if (waitingOn[ii] == 0)
+    {
+      wave.push_back(ii);
+    }
+  }
+
+  std::size_t numberScheduled = 0;
+  while (numberScheduled < entries.size())
+  {
+    if (wave.empty())
+    {
+      // Every remaining entry is waiting on a dependency cycle. Break the
+      // cycle by releasing the entry waiting on the fewest others.
+      std::size_t released = entries.size();
+      for (std::size_t ii = 0; ii < entries.size(); ++ii)
+      {
+        if (!scheduled[ii] && (released == entries.size() || waitingOn[ii] < waitingOn[released]))
+        {
+          released = ii;
+        }
+      }
+      wave.push_back(released);
+    }
+
+    std::vector<std::size_t> next;
+    for (std::size_t ii : wave)
+    {
+      scheduled[ii] = true;
+      for (std::size_t dependent : dependents[ii])
+      {
+        if (!scheduled[dependent] && waitingOn[dependent] > 0 && --waitingOn[dependent] == 0)
+        {
+          next.push_back(dependent);
+        }
+      }
+    }
+    numberScheduled += wave.size();
+    waves.push_back(std::move(wave));
+    wave = std::move(next);
+  }
+
+  return waves;
+}
+
+std::size_t ResourceIO::read(const std::vector<Entry>& entries, ResourceContainer& container) const
+{
+  auto manager = container.manager();
+  if (!manager)
+  {
+    return entries.size();
+  }
+
+  std::size_t processed = 0;
+  std::size_t failed = 0;
+  auto report = [this, &processed, &entries](const std::string& location, Status status) {
+    ++processed;
+    if (m_progress)
+    {
+      m_progress(location, status, processed, entries.size());
+    }
+  };
+
+  // Deferred resources do not hold up the resources that link to them; their
+  // links are resolved when they are eventually read.
+  std::vector<Entry> immediate;
+  immediate.reserve(entries.size());
+  for (const auto& entry : entries)
+  {
+    if (m_defer && !entry.id.isNull() && m_defer(entry))
+    {
+      auto metadata = manager->metadata().get<smtk::resource::NameTag>().find(entry.typeName);
+      if (
+        metadata != manager->metadata().get<smtk::resource::NameTag>().end() &&
+        container.defer(
+          smtk::resource::Surrogate(metadata->index(), entry.typeName, entry.id, entry.location),
+          entry.role,
+          entry.dependencies))
+      {
+        report(entry.location, Status::Deferred);
+        continue;
+      }
+    }
+    immediate.push_back(entry);
+  }
+
+  smtk::common::ThreadPool<smtk::resource::ResourcePtr> pool(m_maxThreads);
+  for (const auto& wave : ResourceIO::schedule(immediate))
+  {
+    std::vector<std::future<smtk::resource::ResourcePtr>> futures(wave.size());
+    for (std::size_t ii = 0; ii < wave.size(); ++ii)
+    {
+      const Entry& entry = immediate[wave[ii]];
+      auto metadata = manager->metadata().get<smtk::resource::NameTag>().find(entry.typeName);
+      if (metadata != manager->metadata().get<smtk::resource::NameTag>().end() && metadata->read)
+      {
+        auto readResource = metadata->read;
+        std::string location = entry.location;
+        futures[ii] = pool([readResource, location]() { return readResource(location, nullptr); });
+      }
+      // Otherwise, the future is left invalid and the resource manager reads
+      // the resource (using its legacy readers) on this thread below.
+    }
+
+    for (std::size_t ii = 0; ii < wave.size(); ++ii)
+    {
+      const Entry& entry = immediate[wave[ii]];
+      smtk::resource::ResourcePtr resource;
+      try
+      {
+        if (futures[ii].valid())
+        {
+          resource = futures[ii].get();
+          if (resource)
+          {
+            manager->add(resource);
+            resource->setLocation(entry.location);
+            resource->setClean(true);
+          }
+        }
+        else
+        {
+          resource = manager->read(entry.typeName, entry.location);
+        }
+      }
+      catch (std::exception& e)
+      {
+        smtkErrorMacro(
+          smtk::io::Logger::instance(),
+          "Could not read \"" << entry.location << "\": " << e.what() << ".");
+        resource = nullptr;
+      }
+
+      if (!resource)
+      {
+        ++failed;
+        report(entry.location, Status::Failed);
+        continue;
+      }
+
+      std::string role = resource->properties().get<std::string>()[ResourceContainer::role_name];
+      container.add(resource, role.empty() ? entry.role : role);
+      report(entry.location, Status::Read);
+    }
+  }
+
+  return failed;
+}
+
+bool ResourceIO::write(
+  const std::vector<smtk::resource::ResourcePtr>& resources,
+  const smtk::operation::ManagerPtr& operationManager,
+  smtk::io::Logger& log) const
+{
+  if (!operationManager)
+  {
+    smtkErrorMacro(log, "Cannot write resources without an operation manager.");
+    return false;
+  }
+
+  // Each resource is written by its own unmanaged writer so that the writers
+  // may run concurrently without dispatching operation observers from worker
+  // threads; observers are notified once by the operation that called us.
+  smtk::common::ThreadPool<smtk::operation::Operation::Result> pool(m_maxThreads);
+  std::vector<std::future<smtk::operation::Operation::Result>> futures(resources.size());
+  for (std::size_t ii = 0; ii < resources.size(); ++ii)
+  {
+    auto writer = createWriter(resources[ii], operationManager, log);
+    if (writer)
+    {
+      futures[ii] = pool([writer]() { return writer->operate(); });
+    }
+  }
+
+  bool allWritten = true;
+  std::size_t processed = 0;
+  for (std::size_t ii = 0; ii < resources.size(); ++ii)
+  {
+    bool written = false;
+    try
+    {
+      written = futures[ii].valid() && succeeded(futures[ii].get());
+    }
+    catch (std::exception& e)
+    {
+      smtkErrorMacro(log, e.what());
+    }
+
+    ++processed;
+    if (written)
+    {
+      // Writers mark the resources they lock for writing as modified; what
+      // was just written matches its persistent state.
+      resources[ii]->setClean(true);
+    }
+    if (!written)
+    {
+      allWritten = false;
+      smtkErrorMacro(log, "Could not write \"" << resources[ii]->location() << "\".");
+    }
+    if (m_progress)
+    {
+      m_progress(
+        resources[ii]->location(),
+        written ? Status::Written : Status::Failed,
+        processed,
+        resources.size());
+    }
+  }
+
+  return allWritten;
+}
+} // namespace project
+} // namespace smtk
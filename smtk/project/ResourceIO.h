@@ -0,0 +1,122 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_project_ResourceIO_h
+#define smtk_project_ResourceIO_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/PublicPointerDefs.h"
+
+#include "smtk/common/UUID.h"
+
+#include <functional>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace smtk
+{
+namespace io
+{
+class Logger;
+}
+namespace project
+{
+class ResourceContainer;
+
+/// ResourceIO reads and writes the resources held by a project. Resources
+/// are read concurrently on a thread pool, in waves that respect the links
+/// between them: a resource is read only after the resources it links to.
+/// Resources are written concurrently (links are written as references, so
+/// writes need no ordering). Resources may instead be deferred, in which case
+/// they are read the first time they are requested from the project's
+/// ResourceContainer.
+///
+/// Readers run on worker threads, but resources are added to the resource
+/// manager and project (and progress is reported) on the calling thread.
+class SMTKCORE_EXPORT ResourceIO
+{
+public:
+  /// A description of a resource to be read.
+  struct Entry
+  {
+    std::string typeName;
+    std::string location;
+    smtk::common::UUID id;
+    std::string role;
+    /// The ids of the resources this resource links to.
+    std::set<smtk::common::UUID> dependencies;
+  };
+
+  enum class Status
+  {
+    Read,
+    Deferred,
+    Written,
+    Failed
+  };
+
+  /// Called on the calling thread as each resource is processed, along with
+  /// the number of resources processed so far and the total to process.
+  using Progress = std::function<
+    void(const std::string& location, Status status, std::size_t processed, std::size_t total)>;
+
+  /// Return true if reading the described resource should be deferred.
+  using Defer = std::function<bool(const Entry&)>;
+
+  /// Construct with the maximum number of threads to use (0 selects the
+  /// hardware concurrency).
+  ResourceIO(unsigned int maxThreads = 0)
+    : m_maxThreads(maxThreads)
+  {
+  }
+
+  unsigned int maxThreads() const { return m_maxThreads; }
+  void setMaxThreads(unsigned int maxThreads) { m_maxThreads = maxThreads; }
+
+  const Progress& progress() const { return m_progress; }
+  void setProgress(const Progress& progress) { m_progress = progress; }
+
+  const Defer& defer() const { return m_defer; }
+  void setDefer(const Defer& defer) { m_defer = defer; }
+
+  /// Return the resources \a resource links to.
+  static std::set<smtk::common::UUID> dependencies(const smtk::resource::ResourcePtr& resource);
+
+  /// Partition \a entries into waves (lists of entry indices) such that each
+  /// entry's dependencies among \a entries lie in earlier waves. Dependency
+  /// cycles are broken by scheduling one member of the cycle before the rest.
+  static std::vector<std::vector<std::size_t>> schedule(const std::vector<Entry>& entries);
+
+  /// Read the resources described by \a entries (or defer them) and add them
+  /// to \a container. Return the number of resources that could not be read.
+  std::size_t read(const std::vector<Entry>& entries, ResourceContainer& container) const;
+
+  /// Write \a resources to their locations. Return true if every resource
+  /// was written; failures are reported to \a log.
+  ///
+  /// Each resource is written concurrently by an unmanaged instance of the
+  /// writer that \a operationManager's WriterGroup registers for its type, so
+  /// the manager's observers are not called for these writers. Callers that
+  /// must notify observers should do so from an operation on their own thread.
+  bool write(
+    const std::vector<smtk::resource::ResourcePtr>& resources,
+    const smtk::operation::ManagerPtr& operationManager,
+    smtk::io::Logger& log) const;
+
+private:
+  unsigned int m_maxThreads;
+  Progress m_progress;
+  Defer m_defer;
+};
+} // namespace project
+} // namespace smtk
+
+#endif // smtk_project_ResourceIO_h
@@ -14,10 +14,16 @@
 #include "smtk/resource/Manager.h"
 
 #include "smtk/project/Project.h"
+#include "smtk/project/ResourceIO.h"
+
+#include "smtk/common/json/jsonUUID.h"
 
 #include <boost/algorithm/string.hpp>
 #include <boost/filesystem.hpp>
 
+#include <set>
+#include <vector>
+
 namespace
 {
 void replaceWindowsSeparators(boost::filesystem::path& path)
@@ -49,6 +55,28 @@ void to_json(json& j, const ResourceContainer& resourceContainer, const ProjectP
     boost::filesystem::path newPath = boost::filesystem::relative(filePath, parentPath);
     replaceWindowsSeparators(newPath);
     jResource["location"] = newPath.string();
+
+    // record the role and the resources this resource links to so that they
+    // are available without reading the resource
+    jResource["role"] = detail::role(resource);
+    jResource["dependencies"] = ResourceIO::dependencies(resource);
+    j["resources"].push_back(jResource);
+  }
+
+  // resources that have not been read are described by their surrogates
+  for (const auto& deferred : resourceContainer.deferred())
+  {
+    const smtk::resource::Surrogate& surrogate = deferred.second.surrogate;
+    boost::filesystem::path newPath =
+      boost::filesystem::relative(boost::filesystem::path(surrogate.location()), parentPath);
+    replaceWindowsSeparators(newPath);
+
+    nlohmann::json jResource;
+    jResource["id"] = surrogate.id().toString();
+    jResource["type"] = surrogate.typeName();
+    jResource["location"] = newPath.string();
+    jResource["role"] = deferred.second.role;
+    jResource["dependencies"] = deferred.second.dependencies;
     j["resources"].push_back(jResource);
   }
 }
@@ -66,6 +94,7 @@ void from_json(const json& j, ResourceContainer& resourceContainer, const Projec
   std::string projectPath = project->location();
   boost::filesystem::path parentPath = boost::filesystem::path(projectPath).parent_path();
 
+  std::vector<ResourceIO::Entry> entries;
   for (json::const_iterator it = j["resources"].begin(); it != j["resources"].end(); ++it)
   {
     std::string location = it->at("location").get<std::string>();
@@ -76,15 +105,29 @@ void from_json(const json& j, ResourceContainer& resourceContainer, const Projec
     }
     replaceWindowsSeparators(locationPath);
 
-    smtk::resource::ResourcePtr resource =
-      manager->read(it->at("type").get<std::string>(), locationPath.string());
-    if (!resource)
+    ResourceIO::Entry entry;
+    entry.typeName = it->at("type").get<std::string>();
+    entry.location = locationPath.string();
+
+    // For backwards compatibility, do not require "id", "role" or
+    // "dependencies" json items.
+    if (it->find("id") != it->end())
+    {
+      entry.id = it->at("id").get<smtk::common::UUID>();
+    }
+    if (it->find("role") != it->end())
+    {
+      entry.role = it->at("role").get<std::string>();
+    }
+    if (it->find("dependencies") != it->end())
     {
-      continue;
+      entry.dependencies = it->at("dependencies").get<std::set<smtk::common::UUID>>();
     }
-    resourceContainer.add(
-      resource, resource->properties().get<std::string>()[ResourceContainer::role_name]);
+    entries.push_back(entry);
   }
+
+  // Resources that fail to read are skipped.
+  resourceContainer.io().read(entries, resourceContainer);
 }
 } // namespace project
 } // namespace smtk
@@ -37,6 +37,7 @@ SMTK_THIRDPARTY_PRE_INCLUDE
 SMTK_THIRDPARTY_POST_INCLUDE
 
 #include <fstream>
+#include <set>
 #include <string>
 
 namespace smtk
@@ -105,8 +106,19 @@ Read::Result Read::operateInternal()
   //   resource paths to being relative (rather than absolute)
   j["location"] = filename;
 
+  // Defer reading the resources whose roles are not active
+  auto activeRolesItem = this->parameters()->findString("active roles");
+  if (activeRolesItem && activeRolesItem->isEnabled())
+  {
+    std::set<std::string> activeRoles(activeRolesItem->begin(), activeRolesItem->end());
+    project->resources().io().setDefer([activeRoles](const ResourceIO::Entry& entry) {
+      return activeRoles.find(entry.role) == activeRoles.end();
+    });
+  }
+
   // Transcribe project data into the project
   smtk::project::from_json(j, project);
+  project->resources().io().setDefer(nullptr);
 
   Result result = this->createResult(smtk::operation::Operation::Outcome::SUCCEEDED);
   {
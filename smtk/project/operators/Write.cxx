@@ -23,8 +23,6 @@
 
 #include "smtk/io/Logger.h"
 
-#include "smtk/operation/operators/WriteResource.h"
-
 #include "smtk/project/Manager.h"
 
 #include "smtk/project/json/jsonProject.h"
@@ -33,6 +31,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <vector>
 
 SMTK_THIRDPARTY_PRE_INCLUDE
 #include "boost/filesystem.hpp"
@@ -62,15 +61,6 @@ Write::Result Write::operateInternal()
   boost::filesystem::path projectFolderPath = outputFilePath.parent_path();
   boost::filesystem::path resourcesFolderPath = projectFolderPath / "resources";
 
-  // Construct a WriteResource operation to write all of the project's resources.
-  smtk::operation::WriteResource::Ptr write =
-    project->operations().manager()->create<smtk::operation::WriteResource>();
-  if (!write)
-  {
-    smtkErrorMacro(this->log(), "Cannot create WriteResource operation.");
-    return this->createResult(smtk::operation::Operation::Outcome::FAILED);
-  }
-
   // Create project and project/resources folders if needed
   if (!boost::filesystem::exists(resourcesFolderPath))
   {
@@ -89,16 +79,14 @@ Write::Result Write::operateInternal()
     return this->createResult(smtk::operation::Operation::Outcome::FAILED);
   }
 
-  // Write the modified resources.
+  // Write the modified resources concurrently.
+  std::vector<smtk::resource::ResourcePtr> modified;
   for (const auto& resource : project->resources())
   {
     const std::string& role = detail::role(resource);
 
     if (!resource->clean())
     {
-      // Reset the write operation's associations.
-      write->parameters()->associations()->reset();
-
       if (resource->location().empty())
       {
         std::string filename = role + "-" + resource->id().toString() + ".smtk";
@@ -106,18 +94,16 @@ Write::Result Write::operateInternal()
         resource->setLocation(location.string());
       }
 
-      write->parameters()->associate(resource);
-      smtk::operation::Operation::Result writeResult = write->operate();
-      if (
-        writeResult->findInt("outcome")->value() !=
-        static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED))
-      {
-        // An error message should already enter the logger from the local operation.
-        return this->createResult(smtk::operation::Operation::Outcome::FAILED);
-      }
+      modified.push_back(resource);
     }
   }
 
+  if (!project->resources().io().write(modified, project->operations().manager(), this->log()))
+  {
+    // An error message should already enter the logger from the local operations.
+    return this->createResult(smtk::operation::Operation::Outcome::FAILED);
+  }
+
   // We now write the project's smtk file.
   {
     nlohmann::json j = project;
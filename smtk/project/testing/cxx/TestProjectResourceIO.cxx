@@ -0,0 +1,288 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/ReferenceItemDefinition.h"
+#include "smtk/attribute/Resource.h"
+
+#include "smtk/common/UUIDGenerator.h"
+#include "smtk/resource/Component.h"
+#include "smtk/resource/DerivedFrom.h"
+#include "smtk/resource/Manager.h"
+
+#include "smtk/operation/Manager.h"
+#include "smtk/operation/Operation.h"
+#include "smtk/operation/groups/WriterGroup.h"
+
+#include "smtk/project/Manager.h"
+#include "smtk/project/Project.h"
+#include "smtk/project/ResourceIO.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <atomic>
+#include <map>
+#include <vector>
+
+namespace
+{
+class MyResource : public smtk::resource::DerivedFrom<MyResource, smtk::resource::Resource>
+{
+public:
+  smtkTypeMacro(MyResource);
+  smtkCreateMacro(MyResource);
+  smtkSharedFromThisMacro(smtk::resource::PersistentObject);
+
+  smtk::resource::ComponentPtr find(const smtk::common::UUID& /*compId*/) const override
+  {
+    return smtk::resource::ComponentPtr();
+  }
+
+  std::function<bool(const smtk::resource::Component&)> queryOperation(
+    const std::string& /*unused*/) const override
+  {
+    return [](const smtk::resource::Component& /*unused*/) { return true; };
+  }
+
+  void visit(smtk::resource::Component::Visitor& /*v*/) const override {}
+
+protected:
+  MyResource()
+    : smtk::resource::DerivedFrom<MyResource, smtk::resource::Resource>()
+  {
+  }
+};
+
+using smtk::project::ResourceIO;
+
+// "Read" a resource whose id is its location. Locations ending in "bad" fail.
+std::atomic<int> numberOfReads(0);
+smtk::resource::ResourcePtr readMyResource(
+  const std::string& location,
+  const std::shared_ptr<smtk::common::Managers>& /*unused*/)
+{
+  ++numberOfReads;
+  if (location.size() > 3 && location.substr(location.size() - 3) == "bad")
+  {
+    return smtk::resource::ResourcePtr();
+  }
+  auto resource = MyResource::create();
+  resource->setId(smtk::common::UUID(location));
+  return resource;
+}
+
+// "Write" a resource. Resources whose location ends in "bad" fail.
+std::atomic<int> numberOfWrites(0);
+class WriteMyResource : public smtk::operation::Operation
+{
+public:
+  smtkTypeMacro(WriteMyResource);
+  smtkCreateMacro(WriteMyResource);
+  smtkSharedFromThisMacro(smtk::operation::Operation);
+
+  Result operateInternal() override
+  {
+    ++numberOfWrites;
+    auto resource = this->parameters()->associations()->valueAs<smtk::resource::Resource>();
+    const std::string& location = resource->location();
+    return this->createResult(
+      location.size() > 3 && location.substr(location.size() - 3) == "bad" ? Outcome::FAILED
+                                                                            : Outcome::SUCCEEDED);
+  }
+
+  Specification createSpecification() override
+  {
+    Specification spec = this->createBaseSpecification();
+    auto opDef = spec->createDefinition("write my resource", "operation");
+    auto rule = opDef->createLocalAssociationRule();
+    rule->setAcceptsEntries(smtk::common::typeName<MyResource>(), "", true);
+    rule->setOnlyResources(true);
+    rule->setNumberOfRequiredValues(1);
+    spec->createDefinition("result(write my resource)", "result");
+    return spec;
+  }
+};
+
+ResourceIO::Entry entry(const smtk::common::UUID& id, const std::string& role)
+{
+  ResourceIO::Entry result;
+  result.typeName = smtk::common::typeName<MyResource>();
+  result.location = id.toString();
+  result.id = id;
+  result.role = role;
+  return result;
+}
+
+// Return the wave in which each entry is scheduled.
+std::vector<std::size_t> waveOf(const std::vector<ResourceIO::Entry>& entries)
+{
+  std::vector<std::size_t> result(entries.size(), entries.size());
+  auto waves = ResourceIO::schedule(entries);
+  for (std::size_t ii = 0; ii < waves.size(); ++ii)
+  {
+    for (std::size_t jj : waves[ii])
+    {
+      smtkTest(result[jj] == entries.size(), "Entry " << jj << " scheduled more than once.");
+      result[jj] = ii;
+    }
+  }
+  for (std::size_t ii = 0; ii < entries.size(); ++ii)
+  {
+    smtkTest(result[ii] != entries.size(), "Entry " << ii << " was not scheduled.");
+  }
+  return result;
+}
+} // namespace
+
+int TestProjectResourceIO(int /*unused*/, char** const /*unused*/)
+{
+  auto& generator = smtk::common::UUIDGenerator::instance();
+
+  // Independent resources are read in a single wave; dependent resources are
+  // read after the resources they link to.
+  std::vector<ResourceIO::Entry> entries;
+  for (int ii = 0; ii < 6; ++ii)
+  {
+    entries.push_back(entry(generator.random(), "role" + std::to_string(ii)));
+  }
+  {
+    auto waves = waveOf(entries);
+    for (auto wave : waves)
+    {
+      smtkTest(wave == 0, "Independent resources should be read together.");
+    }
+  }
+  entries[0].dependencies.insert(entries[1].id);
+  entries[1].dependencies.insert(entries[2].id);
+  entries[3].dependencies.insert(entries[2].id);
+  entries[3].dependencies.insert(generator.random()); // not in the project
+  {
+    auto waves = waveOf(entries);
+    smtkTest(waves[2] == 0 && waves[4] == 0 && waves[5] == 0, "Expected leaves in first wave.");
+    smtkTest(waves[1] == 1 && waves[3] == 1, "Expected dependents of 2 in second wave.");
+    smtkTest(waves[0] == 2, "Expected 0 in third wave.");
+  }
+  // Cycles are broken.
+  entries[2].dependencies.insert(entries[0].id);
+  {
+    auto waves = waveOf(entries);
+    smtkTest(waves[4] == 0 && waves[5] == 0, "Expected leaves in first wave.");
+  }
+  entries[2].dependencies.clear();
+
+  // Create managers and a project.
+  smtk::resource::ManagerPtr resourceManager = smtk::resource::Manager::create();
+  resourceManager->registerResource<MyResource>(readMyResource);
+  smtk::operation::ManagerPtr operationManager = smtk::operation::Manager::create();
+  smtk::project::ManagerPtr projectManager =
+    smtk::project::Manager::create(resourceManager, operationManager);
+  projectManager->registerProject<smtk::project::Project>();
+  auto project = projectManager->create<smtk::project::Project>();
+  smtkTest(!!project, "Could not create project.");
+
+  // Read all but resource 5, deferring resource 4 and failing to read another.
+  auto& container = project->resources();
+  std::map<std::string, ResourceIO::Status> reported;
+  std::size_t lastProcessed = 0;
+  container.io().setMaxThreads(4);
+  container.io().setProgress([&](
+                               const std::string& location,
+                               ResourceIO::Status status,
+                               std::size_t processed,
+                               std::size_t total) {
+    smtkTest(processed == lastProcessed + 1 && total == 6, "Unexpected progress.");
+    lastProcessed = processed;
+    reported[location] = status;
+  });
+  container.io().setDefer(
+    [](const ResourceIO::Entry& candidate) { return candidate.role == "role4"; });
+  entries.pop_back();
+  entries[4].dependencies.insert(entries[2].id);
+  auto bad = entry(generator.random(), "bad");
+  bad.location += "bad";
+  entries.push_back(bad);
+
+  std::size_t failed = container.io().read(entries, container);
+  smtkTest(failed == 1, "Expected one failure, got " << failed << ".");
+  smtkTest(numberOfReads == 5, "Expected 5 reads, got " << numberOfReads << ".");
+  smtkTest(reported.size() == 6, "Expected progress for every resource.");
+  smtkTest(reported[bad.location] == ResourceIO::Status::Failed, "Expected failure.");
+  smtkTest(reported[entries[4].location] == ResourceIO::Status::Deferred, "Expected deferral.");
+  smtkTest(container.size() == 4, "Expected 4 resources, got " << container.size() << ".");
+  for (std::size_t ii = 0; ii < 4; ++ii)
+  {
+    smtkTest(
+      reported[entries[ii].location] == ResourceIO::Status::Read, "Expected " << ii << " read.");
+    auto resource = resourceManager->get(entries[ii].id);
+    smtkTest(!!resource && resource->clean(), "Resource " << ii << " is not managed and clean.");
+    smtkTest(
+      container.findByRole(entries[ii].role).size() == 1, "Resource " << ii << " has no role.");
+  }
+
+  // Deferred resources are read on request.
+  smtkTest(container.deferred().size() == 1, "Expected a deferred resource.");
+  smtkTest(
+    container.deferred().begin()->second.dependencies == entries[4].dependencies,
+    "Deferred resource lost its dependencies.");
+  smtkTest(!resourceManager->get(entries[4].id), "Deferred resource was read.");
+  auto deferred = container.get(entries[4].id);
+  smtkTest(!!deferred, "Deferred resource was not read on request.");
+  smtkTest(numberOfReads == 6, "Expected deferred resource to be read.");
+  smtkTest(container.deferred().empty(), "Expected no deferred resources.");
+  smtkTest(container.findByRole("role4").size() == 1, "Deferred resource has no role.");
+
+  // Write modified resources, one of which fails. Writers run on worker
+  // threads, so operation observers must not be called for them.
+  smtk::operation::WriterGroup(operationManager)
+    .registerOperation<MyResource, WriteMyResource>();
+  int numberOfObservations = 0;
+  auto key = operationManager->observers().insert(
+    [&numberOfObservations](
+      const smtk::operation::Operation& /*unused*/,
+      smtk::operation::EventType /*unused*/,
+      smtk::operation::Operation::Result /*unused*/) -> int {
+      ++numberOfObservations;
+      return 0;
+    });
+  std::vector<smtk::resource::ResourcePtr> modified;
+  for (std::size_t ii = 0; ii < 4; ++ii)
+  {
+    modified.push_back(resourceManager->get(entries[ii].id));
+    modified.back()->setClean(false);
+  }
+  modified.back()->setLocation(modified.back()->location() + "bad");
+  reported.clear();
+  lastProcessed = 0;
+  container.io().setProgress([&](
+                               const std::string& location,
+                               ResourceIO::Status status,
+                               std::size_t processed,
+                               std::size_t total) {
+    smtkTest(processed == lastProcessed + 1 && total == 4, "Unexpected progress.");
+    lastProcessed = processed;
+    reported[location] = status;
+  });
+  bool written = container.io().write(modified, operationManager, smtk::io::Logger::instance());
+  operationManager->observers().erase(key);
+  smtkTest(!written, "Expected a write to fail.");
+  smtkTest(numberOfWrites == 4, "Expected 4 writes, got " << numberOfWrites << ".");
+  smtkTest(numberOfObservations == 0, "Observers were called for concurrent writers.");
+  for (std::size_t ii = 0; ii < 4; ++ii)
+  {
+    bool bad = (ii == 3);
+    smtkTest(modified[ii]->clean() == !bad, "Resource " << ii << " has the wrong clean state.");
+    smtkTest(
+      reported[modified[ii]->location()] ==
+        (bad ? ResourceIO::Status::Failed : ResourceIO::Status::Written),
+      "Resource " << ii << " has the wrong status.");
+  }
+
+  return 0;
+}
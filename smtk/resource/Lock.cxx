@@ -9,6 +9,67 @@
 //=========================================================================
 #include "smtk/resource/Lock.h"
 
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// Layout of Lock::m_state.
+// The number of threads holding a read (or upgradeable read) lock.
+constexpr std::uint32_t ReaderMask = 0x0fffffff;
+// Set while a thread holds the upgradeable read lock.
+constexpr std::uint32_t Upgrader = 1u << 28;
+// Set while a thread holds the write lock.
+constexpr std::uint32_t Writer = 1u << 29;
+// Set while a writer or an upgrade is waiting; new readers must then take
+// the slow path so that they do not starve the writer.
+constexpr std::uint32_t Pending = 1u << 30;
+// Set while threads may be blocked on the condition variable; releases must
+// then take the mutex and notify them.
+constexpr std::uint32_t Sleepers = 1u << 31;
+
+std::int64_t now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch())
+    .count();
+}
+
+std::int64_t since(const Clock::time_point& start)
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+}
+
+// Block on \a condition until \a tryAcquire succeeds or \a deadline (if any) passes.
+// The caller must hold \a lk (a lock on the mutex associated with \a condition).
+template<typename Predicate>
+bool waitFor(
+  std::atomic<std::uint32_t>& state,
+  std::condition_variable& condition,
+  std::unique_lock<std::mutex>& lk,
+  const Clock::time_point* deadline,
+  Predicate tryAcquire)
+{
+  while (true)
+  {
+    // Announce that we may sleep *before* re-checking the state. A thread
+    // releasing the lock either sees the flag (and wakes us after we wait)
+    // or has already released it (and the check below succeeds).
+    state.fetch_or(Sleepers);
+    if (tryAcquire())
+    {
+      return true;
+    }
+    if (deadline == nullptr)
+    {
+      condition.wait(lk);
+    }
+    else if (condition.wait_until(lk, *deadline) == std::cv_status::timeout)
+    {
+      return tryAcquire();
+    }
+  }
+}
+} // namespace
+
 namespace smtk
 {
 namespace resource
@@ -20,92 +81,351 @@ void Lock::lock(LockType lockType)
 {
   if (lockType == LockType::Read)
   {
-    // Lock the resource.
-    std::unique_lock<std::mutex> lk(m_mutex);
-
-    // Wait for writers to finish.
-    while (m_waitingWriters != 0)
+    if (!this->tryAcquireRead())
+    {
+      this->acquireRead(nullptr);
+    }
+  }
+  else if (lockType == LockType::Write)
+  {
+    if (!this->tryAcquireWrite())
     {
-      m_readerCondition.wait(lk);
+      this->acquireWrite(nullptr);
     }
+  }
+}
 
-    // Declare yourself as a reader.
-    ++m_activeReaders;
+bool Lock::tryLock(LockType lockType)
+{
+  bool acquired = true;
+  if (lockType == LockType::Read)
+  {
+    acquired = this->tryAcquireRead();
+  }
+  else if (lockType == LockType::Write)
+  {
+    acquired = this->tryAcquireWrite();
+  }
+  if (!acquired)
+  {
+    ++m_failedAcquisitions;
+  }
+  return acquired;
+}
 
-    // Unlock the resource.
-    lk.unlock();
+bool Lock::tryLockUntil(LockType lockType, const std::chrono::steady_clock::time_point& deadline)
+{
+  if (lockType == LockType::Read)
+  {
+    return this->tryAcquireRead() || this->acquireRead(&deadline);
   }
   else if (lockType == LockType::Write)
   {
-    // Lock the resource.
-    std::unique_lock<std::mutex> lk(m_mutex);
+    return this->tryAcquireWrite() || this->acquireWrite(&deadline);
+  }
+  return true;
+}
 
-    // Declare yourself as a waiting writier.
-    ++m_waitingWriters;
+void Lock::unlock(LockType lockType)
+{
+  if (lockType == LockType::Read)
+  {
+    std::int64_t start = m_readStart.load();
+    this->readReleased(m_state.fetch_sub(1), start);
+  }
+  else if (lockType == LockType::Write)
+  {
+    m_writeHoldTime += now() - m_writeStart.load();
+    std::uint32_t previous = m_state.fetch_and(~Writer);
+    if (previous & Sleepers)
+    {
+      // Admit the readers that waited on this writer before the next writer.
+      this->wakeWaiters(true);
+    }
+  }
+}
 
-    // Wait for active readers and active writers to finish.
-    while (m_activeReaders != 0 || m_activeWriters != 0)
+void Lock::lockUpgradeable()
+{
+  std::uint32_t state = m_state.load();
+  while (!(state & (Writer | Pending | Upgrader)))
+  {
+    if (m_state.compare_exchange_weak(state, (state + 1) | Upgrader))
     {
-      m_writerCondition.wait(lk);
+      this->readAcquired(state);
+      return;
     }
+  }
 
-    // Declare yourself as an active writer.
-    ++m_activeWriters;
+  auto start = Clock::now();
+  ++m_contendedAcquisitions;
+  std::unique_lock<std::mutex> lk(m_mutex);
+  ++m_waitingReaders;
+  waitFor(m_state, m_condition, lk, nullptr, [this]() {
+    std::uint32_t s = m_state.load();
+    while (!(s & (Writer | Upgrader)) && (!(s & Pending) || m_admittedReaders > 0))
+    {
+      if (m_state.compare_exchange_weak(s, (s + 1) | Upgrader))
+      {
+        if (m_admittedReaders > 0)
+        {
+          --m_admittedReaders;
+        }
+        this->readAcquired(s);
+        return true;
+      }
+    }
+    return false;
+  });
+  --m_waitingReaders;
+  m_readWaitTime += since(start);
+}
 
-    // Unlock the resource.
-    lk.unlock();
+void Lock::unlockUpgradeable()
+{
+  std::int64_t start = m_readStart.load();
+  std::uint32_t previous = m_state.fetch_sub(Upgrader + 1);
+  if ((previous & ReaderMask) == 1)
+  {
+    m_readHoldTime += now() - start;
+  }
+  if (previous & Sleepers)
+  {
+    // Another thread may be waiting for the upgradeable lock itself.
+    this->wakeWaiters(false);
   }
 }
 
-void Lock::unlock(LockType lockType)
+void Lock::upgrade()
 {
-  if (lockType == LockType::Read)
-  {
-    // Lock the resource.
-    std::unique_lock<std::mutex> lk(m_mutex);
+  // Succeed when the upgrader is the only reader.
+  auto tryUpgrade = [this]() {
+    std::uint32_t s = m_state.load();
+    while ((s & ReaderMask) == 1)
+    {
+      std::int64_t readStart = m_readStart.load();
+      if (m_state.compare_exchange_weak(s, ((s - 1) & ~Upgrader) | Writer))
+      {
+        m_readHoldTime += now() - readStart;
+        this->writeAcquired();
+        return true;
+      }
+    }
+    return false;
+  };
 
-    // Remove yourself as an active reader.
-    --m_activeReaders;
+  if (tryUpgrade())
+  {
+    return;
+  }
 
-    // Unlock the resource.
-    lk.unlock();
+  auto start = Clock::now();
+  ++m_contendedAcquisitions;
+  std::unique_lock<std::mutex> lk(m_mutex);
+  ++m_waitingUpgrades;
+  m_state.fetch_or(Pending);
+  waitFor(m_state, m_condition, lk, nullptr, tryUpgrade);
+  --m_waitingUpgrades;
+  this->updatePending();
+  m_writeWaitTime += since(start);
+}
 
-    // Tell one of the waiting writers to check if it can write.
-    m_writerCondition.notify_one();
+void Lock::downgrade()
+{
+  m_writeHoldTime += now() - m_writeStart.load();
+  m_readStart.store(now());
+  std::uint32_t state = m_state.load();
+  while (!m_state.compare_exchange_weak(state, ((state & ~Writer) + 1) | Upgrader))
+  {
   }
-  else if (lockType == LockType::Write)
+  if (state & Sleepers)
   {
-    // Lock the resource.
-    std::unique_lock<std::mutex> lk(m_mutex);
+    this->wakeWaiters(true);
+  }
+}
+
+smtk::resource::LockType Lock::state() const
+{
+  std::uint32_t state = m_state.load();
+  return (
+    (state & Writer) ? LockType::Write
+                     : ((state & ReaderMask) ? LockType::Read : LockType::Unlocked));
+}
+
+Lock::Statistics Lock::statistics() const
+{
+  Statistics stats;
+  stats.readAcquisitions = m_readAcquisitions.load();
+  stats.writeAcquisitions = m_writeAcquisitions.load();
+  stats.contendedAcquisitions = m_contendedAcquisitions.load();
+  stats.failedAcquisitions = m_failedAcquisitions.load();
+  stats.readWaitTime = std::chrono::nanoseconds(m_readWaitTime.load());
+  stats.writeWaitTime = std::chrono::nanoseconds(m_writeWaitTime.load());
+  stats.readHoldTime = std::chrono::nanoseconds(m_readHoldTime.load());
+  stats.writeHoldTime = std::chrono::nanoseconds(m_writeHoldTime.load());
+  return stats;
+}
+
+void Lock::resetStatistics()
+{
+  m_readAcquisitions = 0;
+  m_writeAcquisitions = 0;
+  m_contendedAcquisitions = 0;
+  m_failedAcquisitions = 0;
+  m_readWaitTime = 0;
+  m_writeWaitTime = 0;
+  m_readHoldTime = 0;
+  m_writeHoldTime = 0;
+}
 
-    // Remove yourself as a waiting writer.
-    --m_waitingWriters;
+bool Lock::tryAcquireRead()
+{
+  // The uncontended path: no writer holds or awaits the lock.
+  std::uint32_t state = m_state.load();
+  while (!(state & (Writer | Pending)))
+  {
+    if (m_state.compare_exchange_weak(state, state + 1))
+    {
+      this->readAcquired(state);
+      return true;
+    }
+  }
+  return false;
+}
 
-    // Remove yourself as an active writer.
-    --m_activeWriters;
+bool Lock::tryAcquireWrite()
+{
+  // The uncontended path: nobody holds or awaits the lock.
+  std::uint32_t state = 0;
+  if (m_state.compare_exchange_strong(state, Writer))
+  {
+    this->writeAcquired();
+    return true;
+  }
+  return false;
+}
 
-    if (m_waitingWriters > 0)
+bool Lock::acquireRead(const std::chrono::steady_clock::time_point* deadline)
+{
+  auto start = Clock::now();
+  ++m_contendedAcquisitions;
+  std::unique_lock<std::mutex> lk(m_mutex);
+  ++m_waitingReaders;
+  bool acquired = waitFor(m_state, m_condition, lk, deadline, [this]() {
+    std::uint32_t s = m_state.load();
+    while (!(s & Writer) && (!(s & Pending) || m_admittedReaders > 0))
     {
-      // If there are writers waiting to write, tell one of them to check if it
-      // can write.
-      m_writerCondition.notify_one();
+      if (m_state.compare_exchange_weak(s, s + 1))
+      {
+        if (m_admittedReaders > 0)
+        {
+          --m_admittedReaders;
+        }
+        this->readAcquired(s);
+        return true;
+      }
     }
-    else
+    return false;
+  });
+  --m_waitingReaders;
+  m_readWaitTime += since(start);
+  if (!acquired)
+  {
+    ++m_failedAcquisitions;
+    // We may have been admitted ahead of a writer; don't keep it waiting.
+    if (m_admittedReaders > m_waitingReaders)
     {
-      // Otherwise, tell all readers that they can read.
-      m_readerCondition.notify_all();
+      m_admittedReaders = m_waitingReaders;
+      lk.unlock();
+      m_condition.notify_all();
     }
+  }
+  return acquired;
+}
 
-    // Unlock the resource.
+bool Lock::acquireWrite(const std::chrono::steady_clock::time_point* deadline)
+{
+  auto start = Clock::now();
+  ++m_contendedAcquisitions;
+  std::unique_lock<std::mutex> lk(m_mutex);
+  ++m_waitingWriters;
+  m_state.fetch_or(Pending);
+  bool acquired = waitFor(m_state, m_condition, lk, deadline, [this]() {
+    std::uint32_t s = m_state.load();
+    while (!(s & (ReaderMask | Writer)) && m_admittedReaders == 0)
+    {
+      if (m_state.compare_exchange_weak(s, s | Writer))
+      {
+        this->writeAcquired();
+        return true;
+      }
+    }
+    return false;
+  });
+  --m_waitingWriters;
+  this->updatePending();
+  m_writeWaitTime += since(start);
+  if (!acquired)
+  {
+    ++m_failedAcquisitions;
+    // Readers held back on our account may proceed.
     lk.unlock();
+    m_condition.notify_all();
   }
+  return acquired;
 }
 
-smtk::resource::LockType Lock::state() const
+void Lock::readAcquired(std::uint32_t previousState)
 {
-  return (
-    m_activeWriters > 0 ? LockType::Write
-                        : (m_activeReaders > 0 ? LockType::Read : LockType::Unlocked));
+  ++m_readAcquisitions;
+  if ((previousState & ReaderMask) == 0)
+  {
+    m_readStart.store(now());
+  }
+}
+
+void Lock::readReleased(std::uint32_t previousState, std::int64_t readStart)
+{
+  std::uint32_t readers = previousState & ReaderMask;
+  if (readers == 1)
+  {
+    m_readHoldTime += now() - readStart;
+  }
+  // Writers wait for the last reader; upgrades wait for all but one.
+  if ((previousState & Sleepers) && readers <= 2)
+  {
+    this->wakeWaiters(false);
+  }
+}
+
+void Lock::writeAcquired()
+{
+  ++m_writeAcquisitions;
+  m_writeStart.store(now());
+}
+
+void Lock::wakeWaiters(bool admitReaders)
+{
+  {
+    std::lock_guard<std::mutex> lk(m_mutex);
+    if (admitReaders)
+    {
+      m_admittedReaders = m_waitingReaders;
+    }
+    if (m_waitingReaders == 0 && m_waitingWriters == 0 && m_waitingUpgrades == 0)
+    {
+      m_state.fetch_and(~Sleepers);
+    }
+  }
+  m_condition.notify_all();
+}
+
+void Lock::updatePending()
+{
+  if (m_waitingWriters == 0 && m_waitingUpgrades == 0)
+  {
+    m_state.fetch_and(~Pending);
+  }
 }
 
 ScopedLockGuard::ScopedLockGuard(Lock& lock, LockType lockType)
@@ -120,5 +440,41 @@ ScopedLockGuard::~ScopedLockGuard()
   m_lock.unlock(m_lockType);
 }
 
+ScopedUpgradeableLockGuard::ScopedUpgradeableLockGuard(Lock& lock)
+  : m_lock(lock)
+{
+  m_lock.lockUpgradeable();
+}
+
+ScopedUpgradeableLockGuard::~ScopedUpgradeableLockGuard()
+{
+  if (m_upgraded)
+  {
+    m_lock.unlock(LockType::Write);
+  }
+  else
+  {
+    m_lock.unlockUpgradeable();
+  }
+}
+
+void ScopedUpgradeableLockGuard::upgrade()
+{
+  if (!m_upgraded)
+  {
+    m_lock.upgrade();
+    m_upgraded = true;
+  }
+}
+
+void ScopedUpgradeableLockGuard::downgrade()
+{
+  if (m_upgraded)
+  {
+    m_lock.downgrade();
+    m_upgraded = false;
+  }
+}
+
 } // namespace resource
 } // namespace smtk
@@ -13,7 +13,10 @@
 
 #include "smtk/CoreExports.h"
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <mutex>
 
 namespace smtk
@@ -31,13 +34,43 @@ enum class LockType
   Write,
 };
 
-/// A read/write lock for resources. This lock is designed to potentially starve
-/// readers in favor of writers. This is not necessarily bad; it means that
-/// writers are given priority over readers when there are multiple readers and
-/// writers simultaneously attempting to access the resource.
+/// A read/write lock for resources.
+///
+/// Readers that find the lock free of writers take it with a single atomic
+/// operation; only contended acquisitions touch the internal mutex.
+///
+/// Writers are given priority over newly-arriving readers, but the priority
+/// is bounded: when a writer releases the lock, every reader that was already
+/// waiting is admitted before the next writer. Neither readers nor writers can
+/// be starved.
+///
+/// A holder may also take an *upgradeable* read lock. It shares the resource
+/// with ordinary readers but excludes writers and other upgradeable readers,
+/// so it may later be upgraded to a write lock without being released (and
+/// without another writer modifying the resource in between).
+///
+/// Each lock accumulates wait- and hold-time statistics; see statistics().
 class Lock
 {
 public:
+  /// Counters describing how a lock has been used.
+  struct Statistics
+  {
+    /// The number of read (including upgradeable) and write acquisitions.
+    std::uint64_t readAcquisitions{ 0 };
+    std::uint64_t writeAcquisitions{ 0 };
+    /// The number of acquisitions that could not take the uncontended path.
+    std::uint64_t contendedAcquisitions{ 0 };
+    /// The number of tryLock/tryLockUntil calls that failed.
+    std::uint64_t failedAcquisitions{ 0 };
+    /// Total time threads spent waiting to acquire read or write access.
+    std::chrono::nanoseconds readWaitTime{ 0 };
+    std::chrono::nanoseconds writeWaitTime{ 0 };
+    /// Total time the lock was held by at least one reader, or by a writer.
+    std::chrono::nanoseconds readHoldTime{ 0 };
+    std::chrono::nanoseconds writeHoldTime{ 0 };
+  };
+
   SMTKCORE_EXPORT Lock();
   Lock(const Lock&) = delete;
   Lock& operator=(const Lock&) = delete;
@@ -45,15 +78,68 @@ public:
   SMTKCORE_EXPORT void lock(LockType);
   SMTKCORE_EXPORT void unlock(LockType);
 
+  /// Acquire the lock only if it is immediately available.
+  /// Returns true if the lock was acquired.
+  SMTKCORE_EXPORT bool tryLock(LockType);
+
+  /// Acquire the lock, waiting no later than \a deadline for it to become
+  /// available. Returns true if the lock was acquired.
+  SMTKCORE_EXPORT bool tryLockUntil(
+    LockType,
+    const std::chrono::steady_clock::time_point& deadline);
+
+  /// Acquire an upgradeable read lock. At most one thread may hold an
+  /// upgradeable read lock at a time; it coexists with ordinary readers.
+  SMTKCORE_EXPORT void lockUpgradeable();
+  /// Release an upgradeable read lock that has not been upgraded.
+  SMTKCORE_EXPORT void unlockUpgradeable();
+  /// Convert a held upgradeable read lock into a write lock, waiting for
+  /// ordinary readers to finish. Release it with unlock(LockType::Write)
+  /// or return to an upgradeable read lock with downgrade().
+  SMTKCORE_EXPORT void upgrade();
+  /// Convert a held write lock into an upgradeable read lock, admitting
+  /// waiting readers.
+  SMTKCORE_EXPORT void downgrade();
+
   SMTKCORE_EXPORT LockType state() const;
 
+  /// Return a snapshot of this lock's usage counters.
+  SMTKCORE_EXPORT Statistics statistics() const;
+  /// Reset all usage counters to zero.
+  SMTKCORE_EXPORT void resetStatistics();
+
 private:
+  bool acquireRead(const std::chrono::steady_clock::time_point* deadline);
+  bool acquireWrite(const std::chrono::steady_clock::time_point* deadline);
+  bool tryAcquireRead();
+  bool tryAcquireWrite();
+  void readAcquired(std::uint32_t previousState);
+  void readReleased(std::uint32_t previousState, std::int64_t readStart);
+  void writeAcquired();
+  void wakeWaiters(bool admitReaders);
+  void updatePending();
+
+  // Reader count, upgrader/writer flags, and waiter hints packed in one word.
+  std::atomic<std::uint32_t> m_state{ 0 };
+
+  // Guarded by m_mutex; only used by contended acquisitions.
   std::mutex m_mutex;
-  std::condition_variable m_readerCondition;
-  std::condition_variable m_writerCondition;
-  std::size_t m_activeReaders{ 0 };
+  std::condition_variable m_condition;
+  std::size_t m_waitingReaders{ 0 };
   std::size_t m_waitingWriters{ 0 };
-  std::size_t m_activeWriters{ 0 };
+  std::size_t m_waitingUpgrades{ 0 };
+  std::size_t m_admittedReaders{ 0 };
+
+  std::atomic<std::uint64_t> m_readAcquisitions{ 0 };
+  std::atomic<std::uint64_t> m_writeAcquisitions{ 0 };
+  std::atomic<std::uint64_t> m_contendedAcquisitions{ 0 };
+  std::atomic<std::uint64_t> m_failedAcquisitions{ 0 };
+  std::atomic<std::int64_t> m_readWaitTime{ 0 };
+  std::atomic<std::int64_t> m_writeWaitTime{ 0 };
+  std::atomic<std::int64_t> m_readHoldTime{ 0 };
+  std::atomic<std::int64_t> m_writeHoldTime{ 0 };
+  std::atomic<std::int64_t> m_readStart{ 0 };
+  std::atomic<std::int64_t> m_writeStart{ 0 };
 };
 
 /// A scope-guarded utility for handling locks.
@@ -67,6 +153,24 @@ private:
   Lock& m_lock;
   LockType m_lockType;
 };
+
+/// A scope-guarded upgradeable read lock. Call upgrade() to obtain write
+/// access; the guard releases whichever lock is held when it is destroyed.
+class SMTKCORE_EXPORT ScopedUpgradeableLockGuard
+{
+public:
+  ScopedUpgradeableLockGuard(Lock&);
+  ~ScopedUpgradeableLockGuard();
+
+  void upgrade();
+  void downgrade();
+
+  bool upgraded() const { return m_upgraded; }
+
+private:
+  Lock& m_lock;
+  bool m_upgraded{ false };
+};
 } // namespace resource
 } // namespace smtk
 
@@ -196,6 +196,9 @@ public:
   /// Anyone can query whether or not the resource is locked.
   LockType locked() const { return m_lock.state(); }
 
+  /// Anyone can query how long threads have waited for and held the resource's lock.
+  Lock::Statistics lockStatistics() const { return m_lock.statistics(); }
+
   Resource(Resource&&) noexcept;
 
 protected:
@@ -0,0 +1,116 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/resource/Lock.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using smtk::resource::Lock;
+using smtk::resource::LockType;
+
+void testUpgrade()
+{
+  Lock lock;
+  std::atomic<int> writers(0);
+  std::atomic<int> readers(0);
+  long value = 0;
+
+  // Many threads read-modify-write through upgradeable locks while others read.
+  std::vector<std::thread> threads;
+  for (int tt = 0; tt < 4; ++tt)
+  {
+    threads.emplace_back([&]() {
+      for (int ii = 0; ii < 2000; ++ii)
+      {
+        smtk::resource::ScopedUpgradeableLockGuard guard(lock);
+        long current = value;
+        guard.upgrade();
+        smtkTest(++writers == 1 && readers == 0, "Upgraded lock is not exclusive.");
+        value = current + 1;
+        --writers;
+      }
+    });
+    threads.emplace_back([&]() {
+      for (int ii = 0; ii < 2000; ++ii)
+      {
+        smtk::resource::ScopedLockGuard guard(lock, LockType::Read);
+        ++readers;
+        smtkTest(writers == 0, "Reader admitted while a writer holds the lock.");
+        --readers;
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  smtkTest(value == 8000, "Upgrades lost updates: " << value << " instead of 8000.");
+  smtkTest(lock.state() == LockType::Unlocked, "Lock should be released.");
+}
+
+void testTryLock()
+{
+  Lock lock;
+  lock.lock(LockType::Read);
+  smtkTest(lock.tryLock(LockType::Read), "Readers should share the lock.");
+  smtkTest(!lock.tryLock(LockType::Write), "Writer should not acquire a read-locked lock.");
+  smtkTest(
+    !lock.tryLockUntil(
+      LockType::Write, std::chrono::steady_clock::now() + std::chrono::milliseconds(10)),
+    "Writer should time out on a read-locked lock.");
+  // A writer that timed out must not block readers.
+  smtkTest(lock.tryLock(LockType::Read), "Timed-out writer should not block readers.");
+  lock.unlock(LockType::Read);
+  lock.unlock(LockType::Read);
+  lock.unlock(LockType::Read);
+  smtkTest(lock.tryLock(LockType::Write), "Writer should acquire an unlocked lock.");
+  lock.unlock(LockType::Write);
+}
+
+void testStatistics()
+{
+  Lock lock;
+  lock.lock(LockType::Read);
+  std::thread writer([&lock]() {
+    lock.lock(LockType::Write);
+    lock.unlock(LockType::Write);
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  lock.unlock(LockType::Read);
+  writer.join();
+
+  Lock::Statistics stats = lock.statistics();
+  smtkTest(stats.readAcquisitions == 1, "Expected one read, got " << stats.readAcquisitions);
+  smtkTest(stats.writeAcquisitions == 1, "Expected one write, got " << stats.writeAcquisitions);
+  smtkTest(stats.contendedAcquisitions == 1, "Expected the writer to be contended.");
+  smtkTest(
+    stats.writeWaitTime >= std::chrono::milliseconds(10), "Writer wait time was not recorded.");
+  smtkTest(
+    stats.readHoldTime >= std::chrono::milliseconds(10), "Reader hold time was not recorded.");
+
+  lock.resetStatistics();
+  stats = lock.statistics();
+  smtkTest(stats.readAcquisitions == 0 && stats.writeAcquisitions == 0, "Reset failed.");
+}
+} // namespace
+
+int TestResourceLock(int /*unused*/, char** const /*unused*/)
+{
+  testTryLock();
+  testUpgrade();
+  testStatistics();
+  return 0;
+}
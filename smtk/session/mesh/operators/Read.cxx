@@ -45,20 +45,22 @@ Read::Result Read::operateInternal()
   std::string filename = this->parameters()->findFile("filename")->value();
 
   std::ifstream file;
+  std::string index;
 
   smtk::common::Archive archive(filename);
-  if (!archive.contents().empty())
+  const bool archived = !archive.contents().empty();
+  if (archived)
   {
     std::string smtkFilename = "index.json";
 
-    archive.get(smtkFilename, file);
+    archive.read(smtkFilename, index);
   }
   else
   {
     file.open(filename);
   }
 
-  if (!file.good())
+  if (archived ? index.empty() : !file.good())
   {
     smtkErrorMacro(log(), "Cannot read file \"" << filename << "\".");
     file.close();
@@ -68,7 +70,7 @@ Read::Result Read::operateInternal()
   nlohmann::json j;
   try
   {
-    j = nlohmann::json::parse(file);
+    j = archived ? nlohmann::json::parse(index) : nlohmann::json::parse(file);
   }
   catch (...)
   {
@@ -95,7 +97,7 @@ Read::Result Read::operateInternal()
 
   std::string meshFilename = j.at("Mesh URL");
 
-  if (!archive.contents().empty())
+  if (archived)
   {
     meshFilename = archive.location(meshFilename);
   }
@@ -11,7 +11,9 @@
 
 #include <algorithm>
 #include <array>
+#include <cstring>
 #include <iostream>
+#include <vector>
 
 namespace smtk
 {
@@ -20,6 +22,238 @@ namespace string
 
 constexpr Hash Manager::Invalid;
 
+namespace
+{
+// The number of shards must be a power of two.
+constexpr std::size_t shardBits = 5;
+constexpr std::size_t numberOfShards = std::size_t(1) << shardBits;
+constexpr std::size_t minimumCapacity = 16;
+
+// Iteratively compute the same value as the (recursive) Manager::hash(), which
+// may not be evaluated at compile time for strings of arbitrary length.
+Hash hashOf(const char* data, std::size_t size)
+{
+  std::uint64_t hash = 14695981039346656037ull;
+  for (std::size_t ii = 0; ii < size; ++ii)
+  {
+    hash = (hash ^ static_cast<unsigned char>(data[ii])) * 1099511628211ull;
+  }
+  return static_cast<Hash>(hash);
+}
+
+// Scramble a hash so that both its shard and the slot it probes first
+// depend upon all of its bits. Colliding strings are assigned consecutive
+// hashes, which must not cluster in the table.
+std::uint64_t mix(Hash h)
+{
+  std::uint64_t x = static_cast<std::uint64_t>(h);
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdull;
+  x ^= x >> 33;
+  return x;
+}
+
+bool equal(const std::string& value, const char* data, std::size_t size)
+{
+  return value.size() == size && (size == 0 || std::memcmp(value.data(), data, size) == 0);
+}
+} // anonymous namespace
+
+/**\brief An open-addressed table holding the strings whose hashes map to one shard.
+  *
+  * Writers must hold m_mutex; readers never lock. Entries are allocated once and
+  * published with release semantics, so a reader that observes an entry observes
+  * its complete string. When the table grows, the old slot array is retained
+  * (rather than freed) because readers may still be probing it; likewise, erased
+  * entries are retired rather than deleted. Both are released by clear() and by
+  * the destructor.
+  */
+class Manager::Shard
+{
+public:
+  struct Entry
+  {
+    Hash id;
+    std::string value;
+  };
+
+  Shard() { this->rehash(minimumCapacity); }
+
+  ~Shard() { this->release(); }
+
+  const Entry* find(Hash id, std::uint64_t mixed) const
+  {
+    const Table* table = m_table.load(std::memory_order_acquire);
+    for (std::size_t ii = static_cast<std::size_t>(mixed >> shardBits) & table->mask;;
+         ii = (ii + 1) & table->mask)
+    {
+      const Entry* entry = table->slots[ii].load(std::memory_order_acquire);
+      if (!entry)
+      {
+        return nullptr;
+      }
+      if (entry != &s_tombstone && entry->id == id)
+      {
+        return entry;
+      }
+    }
+  }
+
+  /// Insert an entry; \a id must not be present and the caller must hold m_mutex.
+  const Entry* insert(Hash id, std::uint64_t mixed, const char* data, std::size_t size)
+  {
+    if (2 * (m_used + 1) > m_table.load(std::memory_order_relaxed)->mask + 1)
+    {
+      std::size_t capacity = minimumCapacity;
+      while (capacity < 4 * (m_size + 1))
+      {
+        capacity *= 2;
+      }
+      this->rehash(capacity);
+    }
+    Entry* entry = new Entry{ id, std::string(data, size) };
+    Table* table = m_tables.back().get();
+    std::size_t ii = static_cast<std::size_t>(mixed >> shardBits) & table->mask;
+    while (table->slots[ii].load(std::memory_order_relaxed))
+    {
+      ii = (ii + 1) & table->mask;
+    }
+    table->slots[ii].store(entry, std::memory_order_release);
+    ++m_size;
+    ++m_used;
+    return entry;
+  }
+
+  /// Erase \a id if present; the caller must hold m_mutex.
+  bool erase(Hash id, std::uint64_t mixed)
+  {
+    Table* table = m_tables.back().get();
+    for (std::size_t ii = static_cast<std::size_t>(mixed >> shardBits) & table->mask;;
+         ii = (ii + 1) & table->mask)
+    {
+      const Entry* entry = table->slots[ii].load(std::memory_order_relaxed);
+      if (!entry)
+      {
+        return false;
+      }
+      if (entry != &s_tombstone && entry->id == id)
+      {
+        table->slots[ii].store(&s_tombstone, std::memory_order_release);
+        m_retired.emplace_back(const_cast<Entry*>(entry));
+        --m_size;
+        return true;
+      }
+    }
+  }
+
+  /// Invoke \a visitor on each entry until it returns Halt.
+  smtk::common::Visit visit(const std::function<smtk::common::Visit(const Entry&)>& visitor) const
+  {
+    const Table* table = m_table.load(std::memory_order_acquire);
+    for (std::size_t ii = 0; ii <= table->mask; ++ii)
+    {
+      const Entry* entry = table->slots[ii].load(std::memory_order_acquire);
+      if (entry && entry != &s_tombstone && visitor(*entry) == smtk::common::Visit::Halt)
+      {
+        return smtk::common::Visit::Halt;
+      }
+    }
+    return smtk::common::Visit::Continue;
+  }
+
+  /// Delete every entry; the caller must hold m_mutex. Returns the number deleted.
+  std::size_t clear()
+  {
+    std::size_t removed = m_size;
+    this->release();
+    this->rehash(minimumCapacity);
+    return removed;
+  }
+
+  std::mutex m_mutex;
+
+private:
+  struct Table
+  {
+    Table(std::size_t capacity)
+      : mask(capacity - 1)
+      , slots(new std::atomic<const Entry*>[capacity])
+    {
+      for (std::size_t ii = 0; ii < capacity; ++ii)
+      {
+        slots[ii].store(nullptr, std::memory_order_relaxed);
+      }
+    }
+
+    std::size_t mask;
+    std::unique_ptr<std::atomic<const Entry*>[]> slots;
+  };
+
+  void release()
+  {
+    if (!m_tables.empty())
+    {
+      Table* table = m_tables.back().get();
+      for (std::size_t ii = 0; ii <= table->mask; ++ii)
+      {
+        const Entry* entry = table->slots[ii].load(std::memory_order_relaxed);
+        if (entry && entry != &s_tombstone)
+        {
+          delete entry;
+        }
+      }
+    }
+    m_table.store(nullptr, std::memory_order_release);
+    m_tables.clear();
+    m_retired.clear();
+    m_size = 0;
+    m_used = 0;
+  }
+
+  // Move live entries into a new table of the given capacity and publish it.
+  void rehash(std::size_t capacity)
+  {
+    std::unique_ptr<Table> next(new Table(capacity));
+    if (!m_tables.empty())
+    {
+      const Table* table = m_tables.back().get();
+      for (std::size_t ii = 0; ii <= table->mask; ++ii)
+      {
+        const Entry* entry = table->slots[ii].load(std::memory_order_relaxed);
+        if (entry && entry != &s_tombstone)
+        {
+          std::size_t jj = static_cast<std::size_t>(mix(entry->id) >> shardBits) & next->mask;
+          while (next->slots[jj].load(std::memory_order_relaxed))
+          {
+            jj = (jj + 1) & next->mask;
+          }
+          next->slots[jj].store(entry, std::memory_order_relaxed);
+        }
+      }
+    }
+    m_used = m_size;
+    m_table.store(next.get(), std::memory_order_release);
+    m_tables.push_back(std::move(next));
+  }
+
+  static const Entry s_tombstone;
+
+  std::atomic<const Table*> m_table{ nullptr };
+  std::vector<std::unique_ptr<Table>> m_tables;
+  std::vector<std::unique_ptr<Entry>> m_retired;
+  std::size_t m_size{ 0 };
+  std::size_t m_used{ 0 };
+};
+
+const Manager::Shard::Entry Manager::Shard::s_tombstone{ Manager::Invalid, std::string() };
+
+Manager::Manager()
+  : m_shards(new Shard[numberOfShards])
+{
+}
+
+Manager::~Manager() = default;
+
 std::shared_ptr<Manager> Manager::create()
 {
   auto manager = std::make_shared<Manager>();
@@ -28,78 +262,83 @@ std::shared_ptr<Manager> Manager::create()
 
 Hash Manager::manage(const std::string& s)
 {
-  std::pair<Hash, bool> hp;
-  {
-    std::lock_guard<std::mutex> lock(m_writeLock);
-    hp = this->computeInternalAndInsert(s);
-  }
+  return this->manage(s.data(), s.size(), hashOf(s.data(), s.size()));
+}
+
+Hash Manager::manage(const char* data, std::size_t size)
+{
+  return this->manage(data, size, hashOf(data, size));
+}
+
+Hash Manager::manage(const char* data, std::size_t size, Hash initial)
+{
+  std::pair<Hash, bool> hp = this->manageInternal(data, size, initial);
   if (hp.second)
   {
-    m_observers(Event::Managed, hp.first, s, Invalid);
+    // Observers are not thread-safe; serialize notifications as insert() does.
+    std::lock_guard<std::mutex> lock(m_writeLock);
+    m_observers(Event::Managed, hp.first, this->value(hp.first), Invalid);
   }
   return hp.first;
 }
 
 std::size_t Manager::unmanage(Hash h)
 {
+  const std::string* value = this->lookup(h);
+  if (!value)
+  {
+    return 0;
+  }
   std::size_t num = 0;
-  m_writeLock.lock();
-  auto it = m_data.find(h);
-  if (it == m_data.end())
+  std::vector<Hash> members;
   {
-    m_writeLock.unlock();
-    return num;
+    std::lock_guard<std::mutex> lock(m_writeLock);
+    auto it = m_sets.find(h);
+    if (it != m_sets.end())
+    {
+      members.assign(it->second.begin(), it->second.end());
+    }
   }
-  auto members = m_sets.find(h);
-  if (members != m_sets.end())
+  // Erase all sets contained in this set recursively.
+  for (auto member : members)
   {
-    // Erase all sets contained in this set recursively.
-    for (auto member : members->second)
     {
-      m_writeLock.unlock();
+      std::lock_guard<std::mutex> lock(m_writeLock);
       m_observers(Event::Removed, member, this->value(member), h);
-      num += this->unmanage(member);
-      m_writeLock.lock();
     }
+    num += this->unmanage(member);
   }
-  m_observers(Event::Unmanaged, h, it->second, Invalid);
-  num += m_data.erase(h);
-  m_writeLock.unlock();
+  {
+    std::lock_guard<std::mutex> lock(m_writeLock);
+    m_observers(Event::Unmanaged, h, *value, Invalid);
+  }
+  num += this->eraseInternal(h);
   return num;
 }
 
 const std::string& Manager::value(Hash h) const
 {
   static const std::string empty;
-  auto it = m_data.find(h);
-  if (it == m_data.end())
-  {
-    return empty;
-  }
-  return it->second;
+  const std::string* value = this->lookup(h);
+  return value ? *value : empty;
 }
 
 Hash Manager::find(const std::string& s) const
 {
-  std::pair<Hash, bool> h;
-  {
-    std::lock_guard<std::mutex> lock(m_writeLock);
-    h = this->computeInternal(s);
-  }
+  std::pair<Hash, bool> h = this->computeInternal(s.data(), s.size(), hashOf(s.data(), s.size()));
   return h.second ? h.first : Invalid;
 }
 
 Hash Manager::compute(const std::string& s) const
 {
-  // std::lock_guard<std::mutex> lock(m_writeLock);
-  return this->computeInternal(s).first;
+  return this->computeInternal(s.data(), s.size(), hashOf(s.data(), s.size())).first;
 }
 
 Hash Manager::insert(const std::string& set, Hash h)
 {
   bool didInsert = false;
   // Verify \a h is managed.
-  if (m_data.find(h) == m_data.end())
+  if (!this->lookup(h))
   {
     return Invalid;
   }
@@ -107,7 +346,7 @@ Hash Manager::insert(const std::string& set, Hash h)
   std::pair<Hash, bool> setHash{ Invalid, false };
   {
     std::lock_guard<std::mutex> lock(m_writeLock);
-    setHash = this->computeInternalAndInsert(set);
+    setHash = this->manageInternal(set.data(), set.size(), hashOf(set.data(), set.size()));
     didInsert = m_sets[setHash.first].insert(h).second;
     if (didInsert)
     {
@@ -121,7 +360,7 @@ bool Manager::insert(Hash set, Hash h)
 {
   bool didInsert = false;
   // Verify \a set and \a h are managed.
-  if (m_data.find(h) == m_data.end() || m_data.find(set) == m_data.end())
+  if (!this->lookup(h) || !this->lookup(set))
   {
     return didInsert;
   }
@@ -138,54 +377,38 @@ bool Manager::insert(Hash set, Hash h)
 
 bool Manager::remove(const std::string& set, Hash h)
 {
-  bool didRemove = false;
-  // Verify \a h is managed.
-  if (m_data.find(h) == m_data.end())
+  // Verify \a h and \a set are managed.
+  if (!this->lookup(h))
   {
-    return Invalid;
+    return false;
   }
-  // Remove \a h from \a set.
+  auto setHash = this->computeInternal(set.data(), set.size(), hashOf(set.data(), set.size()));
+  if (!setHash.second)
   {
-    std::lock_guard<std::mutex> lock(m_writeLock);
-    auto setHash = this->computeInternalAndInsert(set);
-    auto it = m_sets.find(setHash.first);
-    // Verify \a setHash is managed.
-    if (it == m_sets.end())
-    {
-      return didRemove;
-    }
-    didRemove = m_sets[setHash.first].erase(h) > 0;
-    if (didRemove)
-    {
-      m_observers(Event::Removed, h, this->value(h), setHash.first);
-      if (m_sets[setHash.first].empty())
-      {
-        m_sets.erase(setHash.first);
-      }
-    }
+    return false;
   }
-  return didRemove;
+  return this->remove(setHash.first, h);
 }
 
 bool Manager::remove(Hash set, Hash h)
 {
   bool didRemove = false;
+  const std::string* value = this->lookup(h);
   std::lock_guard<std::mutex> lock(m_writeLock);
-  auto hit = m_data.find(h);
   auto sit = m_sets.find(set);
   // Verify \a h is managed and \a set is a set.
-  if (hit == m_data.end() || sit == m_sets.end())
+  if (!value || sit == m_sets.end())
   {
     return false;
   }
   // Remove \a h from \a set.
-  didRemove = m_sets[set].erase(h) > 0;
+  didRemove = sit->second.erase(h) > 0;
   if (didRemove)
   {
-    m_observers(Event::Removed, h, hit->second, set);
-    if (m_sets[set].empty())
+    m_observers(Event::Removed, h, *value, set);
+    if (sit->second.empty())
     {
-      m_sets.erase(set);
+      m_sets.erase(sit);
     }
   }
   return didRemove;
@@ -193,8 +416,12 @@ bool Manager::remove(Hash set, Hash h)
 
 bool Manager::contains(const std::string& set, Hash h) const
 {
+  auto setHash = this->computeInternal(set.data(), set.size(), hashOf(set.data(), set.size()));
+  if (!setHash.second)
+  {
+    return false;
+  }
   std::lock_guard<std::mutex> lock(m_writeLock);
-  auto setHash = this->computeInternal(set);
   auto sit = m_sets.find(setHash.first);
   return (sit != m_sets.end() && sit->second.find(h) != sit->second.end());
 }
@@ -203,8 +430,7 @@ bool Manager::contains(Hash set, Hash h) const
 {
   if (set == Invalid)
   {
-    auto mit = m_data.find(h);
-    return mit != m_data.end();
+    return this->lookup(h) != nullptr;
   }
   auto sit = m_sets.find(set);
   return (sit != m_sets.end() && sit->second.find(h) != sit->second.end());
@@ -212,8 +438,7 @@ bool Manager::contains(Hash set, Hash h) const
 
 bool Manager::verify(Hash& verified, Hash input) const
 {
-  auto mit = m_data.find(input);
-  if (mit != m_data.end())
+  if (this->lookup(input))
   {
     verified = input;
     return true;
@@ -235,24 +460,23 @@ smtk::common::Visit Manager::visitMembers(Visitor visitor, Hash set)
     return smtk::common::Visit::Halt;
   }
 
-  m_writeLock.lock();
   if (set == Invalid)
   {
-    // Iterate over m_data.
-    for (const auto& entry : m_data)
+    // Iterate over every shard.
+    for (std::size_t ii = 0; ii < numberOfShards; ++ii)
     {
-      m_writeLock.unlock();
-      if (visitor(entry.first) == smtk::common::Visit::Halt)
+      if (
+        m_shards[ii].visit([&visitor](const Shard::Entry& entry) { return visitor(entry.id); }) ==
+        smtk::common::Visit::Halt)
       {
         return smtk::common::Visit::Halt;
       }
-      m_writeLock.lock();
     }
-    m_writeLock.unlock();
     return smtk::common::Visit::Continue;
   }
 
   // Iterate over m_sets[set].
+  m_writeLock.lock();
   auto sit = m_sets.find(set);
   if (sit == m_sets.end())
   {
@@ -303,31 +527,42 @@ void Manager::setData(
   // Remove existing entries.
   // TODO: Notification could be more efficient by only removing entries
   // not identical both before and after.
-  std::unordered_map<Hash, std::string>::iterator next;
-  m_writeLock.lock();
-  auto it = m_data.begin();
-  m_writeLock.unlock();
-  for (; it != m_data.end(); it = next)
+  std::vector<Hash> existing;
+  existing.reserve(m_size.load());
+  this->visitMembers([&existing](Hash h) {
+    existing.push_back(h);
+    return smtk::common::Visit::Continue;
+  });
+  for (const auto& h : existing)
   {
-    next = it;
-    m_writeLock.lock();
-    ++next;
-    m_writeLock.unlock();
-    this->unmanage(it->first);
+    this->unmanage(h);
   }
 
+  for (const auto& member : members)
+  {
+    // Hashes are taken from \a members verbatim, even if they differ from
+    // those this manager would compute.
+    std::uint64_t mixed = mix(member.first);
+    Shard& shard = m_shards[mixed & (numberOfShards - 1)];
+    std::lock_guard<std::mutex> lock(shard.m_mutex);
+    if (shard.erase(member.first, mixed))
+    {
+      --m_size;
+    }
+    shard.insert(member.first, mixed, member.second.data(), member.second.size());
+    ++m_size;
+  }
   m_writeLock.lock();
-  m_data = members;
   m_sets = sets;
   m_writeLock.unlock();
 
   // Notify observers of new members
-  for (const auto& member : m_data)
+  for (const auto& member : members)
   {
-    m_observers(Event::Managed, member.first, member.second, Invalid);
+    m_observers(Event::Managed, member.first, this->value(member.first), Invalid);
   }
   // Notify observers of new sets
-  for (const auto& set : m_sets)
+  for (const auto& set : sets)
   {
     for (const auto& child : set.second)
     {
@@ -338,41 +573,89 @@ void Manager::setData(
 
 void Manager::reset()
 {
+  for (std::size_t ii = 0; ii < numberOfShards; ++ii)
+  {
+    std::lock_guard<std::mutex> lock(m_shards[ii].m_mutex);
+    m_size -= m_shards[ii].clear();
+  }
   m_writeLock.lock();
-  m_data.clear();
   m_sets.clear();
   m_writeLock.unlock();
 }
 
-std::pair<Hash, bool> Manager::computeInternal(const std::string& s) const
+const std::string* Manager::lookup(Hash h) const
 {
-  std::pair<Hash, bool> result{ std::hash<std::string>{}(s), false };
+  std::uint64_t mixed = mix(h);
+  const Shard::Entry* entry = m_shards[mixed & (numberOfShards - 1)].find(h, mixed);
+  return entry ? &entry->value : nullptr;
+}
+
+std::pair<Hash, bool>
+Manager::computeInternal(const char* data, std::size_t size, Hash initial) const
+{
+  std::pair<Hash, bool> result{ initial == Invalid ? initial + 1 : initial, false };
   while (true)
   {
-    auto it = m_data.find(result.first);
-    if (it == m_data.end())
+    const std::string* value = this->lookup(result.first);
+    if (!value)
     {
       return result;
     }
-    else if (it->second == s)
+    else if (equal(*value, data, size))
     {
       result.second = true;
       return result;
     }
-    ++result.first;
+    if (++result.first == Invalid)
+    {
+      ++result.first;
+    }
   }
   return result;
 }
 
-std::pair<Hash, bool> Manager::computeInternalAndInsert(const std::string& s)
+std::pair<Hash, bool> Manager::manageInternal(const char* data, std::size_t size, Hash initial)
+{
+  Hash h = initial == Invalid ? initial + 1 : initial;
+  while (true)
+  {
+    // Probe without locking; only lock the shard when \a h appears to be free.
+    std::uint64_t mixed = mix(h);
+    Shard& shard = m_shards[mixed & (numberOfShards - 1)];
+    const Shard::Entry* entry = shard.find(h, mixed);
+    if (!entry)
+    {
+      std::lock_guard<std::mutex> lock(shard.m_mutex);
+      entry = shard.find(h, mixed);
+      if (!entry)
+      {
+        shard.insert(h, mixed, data, size);
+        ++m_size;
+        return std::make_pair(h, true);
+      }
+    }
+    if (equal(entry->value, data, size))
+    {
+      return std::make_pair(h, false);
+    }
+    if (++h == Invalid)
+    {
+      ++h;
+    }
+  }
+}
+
+std::size_t Manager::eraseInternal(Hash h)
 {
-  std::pair<Hash, bool> result = this->computeInternal(s);
-  if (result.first != Invalid)
+  std::uint64_t mixed = mix(h);
+  Shard& shard = m_shards[mixed & (numberOfShards - 1)];
+  std::lock_guard<std::mutex> lock(shard.m_mutex);
+  if (shard.erase(h, mixed))
   {
-    m_data[result.first] = s;
-    result.second = true;
+    --m_size;
+    return 1;
   }
-  return result;
+  return 0;
 }
 
 std::string eventName(const Manager::Event& e)
@@ -18,8 +18,10 @@
 #include "nlohmann/json.hpp"
 
 #include <atomic>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -37,11 +39,27 @@ using Hash = std::size_t;
 ///
 /// The manager also provides a way to store sets of strings (named with a string that is
 /// itself hashed by the manager).
+///
+/// Strings are held in a table split into independently-locked shards (selected by hash),
+/// so threads managing different strings rarely contend. Looking up a string that is
+/// already managed never locks: find(), value(), contains(), and manage() of an existing
+/// string only read the table. Managed strings never move, so references returned by
+/// value() remain valid until the string is unmanaged (or the manager is reset).
+///
+/// Since readers do not lock, memory a reader might still be using is not freed until
+/// the manager is reset or destroyed: that includes the strings removed by unmanage()
+/// and the tables a shard outgrows (whose total size is less than that of the shard's
+/// current table).
 class SMTKCORE_EXPORT Manager : public std::enable_shared_from_this<Manager>
 {
 public:
   static std::shared_ptr<Manager> create();
 
+  Manager();
+  Manager(const Manager&) = delete;
+  Manager& operator=(const Manager&) = delete;
+  ~Manager();
+
   /// Events that can occur during the lifecycle of the manager.
   enum Event
   {
@@ -65,8 +83,19 @@ public:
   /// An invalid hash (that should never exist inside the manager's storage).
   static constexpr Hash Invalid = 0;
 
+  /// Return the hash the manager initially assigns to a string.
+  ///
+  /// This is a 64-bit FNV-1a hash (truncated to the size of Hash) that can be evaluated
+  /// at compile time. A managed string's hash differs from this value only when it
+  /// collided with another string managed earlier.
+  static constexpr Hash hash(const char* data, std::size_t size)
+  {
+    return static_cast<Hash>(Manager::hashStep(data, size, 14695981039346656037ull));
+  }
+
   /// Insert a string into the manager by computing a unique hash (the returned value).
   Hash manage(const std::string& s);
+  Hash manage(const char* data, std::size_t size);
   /// Remove a hash from the manager. This also removes it from any string sets.
   std::size_t unmanage(Hash h);
 
@@ -128,7 +157,7 @@ public:
   bool verify(Hash& verified, Hash input) const;
 
   /// Return true if the manager is empty (i.e., managing no hashes) and false otherwise.
-  bool empty() const { return m_data.empty(); }
+  bool empty() const { return m_size.load() == 0; }
 
   /// Visit all members of the set (or the entire Manager if passed the Invalid hash).
   /// Your \a visitor may not modify the manager.
@@ -148,20 +177,52 @@ public:
     const std::unordered_map<Hash, std::unordered_set<Hash>>& sets);
 
   /// Reset the manager to an empty state, clearing both members and sets.
+  ///
+  /// This frees the manager's storage, so unlike other methods it must not be
+  /// called while other threads may be using the manager (including through
+  /// tokens).
   void reset();
 
 protected:
   /// This class is a friend so it can access the m_translation table.
   friend class DeserializationContext;
+  /// This class is a friend so that literals can be managed with precomputed hashes.
+  friend class Token;
   /// This function is a friend so it can access m_translation.
   friend void SMTKCORE_EXPORT from_json(const nlohmann::json&, std::shared_ptr<Manager>&);
 
-  /// Same as compute() but does not lock (you must hold m_writeLock upon entry).
-  std::pair<Hash, bool> computeInternal(const std::string& s) const;
-  std::pair<Hash, bool> computeInternalAndInsert(const std::string& s);
+  /// A portion of the string table holding hashes that map to it. Defined in Manager.cxx.
+  class Shard;
+
+  // Fold the characters of \a data into \a hash. C++11 constexpr functions cannot
+  // loop, so the string is split in halves to keep the recursion depth logarithmic.
+  static constexpr std::uint64_t hashStep(const char* data, std::size_t size, std::uint64_t hash)
+  {
+    return size == 0
+      ? hash
+      : (size == 1 ? (hash ^ static_cast<unsigned char>(*data)) * 1099511628211ull
+                   : Manager::hashStep(
+                       data + size / 2, size - size / 2, Manager::hashStep(data, size / 2, hash)));
+  }
+
+  /// Return the string stored under \a h or null if \a h is not managed.
+  const std::string* lookup(Hash h) const;
+
+  /// Find the hash for \a data starting from its initial hash \a initial.
+  /// The boolean is true when the string is already managed.
+  std::pair<Hash, bool> computeInternal(const char* data, std::size_t size, Hash initial) const;
+  /// Find or insert \a data. The boolean is true when the string was inserted.
+  /// Observers are not notified.
+  std::pair<Hash, bool> manageInternal(const char* data, std::size_t size, Hash initial);
+  /// Manage \a data, whose initial hash is \a initial, notifying observers upon insertion.
+  Hash manage(const char* data, std::size_t size, Hash initial);
+  /// Remove \a h from the string table (but not from sets). Returns the number removed.
+  std::size_t eraseInternal(Hash h);
 
   Observers m_observers;
-  std::unordered_map<Hash, std::string> m_data;
+  std::unique_ptr<Shard[]> m_shards;
+  std::atomic<std::size_t> m_size{ 0 };
+  /// Guards m_sets and m_translation and serializes observer notifications.
   std::unordered_map<Hash, std::unordered_set<Hash>> m_sets;
   mutable std::mutex m_writeLock;
 
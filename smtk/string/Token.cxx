@@ -11,9 +11,7 @@
 
 #include <cstring>
 #include <exception>
-#include <thread>
-
-static std::mutex s_managerLock;
+#include <stdexcept>
 
 namespace smtk
 {
@@ -34,7 +32,7 @@ Token::Token(const char* data, std::size_t size)
     {
       size = std::strlen(data);
     }
-    m_id = Token::manager().manage(std::string(data, size));
+    m_id = Token::manager().manage(data, size);
   }
 }
 
@@ -80,28 +78,29 @@ bool Token::operator>=(const Token& other) const
 
 Manager& Token::manager()
 {
-  if (s_manager)
-  {
-    return *s_manager;
-  }
-  else
-  {
-    std::lock_guard<std::mutex> lock(s_managerLock);
-    s_manager = Manager::create();
-    return *s_manager;
-  }
+  // Function-local statics are initialized exactly once, even when
+  // tokens are first constructed on several threads at the same time.
+  static Manager* manager = (s_manager = Manager::create()).get();
+  return *manager;
 }
 
 Token Token::fromHash(Hash h)
 {
   Token result;
-  if (!s_manager->verify(result.m_id, h))
+  if (!Token::manager().verify(result.m_id, h))
   {
     throw std::invalid_argument("Hash does not exist in database.");
   }
   return result;
 }
 
+Token Token::fromLiteral(const char* data, std::size_t size, Hash initial)
+{
+  Token result;
+  result.m_id = Token::manager().manage(data, size, initial);
+  return result;
+}
+
 } // namespace string
 } // namespace smtk
 
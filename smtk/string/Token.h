@@ -60,20 +60,80 @@ public:
   /// It will throw an exception if the hash does not exist in the manager.
   static Token fromHash(Hash h);
 
+  /// Construct a token from a string whose initial hash, \a initial, has been
+  /// computed by Manager::hash() (usually at compile time).
+  ///
+  /// Once the string is managed, this only reads the manager's table.
+  /// This method exists for the `_token` literal operator.
+  static Token fromLiteral(const char* data, std::size_t size, Hash initial);
+
 protected:
   Hash m_id;
   static std::shared_ptr<Manager> s_manager;
 };
 
+/**\brief A string literal along with its hash; the type of `_token` literals.
+  *
+  * Literals are constant expressions, so the hash is computed by the compiler
+  * (always when the literal is used in a constant expression and, in practice,
+  * whenever optimization is enabled). A literal converts to a Token; the string
+  * is inserted into the manager the first time a literal is converted and only
+  * looked up afterward.
+  */
+class Literal
+{
+public:
+  constexpr Literal(const char* data, std::size_t size)
+    : m_data(data)
+    , m_size(size)
+    , m_hash(Manager::hash(data, size))
+  {
+  }
+
+  /// Return the hash the manager initially assigns to the literal.
+  constexpr Hash hash() const { return m_hash; }
+
+  /// Return the token for the literal.
+  Token token() const { return Token::fromLiteral(m_data, m_size, m_hash); }
+  operator Token() const { return this->token(); }
+
+  /// Return the ID and string of the literal's token.
+  Hash id() const { return this->token().id(); }
+  const std::string& data() const { return this->token().data(); }
+
+private:
+  const char* m_data;
+  std::size_t m_size;
+  Hash m_hash;
+};
+
 /// Construct a token from a string literal, like so:
 ///
 /// ```c++
 /// smtk::string::Token t = """test"""_token
-/// std::cout << t.value() << "\n"; // Prints "test"
+/// std::cout << t.data() << "\n"; // Prints "test"
 /// ```
-inline Token operator""_token(const char* data, std::size_t size)
+///
+/// The literal's hash is computed by the compiler (see Literal).
+constexpr Literal operator""_token(const char* data, std::size_t size)
+{
+  return Literal(data, size);
+}
+
+/// Compute the hash of a string literal at compile time, like so:
+///
+/// ```c++
+/// switch (token.id())
+/// {
+///   case "foo"_hash: ...
+/// }
+/// ```
+///
+/// This is the hash a token for the same string holds unless the string
+/// collided with another managed string (see Manager::hash()).
+constexpr Hash operator""_hash(const char* data, std::size_t size)
 {
-  return Token{ data, size };
+  return Manager::hash(data, size);
 }
 
 } // namespace string
@@ -14,6 +14,9 @@
 
 #include "smtk/common/testing/cxx/helpers.h"
 
+#include <thread>
+#include <vector>
+
 namespace
 {
 
@@ -69,12 +72,79 @@ nlohmann::json linux_j = { { "members",
                                    6845680313955517857ull,
                                    9631199822919835226ull } } } } };
 
+
+// Manage overlapping sets of strings from several threads and verify that
+// every thread was given the same hash for each string.
+void testConcurrentManagement()
+{
+  auto manager = smtk::string::Manager::create();
+  const std::size_t numberOfThreads = 8;
+  const std::size_t numberOfStrings = 16384;
+  std::vector<std::vector<smtk::string::Hash>> hashes(
+    numberOfThreads, std::vector<smtk::string::Hash>(numberOfStrings));
+  std::vector<std::thread> threads;
+  for (std::size_t tt = 0; tt < numberOfThreads; ++tt)
+  {
+    threads.emplace_back([&manager, &hashes, tt, numberOfStrings]() {
+      for (std::size_t ii = 0; ii < numberOfStrings; ++ii)
+      {
+        // Visit strings in a different order on each thread (odd strides
+        // permute a power-of-two number of strings).
+        std::size_t jj = (ii * (2 * tt + 1)) % numberOfStrings;
+        hashes[tt][jj] = manager->manage("string " + std::to_string(jj));
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  std::size_t count = 0;
+  manager->visitMembers([&count](smtk::string::Hash) {
+    ++count;
+    return smtk::common::Visit::Continue;
+  });
+  test(count == numberOfStrings, "Expected each string to be managed exactly once.");
+  for (std::size_t ii = 0; ii < numberOfStrings; ++ii)
+  {
+    std::string value = "string " + std::to_string(ii);
+    for (std::size_t tt = 1; tt < numberOfThreads; ++tt)
+    {
+      test(hashes[tt][ii] == hashes[0][ii], "Expected threads to agree on " + value);
+    }
+    test(manager->value(hashes[0][ii]) == value, "Expected hash to map to " + value);
+    test(manager->find(value) == hashes[0][ii], "Expected to find " + value);
+  }
+}
+
+// Verify that a string whose hash is taken by another string is given
+// the next available hash.
+void testCollisions()
+{
+  using namespace smtk::string;
+  auto manager = Manager::create();
+  Hash initial = Manager::hash("victim", 6);
+  manager->setData({ { initial, "squatter" } }, {});
+  test(manager->find("victim") == Manager::Invalid, "Expected victim to be unmanaged.");
+  test(manager->compute("victim") == initial + 1, "Expected collision to be resolved.");
+  Hash victim = manager->manage("victim");
+  test(victim == initial + 1, "Expected victim to be managed at the next hash.");
+  test(manager->manage("victim") == victim, "Expected managing twice to be idempotent.");
+  test(manager->value(initial) == "squatter", "Expected squatter to be retained.");
+  test(manager->unmanage(initial) == 1, "Expected to unmanage squatter.");
+  test(manager->value(victim) == "victim", "Expected victim to be retained.");
+}
+
 } // anonymous namespace
 
 int TestManager(int, char*[])
 {
   using namespace smtk::string;
 
+  testConcurrentManagement();
+  testCollisions();
+
   std::size_t ocount = 0;
   std::function<void(Manager::Event, Hash, const std::string&, Hash)> observer =
     [&ocount](Manager::Event event, Hash h, const std::string& s, Hash set) {
@@ -118,7 +188,8 @@ int TestManager(int, char*[])
   }
 
   std::cout << "\nobserved " << ocount << " events\n\n";
-  test(ocount == 21, "Expected 21 observer firings (11 for fooset, 10 for unixy).");
+  // Managing a string that is already managed ("freen") is not an event.
+  test(ocount == 20, "Expected 20 observer firings (11 for fooset, 9 for unixy).");
   ocount = 0;
 
   // Test to_json.
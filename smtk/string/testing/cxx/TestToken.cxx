@@ -28,9 +28,9 @@ int TestToken(int, char*[])
   smtk::string::Token tmp = "tmp";
 
   // Test that construction from our string literal operator works.
-  auto foo = "foo"_token;
-  auto bar = "bar"_token;
-  auto oof = "foo"_token;
+  Token foo = "foo"_token;
+  Token bar = "bar"_token;
+  Token oof = "foo"_token;
 
   std::cout << bad.data() << " "
             << "0x" << std::hex << bad.id() << std::dec << "\n";
@@ -66,6 +66,34 @@ int TestToken(int, char*[])
   test(bar < "foo", "String lexical order must be preserved.");
   test(foo > "bar", "String lexical order must be preserved.");
 
+  // Test that literal hashes are computed at compile time and match token IDs.
+  static_assert("foo"_hash == Manager::hash("foo", 3), "Expected a compile-time hash.");
+  static_assert("foo"_hash != "bar"_hash, "Expected distinct compile-time hashes.");
+  static_assert("foo"_token.hash() == "foo"_hash, "Expected a compile-time literal hash.");
+#define SMTK_TEST_64 "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef"
+#define SMTK_TEST_512                                                                              \
+  SMTK_TEST_64 SMTK_TEST_64 SMTK_TEST_64 SMTK_TEST_64 SMTK_TEST_64 SMTK_TEST_64 SMTK_TEST_64       \
+    SMTK_TEST_64
+  static_assert(
+    SMTK_TEST_512 SMTK_TEST_512 SMTK_TEST_512 SMTK_TEST_512 ""_hash != Manager::Invalid,
+    "Expected long literals to be hashed at compile time.");
+#undef SMTK_TEST_512
+#undef SMTK_TEST_64
+  test(foo.id() == "foo"_hash, "Expected literal token to use its compile-time hash.");
+  test(Token(std::string("foo")) == foo, "Expected std::string and literal tokens to match.");
+  test(Token("foo", 3) == foo, "Expected C-string and literal tokens to match.");
+  switch (bar.id())
+  {
+    case "foo"_hash:
+      test(false, "Token matched the wrong case label.");
+      break;
+    case "bar"_hash:
+      break;
+    default:
+      test(false, "Token did not match its case label.");
+      break;
+  }
+
   // Test hash functor (verify that unordered containers are supported).
   std::unordered_set<smtk::string::Token> set;
   set.insert("foo"_token);
@@ -0,0 +1,198 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/string/Manager.h"
+#include "smtk/string/Token.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Measure string-interning throughput (strings/sec) as the number of threads
+// constructing tokens grows.
+//
+// The SingleLockManager below reproduces the previous string manager (one
+// std::unordered_map guarded by one mutex that is taken for every lookup)
+// so that it can be compared against the sharded manager.
+
+namespace
+{
+class SingleLockManager
+{
+public:
+  smtk::string::Hash manage(const std::string& s)
+  {
+    std::lock_guard<std::mutex> lock(m_writeLock);
+    smtk::string::Hash h = std::hash<std::string>{}(s);
+    while (true)
+    {
+      auto it = m_data.find(h);
+      if (it == m_data.end())
+      {
+        m_data[h] = s;
+        return h;
+      }
+      else if (it->second == s)
+      {
+        return h;
+      }
+      ++h;
+    }
+  }
+
+private:
+  std::unordered_map<smtk::string::Hash, std::string> m_data;
+  std::mutex m_writeLock;
+};
+
+class Timer
+{
+public:
+  Timer()
+    : m_start(std::chrono::steady_clock::now())
+  {
+  }
+  double elapsed() const
+  {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+  }
+
+private:
+  std::chrono::steady_clock::time_point m_start;
+};
+
+void report(
+  const std::string& label,
+  unsigned int numberOfThreads,
+  std::size_t count,
+  double deltaT)
+{
+  std::cout << "  " << label << " (" << numberOfThreads << " threads): " << count << " strings "
+            << deltaT << " seconds " << (count / deltaT) << " strings/sec\n";
+}
+
+// Run \a body(thread, begin, end) on \a numberOfThreads threads, each handed an
+// equal share of [0, count), and return the elapsed time.
+template<typename Body>
+double run(unsigned int numberOfThreads, std::size_t count, Body body)
+{
+  Timer timer;
+  std::vector<std::thread> threads;
+  for (unsigned int tt = 0; tt < numberOfThreads; ++tt)
+  {
+    std::size_t begin = count * tt / numberOfThreads;
+    std::size_t end = count * (tt + 1) / numberOfThreads;
+    threads.emplace_back([&body, tt, begin, end]() { body(tt, begin, end); });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  return timer.elapsed();
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  std::size_t numberOfStrings = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+  unsigned int maximumThreads = std::max(std::thread::hardware_concurrency(), 1u);
+
+  std::vector<std::string> strings(numberOfStrings);
+  for (std::size_t ii = 0; ii < numberOfStrings; ++ii)
+  {
+    strings[ii] = "node type " + std::to_string(ii);
+  }
+
+  for (unsigned int numberOfThreads = 1; numberOfThreads <= maximumThreads; numberOfThreads *= 2)
+  {
+    std::cout << numberOfThreads << " threads\n";
+
+    // Insert new strings. Every thread interns its own share of the strings.
+    {
+      SingleLockManager manager;
+      double deltaT = run(
+        numberOfThreads, numberOfStrings, [&](unsigned int, std::size_t begin, std::size_t end) {
+          for (std::size_t ii = begin; ii < end; ++ii)
+          {
+            manager.manage(strings[ii]);
+          }
+        });
+      report("single-lock manage (new)", numberOfThreads, numberOfStrings, deltaT);
+
+      // Look up existing strings. Every thread interns every string.
+      deltaT = run(
+        numberOfThreads, numberOfStrings, [&](unsigned int, std::size_t begin, std::size_t end) {
+          for (std::size_t ii = begin; ii < end; ++ii)
+          {
+            manager.manage(strings[(ii * 7919) % numberOfStrings]);
+          }
+        });
+      report("single-lock manage (existing)", numberOfThreads, numberOfStrings, deltaT);
+    }
+
+    {
+      auto manager = smtk::string::Manager::create();
+      double deltaT = run(
+        numberOfThreads, numberOfStrings, [&](unsigned int, std::size_t begin, std::size_t end) {
+          for (std::size_t ii = begin; ii < end; ++ii)
+          {
+            manager->manage(strings[ii]);
+          }
+        });
+      report("string::Manager manage (new)", numberOfThreads, numberOfStrings, deltaT);
+
+      deltaT = run(
+        numberOfThreads, numberOfStrings, [&](unsigned int, std::size_t begin, std::size_t end) {
+          for (std::size_t ii = begin; ii < end; ++ii)
+          {
+            manager->manage(strings[(ii * 7919) % numberOfStrings]);
+          }
+        });
+      report("string::Manager manage (existing)", numberOfThreads, numberOfStrings, deltaT);
+    }
+
+    // Construct tokens from literals, as graph filters and node types do.
+    {
+      std::vector<std::size_t> sums(numberOfThreads, 0);
+      double deltaT = run(
+        numberOfThreads, numberOfStrings, [&](unsigned int tt, std::size_t begin, std::size_t end) {
+          using namespace smtk::string;
+          std::size_t sum = 0;
+          for (std::size_t ii = begin; ii < end; ++ii)
+          {
+            switch (ii % 4)
+            {
+              case 0:
+                sum += "smtk::graph::Component"_token.id();
+                break;
+              case 1:
+                sum += "smtk::markup::UnstructuredData"_token.id();
+                break;
+              case 2:
+                sum += "arcs"_token.id();
+                break;
+              default:
+                sum += "name"_token.id();
+                break;
+            }
+          }
+          sums[tt] = sum;
+        });
+      report("_token literals", numberOfThreads, numberOfStrings, deltaT);
+    }
+  }
+
+  return 0;
+}
@@ -14,10 +14,12 @@
 #include "smtk/task/json/Helper.h"
 #include "smtk/task/json/jsonFillOutAttributes.h"
 
+#include "smtk/operation/ChangeSet.h"
 #include "smtk/operation/Manager.h"
 #include "smtk/operation/SpecificationOps.h"
 
 #include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/Definition.h"
 #include "smtk/attribute/Resource.h"
 #include "smtk/attribute/ResourceItem.h"
 #include "smtk/io/Logger.h"
@@ -30,6 +32,112 @@ namespace smtk
 {
 namespace task
 {
+namespace
+{
+
+// Attributes itemized as created or modified by an operation, by resource.
+using ModifiedAttributes = std::map<smtk::common::UUID, std::set<smtk::attribute::AttributePtr>>;
+
+/// Sort the attributes an operation reports as created or modified by
+/// resource. Any attribute resource mentioned by other items in the result
+/// (or whose attributes were expunged) is added to \a wholesale, since its
+/// changes are not itemized. Returns false if an expunged attribute cannot be
+/// traced back to its resource, in which case nothing should be revalidated
+/// incrementally.
+bool itemizeChanges(
+  const smtk::operation::Operation::Result& result,
+  ModifiedAttributes& modified,
+  std::set<smtk::common::UUID>& wholesale)
+{
+  using Kind = smtk::operation::ChangeSet::Kind;
+
+  // Created, modified and expunged objects are reported by the change set.
+  auto changes = smtk::operation::ChangeSet::of(result);
+  for (const auto& entry : changes->changes())
+  {
+    const auto& resourceChanges = entry.second;
+    auto resource = std::dynamic_pointer_cast<smtk::attribute::Resource>(resourceChanges.resource);
+    if (!resource)
+    {
+      for (const auto& held : resourceChanges.held)
+      {
+        if (std::dynamic_pointer_cast<smtk::attribute::Attribute>(held.second))
+        {
+          return false;
+        }
+      }
+      continue;
+    }
+    if (!resourceChanges[Kind::EXPUNGED].empty())
+    {
+      wholesale.insert(resource->id());
+    }
+    for (auto kind : { Kind::CREATED, Kind::MODIFIED })
+    {
+      for (const auto& id : resourceChanges[kind])
+      {
+        if (id == resource->id())
+        {
+          wholesale.insert(resource->id());
+        }
+        else if (
+          auto attribute =
+            std::dynamic_pointer_cast<smtk::attribute::Attribute>(resourceChanges.object(id)))
+        {
+          modified[resource->id()].insert(attribute);
+        }
+      }
+    }
+  }
+
+  std::vector<smtk::attribute::Item::Ptr> items;
+  result->filterItems(
+    items,
+    [](smtk::attribute::Item::Ptr item) {
+      return item->type() == smtk::attribute::Item::ReferenceType ||
+        item->type() == smtk::attribute::Item::ResourceType ||
+        item->type() == smtk::attribute::Item::ComponentType;
+    },
+    false);
+  if (result->associations())
+  {
+    items.push_back(result->associations());
+  }
+
+  for (const auto& item : items)
+  {
+    const std::string& name = item->name();
+    if (
+      name == "resourcesToExpunge" || name == "created" || name == "modified" ||
+      name == "expunged")
+    {
+      continue;
+    }
+    auto referenceItem = std::static_pointer_cast<smtk::attribute::ReferenceItem>(item);
+    for (std::size_t ii = 0; ii < referenceItem->numberOfValues(); ++ii)
+    {
+      if (!referenceItem->isSet(ii))
+      {
+        continue;
+      }
+      auto object = referenceItem->value(ii);
+      if (auto attribute = std::dynamic_pointer_cast<smtk::attribute::Attribute>(object))
+      {
+        if (auto resource = attribute->attributeResource())
+        {
+          wholesale.insert(resource->id());
+        }
+      }
+      else if (auto resource = std::dynamic_pointer_cast<smtk::attribute::Resource>(object))
+      {
+        wholesale.insert(resource->id());
+      }
+    }
+  }
+  return true;
+}
+
+} // anonymous namespace
 
 constexpr const char* const FillOutAttributes::type_name;
 
@@ -293,6 +401,61 @@ bool FillOutAttributes::updateResourceEntry(
   return changesMade;
 }
 
+bool FillOutAttributes::updateModifiedAttributes(
+  smtk::attribute::Resource& resource,
+  const AttributeSet& predicate,
+  ResourceAttributes& entry,
+  const std::set<smtk::attribute::AttributePtr>& attributes)
+{
+  std::vector<smtk::attribute::DefinitionPtr> definitions;
+  definitions.reserve(predicate.m_definitions.size());
+  for (const auto& definitionName : predicate.m_definitions)
+  {
+    if (auto definition = resource.findDefinition(definitionName))
+    {
+      definitions.push_back(definition);
+    }
+  }
+
+  bool changesMade = false;
+  for (const auto& attribute : attributes)
+  {
+    const auto& uid = attribute->id();
+    bool wasValid = entry.m_valid.find(uid) != entry.m_valid.end();
+    bool wasInvalid = !wasValid && entry.m_invalid.find(uid) != entry.m_invalid.end();
+    if (!wasValid && !wasInvalid)
+    {
+      // Only attributes that the predicate selects are tracked.
+      bool selected = predicate.m_instances.find(attribute->name()) != predicate.m_instances.end();
+      for (auto it = definitions.begin(); !selected && it != definitions.end(); ++it)
+      {
+        selected = attribute->definition()->isA(*it);
+      }
+      if (!selected)
+      {
+        continue;
+      }
+    }
+
+    if (attribute->isValid())
+    {
+      if (!wasValid)
+      {
+        entry.m_invalid.erase(uid);
+        entry.m_valid.insert(uid);
+        changesMade = true;
+      }
+    }
+    else if (!wasInvalid)
+    {
+      entry.m_valid.erase(uid);
+      entry.m_invalid.insert(uid);
+      changesMade = true;
+    }
+  }
+  return changesMade;
+}
+
 bool FillOutAttributes::testValidity(
   const smtk::attribute::AttributePtr& attribute,
   ResourceAttributes& entry)
@@ -333,6 +496,12 @@ int FillOutAttributes::update(
         predicatesUpdated = true; //categories have been changed
       }
       auto mentionedResources = smtk::operation::extractResources(result);
+      // Determine which attributes the operation reports having changed so
+      // that only those need to be revalidated.
+      ModifiedAttributes modifiedAttributes;
+      std::set<smtk::common::UUID> wholesale;
+      bool incremental =
+        !predicatesUpdated && itemizeChanges(result, modifiedAttributes, wholesale);
 
       for (const auto& weakResource : mentionedResources)
       {
@@ -345,6 +514,7 @@ int FillOutAttributes::update(
           {
             auto it = predicate.m_resources.find(resource->id());
             bool doUpdate = false;
+            bool isNew = false;
             if (it != predicate.m_resources.end())
             {
               doUpdate = true;
@@ -356,11 +526,23 @@ int FillOutAttributes::update(
               {
                 it = predicate.m_resources.insert({ resource->id(), { {}, {} } }).first;
                 doUpdate = true;
+                isNew = true;
               }
             }
             if (doUpdate)
             {
-              predicatesUpdated |= this->updateResourceEntry(*resource, predicate, it->second);
+              auto modified = modifiedAttributes.find(resource->id());
+              if (
+                incremental && !isNew && modified != modifiedAttributes.end() &&
+                wholesale.find(resource->id()) == wholesale.end())
+              {
+                predicatesUpdated |= this->updateModifiedAttributes(
+                  *resource, predicate, it->second, modified->second);
+              }
+              else
+              {
+                predicatesUpdated |= this->updateResourceEntry(*resource, predicate, it->second);
+              }
             }
           }
         }
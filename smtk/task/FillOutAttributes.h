@@ -36,6 +36,12 @@ class ResourceAndRole;
   * After each operation, attributes with a definition are validated.
   * If all attributes identify are valid, the task becomes completable.
   * Otherwise, the task will remain (or become) incomplete.
+  *
+  * Validity is tracked incrementally: when an operation's result itemizes
+  * the attributes it created or modified, only those attributes are
+  * revalidated. Resources that are mentioned without itemized changes
+  * (or whose categories changed, or from which attributes were expunged)
+  * have all of their matching attributes revalidated.
   */
 class SMTKCORE_EXPORT FillOutAttributes : public Task
 {
@@ -108,6 +114,14 @@ protected:
     smtk::attribute::Resource& resource,
     const AttributeSet& predicate,
     ResourceAttributes& entry);
+  /// Revalidate only the given (created or modified) attributes of a resource
+  /// in a predicate. Returns true if the set of valid or invalid attributes
+  /// changed.
+  bool updateModifiedAttributes(
+    smtk::attribute::Resource& resource,
+    const AttributeSet& predicate,
+    ResourceAttributes& entry,
+    const std::set<smtk::attribute::AttributePtr>& attributes);
   /// Respond to operations that may change task state.
   int update(
     const smtk::operation::Operation& op,
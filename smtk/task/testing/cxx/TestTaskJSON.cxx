@@ -222,6 +222,53 @@ int TestTaskJSON(int, char*[])
   std::cout << "Signaled after associating to the material\n";
   // Finally, the FillOutAttributes task is completable
   printTaskStates(taskManager);
+  test(
+    fillOutAttributes->state() == smtk::task::State::Completable,
+    "Expected FillOutAttributes to be completable once the material is associated.");
+
+  // Only the attributes itemized by an operation are revalidated, so a new
+  // invalid attribute must make the task incomplete and fixing it must make
+  // the task completable again.
+  auto material2 = attrib->createAttribute("Aluminum", "Material");
+  signal->parameters()->findComponent("modified")->setNumberOfValues(0);
+  signal->parameters()->findComponent("created")->appendValue(material2);
+  result = signal->operate();
+  test(
+    fillOutAttributes->state() == smtk::task::State::Incomplete,
+    "Expected an unassociated material to make FillOutAttributes incomplete.");
+
+  // Modifying a different attribute must not hide the invalid one.
+  signal->parameters()->findComponent("created")->setNumberOfValues(0);
+  signal->parameters()->findComponent("modified")->appendValue(material1);
+  result = signal->operate();
+  test(
+    fillOutAttributes->state() == smtk::task::State::Incomplete,
+    "Expected FillOutAttributes to remain incomplete.");
+
+  material2->associate(volume2.component());
+  signal->parameters()->findComponent("modified")->setValue(material2);
+  result = signal->operate();
+  test(
+    fillOutAttributes->state() == smtk::task::State::Completable,
+    "Expected FillOutAttributes to be completable once both materials are associated.");
+
+  // Expunging an attribute causes the whole resource to be re-examined, so
+  // the removed (invalid) attribute is forgotten.
+  material2->disassociate(volume2.component());
+  signal->parameters()->findComponent("modified")->setValue(material2);
+  result = signal->operate();
+  test(
+    fillOutAttributes->state() == smtk::task::State::Incomplete,
+    "Expected a disassociated material to make FillOutAttributes incomplete.");
+  attrib->removeAttribute(material2);
+  signal->parameters()->findComponent("modified")->setNumberOfValues(0);
+  signal->parameters()->findComponent("expunged")->appendValue(material2);
+  result = signal->operate();
+  test(
+    fillOutAttributes->state() == smtk::task::State::Completable,
+    "Expected FillOutAttributes to be completable once the invalid material is removed.");
+  signal->parameters()->findComponent("expunged")->setNumberOfValues(0);
+  material2.reset();
 
   std::string configString2;
   {
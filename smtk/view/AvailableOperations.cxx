@@ -201,17 +201,16 @@ void AvailableOperations::workingSet(
   if (selectionIn)
   {
     std::map<smtk::operation::Operation::Index, int> counts;
-    const auto& selnMap = selectionIn->currentSelection();
     // Narrow the selection map down to the actual selected
     // set based on how the application wants us to use the selection:
     std::set<smtk::resource::PersistentObjectPtr> actual;
-    for (const auto& entry : selnMap)
+    for (const auto& entry : selectionIn->entries())
     {
       if (
-        (exactSelectionIn && ((entry.second & selectionMaskIn) == selectionMaskIn)) ||
-        (!exactSelectionIn && (entry.second & selectionMaskIn)))
+        (exactSelectionIn && ((entry.value & selectionMaskIn) == selectionMaskIn)) ||
+        (!exactSelectionIn && (entry.value & selectionMaskIn)))
       {
-        actual.insert(entry.first);
+        actual.insert(entry.object);
       }
     }
 
@@ -17,6 +17,7 @@
 #include "smtk/view/PhraseListContent.h"
 #include "smtk/view/SubphraseGenerator.h"
 
+#include "smtk/operation/ChangeSet.h"
 #include "smtk/operation/Manager.h"
 #include "smtk/operation/Operation.h"
 
@@ -27,7 +28,10 @@
 
 #include "smtk/io/Logger.h"
 
+#include <algorithm>
 #include <thread>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace smtk
 {
@@ -377,50 +381,28 @@ int PhraseModel::handleOperationEvent(
   }
 
   // Find out which resource components were created, modified, or expunged.
-  // Only inserting elements that are "set" so the callee, handle*(), is not
-  // passed any nulllptrs.
+  // Only objects that can be resolved are inserted so the callee, handle*(),
+  // is not passed any nullptrs.
+  auto changes = smtk::operation::ChangeSet::of(res);
+  this->handleExpunged(changes->objects(smtk::operation::ChangeSet::Kind::EXPUNGED));
+  this->handleModified(changes->objects(smtk::operation::ChangeSet::Kind::MODIFIED));
 
-  ComponentItemPtr expungedItem = res->findComponent("expunged");
-  if (expungedItem)
+  // Created objects that already have phrases are skipped before they are resolved.
+  smtk::resource::PersistentObjectSet createdObjects;
+  for (const auto& entry : changes->changes())
   {
-    smtk::resource::PersistentObjectSet expungedObjects;
-    for (auto expungedIt = expungedItem->begin(); expungedIt != expungedItem->end(); expungedIt++)
+    for (const auto& id : entry.second[smtk::operation::ChangeSet::Kind::CREATED])
     {
-      if (expungedIt.isSet())
+      if (m_objectMap.find(id) == m_objectMap.end())
       {
-        expungedObjects.insert(*expungedIt);
-      }
-    }
-    this->handleExpunged(expungedObjects);
-  }
-
-  ComponentItemPtr modifiedItem = res->findComponent("modified");
-  if (modifiedItem)
-  {
-    smtk::resource::PersistentObjectSet modifiedObjects;
-    for (auto modifiedIt = modifiedItem->begin(); modifiedIt != modifiedItem->end(); modifiedIt++)
-    {
-      if (modifiedIt.isSet())
-      {
-        modifiedObjects.insert(*modifiedIt);
-      }
-    }
-    this->handleModified(modifiedObjects);
-  }
-
-  ComponentItemPtr createdItem = res->findComponent("created");
-  if (createdItem)
-  {
-    smtk::resource::PersistentObjectSet createdObjects;
-    for (auto createdIt = createdItem->begin(); createdIt != createdItem->end(); createdIt++)
-    {
-      if (createdIt.isSet() && (m_objectMap.find((*createdIt)->id()) == m_objectMap.end()))
-      {
-        createdObjects.insert(*createdIt);
+        if (auto object = entry.second.object(id))
+        {
+          createdObjects.insert(object);
+        }
       }
     }
-    this->handleCreated(createdObjects);
   }
+  this->handleCreated(createdObjects);
 
   return 0;
 }
@@ -494,6 +476,12 @@ void PhraseModel::handleModified(const smtk::resource::PersistentObjectSet& modi
     return;
   }
 
+  // Group the phrases of modified objects by their parent so that each
+  // parent's subphrases are sorted and reconciled once, no matter how many
+  // of its children were modified.
+  std::vector<std::pair<DescriptivePhrasePtr, std::unordered_set<const DescriptivePhrase*>>>
+    modifiedByParent;
+  std::unordered_map<const DescriptivePhrase*, std::size_t> parentEntry;
   for (const auto& object : modifiedObjects)
   {
     auto it = m_objectMap.find(object->id());
@@ -508,15 +496,62 @@ void PhraseModel::handleModified(const smtk::resource::PersistentObjectSet& modi
       {
         continue; // the phrase was previously released
       }
-      std::vector<int> path;
-      dp->index(path);
-
-      this->trigger(dp, PhraseModelEvent::PHRASE_MODIFIED, path, path, std::vector<int>());
-      // Now check whether the modification requires a reorder
       auto pp = dp->parent();
-      smtk::view::DescriptivePhrases sorted(pp->subphrases().begin(), pp->subphrases().end());
+      if (!pp)
+      {
+        std::vector<int> path;
+        dp->index(path);
+        this->trigger(dp, PhraseModelEvent::PHRASE_MODIFIED, path, path, std::vector<int>());
+        continue;
+      }
+      auto entry = parentEntry.insert(std::make_pair(pp.get(), modifiedByParent.size()));
+      if (entry.second)
+      {
+        modifiedByParent.emplace_back(pp, std::unordered_set<const DescriptivePhrase*>());
+      }
+      modifiedByParent[entry.first->second].second.insert(dp.get());
+    }
+  }
+
+  for (const auto& entry : modifiedByParent)
+  {
+    // Reordering one parent's children may change the paths to the others,
+    // so paths are computed just before they are used.
+    const auto& pp = entry.first;
+    std::vector<int> pidx;
+    pp->index(pidx);
+    DescriptivePhrases& children(pp->subphrases());
+
+    // Report each run of consecutive modified siblings with a single event
+    // whose source and destination paths span the run.
+    int count = static_cast<int>(children.size());
+    for (int ii = 0; ii < count; ++ii)
+    {
+      if (entry.second.find(children[ii].get()) == entry.second.end())
+      {
+        continue;
+      }
+      int last = ii;
+      while (last + 1 < count &&
+             entry.second.find(children[last + 1].get()) != entry.second.end())
+      {
+        ++last;
+      }
+      std::vector<int> firstPath(pidx);
+      firstPath.push_back(ii);
+      std::vector<int> lastPath(pidx);
+      lastPath.push_back(last);
+      this->trigger(
+        children[ii], PhraseModelEvent::PHRASE_MODIFIED, firstPath, lastPath, std::vector<int>());
+      ii = last;
+    }
+
+    // Now check whether the modifications require a reorder
+    if (!std::is_sorted(
+          children.begin(), children.end(), DescriptivePhrase::compareByTypeThenTitle))
+    {
+      smtk::view::DescriptivePhrases sorted(children.begin(), children.end());
       std::sort(sorted.begin(), sorted.end(), DescriptivePhrase::compareByTypeThenTitle);
-      std::vector<int> pidx(path.begin(), path.begin() + path.size() - 1);
       this->updateChildren(pp, sorted, pidx);
     }
   }
@@ -256,7 +256,12 @@ protected:
 
   /// Called to deal with resources/components being removed as a result of an operation.
   virtual void handleExpunged(const smtk::resource::PersistentObjectSet& expungedObjects);
-  /// Called to deal with resources/components marked as modified by the operation.
+  /**\brief Called to deal with resources/components marked as modified by the operation.
+    *
+    * Modified phrases are grouped by parent; each parent's subphrases are
+    * re-sorted (if needed) once, and each run of modified siblings is
+    * reported with a single PHRASE_MODIFIED event.
+    */
   virtual void handleModified(const smtk::resource::PersistentObjectSet& modifiedObjects);
   /// Called to deal with resources/components being created as a result of an operation.
   virtual void handleCreated(const smtk::resource::PersistentObjectSet& createdObjects);
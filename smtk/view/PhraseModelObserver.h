@@ -32,6 +32,8 @@ enum class PhraseModelEvent
   ABOUT_TO_MOVE,   //!< A phrase or range of phrases is being moved from one place to another.
   MOVE_FINISHED,   //!< A phrase or range of phrases has been moved and the update is complete.
   PHRASE_MODIFIED  //!< The given phrase has had its text, color, or some other property modified.
+                   //!< The source and destination paths may span a run of siblings, in
+                   //!< which case the phrase passed is the first of them.
 };
 
 /// Events that alter the phrase model trigger callbacks of this type.
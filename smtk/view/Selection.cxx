@@ -12,6 +12,8 @@
 #include "smtk/attribute/ReferenceItem.h"
 #include "smtk/resource/Component.h"
 
+#include <unordered_set>
+
 namespace
 {
 constexpr const char* g_selectionManagerSource = "selection manager";
@@ -140,26 +142,14 @@ int Selection::findOrCreateLabeledValue(const std::string& label)
 
 bool Selection::resetSelectionBits(const std::string& source, int value)
 {
-  bool modified = false;
   int mask = ~value;
-  for (auto it = m_selection.begin(); it != m_selection.end(); /* fancy */)
-  {
-    auto curr = it;
-    bool shouldErase = (it->second & mask) == 0;
-    modified |= (it->second & value) != 0;
-    it->second = it->second & mask;
-
-    ++it;
-
-    if (shouldErase)
-    {
-      m_selection.erase(curr);
-    }
-  }
+  bool modified =
+    m_selection.update([mask](const SelectionStore::Entry& entry) { return entry.value & mask; });
 
   if (modified)
   {
-    this->observers()(source, shared_from_this());
+    this->invalidateSelectionMap();
+    this->notifyObservers(source);
   }
 
   return modified;
@@ -185,10 +175,24 @@ bool Selection::setDefaultAction(const SelectionAction& action)
 
 Selection::SelectionMap& Selection::currentSelection(SelectionMap& selection) const
 {
-  selection = m_selection;
+  selection = this->currentSelection();
   return selection;
 }
 
+const Selection::SelectionMap& Selection::currentSelection() const
+{
+  if (!m_selectionMapValid)
+  {
+    m_selectionMap.clear();
+    for (const auto& entry : m_selection)
+    {
+      m_selectionMap.insert(m_selectionMap.end(), std::make_pair(entry.object, entry.value));
+    }
+    m_selectionMapValid = true;
+  }
+  return m_selectionMap;
+}
+
 void Selection::setFilter(const SelectionFilter& fn, bool refilter)
 {
   if (!fn)
@@ -224,11 +228,27 @@ bool Selection::configureItem(
     return didModify;
   }
 
-  std::set<std::shared_ptr<smtk::resource::PersistentObject>> itemMembers;
-  item->as(itemMembers);
+  // Compare objects by address so that neither the item's members nor
+  // the selection's entries are copied.
+  std::unordered_set<const Object*> itemMembers;
+  item->visit([&itemMembers](const smtk::resource::PersistentObjectPtr& member) {
+    if (member)
+    {
+      itemMembers.insert(member.get());
+    }
+    return true;
+  });
 
-  std::set<std::shared_ptr<smtk::resource::PersistentObject>> selectedObjects;
-  this->currentSelectionByValue(selectedObjects, value, exactMatch);
+  std::vector<const SelectionStore::Entry*> selectedEntries;
+  std::unordered_set<const Object*> selectedObjects;
+  for (const auto& entry : m_selection)
+  {
+    if (exactMatch ? (entry.value & value) == value : (entry.value & value) != 0)
+    {
+      selectedEntries.push_back(&entry);
+      selectedObjects.insert(entry.object.get());
+    }
+  }
 
   if (itemMembers == selectedObjects)
   {
@@ -248,20 +268,15 @@ bool Selection::configureItem(
   }
   else
   {
-    // Remove itemMembers from selectedObjects so we are left
-    // with a set item objects that must be inserted.
-    for (const auto& member : itemMembers)
-    {
-      selectedObjects.erase(member);
-    }
     retainedMembers = !itemMembers.empty();
   }
-  // TODO: This should reserve storage before appending, but
-  //       we don't know how many objects will be accepted so
-  //       it is not easy.
-  for (const auto& object : selectedObjects)
+  for (const auto* entry : selectedEntries)
   {
-    didInsert |= item->appendValue(object, /* allowDuplicates */ true);
+    // Without clearItem, only objects that are not already members are inserted.
+    if (clearItem || itemMembers.find(entry->object.get()) == itemMembers.end())
+    {
+      didInsert |= item->appendValue(entry->object, /* allowDuplicates */ true);
+    }
   }
   didModify |= didInsert;
 
@@ -292,40 +307,15 @@ bool Selection::performAction(
         // Add the suggested entries if any.
         for (const auto& suggestion : suggestions)
         {
-          auto it = m_selection.find(suggestion.first);
-          if (it == m_selection.end())
+          int current = m_selection.value(suggestion.first.get());
+          if (current == 0 || suggestion.second != 0)
           {
-            if (suggestion.second != 0)
-            {
-              modified = true;
-              m_selection.insert(suggestion);
-            }
+            modified |= m_selection.set(
+              suggestion.first, bitwise ? current | suggestion.second : suggestion.second);
           }
-          else if (it->second != suggestion.second)
+          else
           {
-            modified = true;
-            if (suggestion.second == 0)
-            {
-              if (bitwise)
-              {
-                it->second = it->second & ~value;
-              }
-              else
-              {
-                m_selection.erase(it);
-              }
-            }
-            else
-            {
-              if (bitwise)
-              {
-                it->second |= suggestion.second;
-              }
-              else
-              {
-                it->second = suggestion.second;
-              }
-            }
+            modified |= m_selection.set(suggestion.first, bitwise ? current & ~value : 0);
           }
         }
         suggestions.clear();
@@ -336,84 +326,46 @@ bool Selection::performAction(
   };
 
   // Replace (which is equivalent to add inside performAction), add, or subtract:
-  auto it = m_selection.find(obj);
+  int current = m_selection.value(obj.get());
+  int mask = ~value;
   switch (action)
   {
     case SelectionAction::FILTERED_REPLACE:
     case SelectionAction::UNFILTERED_REPLACE:
     case SelectionAction::FILTERED_ADD:
     case SelectionAction::UNFILTERED_ADD:
-      if (it == m_selection.end())
-      {
-        modified = true;
-        m_selection[obj] = value;
-      }
-      else if (it->second != value)
-      {
-        modified = true;
-        it->second = (bitwise ? it->second | value : value);
-      }
+      modified |= m_selection.set(obj, bitwise ? current | value : value);
       // Now add all the suggested entries and clear.
       for (const auto& suggestion : suggestions)
       {
-        it = m_selection.find(suggestion.first);
-        if (it == m_selection.end())
+        current = m_selection.value(suggestion.first.get());
+        if (current != 0 && suggestion.second == 0 && !(bitwise && (current & mask)))
         {
-          if (suggestion.second != 0)
-          {
-            modified = true;
-            m_selection.insert(suggestion);
-          }
+          modified |= m_selection.erase(suggestion.first.get());
         }
-        else if (it->second != suggestion.second)
+        else
         {
-          modified = true;
-          if (suggestion.second == 0 && (!bitwise || (bitwise && !(it->second & ~value))))
-          {
-            m_selection.erase(it);
-          }
-          else
-          {
-            it->second = (bitwise ? it->second | suggestion.second : suggestion.second);
-          }
+          modified |= m_selection.set(
+            suggestion.first, bitwise ? current | suggestion.second : suggestion.second);
         }
       }
       suggestions.clear();
       break;
     case SelectionAction::FILTERED_SUBTRACT:
     case SelectionAction::UNFILTERED_SUBTRACT:
-      if (it != m_selection.end())
+      if (current != 0)
       {
-        modified = true;
-        int mask = ~value;
-        if (!bitwise || (bitwise && (it->second & mask) == 0))
-        {
-          m_selection.erase(it);
-        }
-        else
-        {
-          it->second &= mask;
-        }
+        modified |= m_selection.set(obj, bitwise ? current & mask : 0);
       }
       // Now deal with suggestions... should we really allow additions
       // during a subtract? Not going to for now, but I guess it is
       // possible someone might want to make a substitution.
       for (const auto& suggestion : suggestions)
       {
-        it = m_selection.find(suggestion.first);
-        if (it != m_selection.end())
+        current = m_selection.value(suggestion.first.get());
+        if (current != 0)
         {
-          int mask = ~value;
-          if (!bitwise || (bitwise && (it->second & mask) == 0))
-          {
-            modified = true;
-            m_selection.erase(it);
-          }
-          else if (bitwise)
-          {
-            modified = true;
-            it->second &= mask;
-          }
+          modified |= m_selection.set(suggestion.first, bitwise ? current & mask : 0);
         }
       }
       suggestions.clear();
@@ -427,52 +379,34 @@ bool Selection::performAction(
 bool Selection::refilter(const std::string& source)
 {
   SelectionMap suggestions;
-  bool modified = false;
-  for (auto it = m_selection.begin(); it != m_selection.end();)
-  {
-    if (!m_filter(it->first, it->second, suggestions))
-    { // Remove the current item from the selection, being careful not to invalidate the iterator:
-      auto tmp = it;
-      modified = true;
-      ++it;
-      m_selection.erase(tmp);
-    }
-    else
-    { // We still like the current item; keep it.
-      ++it;
-    }
-  }
+  bool modified = m_selection.update([this, &suggestions](const SelectionStore::Entry& entry) {
+    return m_filter(entry.object, entry.value, suggestions) ? entry.value : 0;
+  });
   // Now handle suggestions
   for (const auto& suggestion : suggestions)
   {
-    auto it = m_selection.find(suggestion.first);
-    if (it == m_selection.end())
-    {
-      if (suggestion.second != 0)
-      {
-        modified = true;
-        m_selection.insert(suggestion);
-      }
-    }
-    else if (it->second != suggestion.second)
-    {
-      modified = true;
-      if (suggestion.second == 0)
-      {
-        m_selection.erase(it);
-      }
-      else
-      {
-        it->second = suggestion.second;
-      }
-    }
+    modified |= m_selection.set(suggestion.first, suggestion.second);
   }
   suggestions.clear();
   if (modified)
   {
-    this->observers()(source, shared_from_this());
+    this->invalidateSelectionMap();
+    this->notifyObservers(source);
   }
   return modified;
 }
+
+void Selection::invalidateSelectionMap()
+{
+  m_selectionMap.clear();
+  m_selectionMapValid = false;
+}
+
+void Selection::notifyObservers(const std::string& source)
+{
+  m_changes = m_selection.takeChanges();
+  this->observers()(source, shared_from_this());
+  m_changes.clear();
+}
 } // namespace view
 } // namespace smtk
@@ -17,10 +17,12 @@
 #include "smtk/resource/Component.h"
 #include "smtk/view/SelectionAction.h"
 #include "smtk/view/SelectionObserver.h"
+#include "smtk/view/SelectionStore.h"
 
 #include <functional>
 #include <map>
 #include <set>
+#include <unordered_set>
 
 namespace smtk
 {
@@ -88,7 +90,10 @@ namespace view
   * caused the event (or "selection" if a change inside the
   * selection itself caused the event). A pointer to the selection
   * is also provided so you can query the selection
-  * inside the Observer function. You should **not** modify
+  * inside the Observer function; changes() holds the objects
+  * whose values changed since observers were last notified,
+  * so observers need not compare the entire selection against
+  * a copy of its former state. You should **not** modify
   * the selection inside a Observer as that can cause infinite
   * recursion.
   *
@@ -129,8 +134,14 @@ public:
 
   static Ptr instance();
 
-  /// This is the underlying storage type that holds selections.
+  /// A map from selected objects to their selection values.
+  ///
+  /// Selections are not stored this way (see SelectionStore) but maps are
+  /// used to pass filter suggestions and by currentSelection().
   using SelectionMap = std::map<Object::Ptr, int>;
+  /// A change to the selection value of one object.
+  using Change = SelectionStore::Change;
+  using Changes = SelectionStore::Changes;
 
   /**\brief Selection filters take functions of this form.
     *
@@ -298,12 +309,32 @@ public:
   {
     for (const auto& entry : m_selection)
     {
-      visitor(entry.first, entry.second);
+      visitor(entry.object, entry.value);
     }
   }
+  /// Return the selected objects and their values without copying them.
+  ///
+  /// Entries are in no particular order and are invalidated by any change
+  /// to the selection.
+  const SelectionStore& entries() const { return m_selection; }
+  /// Return the selection value of \a object (0 if it is not selected).
+  int selectionValue(const Object* object) const { return m_selection.value(object); }
   /// Return the current selection as a map from objects to integer selection values.
   SelectionMap& currentSelection(SelectionMap& selection) const;
-  const SelectionMap& currentSelection() const { return m_selection; }
+  /// Return the current selection as a map.
+  ///
+  /// The map is built from entries() when it is first requested after the
+  /// selection changes; prefer entries() or visitSelection() for iteration
+  /// and selectionValue() for lookups.
+  const SelectionMap& currentSelection() const;
+  /**\brief Return the changes being reported to observers.
+    *
+    * This is only meaningful inside an Observer; it holds every change made
+    * since observers were last notified (including changes made with
+    * notification postponed). It is empty when an observer is called upon
+    * registration.
+    */
+  const Changes& changes() const { return m_changes; }
   /// Return the subset of selected elements that match the given selection value.
   template<typename T>
   T& currentSelectionByValue(T& selection, int value, bool exactMatch = true) const;
@@ -383,13 +414,20 @@ protected:
     SelectionMap& suggested,
     bool bitwise);
   bool refilter(const std::string& source);
+  /// Mark the cached selection map stale and release the objects it holds.
+  void invalidateSelectionMap();
+  /// Report the changes recorded by the store to observers.
+  void notifyObservers(const std::string& source);
 
   SelectionAction m_defaultAction{ SelectionAction::FILTERED_REPLACE };
   //smtk::model::BitFlags m_modelEntityMask;
   bool m_meshSetMask;
   std::set<std::string> m_selectionSources;
   std::map<std::string, int> m_selectionValueLabels;
-  SelectionMap m_selection;
+  SelectionStore m_selection;
+  mutable SelectionMap m_selectionMap;
+  mutable bool m_selectionMapValid{ true };
+  Changes m_changes;
   Observers m_observers;
   SelectionFilter m_filter;
 };
@@ -401,9 +439,9 @@ T& Selection::currentSelectionByValue(T& selection, int value, bool exactMatch)
   {
     for (const auto& entry : m_selection)
     {
-      if ((entry.second & value) == value)
+      if ((entry.value & value) == value)
       {
-        auto entryT = std::dynamic_pointer_cast<typename T::value_type::element_type>(entry.first);
+        auto entryT = std::dynamic_pointer_cast<typename T::value_type::element_type>(entry.object);
         if (entryT)
         {
           selection.insert(selection.end(), entryT);
@@ -415,9 +453,9 @@ T& Selection::currentSelectionByValue(T& selection, int value, bool exactMatch)
   {
     for (const auto& entry : m_selection)
     {
-      if (entry.second & value)
+      if (entry.value & value)
       {
-        auto entryT = std::dynamic_pointer_cast<typename T::value_type::element_type>(entry.first);
+        auto entryT = std::dynamic_pointer_cast<typename T::value_type::element_type>(entry.object);
         if (entryT)
         {
           selection.insert(selection.end(), entryT);
@@ -455,52 +493,41 @@ bool Selection::modifySelection(
     !bitwise &&
     (action == SelectionAction::FILTERED_REPLACE || action == SelectionAction::UNFILTERED_REPLACE))
   {
-    modified = !m_selection.empty();
-    m_selection.clear();
+    modified = m_selection.clear();
   }
   else if (
     bitwise &&
     (action == SelectionAction::FILTERED_REPLACE || action == SelectionAction::UNFILTERED_REPLACE))
   {
-    // Remove unmatched objects from existing selection
-    int mask = ~value;
-    smtk::resource::PersistentObjectSet willErase;
-    for (auto& entry : m_selection)
+    // Remove value's bits from objects not being selected, erasing those
+    // left with no bits set (or every object when value is 0).
+    std::unordered_set<const Object*> replacements;
+    replacements.reserve(objects.size());
+    for (const auto& object : objects)
     {
-      auto it = std::find(objects.begin(), objects.end(), entry.first);
-      // std::cout << "  " << entry.first->id() << "  " << (it == objects.end() ? "not in obj" : "in obj") << " " << entry.second << " " << (entry.second & mask);
-      if ((it == objects.end() && ((entry.second & mask) == 0)) || value == 0)
-      {
-        willErase.insert(entry.first);
-        // std::cout << "    erase obj\n";
-      }
-      else if (it == objects.end() && ((entry.second & mask) != 0))
-      {
-        entry.second &= mask;
-        modified = true;
-      }
-      else
-      {
-        // std::cout << "    keep  obj\n";
-      }
+      replacements.insert(object.get());
     }
-    // std::cout << "---\n";
-    if (!willErase.empty())
-    {
-      modified = true;
-      for (const auto& key : willErase)
+    int mask = ~value;
+    modified = m_selection.update([&](const SelectionStore::Entry& entry) {
+      if (value == 0)
       {
-        m_selection.erase(key);
+        return 0;
       }
-    }
+      return replacements.find(entry.object.get()) == replacements.end() ? entry.value & mask
+                                                                          : entry.value;
+    });
   }
   for (const auto& object : objects)
   {
     modified |= this->performAction(object, value, action, suggestions, bitwise);
   }
-  if (modified && !postponeNotification)
+  if (modified)
   {
-    this->observers()(source, shared_from_this());
+    this->invalidateSelectionMap();
+    if (!postponeNotification)
+    {
+      this->notifyObservers(source);
+    }
   }
   return modified;
 }
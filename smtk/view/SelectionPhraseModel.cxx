@@ -93,14 +93,14 @@ void SelectionPhraseModel::populateRoot(const std::string& src, Selection::Ptr s
   DescriptivePhrases children;
   smtk::resource::Component::Ptr comp;
   smtk::resource::Resource::Ptr rsrc;
-  for (const auto& entry : seln->currentSelection())
+  for (const auto& entry : seln->entries())
   {
-    if ((entry.second & m_selectionBit) == 0)
+    if ((entry.value & m_selectionBit) == 0)
     { // Not part of the selection we're interested in.
       continue;
     }
 
-    auto obj = entry.first;
+    const auto& obj = entry.object;
     if ((comp = std::dynamic_pointer_cast<smtk::resource::Component>(obj)))
     {
       children.push_back(
@@ -0,0 +1,151 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/view/SelectionStore.h"
+
+#include "smtk/resource/PersistentObject.h"
+
+#include <map>
+
+namespace smtk
+{
+namespace view
+{
+
+void SelectionStore::reserve(std::size_t size)
+{
+  m_entries.reserve(size);
+  m_positions.reserve(size);
+}
+
+int SelectionStore::value(const Object* object) const
+{
+  auto it = m_positions.find(object);
+  return it == m_positions.end() ? 0 : m_entries[it->second].value;
+}
+
+bool SelectionStore::set(const std::shared_ptr<Object>& object, int value)
+{
+  if (!object)
+  {
+    return false;
+  }
+  auto it = m_positions.find(object.get());
+  if (it == m_positions.end())
+  {
+    if (value == 0)
+    {
+      return false;
+    }
+    m_positions[object.get()] = m_entries.size();
+    m_entries.push_back(Entry{ object, value });
+    this->record(object, 0, value);
+    return true;
+  }
+  Entry& entry = m_entries[it->second];
+  if (entry.value == value)
+  {
+    return false;
+  }
+  this->record(object, entry.value, value);
+  if (value == 0)
+  {
+    this->eraseAt(it->second);
+  }
+  else
+  {
+    entry.value = value;
+  }
+  return true;
+}
+
+bool SelectionStore::erase(const Object* object)
+{
+  auto it = m_positions.find(object);
+  if (it == m_positions.end())
+  {
+    return false;
+  }
+  std::size_t position = it->second;
+  this->record(m_entries[position].object, m_entries[position].value, 0);
+  this->eraseAt(position);
+  return true;
+}
+
+bool SelectionStore::clear()
+{
+  if (m_entries.empty())
+  {
+    return false;
+  }
+  for (const auto& entry : m_entries)
+  {
+    this->record(entry.object, entry.value, 0);
+  }
+  m_entries.clear();
+  m_positions.clear();
+  return true;
+}
+
+SelectionStore::Changes SelectionStore::takeChanges()
+{
+  Changes result;
+  if (m_changes.empty())
+  {
+    return result;
+  }
+  // Objects are matched by ownership rather than address since a removed
+  // object may have been destroyed and its address reused.
+  std::map<std::weak_ptr<Object>, std::size_t, std::owner_less<std::weak_ptr<Object>>> merged;
+  result.reserve(m_changes.size());
+  for (auto& change : m_changes)
+  {
+    auto inserted = merged.insert(std::make_pair(change.object, result.size()));
+    if (inserted.second)
+    {
+      result.push_back(std::move(change));
+    }
+    else
+    {
+      result[inserted.first->second].current = change.current;
+    }
+  }
+  m_changes.clear();
+
+  std::size_t kept = 0;
+  for (auto& change : result)
+  {
+    if (change.previous != change.current)
+    {
+      result[kept++] = std::move(change);
+    }
+  }
+  result.resize(kept);
+  return result;
+}
+
+void SelectionStore::record(const std::shared_ptr<Object>& object, int previous, int current)
+{
+  m_changes.push_back(Change{ object, previous, current });
+}
+
+void SelectionStore::eraseAt(std::size_t position)
+{
+  m_positions.erase(m_entries[position].object.get());
+  std::size_t last = m_entries.size() - 1;
+  if (position != last)
+  {
+    m_entries[position] = std::move(m_entries[last]);
+    m_positions[m_entries[position].object.get()] = position;
+  }
+  m_entries.pop_back();
+}
+
+} // namespace view
+} // namespace smtk
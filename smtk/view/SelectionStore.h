@@ -0,0 +1,145 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_view_SelectionStore_h
+#define smtk_view_SelectionStore_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/PublicPointerDefs.h"
+#include "smtk/SystemConfig.h" // quiet dll-interface warnings on windows
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace smtk
+{
+namespace view
+{
+
+/**\brief Storage for the objects held by a Selection and their selection values.
+  *
+  * Entries are held contiguously (in no particular order) and located by
+  * the address of their object, so membership tests, insertions, and
+  * removals take constant time and iteration does not chase tree nodes.
+  * Objects whose value becomes 0 are removed.
+  *
+  * Every change to an entry's value is recorded until takeChanges() is
+  * called so that observers can be told what changed rather than being
+  * handed the entire selection.
+  */
+class SMTKCORE_EXPORT SelectionStore
+{
+public:
+  using Object = smtk::resource::PersistentObject;
+
+  /// An object and its (non-zero) selection value.
+  struct Entry
+  {
+    std::shared_ptr<Object> object;
+    int value;
+  };
+
+  /// A change to the selection value of an object.
+  ///
+  /// Objects were added when \a previous is 0 and removed when \a current is 0.
+  /// Removed objects may have been destroyed by the time the change is reported,
+  /// so only a weak reference is held.
+  struct Change
+  {
+    std::weak_ptr<Object> object;
+    int previous;
+    int current;
+  };
+
+  using Entries = std::vector<Entry>;
+  using Changes = std::vector<Change>;
+  using const_iterator = Entries::const_iterator;
+
+  const_iterator begin() const { return m_entries.begin(); }
+  const_iterator end() const { return m_entries.end(); }
+  std::size_t size() const { return m_entries.size(); }
+  bool empty() const { return m_entries.empty(); }
+  void reserve(std::size_t size);
+
+  /// Return the selection value of \a object (0 if it is not selected).
+  int value(const Object* object) const;
+  bool contains(const Object* object) const { return this->value(object) != 0; }
+
+  /// Set the selection value of \a object, removing it when \a value is 0.
+  ///
+  /// Returns true if the value changed.
+  bool set(const std::shared_ptr<Object>& object, int value);
+  /// Remove \a object, returning true if it was present.
+  bool erase(const Object* object);
+  /// Remove every entry, returning true if any were present.
+  bool clear();
+
+  /**\brief Replace the value of every entry with the result of \a fn.
+    *
+    * The functor is passed each entry (as a const reference) and returns its
+    * new value; entries whose new value is 0 are removed.
+    * Returns true if any value changed.
+    */
+  template<typename Functor>
+  bool update(Functor fn);
+
+  /// Return the number of changes recorded since takeChanges() was last called.
+  std::size_t numberOfPendingChanges() const { return m_changes.size(); }
+
+  /**\brief Return the changes recorded since the last call and forget them.
+    *
+    * Repeated changes to one object are merged into a single change from its
+    * first previous value to its final current value; objects whose values
+    * end where they started are omitted.
+    */
+  Changes takeChanges();
+
+private:
+  void record(const std::shared_ptr<Object>& object, int previous, int current);
+  void eraseAt(std::size_t position);
+
+  Entries m_entries;
+  std::unordered_map<const Object*, std::size_t> m_positions;
+  Changes m_changes;
+};
+
+template<typename Functor>
+bool SelectionStore::update(Functor fn)
+{
+  bool modified = false;
+  for (std::size_t ii = 0; ii < m_entries.size();)
+  {
+    int value = fn(static_cast<const Entry&>(m_entries[ii]));
+    Entry& entry = m_entries[ii];
+    if (value == entry.value)
+    {
+      ++ii;
+      continue;
+    }
+    modified = true;
+    this->record(entry.object, entry.value, value);
+    if (value == 0)
+    {
+      // The last entry is moved to position ii; visit it next.
+      this->eraseAt(ii);
+    }
+    else
+    {
+      entry.value = value;
+      ++ii;
+    }
+  }
+  return modified;
+}
+
+} // namespace view
+} // namespace smtk
+
+#endif // smtk_view_SelectionStore_h
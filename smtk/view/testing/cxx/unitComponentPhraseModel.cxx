@@ -37,6 +37,7 @@
 
 #include "smtk/AutoInit.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <map>
@@ -319,6 +320,67 @@ int unitComponentPhraseModel(int argc, char* argv[])
         phraseModel->root()->subphrases()[6]->title() == "epic",
         "Did not sort phrases alphabetically.");
     }
+    {
+      // Rename several faces in one operation. Each run of adjacent
+      // modified phrases should be reported by a single event.
+      std::size_t numModifiedEvents = 0;
+      auto key = phraseModel->observers().insert(
+        [&numModifiedEvents](
+          DescriptivePhrasePtr /*unused*/,
+          PhraseModelEvent event,
+          const std::vector<int>& first,
+          const std::vector<int>& last,
+          const std::vector<int>& /*unused*/) {
+          if (event == PhraseModelEvent::PHRASE_MODIFIED)
+          {
+            ++numModifiedEvents;
+            smtkTest(
+              first.size() == last.size() && first.back() <= last.back(),
+              "Modified range is not a run of siblings.");
+          }
+        });
+      auto op = operMgr->create<smtk::operation::SetProperty>();
+      auto pm = op->parameters();
+      pm->findString("name")->setValue("name");
+      pm->findString("string value")->appendValue("mmm");
+      // Pick a run of adjacent face phrases so the expected grouping is deterministic.
+      std::size_t numRenamed = 0;
+      for (const auto& phrase : phraseModel->root()->subphrases())
+      {
+        auto ent = std::dynamic_pointer_cast<smtk::model::Entity>(phrase->relatedComponent());
+        if (ent && ent->isFace())
+        {
+          pm->associate(ent);
+          if (++numRenamed == 4)
+          {
+            break;
+          }
+        }
+        else if (numRenamed > 0)
+        {
+          break;
+        }
+      }
+      auto res = op->operate();
+      bool ok =
+        (res->findInt("outcome")->value(0) ==
+         static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED));
+      std::cout << "set property success " << (ok ? "T" : "F") << "\n";
+      std::cout << "---\n";
+      phraseModel->root()->visitChildren(printer);
+      phraseModel->observers().erase(key);
+      smtkTest(ok, "Could not rename several faces.");
+      smtkTest(numRenamed >= 3, "Expected a run of at least 3 adjacent faces to rename.");
+      const auto& renamed = phraseModel->root()->subphrases();
+      smtkTest(
+        std::is_sorted(renamed.begin(), renamed.end(), DescriptivePhrase::compareByTypeThenTitle),
+        "Phrases are out of order after renaming several faces.");
+      // Each parent (the root and, if expanded, the group holding the faces) reports
+      // its run of renamed siblings once, so there must be fewer events than renames.
+      smtkTest(numModifiedEvents > 0, "Renamed phrases were not reported.");
+      smtkTest(
+        numModifiedEvents < numRenamed, "Renamed sibling phrases were not reported as a group.");
+    }
 
     // Don't leak
     free(dataArgs[1]);
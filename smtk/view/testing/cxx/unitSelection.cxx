@@ -0,0 +1,200 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/view/Selection.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/Resource.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <map>
+#include <set>
+#include <vector>
+
+using smtk::view::Selection;
+using smtk::view::SelectionAction;
+
+namespace
+{
+// The selection's map view must agree with its entries.
+void checkConsistent(const Selection::Ptr& selection, const std::string& when)
+{
+  const auto& map = selection->currentSelection();
+  smtkTest(
+    map.size() == selection->entries().size(),
+    "Map has " << map.size() << " entries, store " << selection->entries().size() << " " << when
+               << ".");
+  for (const auto& entry : selection->entries())
+  {
+    auto it = map.find(entry.object);
+    smtkTest(
+      it != map.end() && it->second == entry.value && entry.value != 0,
+      "Map disagrees with store " << when << ".");
+    smtkTest(
+      selection->selectionValue(entry.object.get()) == entry.value,
+      "Lookup disagrees with store " << when << ".");
+  }
+}
+
+// Record the changes reported to observers.
+struct Recorder
+{
+  std::map<const smtk::resource::PersistentObject*, std::pair<int, int>> changes;
+  int calls = 0;
+
+  void operator()(const std::string&, const Selection::Ptr& selection)
+  {
+    ++this->calls;
+    for (const auto& change : selection->changes())
+    {
+      auto object = change.object.lock();
+      this->changes[object.get()] = std::make_pair(change.previous, change.current);
+    }
+  }
+
+  void reset()
+  {
+    this->changes.clear();
+    this->calls = 0;
+  }
+};
+} // namespace
+
+int unitSelection(int /*unused*/, char* /*unused*/[])
+{
+  auto resource = smtk::attribute::Resource::create();
+  auto definition = resource->createDefinition("thing");
+  std::vector<smtk::attribute::AttributePtr> things;
+  for (int ii = 0; ii < 8; ++ii)
+  {
+    things.push_back(resource->createAttribute(definition));
+  }
+
+  auto selection = Selection::create();
+  selection->registerSelectionSource("test");
+  Recorder recorder;
+  auto key = selection->observers().insert(
+    [&recorder](const std::string& source, Selection::Ptr seln) { recorder(source, seln); },
+    0,
+    /* initialize */ false,
+    "record selection changes");
+
+  // Replace the selection.
+  std::set<smtk::attribute::AttributePtr> first{ things[0], things[1], things[2] };
+  smtkTest(
+    selection->modifySelection(first, "test", 1, SelectionAction::UNFILTERED_REPLACE),
+    "Selection was not modified.");
+  checkConsistent(selection, "after replacement");
+  smtkTest(recorder.calls == 1 && recorder.changes.size() == 3, "Expected three additions.");
+  for (const auto& thing : first)
+  {
+    smtkTest(
+      recorder.changes[thing.get()] == std::make_pair(0, 1), "Addition of " << thing->name());
+  }
+  smtkTest(selection->changes().empty(), "Changes should only be held during notification.");
+
+  // Replacing with an overlapping set reports only the difference.
+  recorder.reset();
+  std::set<smtk::attribute::AttributePtr> second{ things[1], things[2], things[3] };
+  selection->modifySelection(second, "test", 1, SelectionAction::UNFILTERED_REPLACE);
+  checkConsistent(selection, "after overlapping replacement");
+  smtkTest(recorder.changes.size() == 2, "Expected two changes, got " << recorder.changes.size());
+  smtkTest(recorder.changes[things[0].get()] == std::make_pair(1, 0), "Expected removal.");
+  smtkTest(recorder.changes[things[3].get()] == std::make_pair(0, 1), "Expected addition.");
+
+  // Repeating a modification has no effect.
+  recorder.reset();
+  smtkTest(
+    !selection->modifySelection(second, "test", 1, SelectionAction::UNFILTERED_ADD),
+    "Adding selected objects should not modify the selection.");
+  smtkTest(recorder.calls == 0, "Observers called without a change.");
+
+  // Bitwise addition and replacement.
+  std::set<smtk::attribute::AttributePtr> hover{ things[3], things[4] };
+  selection->modifySelection(hover, "test", 2, SelectionAction::UNFILTERED_ADD, true);
+  checkConsistent(selection, "after bitwise addition");
+  smtkTest(selection->selectionValue(things[3].get()) == 3, "Expected bits to be combined.");
+  smtkTest(selection->selectionValue(things[4].get()) == 2, "Expected a new entry.");
+  recorder.reset();
+  std::set<smtk::attribute::AttributePtr> moved{ things[5] };
+  selection->modifySelection(moved, "test", 2, SelectionAction::UNFILTERED_REPLACE, true);
+  checkConsistent(selection, "after bitwise replacement");
+  smtkTest(selection->selectionValue(things[3].get()) == 1, "Expected bit 2 to be removed.");
+  smtkTest(selection->selectionValue(things[4].get()) == 0, "Expected entry to be removed.");
+  smtkTest(selection->selectionValue(things[5].get()) == 2, "Expected entry to be added.");
+  smtkTest(
+    recorder.calls == 1 && recorder.changes.size() == 3,
+    "Expected three changes, got " << recorder.changes.size());
+
+  // Postponed changes are reported with the next notification.
+  recorder.reset();
+  std::set<smtk::attribute::AttributePtr> postponed{ things[6] };
+  selection->modifySelection(
+    postponed, "test", 1, SelectionAction::UNFILTERED_ADD, false, /*postpone*/ true);
+  smtkTest(recorder.calls == 0, "Notification should have been postponed.");
+  checkConsistent(selection, "after postponed addition");
+  selection->resetSelectionBits("test", 2);
+  checkConsistent(selection, "after resetting bits");
+  smtkTest(recorder.calls == 1, "Expected a notification.");
+  smtkTest(
+    recorder.changes.size() == 2 && recorder.changes[things[6].get()] == std::make_pair(0, 1) &&
+      recorder.changes[things[5].get()] == std::make_pair(2, 0),
+    "Expected postponed and current changes to be reported together.");
+
+  // Subtraction.
+  recorder.reset();
+  std::set<smtk::attribute::AttributePtr> subtracted{ things[1], things[7] };
+  selection->modifySelection(subtracted, "test", 1, SelectionAction::UNFILTERED_SUBTRACT);
+  checkConsistent(selection, "after subtraction");
+  smtkTest(selection->selectionValue(things[1].get()) == 0, "Expected removal.");
+  smtkTest(
+    recorder.changes.size() == 1 && recorder.changes[things[1].get()] == std::make_pair(1, 0),
+    "Expected a single removal.");
+
+  // Filters may reject objects and suggest others.
+  recorder.reset();
+  auto rejected = things[2];
+  auto suggested = things[7];
+  selection->setFilter([&rejected, &suggested](
+                         smtk::resource::PersistentObjectPtr object,
+                         int value,
+                         Selection::SelectionMap& suggestions) {
+    if (object == rejected)
+    {
+      suggestions[suggested] = value;
+      return false;
+    }
+    return true;
+  });
+  checkConsistent(selection, "after filtering");
+  smtkTest(selection->selectionValue(rejected.get()) == 0, "Filter did not reject object.");
+  smtkTest(selection->selectionValue(suggested.get()) == 1, "Filter suggestion not selected.");
+  smtkTest(recorder.changes.size() == 2, "Expected a removal and an addition.");
+
+  // Retrieve the selection by value.
+  auto selected = selection->currentSelectionByValueAs<std::set<smtk::attribute::AttributePtr>>(1);
+  std::set<smtk::attribute::AttributePtr> expected{ things[3], things[6], things[7] };
+  smtkTest(selected == expected, "Unexpected selection by value.");
+  selected.clear();
+  expected.clear();
+  postponed.clear();
+
+  // Objects removed from the selection are not kept alive by it.
+  recorder.reset();
+  std::weak_ptr<smtk::attribute::Attribute> weak = things[6];
+  std::set<smtk::attribute::AttributePtr> gone{ things[6] };
+  selection->modifySelection(gone, "test", 1, SelectionAction::UNFILTERED_SUBTRACT);
+  gone.clear();
+  resource->removeAttribute(things[6]);
+  things[6].reset();
+  smtkTest(weak.expired(), "Selection holds a removed object.");
+  return 0;
+}